@@ -0,0 +1,191 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+
+#include <system.h>
+
+#include <Muhelp/BinaryStream.hh>
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+using std::string;
+
+BinaryWriter::BinaryWriter() : mFile(0), mFailed(true), mChecksum(0), mLength(0) {
+}
+
+BinaryWriter::~BinaryWriter() {
+	if(mFile) {
+		fclose(mFile);
+		unlink((mFn + ".tmp").c_str());
+	}
+}
+
+bool BinaryWriter::open(const string& fn) {
+	mFn = fn;
+	mFile = fopen((fn + ".tmp").c_str(), "wb");
+	mFailed = ! mFile;
+	mChecksum = crc32(0, Z_NULL, 0);
+	mLength = 0;
+	return mFile != 0;
+}
+
+void BinaryWriter::flush() {
+	if(mLength == 0)
+		return;
+	mChecksum = crc32(mChecksum, mBuffer, mLength);
+	if(mFile && fwrite(mBuffer, 1, mLength, mFile) != mLength)
+		mFailed = true;
+	mLength = 0;
+}
+
+void BinaryWriter::write(const void* data, size_t length) {
+	flush();
+	if(length < sizeof(mBuffer)) {
+		memcpy(mBuffer, data, length);
+		mLength = length;
+		return;
+	}
+	mChecksum = crc32(mChecksum, (const Bytef*)data, length);
+	if(mFile && fwrite(data, 1, length, mFile) != length)
+		mFailed = true;
+}
+
+uint32 BinaryWriter::checksum() {
+	flush();
+	return mChecksum;
+}
+
+bool BinaryWriter::close() {
+	if(! mFile)
+		return false;
+	flush();
+	if(fclose(mFile) != 0)
+		mFailed = true;
+	mFile = 0;
+
+	string tmp = mFn + ".tmp";
+	if(mFailed || rename(tmp.c_str(), mFn.c_str()) != 0) {
+		unlink(tmp.c_str());
+		return false;
+	}
+	return true;
+}
+
+BinaryReader::BinaryReader() : mFile(0), mFailed(true), mLeft(0), mChecksum(0) {
+	mPos = mEnd = mChecked = mBuffer;
+}
+
+BinaryReader::~BinaryReader() {
+	if(mFile)
+		fclose(mFile);
+}
+
+bool BinaryReader::open(const string& fn) {
+	if(mFile)
+		fclose(mFile);
+	mFile = fopen(fn.c_str(), "rb");
+	struct stat st;
+	if(mFile && fstat(fileno(mFile), &st) != 0) {
+		fclose(mFile);
+		mFile = 0;
+	}
+	mFailed = ! mFile;
+	mLeft = mFile ? st.st_size : 0;
+	mChecksum = crc32(0, Z_NULL, 0);
+	mPos = mEnd = mChecked = mBuffer;
+	return mFile != 0;
+}
+
+/* Keep what's left in the buffer and read more after it. */
+bool BinaryReader::fill() {
+	checksum();
+	size_t kept = mEnd - mPos;
+	memmove(mBuffer, mPos, kept);
+	mPos = mChecked = mBuffer;
+	mEnd = mBuffer + kept;
+
+	size_t wanted = sizeof(mBuffer) - kept;
+	if(wanted > mLeft)
+		wanted = mLeft;
+	if(wanted == 0 || ! mFile)
+		return false;
+	size_t got = fread(mBuffer + kept, 1, wanted, mFile);
+	mEnd += got;
+	mLeft -= wanted;
+	if(got != wanted) {
+		mFailed = true;
+		mLeft = 0;
+	}
+	return got > 0;
+}
+
+bool BinaryReader::read(void* data, size_t length) {
+	unsigned char* out = (unsigned char*)data;
+	while(length > 0) {
+		if(mPos == mEnd && ! fill()) {
+			mFailed = true;
+			memset(out, 0, length);
+			return false;
+		}
+		size_t n = mEnd - mPos;
+		if(n > length)
+			n = length;
+		memcpy(out, mPos, n);
+		mPos += n;
+		out += n;
+		length -= n;
+	}
+	return true;
+}
+
+string BinaryReader::getString() {
+	uint32 length = getInt();
+	/* Don't believe a length the file can't hold */
+	if(length > (uint64)(mEnd - mPos) + mLeft) {
+		mFailed = true;
+		mPos = mEnd;
+		mLeft = 0;
+		return string();
+	}
+	string s(length, '\0');
+	if(length > 0 && ! get(&s[0], length))
+		return string();
+	return s;
+}
+
+bool BinaryReader::peekInt(uint32& i) {
+	if(mEnd - mPos < 4)
+		fill();
+	if(mEnd - mPos < 4)
+		return false;
+	i = mPos[0] | (mPos[1] << 8) | (mPos[2] << 16) | ((uint32)mPos[3] << 24);
+	return true;
+}
+
+uint32 BinaryReader::checksum() {
+	mChecksum = crc32(mChecksum, mChecked, mPos - mChecked);
+	mChecked = mPos;
+	return mChecksum;
+}
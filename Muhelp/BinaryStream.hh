@@ -0,0 +1,129 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __BINARYSTREAM_HH__
+#define __BINARYSTREAM_HH__
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include <museekd/mutypes.h>
+
+/* Buffered writing and reading of the binary files of Museek: integers in
+ * little endian, strings prefixed with their length. Both keep the CRC-32
+ * of what went through them, so a file can end with it. */
+
+class BinaryWriter {
+public:
+	BinaryWriter();
+	~BinaryWriter();
+
+	/* Writes go to fn.tmp, which close() renames to fn once all went
+	 * well: whoever reads fn meanwhile sees the previous version. */
+	bool open(const std::string& fn);
+	bool close();
+
+	inline void put(uint32 i) {
+		unsigned char b[4] = { (unsigned char)i, (unsigned char)(i >> 8), (unsigned char)(i >> 16), (unsigned char)(i >> 24) };
+		put(b, 4);
+	}
+	inline void put(uint64 i) {
+		put((uint32)i);
+		put((uint32)(i >> 32));
+	}
+	inline void put(const std::string& s) {
+		put((uint32)s.size());
+		put(s.data(), s.size());
+	}
+	inline void put(const void* data, size_t length) {
+		if(length <= sizeof(mBuffer) - mLength) {
+			memcpy(mBuffer + mLength, data, length);
+			mLength += length;
+		}
+		else
+			write(data, length);
+	}
+
+	/* Of everything put so far. */
+	uint32 checksum();
+
+private:
+	void write(const void* data, size_t length);
+	void flush();
+
+	FILE* mFile;
+	std::string mFn;
+	bool mFailed;
+	uint32 mChecksum;
+	size_t mLength;
+	unsigned char mBuffer[65536];
+};
+
+class BinaryReader {
+public:
+	BinaryReader();
+	~BinaryReader();
+
+	bool open(const std::string& fn);
+
+	/* Past the end of the file, or on a read error, the values read are
+	 * zeroes and empty strings, and good() turns false. */
+	inline bool good() const { return ! mFailed; }
+	inline bool eof() const { return mPos == mEnd && mLeft == 0; }
+
+	inline uint32 getInt() {
+		unsigned char b[4];
+		if(! get(b, 4))
+			return 0;
+		return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32)b[3] << 24);
+	}
+	inline uint64 getOff() {
+		uint64 i = getInt();
+		return i | ((uint64)getInt() << 32);
+	}
+	std::string getString();
+	inline bool get(void* data, size_t length) {
+		if(length <= (size_t)(mEnd - mPos)) {
+			memcpy(data, mPos, length);
+			mPos += length;
+			return true;
+		}
+		return read(data, length);
+	}
+	/* The next integer, left to be read. */
+	bool peekInt(uint32& i);
+
+	/* Of everything read so far. */
+	uint32 checksum();
+
+private:
+	bool read(void* data, size_t length);
+	bool fill();
+
+	FILE* mFile;
+	bool mFailed;
+	uint64 mLeft; // In the file, past the buffer
+	uint32 mChecksum;
+	const unsigned char *mPos, *mEnd, *mChecked;
+	unsigned char mBuffer[65536];
+};
+
+#endif // __BINARYSTREAM_HH__
@@ -22,6 +22,7 @@
 
 #include <Muhelp/Codec.hh>
 
+#include <errno.h>
 #include <iconv.h>
 #include <string>
 #include <iostream>
@@ -78,6 +79,36 @@ string Codec::convert(const string& text) {
 	return ret;
 }
 
+string Codec::convertLossy(const string& text) {
+	if(text.empty() || mCD == (iconv_t)-1)
+		return string();
+
+	/* Start from the initial state, a previous text may have left it
+	 * anywhere */
+	iconv(mCD, 0, 0, 0, 0);
+
+	string ret;
+	char out_buf[1024];
+	const char* pinbuf = text.data();
+	size_t in_left = text.size();
+	while(in_left > 0) {
+		char* pout_buf = out_buf;
+		size_t out_left = sizeof(out_buf);
+		size_t r = iconv(mCD, (ICONV_IN)(&pinbuf), &in_left, &pout_buf, &out_left);
+		ret.append(out_buf, sizeof(out_buf) - out_left);
+		if(r != (size_t)-1 || errno == E2BIG)
+			continue;
+		/* Skip the byte that can't be converted, or the end of a
+		 * truncated character */
+		ret.append("\xef\xbf\xbd");
+		if(errno != EILSEQ)
+			break;
+		++pinbuf;
+		--in_left;
+	}
+	return ret;
+}
+
 string Codec::convert(const string& text, const string& from, const string& to) {
 	if(text.empty())
 		return string();
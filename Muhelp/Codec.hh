@@ -32,6 +32,9 @@ public:
 	inline bool valid() const { return mCD != (iconv_t)-1; }
 	
 	std::string convert(const std::string& text);
+	/* Like convert, but what can't be converted becomes U+FFFD instead
+	 * of failing the whole text, the way museekd converts names. */
+	std::string convertLossy(const std::string& text);
 	std::wstring wide(const std::string& text);
 	std::string narrow(const std::wstring& to);
 	
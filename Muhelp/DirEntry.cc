@@ -25,14 +25,22 @@
 #include <system.h>
 
 #include <Muhelp/DirEntry.hh>
-#include <Muhelp/string_ext.hh>
+#include <Muhelp/BinaryStream.hh>
 
 #include <NewNet/nnlog.h>
-#include <NewNet/nnpath.h>
+
+#include <sys/stat.h>
 
 using std::string;
 using std::map;
-using std::queue;
+
+/* "MSDB", starts the databases since they have a version and a
+ * checksum. */
+#define DB_MAGIC 0x4244534d
+#define DB_VERSION 1
+/* "MSDL", starts the delta files. */
+#define DELTA_MAGIC 0x4c44534d
+#define DELTA_VERSION 3
 
 DirEntry::~DirEntry() {
 	map<string, DirEntry*>::iterator it = folders.begin();
@@ -40,6 +48,13 @@ DirEntry::~DirEntry() {
 		delete (*it).second;
 }
 
+void DirEntry::clear() {
+	for(map<string, DirEntry*>::iterator it = folders.begin(); it != folders.end(); ++it)
+		delete (*it).second;
+	folders.clear();
+	files.clear();
+}
+
 DirEntry* DirEntry::new_folder(const string& path) {
 	return new DirEntry(path);
 }
@@ -69,216 +84,243 @@ void DirEntry::fold(DirEntry* folded) {
 		(*dit).second->fold(folded);
 }
 
-static inline void _pack(queue<unsigned char>& data, uint32 i) {
-    for(uint j = 0; j < 4; j++) {
-        data.push(i & 0xff);
-        i >>= 8;
-    }
-}
+void DirEntry::write(BinaryWriter& writer) const {
+	writer.put(path);
+	writer.put((uint32)mtime);
 
-static inline void _pack(queue<unsigned char>& data, uint64 i) {
-    for(uint j = 0; j < 8; j++) {
-        data.push(i & 0xff);
-        i >>= 8;
-    }
-}
+	writer.put((uint32)folders.size());
+	map<string, DirEntry*>::const_iterator dit = folders.begin();
+	for(; dit != folders.end(); ++dit)
+		(*dit).second->write(writer);
 
-static inline void _pack(queue<unsigned char>& data, string s) {
-    _pack(data, (uint32) s.size());
-    string::const_iterator it = s.begin();
-    for(; it != s.end(); ++it)
-        data.push(*it);
+	writer.put((uint32)files.size());
+	Folder::const_iterator fit = files.begin();
+	for(; fit != files.end(); ++fit) {
+		writer.put((*fit).first);
+		writer.put((*fit).second.size);
+		writer.put((*fit).second.ext);
+		writer.put((uint32)(*fit).second.attrs.size());
+		std::vector<uint32>::const_iterator ait = (*fit).second.attrs.begin();
+		for(; ait != (*fit).second.attrs.end(); ++ait)
+			writer.put(*ait);
+	}
 }
 
-static inline void _pack_path(queue<unsigned char>& data, string s) {
-    _pack(data, (uint32) s.size());
-    string::const_iterator it = s.begin();
-    for(; it != s.end(); ++it)
-        if((*it) == '/')
-            data.push('\\');
-        else
-            data.push(*it);
-}
+bool DirEntry::save(const string& fn) {
+	NNLOG("museek.direntry", "save %s", fn.c_str());
 
-static inline uint32 _unpack_int(queue<unsigned char>& data) {
-	uint32 i = 0;
-	for(uint j = 0; j < 4; j++) {
-		i += data.front() << (j * 8);
-		data.pop();
-	}
-	return i;
+	BinaryWriter writer;
+	if(! writer.open(fn))
+		return false;
+	writer.put((uint32)DB_MAGIC);
+	writer.put((uint32)DB_VERSION);
+	write(writer);
+	writer.put(writer.checksum());
+	return writer.close();
 }
 
-static inline uint64 _unpack_off(queue<unsigned char>& data) {
-	uint64 i = 0;
-	for(uint j = 0; j < 8; j++) {
-		i += data.front() << (j * 8);
-		data.pop();
+void DirEntry::read(BinaryReader& reader) {
+	clear();
+
+	path = reader.getString();
+	mtime = reader.getInt();
+
+	uint32 i = reader.getInt();
+	for(uint32 j = 0; j < i && reader.good(); ++j) {
+		DirEntry* de = new_folder(false);
+		de->read(reader);
+		folders[de->path] = de;
 	}
-	return i;
-}
 
-static inline string _unpack_str(queue<unsigned char>& data) {
-	string r;
-	uint32 l = _unpack_int(data);
-	r.reserve(l);
-	for(uint32 j = 0; j < l; ++j) {
-		r += data.front();
-		data.pop();
+	i = reader.getInt();
+	for(uint32 j = 0; j < i && reader.good(); ++j) {
+		FileEntry fe;
+		string fn = reader.getString();
+		fe.size = reader.getOff();
+		fe.ext = reader.getString();
+		uint32 k = reader.getInt();
+		for(uint32 l = 0; l < k && reader.good(); ++l)
+			fe.attrs.push_back(reader.getInt());
+		files[fn] = fe;
 	}
-	return r;
 }
 
-queue<unsigned char> DirEntry::pack() {
-	NNLOG("museek.direntry", "pack");
-
-	queue<unsigned char> data;
-
-	_pack(data, path);
-	_pack(data, (uint32)mtime);
+bool DirEntry::load(const string& fn) {
+	NNLOG("museek.direntry", "load %s", fn.c_str());
 
-	_pack(data, (uint32)folders.size());
-	map<string, DirEntry*>::iterator dit = folders.begin();
-	for(; dit != folders.end(); ++dit) {
-		queue<unsigned char> data2 = (*dit).second->pack();
-		while(! data2.empty()) {
-			data.push(data2.front());
-			data2.pop();
+	BinaryReader reader;
+	uint32 magic;
+	if(! reader.open(fn) || ! reader.peekInt(magic))
+		return false;
+
+	/* Databases saved before they had a header are only the folders */
+	bool legacy = magic != DB_MAGIC;
+	if(! legacy) {
+		reader.getInt();
+		uint32 version = reader.getInt();
+		if(version != DB_VERSION) {
+			NNLOG("museek.direntry", "%s has unknown version %u", fn.c_str(), version);
+			return false;
 		}
 	}
 
-	_pack(data, (uint32)files.size());
+	read(reader);
+	if(! legacy && reader.good()) {
+		uint32 checksum = reader.checksum();
+		if(reader.getInt() != checksum) {
+			NNLOG("museek.direntry", "%s has a bad checksum", fn.c_str());
+			clear();
+			return false;
+		}
+	}
+	if(! reader.good()) {
+		NNLOG("museek.direntry", "%s is cut short", fn.c_str());
+		clear();
+		return false;
+	}
+	return true;
+}
 
-	Folder::iterator fit = files.begin();
-	for(; fit != files.end(); ++fit) {
-		_pack(data, (*fit).first);
-		_pack(data, (*fit).second.size);
-		_pack(data, (*fit).second.ext);
-		_pack(data, (uint32)(*fit).second.attrs.size());
-		std::vector<uint32>::iterator ait = (*fit).second.attrs.begin();
-		for(; ait != (*fit).second.attrs.end(); ++ait)
-			_pack(data, *ait);
+ShareDelta::Stamp ShareDelta::stamp(const string& fn) {
+	Stamp s;
+	struct stat st;
+	if(stat(fn.c_str(), &st) == 0) {
+		s.size = st.st_size;
+		s.mtime = (uint64)st.st_mtime * 1000000000;
+#if defined(HAVE_STRUCT_STAT_ST_MTIM)
+		s.mtime += st.st_mtim.tv_nsec;
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC)
+		s.mtime += st.st_mtimespec.tv_nsec;
+#endif
 	}
-	return data;
+	return s;
 }
 
-void DirEntry::save(const string& fn) {
-	NNLOG("museek.direntry", "save %s", fn.c_str());
+ShareDelta::~ShareDelta() {
+	map<string, DirEntry*>::iterator it = changed.begin();
+	for(; it != changed.end(); ++it)
+		delete (*it).second;
+}
 
-	queue<unsigned char> data = pack();
-	unsigned char *cdata = new unsigned char[data.size()];
+static bool _same(const Folder& a, const Folder& b) {
+	if(a.size() != b.size())
+		return false;
+	Folder::const_iterator ait = a.begin(), bit = b.begin();
+	for(; ait != a.end(); ++ait, ++bit)
+		if((*ait).first != (*bit).first || (*ait).second.size != (*bit).second.size ||
+		   (*ait).second.ext != (*bit).second.ext || (*ait).second.attrs != (*bit).second.attrs)
+			return false;
+	return true;
+}
 
-	uint32 i = 0;
-	while (! data.empty()) {
-		cdata[i++] = data.front();
-		data.pop();
+void ShareDelta::diff(const DirEntry& before, const DirEntry& after) {
+	NNLOG("museek.direntry", "diff");
+
+	map<string, DirEntry*>::const_iterator it = after.folders.begin();
+	for(; it != after.folders.end(); ++it) {
+		map<string, DirEntry*>::const_iterator old = before.folders.find((*it).first);
+		if(old != before.folders.end() && _same((*old).second->files, (*it).second->files))
+			continue;
+		DirEntry* de = new DirEntry((*it).first);
+		de->files = (*it).second->files;
+		changed[(*it).first] = de;
 	}
 
-	FILE *f = fopen(fn.c_str(), "w");
-	if (f != NULL) {
-		fwrite(cdata, 1, i, f);
-		fclose(f);
-	}
-	delete [] cdata;
+	for(it = before.folders.begin(); it != before.folders.end(); ++it)
+		if(after.folders.find((*it).first) == after.folders.end())
+			removed.push_back((*it).first);
 }
 
-void DirEntry::unpack(queue<unsigned char>& data) {
-	NNLOG("museek.direntry", "unpack %d", data.size());
+void ShareDelta::apply(DirEntry& folded) {
+	NNLOG("museek.direntry", "apply %d changed, %d removed", (int)changed.size(), (int)removed.size());
 
-	for(map<string, DirEntry*>::iterator it = folders.begin(); it != folders.end(); ++it)
-		delete (*it).second;
-	folders.clear();
-	files.clear();
-
-	path = _unpack_str(data);
-	mtime = _unpack_int(data);
-
-	uint32 i = _unpack_int(data);
-	for(uint32 j = 0; j < i; ++j) {
-		DirEntry* de = new_folder(false);
-		de->unpack(data);
-		folders[de->path] = de;
+	std::vector<string>::const_iterator rit = removed.begin();
+	for(; rit != removed.end(); ++rit) {
+		map<string, DirEntry*>::iterator old = folded.folders.find(*rit);
+		if(old != folded.folders.end()) {
+			delete (*old).second;
+			folded.folders.erase(old);
+		}
 	}
 
-	i = _unpack_int(data);
-	for(uint32 j = 0; j < i; ++j) {
-		FileEntry fe;
-		string fn;
-		uint32 k;
-		fn = _unpack_str(data);
-		fe.size = _unpack_off(data);
-		fe.ext = _unpack_str(data);
-		k = _unpack_int(data);
-        for(uint32 l = 0; l < k; ++l)
-			fe.attrs.push_back(_unpack_int(data));
-		files[fn] = fe;
+	map<string, DirEntry*>::iterator it = changed.begin();
+	for(; it != changed.end(); ++it) {
+		map<string, DirEntry*>::iterator old = folded.folders.find((*it).first);
+		if(old != folded.folders.end())
+			delete (*old).second;
+		folded.folders[(*it).first] = (*it).second;
 	}
+	changed.clear();
 }
 
-void DirEntry::load(const string& fn) {
-	NNLOG("museek.direntry", "load %s", fn.c_str());
-
-	long long size;
-
-	FILE *f = fopen(fn.c_str(), "r");
-	if (f == NULL)
-		return;
+bool ShareDelta::save(const string& fn) {
+	NNLOG("museek.direntry", "save delta %s", fn.c_str());
+
+	BinaryWriter writer;
+	if(! writer.open(fn))
+		return false;
+	writer.put((uint32)DELTA_MAGIC);
+	writer.put((uint32)DELTA_VERSION);
+	writer.put(from.size);
+	writer.put(from.mtime);
+	writer.put(to.size);
+	writer.put(to.mtime);
+
+	/* The changed folders are saved like the ones of a database */
+	DirEntry root;
+	root.folders.swap(changed);
+	root.write(writer);
+	root.folders.swap(changed);
+
+	writer.put((uint32)removed.size());
+	std::vector<string>::const_iterator it = removed.begin();
+	for(; it != removed.end(); ++it)
+		writer.put(*it);
+
+	writer.put(writer.checksum());
+	return writer.close();
+}
 
-    // obtain file size:
-    fseek (f , 0 , SEEK_END);
-    size = ftell (f);
-    rewind (f);
-    
-	if (size == 0)
-		return;
+bool ShareDelta::load(const string& fn) {
+	NNLOG("museek.direntry", "load delta %s", fn.c_str());
 
-	unsigned char *cdata = new unsigned char[size];
-	if (fread(cdata, 1, size, f) != (uint32)size) {
-		delete [] cdata;
-		return;
-	}
+	BinaryReader reader;
+	if(! reader.open(fn) || reader.getInt() != DELTA_MAGIC || reader.getInt() != DELTA_VERSION)
+		return false;
+	from.size = reader.getOff();
+	from.mtime = reader.getOff();
+	to.size = reader.getOff();
+	to.mtime = reader.getOff();
 
-	queue<unsigned char> data;
-	for(int i = 0; i < size; i++)
-		data.push(cdata[i]);
+	DirEntry root;
+	root.read(reader);
+	changed.swap(root.folders);
 
-	delete [] cdata;
+	uint32 count = reader.getInt();
+	for(uint32 i = 0; i < count && reader.good(); ++i)
+		removed.push_back(reader.getString());
 
-	unpack(data);
+	/* Don't trust a delta cut short */
+	uint32 checksum = reader.checksum();
+	return reader.getInt() == checksum && reader.good();
 }
 
-void DirEntry::network_pack(queue<unsigned char>& data) {
-	NNLOG("museek.direntry", "network pack <...>");
-
-	_pack(data, (uint32)folders.size());
-	map<string, DirEntry*>::iterator dit = folders.begin();
-	for(; dit != folders.end(); ++dit) {
-		_pack_path(data, (*dit).first);
-		_pack(data, (uint32)(*dit).second->files.size());
-		Folder::iterator fit = (*dit).second->files.begin();
-		for(; fit != (*dit).second->files.end(); ++fit) {
-			data.push(1);
-			_pack(data, (*fit).first);
-			_pack(data, (*fit).second.size);
-			_pack(data, (*fit).second.ext);
-			_pack(data, (uint32)(*fit).second.attrs.size());
-			std::vector<uint32>::iterator ait = (*fit).second.attrs.begin();
-			for(uint32 j = 0; ait != (*fit).second.attrs.end(); ++ait) {
-				_pack(data, j++);
-				_pack(data, *ait);
-			}
-		}
+void ShareDelta::save(const string& fn, DirEntry& folded) {
+	ShareDelta delta;
+	delta.from = stamp(fn);
+	if(delta.from.valid()) {
+		DirEntry previous;
+		previous.load(fn);
+		delta.diff(previous, folded);
 	}
-}
 
-void DirEntry::flatten(Folder& filemap) {
-	NNLOG("museek.direntry", "flatten <...>");
-
-	map<string, DirEntry*>::iterator dit = folders.begin();
-	for(; dit != folders.end(); ++dit)
-		(*dit).second->flatten(filemap);
+	folded.save(fn);
+	delta.to = stamp(fn);
 
-	Folder::iterator fit = files.begin();
-	for(; fit != files.end(); ++fit)
-		filemap[str_replace(path, NewNet::Path::separator(), '\\') + "\\" + (*fit).first] = (*fit).second;
+	/* Without a way to tell both versions apart, museekd has to load the
+	 * whole database again */
+	if(delta.from.valid() && delta.to.valid() && delta.from != delta.to)
+		delta.save(fn + ".delta");
+	else
+		unlink((fn + ".delta").c_str());
 }
@@ -21,13 +21,15 @@
 #ifndef __DIRENTRY_HH__
 #define __DIRENTRY_HH__
 
-#include <queue>
 #include <string>
 #include <vector>
 #include <map>
 
 #include <museekd/mutypes.h>
 
+class BinaryReader;
+class BinaryWriter;
+
 class DirEntry {
 public:
 	DirEntry(bool _f = true) { fake = _f; mtime = 0; };
@@ -38,22 +40,65 @@ public:
 	virtual DirEntry* new_folder(const std::string& path);
 
 	void fold(DirEntry* folded);
-	void network_pack(std::queue<unsigned char>&);
-	void flatten(Folder&);
 
-	void save(const std::string&);
-	void load(const std::string&);
+	/* Return false when the file can't be written, or read back whole.
+	 * load also reads the databases saved before they had a version. */
+	bool save(const std::string&);
+	bool load(const std::string&);
+	/* Forget every folder and file. */
+	void clear();
 
 	std::string path;
 	std::map<std::string, DirEntry*> folders;
 	Folder files;
 
 protected:
-	std::queue<unsigned char> pack();
-	void unpack(std::queue<unsigned char>&);
+	friend class ShareDelta;
+
+	void write(BinaryWriter&) const;
+	void read(BinaryReader&);
 
 	bool fake;
 	time_t mtime;
 };
 
+/* The changes between two versions of a folded database (one folder per
+ * shared directory, holding its files): the folders added or changed, and
+ * the paths of the folders removed. muscan writes it next to the database
+ * as <database>.delta, so museekd can update what it loaded before instead
+ * of loading it again. from and to tell which versions of the database the
+ * delta goes between. */
+class ShareDelta {
+public:
+	/* Identifies a version of a file: its size and modification time, in
+	 * nanoseconds where the system has them, so a file rewritten within
+	 * the same second still gets another stamp. */
+	struct Stamp {
+		Stamp() : size(0), mtime(0) {}
+		bool operator==(const Stamp& other) const { return size == other.size && mtime == other.mtime; }
+		bool operator!=(const Stamp& other) const { return ! (*this == other); }
+		inline bool valid() const { return mtime != 0; }
+		uint64 size, mtime;
+	};
+	static Stamp stamp(const std::string& fn);
+
+	~ShareDelta();
+
+	/* Fill the delta in with what changed between before and after. */
+	void diff(const DirEntry& before, const DirEntry& after);
+	/* Make the changes in folded, the changed folders move there. */
+	void apply(DirEntry& folded);
+
+	bool save(const std::string& fn);
+	bool load(const std::string& fn);
+
+	/* Save folded as the database fn, and the delta from what fn held
+	 * before in fn.delta. */
+	static void save(const std::string& fn, DirEntry& folded);
+
+	Stamp from, to;
+	std::map<std::string, DirEntry*> changed;
+	std::vector<std::string> removed;
+};
+
 #endif // __DIRENTRY_HH__
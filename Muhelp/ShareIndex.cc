@@ -0,0 +1,980 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+
+#include <Muhelp/ShareIndex.hh>
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using std::string;
+using std::vector;
+
+const uint32 ShareIndex::BlockSize;
+const uint32 ShareIndex::None;
+
+static inline uint32 _read_int(const unsigned char* p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32)p[3] << 24);
+}
+
+static inline uint32 _read_varint(const unsigned char*& p) {
+	uint32 i = *p & 0x7f;
+	for(uint shift = 7; *p++ & 0x80; shift += 7)
+		i |= (*p & 0x7f) << shift;
+	return i;
+}
+
+template<typename T> static inline void _write_varint(T& data, uint32 i) {
+	while(i >= 0x80) {
+		data.push_back((i & 0x7f) | 0x80);
+		i >>= 7;
+	}
+	data.push_back(i);
+}
+
+/* FNV-1a of the path with its ASCII letters lowered, continued from h. */
+static const uint32 _hash_start = 2166136261u;
+
+static inline uint32 _hash(uint32 h, const char* s, size_t length) {
+	for(size_t i = 0; i < length; ++i) {
+		char c = s[i];
+		if(c >= 'A' && c <= 'Z')
+			c |= 32;
+		h = (h ^ (unsigned char)c) * 16777619u;
+	}
+	return h;
+}
+
+static inline bool _same(const char* a, const char* b, size_t length, bool nocase) {
+	if(! nocase)
+		return memcmp(a, b, length) == 0;
+	for(size_t i = 0; i < length; ++i) {
+		char ca = a[i], cb = b[i];
+		if(ca >= 'A' && ca <= 'Z')
+			ca |= 32;
+		if(cb >= 'A' && cb <= 'Z')
+			cb |= 32;
+		if(ca != cb)
+			return false;
+	}
+	return true;
+}
+
+static inline uint32 _trigram(const char* p) {
+	return ((unsigned char)p[0] << 16) | ((unsigned char)p[1] << 8) | (unsigned char)p[2];
+}
+
+/* Key of the one or two bytes at p: the length in the top byte keeps them
+ * apart from the trigrams, after them. */
+static inline uint32 _shortgram(const char* p, size_t length) {
+	uint32 key = length << 24;
+	for(size_t i = 0; i < length; ++i)
+		key |= (unsigned char)p[i] << ((length - 1 - i) * 8);
+	return key;
+}
+
+/* A skip table entry is the first id of the block and the offset of the
+ * rest of the block from the start of the data. */
+inline uint32 ShareIndex::Cursor::first(uint32 block) const {
+	return _read_int(mSkip + block * 8);
+}
+
+void ShareIndex::Cursor::enter(uint32 block) {
+	mBlock = block;
+	mPos = mData + _read_int(mSkip + block * 8 + 4);
+	mValue = first(block);
+	mLeft = std::min(BlockSize, mCount - block * BlockSize) - 1;
+	mValid = true;
+}
+
+void ShareIndex::Cursor::next() {
+	if(mLeft > 0) {
+		mValue += _read_varint(mPos);
+		--mLeft;
+	}
+	else if(mBlock + 1 < mBlocks)
+		enter(mBlock + 1);
+	else
+		mValid = false;
+}
+
+void ShareIndex::Cursor::seek(uint32 target) {
+	if(! mValid || mValue >= target)
+		return;
+
+	/* Gallop over the skip table to the last block starting at or before
+	 * target, then decode that block. */
+	if(mBlock + 1 < mBlocks && first(mBlock + 1) <= target) {
+		uint32 low = mBlock + 1, step = 1;
+		while(low + step < mBlocks && first(low + step) <= target) {
+			low += step;
+			step *= 2;
+		}
+		uint32 high = std::min(low + step, mBlocks);
+		while(high - low > 1) {
+			uint32 middle = low + (high - low) / 2;
+			if(first(middle) <= target)
+				low = middle;
+			else
+				high = middle;
+		}
+		enter(low);
+	}
+
+	while(mValid && mValue < target)
+		next();
+}
+
+ShareIndex::Intersection::Intersection(vector<Cursor>& lists) : mLists(lists), mStarted(false) {
+	/* Walk the shortest list and seek in the others. */
+	for(size_t i = 1; i < mLists.size(); ++i)
+		for(size_t j = i; j > 0 && mLists[j].count() < mLists[j - 1].count(); --j)
+			std::swap(mLists[j], mLists[j - 1]);
+}
+
+bool ShareIndex::Intersection::next(uint32& id) {
+	if(mLists.empty())
+		return false;
+
+	if(mStarted)
+		mLists[0].next();
+	mStarted = true;
+
+	while(mLists[0].valid()) {
+		uint32 candidate = mLists[0].value();
+		size_t i = 1;
+		for(; i < mLists.size(); ++i) {
+			mLists[i].seek(candidate);
+			if(! mLists[i].valid())
+				return false;
+			if(mLists[i].value() != candidate)
+				break;
+		}
+		if(i == mLists.size()) {
+			id = candidate;
+			return true;
+		}
+		mLists[0].seek(mLists[i].value());
+	}
+	return false;
+}
+
+bool ShareIndex::PathLess::operator()(const string& a, const string& b) const {
+	size_t n = std::min(a.size(), b.size());
+	for(size_t i = 0; i < n; ++i) {
+		if(a[i] == b[i])
+			continue;
+		if(a[i] == '\\')
+			return true;
+		if(b[i] == '\\')
+			return false;
+		return (unsigned char)a[i] < (unsigned char)b[i];
+	}
+	return a.size() < b.size();
+}
+
+ShareIndex::ShareIndex() : mShared(0), mMapping(0), mMappingSize(0) {
+}
+
+ShareIndex::~ShareIndex() {
+	unmap();
+}
+
+void ShareIndex::clear() {
+	mPending.clear();
+	mInterned.clear();
+	mPendingDirectories.clear();
+	mPendingFileTrigrams.clear();
+	mPendingDirectoryTrigrams.clear();
+	mStrings.clear();
+	mDirectories.clear();
+	mChildren.clear();
+	mFiles.clear();
+	mAttrs.clear();
+	mShared = 0;
+	mWords.clear();
+	mFileTrigrams.clear();
+	mDirectoryTrigrams.clear();
+	mPostings.clear();
+	mPaths.clear();
+	unmap();
+}
+
+/* Strings that come back often (path components, extensions) are only
+ * stored once. */
+uint32 ShareIndex::intern(const string& text) {
+	std::unordered_map<string, uint32>::const_iterator it = mInterned.find(text);
+	if(it != mInterned.end())
+		return it->second;
+	uint32 pos = store(text);
+	mInterned[text] = pos;
+	return pos;
+}
+
+uint32 ShareIndex::store(const string& text) {
+	uint32 pos = mStrings.size();
+	mStrings.append(text.begin(), text.end());
+	return pos;
+}
+
+int ShareIndex::compare(uint32 text, uint32 length, const char* other, size_t otherLength) const {
+	int cmp = memcmp(mStrings.begin() + text, other, std::min<size_t>(length, otherLength));
+	if(cmp == 0)
+		cmp = (length < otherLength) ? -1 : (length > otherLength ? 1 : 0);
+	return cmp;
+}
+
+uint32 ShareIndex::addDirectory(const string& path) {
+	uint32 parent = None;
+	string::size_type start = 0;
+	while(true) {
+		string::size_type end = path.find('\\', start);
+		string component = path.substr(start, end == string::npos ? string::npos : end - start);
+
+		string key((const char*)&parent, sizeof(parent));
+		key += component;
+		std::unordered_map<string, uint32>::const_iterator it = mPendingDirectories.find(key);
+		uint32 id;
+		if(it != mPendingDirectories.end())
+			id = it->second;
+		else {
+			Directory d;
+			d.parent = parent;
+			d.name = intern(component);
+			d.nameLength = component.size();
+			d.firstFile = mFiles.size();
+			d.fileCount = 0;
+			d.lastFile = d.firstFile;
+			d.shared = 0;
+			id = mDirectories.size();
+			mDirectories.push_back(d);
+			mPendingDirectories[key] = id;
+		}
+
+		if(end == string::npos) {
+			if(! mDirectories[id].shared) {
+				mDirectories.at(id).shared = 1;
+				++mShared;
+			}
+			return id;
+		}
+		parent = id;
+		start = end + 1;
+	}
+}
+
+uint32 ShareIndex::addFile(uint32 directory, const string& name, const FileEntry& entry) {
+	Directory& d = mDirectories.at(directory);
+	if(d.fileCount == 0)
+		d.firstFile = mFiles.size();
+	else if(d.firstFile + d.fileCount != mFiles.size())
+		return None;
+
+	File f;
+	f.size = entry.size;
+	f.directory = directory;
+	f.name = store(name);
+	f.nameLength = name.size();
+	f.ext = intern(entry.ext);
+	f.extLength = entry.ext.size();
+	f.attrs = mAttrs.size();
+	f.attrCount = entry.attrs.size();
+	mAttrs.append(entry.attrs.begin(), entry.attrs.end());
+
+	++d.fileCount;
+	mFiles.push_back(f);
+	return mFiles.size() - 1;
+}
+
+string ShareIndex::component(uint32 directory) const {
+	return string(mStrings.begin() + mDirectories[directory].name, mDirectories[directory].nameLength);
+}
+
+string ShareIndex::directoryPath(uint32 directory) const {
+	vector<uint32> parts;
+	for(uint32 d = directory; d != None; d = mDirectories[d].parent)
+		parts.push_back(d);
+
+	string path;
+	vector<uint32>::const_reverse_iterator it = parts.rbegin();
+	for(; it != parts.rend(); ++it) {
+		if(it != parts.rbegin())
+			path += '\\';
+		path.append(mStrings.begin() + mDirectories[*it].name, mDirectories[*it].nameLength);
+	}
+	return path;
+}
+
+string ShareIndex::name(uint32 file) const {
+	return string(mStrings.begin() + mFiles[file].name, mFiles[file].nameLength);
+}
+
+string ShareIndex::path(uint32 file) const {
+	string path = directoryPath(mFiles[file].directory);
+	path += '\\';
+	path.append(mStrings.begin() + mFiles[file].name, mFiles[file].nameLength);
+	return path;
+}
+
+void ShareIndex::entry(uint32 file, FileEntry& entry) const {
+	const File& f = mFiles[file];
+	entry.size = f.size;
+	entry.ext.assign(mStrings.begin() + f.ext, f.extLength);
+	entry.attrs.assign(mAttrs.begin() + f.attrs, mAttrs.begin() + f.attrs + f.attrCount);
+}
+
+bool ShareIndex::findChild(uint32 parent, const char* name, size_t length, uint32& child) const {
+	size_t low = 0, high = mChildren.size();
+	while(low < high) {
+		size_t middle = low + (high - low) / 2;
+		const Directory& d = mDirectories[mChildren[middle]];
+		int cmp = (d.parent < parent) ? -1 : (d.parent > parent ? 1 : compare(d.name, d.nameLength, name, length));
+		if(cmp == 0) {
+			child = mChildren[middle];
+			return true;
+		}
+		if(cmp < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return false;
+}
+
+bool ShareIndex::findDirectory(const string& path, uint32& directory) const {
+	uint32 parent = None;
+	string::size_type start = 0;
+	while(true) {
+		string::size_type end = path.find('\\', start);
+		size_t length = (end == string::npos ? path.size() : end) - start;
+		if(! findChild(parent, path.data() + start, length, parent))
+			return false;
+		if(end == string::npos) {
+			directory = parent;
+			return true;
+		}
+		start = end + 1;
+	}
+}
+
+bool ShareIndex::findFile(const string& path, uint32& file) const {
+	string::size_type sep = path.rfind('\\');
+	uint32 directory;
+	if(sep == string::npos || ! findDirectory(path.substr(0, sep), directory))
+		return false;
+
+	const char* name = path.data() + sep + 1;
+	size_t length = path.size() - sep - 1;
+	uint32 low = mDirectories[directory].firstFile, high = low + mDirectories[directory].fileCount;
+	while(low < high) {
+		uint32 middle = low + (high - low) / 2;
+		int cmp = compare(mFiles[middle].name, mFiles[middle].nameLength, name, length);
+		if(cmp == 0) {
+			file = middle;
+			return true;
+		}
+		if(cmp < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return false;
+}
+
+/* Open addressing, linear probing, at most half full. Parents are added
+ * before their children, so the hashes of the directories are continued
+ * from the ones of their parents. */
+void ShareIndex::hashPaths() {
+	vector<uint32> directories(mDirectories.size());
+	for(uint32 d = 0; d < mDirectories.size(); ++d) {
+		const Directory& dir = mDirectories[d];
+		uint32 h = _hash_start;
+		if(dir.parent != None)
+			h = _hash(directories[dir.parent], "\\", 1);
+		directories[d] = _hash(h, mStrings.begin() + dir.name, dir.nameLength);
+	}
+
+	vector<uint32> paths;
+	if(! mFiles.size()) {
+		mPaths.swap(paths);
+		return;
+	}
+	size_t slots = 1;
+	while(slots < mFiles.size() * 2)
+		slots *= 2;
+	paths.resize(slots * 2, None);
+	for(uint32 file = 0; file < mFiles.size(); ++file) {
+		const File& f = mFiles[file];
+		uint32 h = _hash(_hash(directories[f.directory], "\\", 1), mStrings.begin() + f.name, f.nameLength);
+		size_t slot = h & (slots - 1);
+		while(paths[slot * 2 + 1] != None)
+			slot = (slot + 1) & (slots - 1);
+		paths[slot * 2] = h;
+		paths[slot * 2 + 1] = file;
+	}
+	mPaths.swap(paths);
+}
+
+/* Compare path with the one of file from the end, without building it. */
+bool ShareIndex::matches(uint32 file, const string& path, bool nocase) const {
+	const File& f = mFiles[file];
+	size_t end = path.size();
+	if(end < f.nameLength || ! _same(path.data() + end - f.nameLength, mStrings.begin() + f.name, f.nameLength, nocase))
+		return false;
+	end -= f.nameLength;
+	for(uint32 d = f.directory; d != None; d = mDirectories[d].parent) {
+		const Directory& dir = mDirectories[d];
+		if(end < dir.nameLength + 1 || path[end - 1] != '\\')
+			return false;
+		end -= 1;
+		if(! _same(path.data() + end - dir.nameLength, mStrings.begin() + dir.name, dir.nameLength, nocase))
+			return false;
+		end -= dir.nameLength;
+	}
+	return end == 0;
+}
+
+bool ShareIndex::lookup(const string& path, uint32& file, bool nocase) const {
+	size_t slots = mPaths.size() / 2;
+	if(slots == 0)
+		return false;
+	uint32 h = _hash(_hash_start, path.data(), path.size());
+	for(size_t slot = h & (slots - 1); mPaths[slot * 2 + 1] != None; slot = (slot + 1) & (slots - 1)) {
+		if(mPaths[slot * 2] == h && matches(mPaths[slot * 2 + 1], path, nocase)) {
+			file = mPaths[slot * 2 + 1];
+			return true;
+		}
+	}
+	return false;
+}
+
+void ShareIndex::children(uint32 directory, vector<uint32>& children) const {
+	size_t low = 0, high = mChildren.size();
+	while(low < high) {
+		size_t middle = low + (high - low) / 2;
+		if(mDirectories[mChildren[middle]].parent < directory)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	for(; low < mChildren.size() && mDirectories[mChildren[low]].parent == directory; ++low)
+		children.push_back(mChildren[low]);
+}
+
+static inline void _pack(vector<unsigned char>& data, uint32 i) {
+	for(uint j = 0; j < 4; j++) {
+		data.push_back(i & 0xff);
+		i >>= 8;
+	}
+}
+
+static inline void _pack(vector<unsigned char>& data, uint64 i) {
+	for(uint j = 0; j < 8; j++) {
+		data.push_back(i & 0xff);
+		i >>= 8;
+	}
+}
+
+static inline void _pack(vector<unsigned char>& data, const char* s, uint32 length) {
+	_pack(data, length);
+	data.insert(data.end(), s, s + length);
+}
+
+void ShareIndex::network_pack(uint32 directory, vector<unsigned char>& data) const {
+	const Directory& dir = mDirectories[directory];
+	string path = directoryPath(directory);
+	_pack(data, path.data(), path.size());
+	_pack(data, dir.fileCount);
+	for(uint32 i = dir.firstFile; i < dir.firstFile + dir.fileCount; ++i) {
+		const File& f = mFiles[i];
+		data.push_back(1);
+		_pack(data, mStrings.begin() + f.name, f.nameLength);
+		_pack(data, f.size);
+		_pack(data, mStrings.begin() + f.ext, f.extLength);
+		_pack(data, (uint32)f.attrCount);
+		for(uint32 j = 0; j < f.attrCount; ++j) {
+			_pack(data, j);
+			_pack(data, mAttrs[f.attrs + j]);
+		}
+	}
+}
+
+void ShareIndex::split(const string& text, vector<string>& words) {
+	string word;
+	string::const_iterator it = text.begin();
+	for(; it != text.end(); ++it) {
+		char c = fold(*it);
+		if(c == ' ') {
+			if(! word.empty())
+				words.push_back(word);
+			word.clear();
+		} else
+			word += c;
+	}
+	if(! word.empty())
+		words.push_back(word);
+}
+
+void ShareIndex::add(uint32 id, const string& text) {
+	vector<string> words;
+	split(text, words);
+
+	vector<string>::const_iterator it = words.begin();
+	for(; it != words.end(); ++it) {
+		vector<uint32>& ids = mPending[*it];
+		if(ids.empty() || ids.back() != id)
+			ids.push_back(id);
+	}
+}
+
+void ShareIndex::addText(PendingTrigrams& pending, uint32 id, const string& text) {
+	for(size_t i = 0; i < text.size(); ++i)
+		for(size_t length = 1; length <= 3 && i + length <= text.size(); ++length) {
+			uint32 key = length == 3 ? _trigram(text.data() + i) : _shortgram(text.data() + i, length);
+			vector<uint32>& ids = pending[key];
+			if(ids.empty() || ids.back() != id)
+				ids.push_back(id);
+		}
+}
+
+void ShareIndex::addFileText(uint32 file, const string& text) {
+	addText(mPendingFileTrigrams, file, text);
+}
+
+void ShareIndex::addDirectoryText(uint32 directory, const string& text) {
+	addText(mPendingDirectoryTrigrams, directory, text);
+}
+
+void ShareIndex::encode(const vector<uint32>& ids) {
+	uint32 blocks = (ids.size() + BlockSize - 1) / BlockSize;
+
+	size_t skip = mPostings.size();
+	mPostings.resize(skip + blocks * 8);
+
+	size_t data = mPostings.size();
+	for(uint32 b = 0; b < blocks; ++b) {
+		uint32 start = b * BlockSize, end = std::min<uint32>(start + BlockSize, ids.size());
+		uint32 offset = mPostings.size() - data;
+		for(uint j = 0; j < 4; j++) {
+			mPostings.at(skip + b * 8 + j) = (ids[start] >> (j * 8)) & 0xff;
+			mPostings.at(skip + b * 8 + 4 + j) = (offset >> (j * 8)) & 0xff;
+		}
+		for(uint32 i = start + 1; i < end; ++i)
+			_write_varint(mPostings, ids[i] - ids[i - 1]);
+	}
+}
+
+/* Orders the directories by parent, then by name. */
+struct ShareIndex::ChildOrder {
+	ChildOrder(const ShareIndex& index) : mIndex(index) {}
+
+	bool operator()(uint32 a, uint32 b) const {
+		const Directory& da = mIndex.mDirectories[a];
+		const Directory& db = mIndex.mDirectories[b];
+		if(da.parent != db.parent)
+			return da.parent < db.parent;
+		return mIndex.compare(da.name, da.nameLength, mIndex.mStrings.begin() + db.name, db.nameLength) < 0;
+	}
+
+	const ShareIndex& mIndex;
+};
+
+void ShareIndex::finish() {
+	vector<string> words;
+	words.reserve(mPending.size());
+	std::unordered_map<string, vector<uint32> >::const_iterator it = mPending.begin();
+	for(; it != mPending.end(); ++it)
+		words.push_back(it->first);
+	std::sort(words.begin(), words.end());
+
+	mWords.reserve(words.size());
+	vector<string>::const_iterator wit = words.begin();
+	for(; wit != words.end(); ++wit) {
+		const vector<uint32>& ids = mPending[*wit];
+		Word w;
+		w.text = store(*wit);
+		w.length = wit->size();
+		w.postings = mPostings.size();
+		w.count = ids.size();
+		encode(ids);
+		mWords.push_back(w);
+	}
+
+	vector<uint32> children(mDirectories.size());
+	for(uint32 d = 0; d < mDirectories.size(); ++d)
+		children[d] = d;
+	std::sort(children.begin(), children.end(), ChildOrder(*this));
+	mChildren.swap(children);
+
+	encode(mPendingFileTrigrams, mFileTrigrams);
+	encode(mPendingDirectoryTrigrams, mDirectoryTrigrams);
+
+	hashPaths();
+
+	for(uint32 d = 0; d < mDirectories.size(); ++d)
+		mDirectories.at(d).lastFile = mDirectories[d].firstFile + mDirectories[d].fileCount;
+	for(uint32 d = mDirectories.size(); d-- > 0;) {
+		uint32 parent = mDirectories[d].parent;
+		if(parent != None)
+			mDirectories.at(parent).lastFile = std::max(mDirectories[parent].lastFile, mDirectories[d].lastFile);
+	}
+
+	std::unordered_map<string, vector<uint32> >().swap(mPending);
+	std::unordered_map<string, uint32>().swap(mInterned);
+	std::unordered_map<string, uint32>().swap(mPendingDirectories);
+	mStrings.shrink();
+	mDirectories.shrink();
+	mFiles.shrink();
+	mAttrs.shrink();
+	mPostings.shrink();
+}
+
+bool ShareIndex::find(const string& word, Cursor& cursor) const {
+	size_t low = 0, high = mWords.size();
+	while(low < high) {
+		size_t middle = low + (high - low) / 2;
+		const Word& w = mWords[middle];
+		int cmp = compare(w.text, w.length, word.data(), word.size());
+		if(cmp == 0) {
+			open(w.postings, w.count, cursor);
+			return true;
+		}
+		if(cmp < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return false;
+}
+
+void ShareIndex::encode(PendingTrigrams& pending, Table<Trigram>& trigrams) {
+	vector<uint32> keys;
+	keys.reserve(pending.size());
+	PendingTrigrams::const_iterator it = pending.begin();
+	for(; it != pending.end(); ++it)
+		keys.push_back(it->first);
+	std::sort(keys.begin(), keys.end());
+
+	trigrams.reserve(keys.size());
+	vector<uint32>::const_iterator kit = keys.begin();
+	for(; kit != keys.end(); ++kit) {
+		const vector<uint32>& ids = pending[*kit];
+		Trigram t;
+		t.key = *kit;
+		t.postings = mPostings.size();
+		t.count = ids.size();
+		encode(ids);
+		trigrams.push_back(t);
+	}
+	PendingTrigrams().swap(pending);
+}
+
+void ShareIndex::open(uint32 postings, uint32 count, Cursor& cursor) const {
+	cursor.mSkip = mPostings.begin() + postings;
+	cursor.mCount = count;
+	cursor.mBlocks = (count + BlockSize - 1) / BlockSize;
+	cursor.mData = cursor.mSkip + cursor.mBlocks * 8;
+	cursor.enter(0);
+}
+
+const ShareIndex::Trigram* ShareIndex::find(const Table<Trigram>& trigrams, uint32 key) const {
+	size_t low = 0, high = trigrams.size();
+	while(low < high) {
+		size_t middle = low + (high - low) / 2;
+		if(trigrams[middle].key < key)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if(low == trigrams.size() || trigrams[low].key != key)
+		return 0;
+	return &trigrams[low];
+}
+
+bool ShareIndex::candidates(const Table<Trigram>& trigrams, const string& phrase, vector<uint32>& ids) const {
+	if(phrase.size() >= 3) {
+		/* Everything holding every trigram of the phrase */
+		vector<Cursor> lists;
+		for(size_t i = 0; i + 3 <= phrase.size(); ++i) {
+			const Trigram* trigram = find(trigrams, _trigram(phrase.data() + i));
+			if(! trigram)
+				return false;
+			lists.push_back(Cursor());
+			open(trigram->postings, trigram->count, lists.back());
+		}
+		Intersection matches(lists);
+		uint32 id;
+		while(matches.next(id))
+			ids.push_back(id);
+		return phrase.size() == 3;
+	}
+
+	/* Shorter phrases have their own lists */
+	const Trigram* gram = find(trigrams, _shortgram(phrase.data(), phrase.size()));
+	if(! gram)
+		return true;
+	Cursor cursor;
+	open(gram->postings, gram->count, cursor);
+	for(; cursor.valid(); cursor.next())
+		ids.push_back(cursor.value());
+	return true;
+}
+
+bool ShareIndex::candidates(const string& phrase, vector<uint32>& directories, vector<uint32>& files) const {
+	if(phrase.empty())
+		return true;
+	candidates(mDirectoryTrigrams, phrase, directories);
+	return candidates(mFileTrigrams, phrase, files);
+}
+
+void ShareIndex::cost(const Table<Trigram>& trigrams, const string& phrase, uint64& read, uint64& check) const {
+	if(phrase.size() >= 3) {
+		/* The intersection reads the lists, at most the shortest one
+		 * comes out of it */
+		uint64 shortest = None;
+		for(size_t i = 0; i + 3 <= phrase.size(); ++i) {
+			const Trigram* trigram = find(trigrams, _trigram(phrase.data() + i));
+			if(! trigram)
+				return;
+			read += trigram->count;
+			shortest = std::min<uint64>(shortest, trigram->count);
+		}
+		if(phrase.size() > 3)
+			check += shortest;
+		return;
+	}
+
+	const Trigram* gram = find(trigrams, _shortgram(phrase.data(), phrase.size()));
+	if(gram)
+		read += gram->count;
+}
+
+void ShareIndex::cost(const string& phrase, uint64& read, uint64& check) const {
+	if(phrase.empty())
+		return;
+	cost(mDirectoryTrigrams, phrase, read, check);
+	cost(mFileTrigrams, phrase, read, check);
+}
+
+void ShareIndex::merge(Ranges& ranges) {
+	if(! std::is_sorted(ranges.begin(), ranges.end()))
+		std::sort(ranges.begin(), ranges.end());
+	size_t out = 0;
+	for(size_t i = 0; i < ranges.size(); ++i) {
+		if(ranges[i].first >= ranges[i].second)
+			continue;
+		if(out > 0 && ranges[i].first <= ranges[out - 1].second)
+			ranges[out - 1].second = std::max(ranges[out - 1].second, ranges[i].second);
+		else
+			ranges[out++] = ranges[i];
+	}
+	ranges.resize(out);
+}
+
+void ShareIndex::intersect(const Ranges& a, const Ranges& b, Ranges& result) {
+	Ranges::const_iterator ait = a.begin(), bit = b.begin();
+	while(ait != a.end() && bit != b.end()) {
+		uint32 first = std::max(ait->first, bit->first), end = std::min(ait->second, bit->second);
+		if(first < end)
+			result.push_back(std::make_pair(first, end));
+		if(ait->second < bit->second)
+			++ait;
+		else
+			++bit;
+	}
+}
+
+bool ShareIndex::contains(const Ranges& ranges, uint32 file) {
+	Ranges::const_iterator it = std::upper_bound(ranges.begin(), ranges.end(), std::make_pair(file, None));
+	return it != ranges.begin() && file < (it - 1)->second;
+}
+
+/* The index files: a header, then the tables and the attachments, each
+ * at an offset aligned on 8 bytes. */
+#define INDEX_MAGIC "MUSIDX\r\n"
+#define INDEX_VERSION 3
+
+namespace {
+	struct IndexHeader {
+		char magic[8];
+		uint32 version;
+		uint32 order;     // 0x01020304, in the byte order of the writer
+		uint32 sizes;     // Sizes of the records, in the layout of the writer
+		uint32 shared;
+		uint32 sections;  // The tables, then the attachments
+		uint32 reserved;
+	};
+
+	struct IndexSection {
+		uint64 offset, size; // In bytes
+	};
+
+	enum { Strings, Directories, Children, Files, Attrs, Words, FileTrigrams, DirectoryTrigrams, Postings, Paths, Tables };
+}
+
+static inline uint32 _sizes(uint32 directory, uint32 file, uint32 word, uint32 trigram) {
+	return directory | (file << 8) | (word << 16) | (trigram << 24);
+}
+
+bool ShareIndex::save(const string& fn, const Attachments& attachments) const {
+	vector<std::pair<const char*, size_t> > sections;
+	sections.push_back(std::make_pair(mStrings.begin(), mStrings.size()));
+	sections.push_back(std::make_pair((const char*)mDirectories.begin(), mDirectories.size() * sizeof(Directory)));
+	sections.push_back(std::make_pair((const char*)mChildren.begin(), mChildren.size() * sizeof(uint32)));
+	sections.push_back(std::make_pair((const char*)mFiles.begin(), mFiles.size() * sizeof(File)));
+	sections.push_back(std::make_pair((const char*)mAttrs.begin(), mAttrs.size() * sizeof(uint32)));
+	sections.push_back(std::make_pair((const char*)mWords.begin(), mWords.size() * sizeof(Word)));
+	sections.push_back(std::make_pair((const char*)mFileTrigrams.begin(), mFileTrigrams.size() * sizeof(Trigram)));
+	sections.push_back(std::make_pair((const char*)mDirectoryTrigrams.begin(), mDirectoryTrigrams.size() * sizeof(Trigram)));
+	sections.push_back(std::make_pair((const char*)mPostings.begin(), mPostings.size()));
+	sections.push_back(std::make_pair((const char*)mPaths.begin(), mPaths.size() * sizeof(uint32)));
+	sections.insert(sections.end(), attachments.begin(), attachments.end());
+
+	IndexHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+	header.version = INDEX_VERSION;
+	header.order = 0x01020304;
+	header.sizes = _sizes(sizeof(Directory), sizeof(File), sizeof(Word), sizeof(Trigram));
+	header.shared = mShared;
+	header.sections = sections.size();
+
+	vector<IndexSection> table(sections.size());
+	uint64 offset = sizeof(header) + table.size() * sizeof(IndexSection);
+	for(size_t i = 0; i < sections.size(); ++i) {
+		offset = (offset + 7) & ~(uint64)7;
+		table[i].offset = offset;
+		table[i].size = sections[i].second;
+		offset += sections[i].second;
+	}
+
+	/* Written aside then renamed: whoever maps fn meanwhile keeps the
+	 * previous one */
+	string tmp = fn + ".tmp";
+	FILE* f = fopen(tmp.c_str(), "w");
+	if(! f)
+		return false;
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+	          fwrite(&table[0], sizeof(IndexSection), table.size(), f) == table.size();
+	static const char padding[8] = { 0 };
+	uint64 written = sizeof(header) + table.size() * sizeof(IndexSection);
+	for(size_t i = 0; ok && i < sections.size(); ++i) {
+		ok = fwrite(padding, 1, table[i].offset - written, f) == table[i].offset - written &&
+		     fwrite(sections[i].first, 1, sections[i].second, f) == sections[i].second;
+		written = table[i].offset + table[i].size;
+	}
+	if(fclose(f) != 0)
+		ok = false;
+	if(! ok || rename(tmp.c_str(), fn.c_str()) != 0) {
+		unlink(tmp.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool ShareIndex::map(const string& fn, Attachments& attachments) {
+	int fd = ::open(fn.c_str(), O_RDONLY);
+	if(fd == -1)
+		return false;
+	struct stat st;
+	void* mapping = MAP_FAILED;
+	if(fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(IndexHeader))
+		mapping = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if(mapping == MAP_FAILED)
+		return false;
+
+	const char* data = (const char*)mapping;
+	uint64 size = st.st_size;
+	const IndexHeader* header = (const IndexHeader*)data;
+	const IndexSection* table = (const IndexSection*)(data + sizeof(IndexHeader));
+	bool ok = memcmp(header->magic, INDEX_MAGIC, sizeof(header->magic)) == 0 && header->version == INDEX_VERSION &&
+	          header->order == 0x01020304 &&
+	          header->sizes == _sizes(sizeof(Directory), sizeof(File), sizeof(Word), sizeof(Trigram)) &&
+	          header->sections >= Tables && header->sections <= (size - sizeof(IndexHeader)) / sizeof(IndexSection);
+	static const size_t records[Tables] = { 1, sizeof(Directory), sizeof(uint32), sizeof(File), sizeof(uint32),
+	                                        sizeof(Word), sizeof(Trigram), sizeof(Trigram), 1, 2 * sizeof(uint32) };
+	for(uint32 i = 0; ok && i < header->sections; ++i)
+		ok = table[i].offset % 8 == 0 && table[i].offset <= size && table[i].size <= size - table[i].offset &&
+		     (i >= Tables || table[i].size % records[i] == 0);
+	ok = ok && table[Children].size / sizeof(uint32) == table[Directories].size / sizeof(Directory);
+	// The number of slots of the hash table has to be a power of two
+	uint64 slots = ok ? table[Paths].size / (2 * sizeof(uint32)) : 0;
+	ok = ok && (slots & (slots - 1)) == 0 && (slots > 0 || table[Files].size == 0);
+	if(! ok) {
+		munmap(mapping, size);
+		return false;
+	}
+
+	clear();
+	mMapping = mapping;
+	mMappingSize = size;
+	mStrings.point(data + table[Strings].offset, table[Strings].size);
+	mDirectories.point((const Directory*)(data + table[Directories].offset), table[Directories].size / sizeof(Directory));
+	mChildren.point((const uint32*)(data + table[Children].offset), table[Children].size / sizeof(uint32));
+	mFiles.point((const File*)(data + table[Files].offset), table[Files].size / sizeof(File));
+	mAttrs.point((const uint32*)(data + table[Attrs].offset), table[Attrs].size / sizeof(uint32));
+	mShared = header->shared;
+	mWords.point((const Word*)(data + table[Words].offset), table[Words].size / sizeof(Word));
+	mFileTrigrams.point((const Trigram*)(data + table[FileTrigrams].offset), table[FileTrigrams].size / sizeof(Trigram));
+	mDirectoryTrigrams.point((const Trigram*)(data + table[DirectoryTrigrams].offset),
+	                         table[DirectoryTrigrams].size / sizeof(Trigram));
+	mPostings.point((const unsigned char*)(data + table[Postings].offset), table[Postings].size);
+	mPaths.point((const uint32*)(data + table[Paths].offset), table[Paths].size / sizeof(uint32));
+
+	attachments.clear();
+	for(uint32 i = Tables; i < header->sections; ++i)
+		attachments.push_back(std::make_pair(data + table[i].offset, (size_t)table[i].size));
+	return true;
+}
+
+void ShareIndex::unmap() {
+	if(! mMapping)
+		return;
+	mStrings.point(0, 0);
+	mDirectories.point(0, 0);
+	mChildren.point(0, 0);
+	mFiles.point(0, 0);
+	mAttrs.point(0, 0);
+	mWords.point(0, 0);
+	mFileTrigrams.point(0, 0);
+	mDirectoryTrigrams.point(0, 0);
+	mPostings.point(0, 0);
+	mPaths.point(0, 0);
+	munmap(mMapping, mMappingSize);
+	mMapping = 0;
+	mMappingSize = 0;
+}
+
+size_t ShareIndex::memory() const {
+	return mMappingSize + mStrings.capacity() + mDirectories.capacity() * sizeof(Directory) +
+	       mChildren.capacity() * sizeof(uint32) + mFiles.capacity() * sizeof(File) +
+	       mAttrs.capacity() * sizeof(uint32) + mWords.capacity() * sizeof(Word) +
+	       (mFileTrigrams.capacity() + mDirectoryTrigrams.capacity()) * sizeof(Trigram) + mPostings.capacity() +
+	       mPaths.capacity() * sizeof(uint32);
+}
@@ -0,0 +1,320 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __SHAREINDEX_HH__
+#define __SHAREINDEX_HH__
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <museekd/mutypes.h>
+
+/* Compact index of the shared files.
+ *
+ * The tree: every string lives once in an arena. A directory is stored as
+ * its parent directory and its last path component, a file as its
+ * directory, its name and its attributes. Files are numbered densely in the
+ * order they are added, full paths are only built when needed.
+ *
+ * The words: every word maps to the sorted list of the files containing it.
+ * The lists are stored as varint encoded deltas, in blocks of BlockSize
+ * numbers with a skip table giving the first number and the offset of each
+ * block, so a cursor can jump over the parts of a list it doesn't need.
+ *
+ * The trigrams: for phrases, every three bytes of the names of the files
+ * and of the directories map to the lists of files and directories holding
+ * them, stored the same way. Every byte and every two bytes of a name have
+ * their lists too, for phrases shorter than three bytes.
+ *
+ * The paths: a hash table maps the full paths of the files, with their
+ * ASCII letters lowered, to the files, for looking them up in one go.
+ *
+ * Once finished, the index can be saved to a file and mapped back read
+ * only: every table is a flat array of fixed size records, positions are
+ * offsets, so it's searched in place. */
+class ShareIndex {
+public:
+	static const uint32 BlockSize = 128;
+	static const uint32 None = 0xffffffff;
+
+	/* Sorted disjoint ranges of file numbers, [first, end). */
+	typedef std::vector<std::pair<uint32, uint32> > Ranges;
+
+	/* Orders paths like a depth first walk of the tree would: the
+	 * separator goes before any other character. */
+	struct PathLess {
+		bool operator()(const std::string& a, const std::string& b) const;
+	};
+
+	/* Walks the list of one word in increasing order. */
+	class Cursor {
+	public:
+		Cursor() : mSkip(0), mData(0), mCount(0), mBlocks(0) { mValid = false; }
+
+		inline bool valid() const { return mValid; }
+		inline uint32 value() const { return mValue; }
+		/* Number of files in the whole list. */
+		inline uint32 count() const { return mCount; }
+
+		void next();
+		/* Move to the first value >= target. */
+		void seek(uint32 target);
+
+	private:
+		friend class ShareIndex;
+		void enter(uint32 block);
+		uint32 first(uint32 block) const;
+
+		const unsigned char *mSkip, *mData, *mPos;
+		uint32 mCount, mBlocks, mBlock, mLeft, mValue;
+		bool mValid;
+	};
+
+	/* Files found in every one of a set of lists. */
+	class Intersection {
+	public:
+		Intersection(std::vector<Cursor>& lists);
+		/* Put the next common file in id, false when there's none left. */
+		bool next(uint32& id);
+	private:
+		std::vector<Cursor>& mLists;
+		bool mStarted;
+	};
+
+	/* Other data saved along with the index, and found back in the
+	 * mapping. */
+	typedef std::vector<std::pair<const char*, size_t> > Attachments;
+
+	ShareIndex();
+	~ShareIndex();
+
+	void clear();
+
+	/* Building the tree: paths are in network encoding, separated by
+	 * backslashes. The parents of a directory are created as needed but
+	 * only the directories added themselves are shared. Add the
+	 * directories in PathLess order, and the files of a directory right
+	 * after it, sorted by name: the files below a directory are then
+	 * numbered contiguously. addFile returns the number of the file, or
+	 * None if its directory isn't the last one added. */
+	uint32 addDirectory(const std::string& path);
+	uint32 addFile(uint32 directory, const std::string& name, const FileEntry& entry);
+
+	/* Building the words: add the files in increasing id order. text is
+	 * split in words with split(). */
+	void add(uint32 id, const std::string& text);
+	/* Building the trigrams: the searchable text of the name of a file or
+	 * of the last component of a directory, in increasing id order. */
+	void addFileText(uint32 file, const std::string& text);
+	void addDirectoryText(uint32 directory, const std::string& text);
+	/* Call once everything is added, before looking anything up. */
+	void finish();
+
+	/* Write the finished index and attachments to fn, replacing it at
+	 * once. The file is only good for machines of the same kind. */
+	bool save(const std::string& fn, const Attachments& attachments) const;
+	/* Map the index saved in fn in place of this one, and point
+	 * attachments into the mapping. False if fn can't be mapped or
+	 * doesn't hold an index of this version. */
+	bool map(const std::string& fn, Attachments& attachments);
+	inline bool mapped() const { return mMapping != 0; }
+
+	inline uint32 directories() const { return mDirectories.size(); }
+	inline uint32 sharedDirectories() const { return mShared; }
+	inline uint32 files() const { return mFiles.size(); }
+	inline uint32 words() const { return mWords.size(); }
+
+	inline bool shared(uint32 directory) const { return mDirectories[directory].shared; }
+	inline uint32 parent(uint32 directory) const { return mDirectories[directory].parent; }
+	inline uint32 firstFile(uint32 directory) const { return mDirectories[directory].firstFile; }
+	inline uint32 fileCount(uint32 directory) const { return mDirectories[directory].fileCount; }
+	inline uint32 directoryOf(uint32 file) const { return mFiles[file].directory; }
+	/* The files of directory and of everything below it. */
+	inline std::pair<uint32, uint32> subtree(uint32 directory) const {
+		return std::make_pair(mDirectories[directory].firstFile, mDirectories[directory].lastFile);
+	}
+
+	std::string component(uint32 directory) const;
+	std::string directoryPath(uint32 directory) const;
+	std::string name(uint32 file) const;
+	std::string path(uint32 file) const;
+	void entry(uint32 file, FileEntry& entry) const;
+
+	/* Look a directory or a file up by its full path. */
+	bool findDirectory(const std::string& path, uint32& directory) const;
+	bool findFile(const std::string& path, uint32& file) const;
+	/* The same through the hash table of the paths, which can also ignore
+	 * the case of ASCII letters. The file added first wins. */
+	bool lookup(const std::string& path, uint32& file, bool nocase = false) const;
+	/* Append the directories right below directory to children. */
+	void children(uint32 directory, std::vector<uint32>& children) const;
+
+	/* Append directory to data the way shares replies carry it: its path,
+	 * then its files with their attributes. */
+	void network_pack(uint32 directory, std::vector<unsigned char>& data) const;
+
+	/* Point cursor at the list of word, false if no file contains it. */
+	bool find(const std::string& word, Cursor& cursor) const;
+
+	/* Directories and files whose text may contain phrase. Returns true
+	 * when they all do for sure (phrases of up to three bytes), false when
+	 * they still have to be checked. */
+	bool candidates(const std::string& phrase, std::vector<uint32>& directories, std::vector<uint32>& files) const;
+
+	/* Rough work candidates() does for phrase: read is increased by the
+	 * number of list entries it reads, check by the number of the ids it
+	 * returns that may have to be checked. */
+	void cost(const std::string& phrase, uint64& read, uint64& check) const;
+
+	/* Sort ranges and join the ones that overlap. */
+	static void merge(Ranges& ranges);
+	static void intersect(const Ranges& a, const Ranges& b, Ranges& result);
+	static bool contains(const Ranges& ranges, uint32 file);
+
+	/* Bytes used by the index once finished, or mapped. */
+	size_t memory() const;
+
+	/* Separators become spaces and ASCII letters are lowered. With special
+	 * set, '-' and '*' are kept as they start query modifiers. */
+	static inline char fold(char c, bool special = false) {
+		if(c >= 'A' && c <= 'Z')
+			return c | 32;
+		switch(c) {
+			case '/': case ' ': case ';': case ':': case '\'':
+			case '\\': case ']': case '[': case '{': case '}':
+			case '<': case '>': case ',': case '.': case '!':
+			case '@': case '#': case '$': case '%': case '^':
+			case '&': case '(': case ')': case '_': case '+':
+			case '=': case '~': case '`': case '"':
+				return ' ';
+			case '-': case '*':
+				if(! special)
+					return ' ';
+			default:
+				return c;
+		}
+	}
+
+	/* Break text up in folded words. */
+	static void split(const std::string& text, std::vector<std::string>& words);
+
+private:
+	/* A table of the index: built in memory, or pointing into the
+	 * mapping. Changed only while building. */
+	template<typename T> class Table {
+	public:
+		Table() : mData(0), mSize(0) {}
+		Table(const Table&) = delete;
+		Table& operator=(const Table&) = delete;
+
+		inline const T& operator[](size_t i) const { return mData[i]; }
+		inline size_t size() const { return mSize; }
+		inline const T* begin() const { return mData; }
+		inline const T* end() const { return mData + mSize; }
+		inline size_t capacity() const { return mOwn.capacity(); }
+
+		inline T& at(size_t i) { return mOwn[i]; }
+		inline void push_back(const T& value) { mOwn.push_back(value); sync(); }
+		template<typename I> void append(I first, I last) { mOwn.insert(mOwn.end(), first, last); sync(); }
+		inline void resize(size_t size) { mOwn.resize(size); sync(); }
+		inline void reserve(size_t size) { mOwn.reserve(size); sync(); }
+		inline void swap(std::vector<T>& other) { mOwn.swap(other); sync(); }
+		inline void shrink() { std::vector<T>(mOwn).swap(mOwn); sync(); }
+		inline void clear() { std::vector<T>().swap(mOwn); sync(); }
+		inline void point(const T* data, size_t size) { clear(); mData = data; mSize = size; }
+
+	private:
+		inline void sync() { mData = mOwn.empty() ? 0 : &mOwn[0]; mSize = mOwn.size(); }
+
+		std::vector<T> mOwn;
+		const T* mData;
+		size_t mSize;
+	};
+
+	struct Directory {
+		uint32 parent;            // None for the roots
+		uint32 name, nameLength;  // Last component, position in mStrings
+		uint32 firstFile, fileCount;
+		uint32 lastFile;          // End of the files below it
+		uint32 shared;
+	};
+
+	struct File {
+		uint64 size;
+		uint32 directory;
+		uint32 name, nameLength;  // Position in mStrings
+		uint32 ext;               // Position in mStrings
+		uint32 attrs;             // Position in mAttrs
+		uint16_t extLength, attrCount;
+	};
+
+	struct Word {
+		uint32 text, length; // Position in mStrings
+		uint32 postings, count; // Position in mPostings, number of files
+	};
+
+	struct Trigram {
+		uint32 key; // The three bytes, or the length and the one or two bytes
+		uint32 postings, count;
+	};
+
+	typedef std::unordered_map<uint32, std::vector<uint32> > PendingTrigrams;
+
+	struct ChildOrder;
+
+	uint32 intern(const std::string& text);
+	uint32 store(const std::string& text);
+	int compare(uint32 text, uint32 length, const char* other, size_t otherLength) const;
+	bool findChild(uint32 parent, const char* name, size_t length, uint32& child) const;
+	void encode(const std::vector<uint32>& ids);
+	void addText(PendingTrigrams& pending, uint32 id, const std::string& text);
+	void encode(PendingTrigrams& pending, Table<Trigram>& trigrams);
+	void open(uint32 postings, uint32 count, Cursor& cursor) const;
+	const Trigram* find(const Table<Trigram>& trigrams, uint32 key) const;
+	bool candidates(const Table<Trigram>& trigrams, const std::string& phrase, std::vector<uint32>& ids) const;
+	void cost(const Table<Trigram>& trigrams, const std::string& phrase, uint64& read, uint64& check) const;
+	void hashPaths();
+	bool matches(uint32 file, const std::string& path, bool nocase) const;
+	void unmap();
+
+	// Only used while building
+	std::unordered_map<std::string, std::vector<uint32> > mPending;
+	std::unordered_map<std::string, uint32> mInterned;
+	std::unordered_map<std::string, uint32> mPendingDirectories;
+	PendingTrigrams mPendingFileTrigrams, mPendingDirectoryTrigrams;
+
+	Table<char> mStrings;
+	Table<Directory> mDirectories;
+	Table<uint32> mChildren; // Directories sorted by parent and name
+	Table<File> mFiles;
+	Table<uint32> mAttrs;
+	uint32 mShared;
+	Table<Word> mWords; // Sorted by text
+	Table<Trigram> mFileTrigrams, mDirectoryTrigrams; // Sorted by key
+	Table<unsigned char> mPostings;
+	Table<uint32> mPaths; // Pairs of hash and file, None when empty
+
+	// The file the tables point into, when mapped
+	void* mMapping;
+	size_t mMappingSize;
+};
+
+#endif // __SHAREINDEX_HH__
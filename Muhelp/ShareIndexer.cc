@@ -0,0 +1,237 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+
+#include <system.h>
+
+#include <Muhelp/ShareIndexer.hh>
+#include <Muhelp/string_ext.hh>
+#include <Muhelp/UnicodeFold.hh>
+
+#include <NewNet/nnlog.h>
+#include <NewNet/nnpath.h>
+
+#include <map>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+
+using std::string;
+using std::vector;
+
+typedef std::map<string, const DirEntry*, ShareIndex::PathLess> SortedFolders;
+
+ShareIndexer::ShareIndexer(const string& filesystem, const string& network)
+	: mFilesystem(filesystem), mNetwork(network), mToNet(filesystem, network), mFromNet(network, "UTF-8") {
+}
+
+void ShareIndexer::build(const DirEntry& folded, ShareIndex& index, StringList* skipped) {
+	Codec codec(mNetwork, "UTF-8");
+
+	/* Recode the folders first: two of them may end up with the same name
+	 * in network encoding, keep the last one like before. */
+	SortedFolders folders;
+	std::map<string, DirEntry*>::const_iterator it = folded.folders.begin();
+	for(; it != folded.folders.end(); ++it) {
+		string folder = mToNet.convertLossy(str_replace((*it).first, NewNet::Path::separator(), '\\'));
+		if(folder.empty()) {
+			if(skipped)
+				skipped->push_back((*it).first);
+			else
+				NNLOG("museekd.shares.warn", "Couldn't transcode '%s' to network encoding", (*it).first.c_str());
+			continue;
+		}
+		folders[folder] = (*it).second;
+	}
+
+	// Number the files and index the words of their paths (used for searching)
+	SortedFolders::const_iterator dit = folders.begin();
+	for(; dit != folders.end(); ++dit) {
+		Folder files;
+		Folder::const_iterator fit = (*dit).second->files.begin();
+		for(; fit != (*dit).second->files.end(); ++fit) {
+			string name = mToNet.convertLossy((*fit).first);
+			if(name.empty()) {
+				if(skipped)
+					skipped->push_back((*fit).first);
+				else
+					NNLOG("museekd.shares.warn", "Couldn't transcode '%s' to network encoding", (*fit).first.c_str());
+				continue;
+			}
+			files[name] = (*fit).second;
+		}
+
+		uint32 directory = index.addDirectory((*dit).first);
+		for(fit = files.begin(); fit != files.end(); ++fit) {
+			uint32 id = index.addFile(directory, (*fit).first, (*fit).second);
+			index.add(id, fold(mFromNet.convertLossy((*dit).first + '\\' + (*fit).first)));
+			index.addFileText(id, searchable(codec, (*fit).first));
+		}
+	}
+	for(uint32 d = 0; d < index.directories(); ++d)
+		index.addDirectoryText(d, searchable(codec, index.component(d)));
+	index.finish();
+}
+
+string ShareIndexer::searchable(Codec& codec, const string& name) {
+	return fold(codec.convert(name));
+}
+
+/* Deflate data at the end of compressed, growing it as needed. */
+static bool _deflate(z_stream& z, vector<unsigned char>& data, vector<unsigned char>& compressed, int flush) {
+	z.next_in = data.empty() ? Z_NULL : &data[0];
+	z.avail_in = data.size();
+	while(true) {
+		if(z.total_out == compressed.size())
+			compressed.resize(compressed.size() * 2);
+		z.next_out = &compressed[z.total_out];
+		z.avail_out = compressed.size() - z.total_out;
+		int r = deflate(&z, flush);
+		if(r == Z_STREAM_END)
+			break;
+		if(r != Z_OK && r != Z_BUF_ERROR)
+			return false;
+		if(flush == Z_NO_FLUSH && z.avail_in == 0 && z.avail_out > 0)
+			break;
+	}
+	data.clear();
+	return true;
+}
+
+static inline void _pack(vector<unsigned char>& data, uint32 i) {
+	for(uint j = 0; j < 4; j++)
+		data.push_back((i >> (j * 8)) & 0xff);
+}
+
+/* The folders are packed one at a time after data and deflated as they
+ * come, only the compressed reply is ever whole. */
+static bool _compress(const ShareIndex& index, vector<unsigned char>& data, const vector<uint32>& directories,
+                      vector<unsigned char>& compressed) {
+	z_stream z;
+	memset(&z, 0, sizeof(z));
+	if(deflateInit(&z, Z_DEFAULT_COMPRESSION) != Z_OK) {
+		compressed.clear();
+		return false;
+	}
+	compressed.resize(65536);
+
+	bool ok = true;
+	vector<uint32>::const_iterator it = directories.begin();
+	for(; ok && it != directories.end(); ++it) {
+		index.network_pack(*it, data);
+		if(data.size() >= 65536)
+			ok = _deflate(z, data, compressed, Z_NO_FLUSH);
+	}
+	ok = ok && _deflate(z, data, compressed, Z_FINISH);
+	compressed.resize(ok ? z.total_out : 0);
+	deflateEnd(&z);
+
+	// Kept for a while, don't keep the spare room too
+	vector<unsigned char>(compressed).swap(compressed);
+	return ok;
+}
+
+bool ShareIndexer::compress(const ShareIndex& index, vector<unsigned char>& compressed) {
+	vector<uint32> directories;
+	directories.reserve(index.sharedDirectories());
+	for(uint32 d = 0; d < index.directories(); ++d)
+		if(index.shared(d))
+			directories.push_back(d);
+
+	vector<unsigned char> data;
+	_pack(data, directories.size());
+	return _compress(index, data, directories, compressed);
+}
+
+bool ShareIndexer::compress(const ShareIndex& index, const string& folder, const vector<uint32>& directories,
+                            vector<unsigned char>& compressed) {
+	vector<unsigned char> data;
+	_pack(data, 1);
+	// Echoed the way the request spelled it
+	_pack(data, folder.size());
+	data.insert(data.end(), folder.begin(), folder.end());
+	_pack(data, directories.size());
+	return _compress(index, data, directories, compressed);
+}
+
+/* What an index is only good for: a version of the database, the
+ * encodings, and the table the words were folded with. */
+string ShareIndexer::tag(const ShareDelta::Stamp& stamp) const {
+	char buf[64];
+	snprintf(buf, sizeof(buf), "%llu %llu %d ", (unsigned long long)stamp.size, (unsigned long long)stamp.mtime,
+	         FOLD_VERSION);
+	return buf + mFilesystem + ' ' + mNetwork;
+}
+
+bool ShareIndexer::save(const string& db, const DirEntry& folded) {
+	NNLOG("museek.shareindexer", "save index %s.index", db.c_str());
+
+	string fn = db + ".index";
+	ShareDelta::Stamp stamp = ShareDelta::stamp(db);
+	if(! stamp.valid()) {
+		unlink(fn.c_str());
+		return false;
+	}
+
+	ShareIndex index;
+	build(folded, index);
+	vector<unsigned char> reply;
+	if(! compress(index, reply)) {
+		unlink(fn.c_str());
+		return false;
+	}
+
+	string header = tag(stamp);
+	ShareIndex::Attachments attachments;
+	attachments.push_back(std::make_pair(header.data(), header.size()));
+	attachments.push_back(std::make_pair((const char*)&reply[0], reply.size()));
+	if(! index.save(fn, attachments)) {
+		unlink(fn.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool ShareIndexer::map(const string& db, ShareIndex& index, const unsigned char*& reply, size_t& replySize) {
+	ShareDelta::Stamp stamp = ShareDelta::stamp(db);
+	if(! stamp.valid())
+		return false;
+
+	ShareIndex::Attachments attachments;
+	if(! index.map(db + ".index", attachments))
+		return false;
+
+	/* Left by an older muscan, or with other encodings */
+	string header = tag(stamp);
+	if(attachments.size() < 2 || attachments[0].second != header.size() ||
+	   memcmp(attachments[0].first, header.data(), header.size()) != 0) {
+		NNLOG("museek.shareindexer", "%s.index doesn't match %s", db.c_str(), db.c_str());
+		index.clear();
+		return false;
+	}
+
+	reply = (const unsigned char*)attachments[1].first;
+	replySize = attachments[1].second;
+	return true;
+}
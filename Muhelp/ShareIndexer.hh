@@ -0,0 +1,73 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __SHAREINDEXER_HH__
+#define __SHAREINDEXER_HH__
+
+#include <string>
+#include <vector>
+
+#include <Muhelp/Codec.hh>
+#include <Muhelp/DirEntry.hh>
+#include <Muhelp/ShareIndex.hh>
+
+/* Indexes a folded shares database the way museekd searches it. muscan
+ * saves the index next to the database, in <database>.index, along with
+ * the compressed reply to browse requests, and museekd maps it instead of
+ * loading the database and building the index again. Names go from the
+ * filesystem encoding to the network one, so an index only holds for the
+ * encodings it was built with. */
+class ShareIndexer {
+public:
+	ShareIndexer(const std::string& filesystem, const std::string& network);
+
+	/* Index the folders of folded. Names that can't be recoded are left
+	 * out and logged, or added to skipped when given (the log is only for
+	 * the main thread). The words of the paths are folded with fold()
+	 * first. */
+	void build(const DirEntry& folded, ShareIndex& index, StringList* skipped = 0);
+
+	/* Index the database db, just saved from folded, and save it with
+	 * its browse reply in db.index. */
+	bool save(const std::string& db, const DirEntry& folded);
+	/* Map db.index in index if it was made from the current version of db
+	 * with the same encodings. reply then points to the browse reply in
+	 * the mapping. index is left empty when it's not. */
+	bool map(const std::string& db, ShareIndex& index, const unsigned char*& reply, size_t& replySize);
+
+	/* Text of a name as phrases are looked for in it: in UTF-8, folded.
+	 * codec converts from the network encoding. */
+	static std::string searchable(Codec& codec, const std::string& name);
+	/* Pack the shared directories of index the way a browse reply holds
+	 * them, and compress them. */
+	static bool compress(const ShareIndex& index, std::vector<unsigned char>& compressed);
+	/* The same for a folder contents reply to a request for folder: the
+	 * given directories, sorted, are the shared ones in and below it. */
+	static bool compress(const ShareIndex& index, const std::string& folder, const std::vector<uint32>& directories,
+	                     std::vector<unsigned char>& compressed);
+
+private:
+	std::string tag(const ShareDelta::Stamp& stamp) const;
+
+	std::string mFilesystem, mNetwork;
+	Codec mToNet, mFromNet;
+};
+
+#endif // __SHAREINDEXER_HH__
@@ -0,0 +1,91 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <Muhelp/UnicodeFold.hh>
+
+#include <algorithm>
+
+namespace {
+	struct FoldEntry {
+		unsigned int code;
+		unsigned short offset; // In _fold_pool
+		unsigned char length;
+	};
+
+	inline bool operator<(const FoldEntry& entry, unsigned int code) {
+		return entry.code < code;
+	}
+}
+
+#include "UnicodeFoldTable.hh"
+
+static const FoldEntry* const _fold_end = _fold_table + sizeof(_fold_table) / sizeof(_fold_table[0]);
+
+/* Length of the character starting with lead, 0 if it can't start one. */
+static inline size_t _length(unsigned char lead) {
+	if(lead < 0xc2)
+		return 0;
+	if(lead < 0xe0)
+		return 2;
+	if(lead < 0xf0)
+		return 3;
+	if(lead < 0xf5)
+		return 4;
+	return 0;
+}
+
+std::string fold(const std::string& text) {
+	std::string folded;
+	folded.reserve(text.size());
+	const unsigned char* p = (const unsigned char*)text.data();
+	const unsigned char* end = p + text.size();
+	while(p < end) {
+		unsigned char c = *p;
+		if(c < 0x80) {
+			folded += (c >= 'A' && c <= 'Z') ? c | 32 : c;
+			++p;
+			continue;
+		}
+
+		// Decode the character, copy the byte alone when it isn't one
+		size_t length = _length(c);
+		unsigned int code = length ? c & (0x7f >> length) : 0;
+		for(size_t i = 1; i < length; ++i) {
+			if(p + i >= end || (p[i] & 0xc0) != 0x80) {
+				length = 0;
+				break;
+			}
+			code = (code << 6) | (p[i] & 0x3f);
+		}
+		if(! length) {
+			folded += c;
+			++p;
+			continue;
+		}
+
+		const FoldEntry* entry = std::lower_bound(_fold_table, _fold_end, code);
+		if(entry != _fold_end && entry->code == code)
+			folded.append(_fold_pool + entry->offset, entry->length);
+		else
+			folded.append((const char*)p, length);
+		p += length;
+	}
+	return folded;
+}
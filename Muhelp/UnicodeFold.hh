@@ -0,0 +1,36 @@
+/* Muhelp - Helper library for Museek
+ *
+ * Copyright (C) 2003-2004 Hyriand <hyriand@thegraveyard.org>
+ * Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __UNICODEFOLD_HH__
+#define __UNICODEFOLD_HH__
+
+#include <string>
+
+/* Version of the table below, kept along with what was folded with it. */
+#define FOLD_VERSION 1
+
+/* Fold UTF-8 text the way names are indexed and queries looked up: every
+ * character goes to its NFKC form, case folded fully, without accents, so
+ * "Ｃafé", "CAFE" and "café" all give "cafe". Characters are folded one by
+ * one from a table made by scripts/unicodefold, what isn't valid UTF-8 is
+ * left alone. */
+std::string fold(const std::string& text);
+
+#endif // __UNICODEFOLD_HH__
@@ -0,0 +1,7520 @@
+/* Generated by scripts/unicodefold from Unicode 14.0.0, do not edit. */
+
+static const char _fold_pool[] =
+	"\x20\x61\x32\x33\xce\xbc\x31\x6f\x31\xe2\x81\x84\x34\x31\xe2\x81"
+	"\x84\x32\x33\xe2\x81\x84\x34\xc3\xa6\x63\x65\x69\xc3\xb0\x6e\xc3"
+	"\xb8\x75\x79\xc3\xbe\x73\x73\x64\xc4\x91\x67\x68\xc4\xa7\x69\x6a"
+	"\x6a\x6b\x6c\x6c\xc2\xb7\xc5\x82\xca\xbc\x6e\xc5\x8b\xc5\x93\x72"
+	"\x73\x74\xc5\xa7\x77\x7a\xc9\x93\xc6\x83\xc6\x85\xc9\x94\xc6\x88"
+	"\xc9\x96\xc9\x97\xc6\x8c\xc7\x9d\xc9\x99\xc9\x9b\xc6\x92\xc9\xa0"
+	"\xc9\xa3\xc9\xa9\xc9\xa8\xc6\x99\xc9\xaf\xc9\xb2\xc9\xb5\xc6\xa3"
+	"\xc6\xa5\xca\x80\xc6\xa8\xca\x83\xc6\xad\xca\x88\xca\x8a\xca\x8b"
+	"\xc6\xb4\xc6\xb6\xca\x92\xc6\xb9\xc6\xbd\x64\x7a\x6c\x6a\x6e\x6a"
+	"\xc7\xa5\xc6\x95\xc6\xbf\xc8\x9d\xc6\x9e\xc8\xa3\xc8\xa5\xe2\xb1"
+	"\xa5\xc8\xbc\xc6\x9a\xe2\xb1\xa6\xc9\x82\xc6\x80\xca\x89\xca\x8c"
+	"\xc9\x87\xc9\x89\xc9\x8b\xc9\x8d\xc9\x8f\xc9\xa6\xc9\xb9\xc9\xbb"
+	"\xca\x81\x78\xca\x95\xce\xb9\xcd\xb1\xcd\xb3\xca\xb9\xcd\xb7\x20"
+	"\xce\xb9\x3b\xcf\xb3\xce\xb1\xc2\xb7\xce\xb5\xce\xb7\xce\xbf\xcf"
+	"\x85\xcf\x89\xce\xb2\xce\xb3\xce\xb4\xce\xb6\xce\xb8\xce\xba\xce"
+	"\xbb\xce\xbd\xce\xbe\xcf\x80\xcf\x81\xcf\x83\xcf\x84\xcf\x86\xcf"
+	"\x87\xcf\x88\xcf\x97\xcf\x99\xcf\x9b\xcf\x9d\xcf\x9f\xcf\xa1\xcf"
+	"\xa3\xcf\xa5\xcf\xa7\xcf\xa9\xcf\xab\xcf\xad\xcf\xaf\xcf\xb8\xcf"
+	"\xbb\xcd\xbb\xcd\xbc\xcd\xbd\xd0\xb5\xd1\x92\xd0\xb3\xd1\x94\xd1"
+	"\x95\xd1\x96\xd1\x98\xd1\x99\xd1\x9a\xd1\x9b\xd0\xba\xd0\xb8\xd1"
+	"\x83\xd1\x9f\xd0\xb0\xd0\xb1\xd0\xb2\xd0\xb4\xd0\xb6\xd0\xb7\xd0"
+	"\xbb\xd0\xbc\xd0\xbd\xd0\xbe\xd0\xbf\xd1\x80\xd1\x81\xd1\x82\xd1"
+	"\x84\xd1\x85\xd1\x86\xd1\x87\xd1\x88\xd1\x89\xd1\x8a\xd1\x8b\xd1"
+	"\x8c\xd1\x8d\xd1\x8e\xd1\x8f\xd1\xa1\xd1\xa3\xd1\xa5\xd1\xa7\xd1"
+	"\xa9\xd1\xab\xd1\xad\xd1\xaf\xd1\xb1\xd1\xb3\xd1\xb5\xd1\xb9\xd1"
+	"\xbb\xd1\xbd\xd1\xbf\xd2\x81\xd2\x8b\xd2\x8d\xd2\x8f\xd2\x91\xd2"
+	"\x93\xd2\x95\xd2\x97\xd2\x99\xd2\x9b\xd2\x9d\xd2\x9f\xd2\xa1\xd2"
+	"\xa3\xd2\xa5\xd2\xa7\xd2\xa9\xd2\xab\xd2\xad\xd2\xaf\xd2\xb1\xd2"
+	"\xb3\xd2\xb5\xd2\xb7\xd2\xb9\xd2\xbb\xd2\xbd\xd2\xbf\xd3\x8f\xd3"
+	"\x84\xd3\x86\xd3\x88\xd3\x8a\xd3\x8c\xd3\x8e\xd3\x95\xd3\x99\xd3"
+	"\xa1\xd3\xa9\xd3\xb7\xd3\xbb\xd3\xbd\xd3\xbf\xd4\x81\xd4\x83\xd4"
+	"\x85\xd4\x87\xd4\x89\xd4\x8b\xd4\x8d\xd4\x8f\xd4\x91\xd4\x93\xd4"
+	"\x95\xd4\x97\xd4\x99\xd4\x9b\xd4\x9d\xd4\x9f\xd4\xa1\xd4\xa3\xd4"
+	"\xa5\xd4\xa7\xd4\xa9\xd4\xab\xd4\xad\xd4\xaf\xd5\xa1\xd5\xa2\xd5"
+	"\xa3\xd5\xa4\xd5\xa5\xd5\xa6\xd5\xa7\xd5\xa8\xd5\xa9\xd5\xaa\xd5"
+	"\xab\xd5\xac\xd5\xad\xd5\xae\xd5\xaf\xd5\xb0\xd5\xb1\xd5\xb2\xd5"
+	"\xb3\xd5\xb4\xd5\xb5\xd5\xb6\xd5\xb7\xd5\xb8\xd5\xb9\xd5\xba\xd5"
+	"\xbb\xd5\xbc\xd5\xbd\xd5\xbe\xd5\xbf\xd6\x80\xd6\x81\xd6\x82\xd6"
+	"\x83\xd6\x84\xd6\x85\xd6\x86\xd5\xa5\xd6\x82\xd8\xa7\xd9\xb4\xd9"
+	"\x88\xd9\xb4\xdb\x87\xd9\xb4\xd9\x8a\xd9\xb4\xe0\xa4\x95\xe0\xa4"
+	"\xbc\xe0\xa4\x96\xe0\xa4\xbc\xe0\xa4\x97\xe0\xa4\xbc\xe0\xa4\x9c"
+	"\xe0\xa4\xbc\xe0\xa4\xa1\xe0\xa4\xbc\xe0\xa4\xa2\xe0\xa4\xbc\xe0"
+	"\xa4\xab\xe0\xa4\xbc\xe0\xa4\xaf\xe0\xa4\xbc\xe0\xa6\xa1\xe0\xa6"
+	"\xbc\xe0\xa6\xa2\xe0\xa6\xbc\xe0\xa6\xaf\xe0\xa6\xbc\xe0\xa8\xb2"
+	"\xe0\xa8\xbc\xe0\xa8\xb8\xe0\xa8\xbc\xe0\xa8\x96\xe0\xa8\xbc\xe0"
+	"\xa8\x97\xe0\xa8\xbc\xe0\xa8\x9c\xe0\xa8\xbc\xe0\xa8\xab\xe0\xa8"
+	"\xbc\xe0\xac\xa1\xe0\xac\xbc\xe0\xac\xa2\xe0\xac\xbc\xe0\xb9\x8d"
+	"\xe0\xb8\xb2\xe0\xbb\x8d\xe0\xba\xb2\xe0\xba\xab\xe0\xba\x99\xe0"
+	"\xba\xab\xe0\xba\xa1\xe0\xbc\x8b\xe0\xbd\x82\xe0\xbe\xb7\xe0\xbd"
+	"\x8c\xe0\xbe\xb7\xe0\xbd\x91\xe0\xbe\xb7\xe0\xbd\x96\xe0\xbe\xb7"
+	"\xe0\xbd\x9b\xe0\xbe\xb7\xe0\xbd\x80\xe0\xbe\xb5\xe0\xbd\xb1\xe0"
+	"\xbd\xb2\xe0\xbd\xb1\xe0\xbd\xb4\xe0\xbe\xb2\xe0\xbe\x80\xe0\xbe"
+	"\xb2\xe0\xbd\xb1\xe0\xbe\x80\xe0\xbe\xb3\xe0\xbe\x80\xe0\xbe\xb3"
+	"\xe0\xbd\xb1\xe0\xbe\x80\xe0\xbd\xb1\xe0\xbe\x80\xe0\xbe\x92\xe0"
+	"\xbe\xb7\xe0\xbe\x9c\xe0\xbe\xb7\xe0\xbe\xa1\xe0\xbe\xb7\xe0\xbe"
+	"\xa6\xe0\xbe\xb7\xe0\xbe\xab\xe0\xbe\xb7\xe0\xbe\x90\xe0\xbe\xb5"
+	"\xe2\xb4\x80\xe2\xb4\x81\xe2\xb4\x82\xe2\xb4\x83\xe2\xb4\x84\xe2"
+	"\xb4\x85\xe2\xb4\x86\xe2\xb4\x87\xe2\xb4\x88\xe2\xb4\x89\xe2\xb4"
+	"\x8a\xe2\xb4\x8b\xe2\xb4\x8c\xe2\xb4\x8d\xe2\xb4\x8e\xe2\xb4\x8f"
+	"\xe2\xb4\x90\xe2\xb4\x91\xe2\xb4\x92\xe2\xb4\x93\xe2\xb4\x94\xe2"
+	"\xb4\x95\xe2\xb4\x96\xe2\xb4\x97\xe2\xb4\x98\xe2\xb4\x99\xe2\xb4"
+	"\x9a\xe2\xb4\x9b\xe2\xb4\x9c\xe2\xb4\x9d\xe2\xb4\x9e\xe2\xb4\x9f"
+	"\xe2\xb4\xa0\xe2\xb4\xa1\xe2\xb4\xa2\xe2\xb4\xa3\xe2\xb4\xa4\xe2"
+	"\xb4\xa5\xe2\xb4\xa7\xe2\xb4\xad\xe1\x83\x9c\xe1\x8f\xb0\xe1\x8f"
+	"\xb1\xe1\x8f\xb2\xe1\x8f\xb3\xe1\x8f\xb4\xe1\x8f\xb5\xea\x99\x8b"
+	"\xe1\x83\x90\xe1\x83\x91\xe1\x83\x92\xe1\x83\x93\xe1\x83\x94\xe1"
+	"\x83\x95\xe1\x83\x96\xe1\x83\x97\xe1\x83\x98\xe1\x83\x99\xe1\x83"
+	"\x9a\xe1\x83\x9b\xe1\x83\x9d\xe1\x83\x9e\xe1\x83\x9f\xe1\x83\xa0"
+	"\xe1\x83\xa1\xe1\x83\xa2\xe1\x83\xa3\xe1\x83\xa4\xe1\x83\xa5\xe1"
+	"\x83\xa6\xe1\x83\xa7\xe1\x83\xa8\xe1\x83\xa9\xe1\x83\xaa\xe1\x83"
+	"\xab\xe1\x83\xac\xe1\x83\xad\xe1\x83\xae\xe1\x83\xaf\xe1\x83\xb0"
+	"\xe1\x83\xb1\xe1\x83\xb2\xe1\x83\xb3\xe1\x83\xb4\xe1\x83\xb5\xe1"
+	"\x83\xb6\xe1\x83\xb7\xe1\x83\xb8\xe1\x83\xb9\xe1\x83\xba\xe1\x83"
+	"\xbd\xe1\x83\xbe\xe1\x83\xbf\x62\x6d\x70\xc9\x90\xc9\x91\xe1\xb4"
+	"\x82\xc9\x9c\xe1\xb4\x96\xe1\xb4\x97\xe1\xb4\x9d\x76\xe1\xb4\xa5"
+	"\xc9\x92\xc9\x95\x66\xc9\x9f\xc9\xa1\xc9\xa5\xc9\xaa\xe1\xb5\xbb"
+	"\xca\x9d\xc9\xad\xe1\xb6\x85\xca\x9f\xc9\xb1\xc9\xb0\xc9\xb3\xc9"
+	"\xb4\xc9\xb8\xca\x82\xc6\xab\xe1\xb4\x9c\xca\x90\xca\x91\x61\xca"
+	"\xbe\xe1\xbb\xbb\xe1\xbb\xbd\xe1\xbb\xbf\xce\xb1\xce\xb9\xce\xb7"
+	"\xce\xb9\xcf\x89\xce\xb9\x60\xe2\x80\x90\x2e\x2e\x2e\x2e\x2e\x2e"
+	"\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2"
+	"\x80\xb5\xe2\x80\xb5\xe2\x80\xb5\xe2\x80\xb5\xe2\x80\xb5\x21\x21"
+	"\x3f\x3f\x3f\x21\x21\x3f\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2"
+	"\x80\xb2\x30\x34\x35\x36\x37\x38\x39\x2b\xe2\x88\x92\x3d\x28\x29"
+	"\x72\x73\x61\x2f\x63\x61\x2f\x73\xc2\xb0\x63\x63\x2f\x6f\x63\x2f"
+	"\x75\xc2\xb0\x66\x6e\x6f\x71\x73\x6d\x74\x65\x6c\x74\x6d\xe2\x85"
+	"\x8e\xd7\x90\xd7\x91\xd7\x92\xd7\x93\x66\x61\x78\xe2\x88\x91\x31"
+	"\xe2\x81\x84\x37\x31\xe2\x81\x84\x39\x31\xe2\x81\x84\x31\x30\x31"
+	"\xe2\x81\x84\x33\x32\xe2\x81\x84\x33\x31\xe2\x81\x84\x35\x32\xe2"
+	"\x81\x84\x35\x33\xe2\x81\x84\x35\x34\xe2\x81\x84\x35\x31\xe2\x81"
+	"\x84\x36\x35\xe2\x81\x84\x36\x31\xe2\x81\x84\x38\x33\xe2\x81\x84"
+	"\x38\x35\xe2\x81\x84\x38\x37\xe2\x81\x84\x38\x31\xe2\x81\x84\x69"
+	"\x69\x69\x69\x69\x69\x76\x76\x69\x76\x69\x69\x76\x69\x69\x69\x69"
+	"\x78\x78\x69\x78\x69\x69\xe2\x86\x84\x30\xe2\x81\x84\x33\xe2\x86"
+	"\x90\xe2\x86\x92\xe2\x86\x94\xe2\x87\x90\xe2\x87\x94\xe2\x87\x92"
+	"\xe2\x88\x83\xe2\x88\x88\xe2\x88\x8b\xe2\x88\xa3\xe2\x88\xa5\xe2"
+	"\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88"
+	"\xae\xe2\x88\xae\xe2\x88\xae\xe2\x88\xae\xe2\x88\xae\xe2\x88\xbc"
+	"\xe2\x89\x83\xe2\x89\x85\xe2\x89\x88\xe2\x89\xa1\xe2\x89\x8d\x3c"
+	"\x3e\xe2\x89\xa4\xe2\x89\xa5\xe2\x89\xb2\xe2\x89\xb3\xe2\x89\xb6"
+	"\xe2\x89\xb7\xe2\x89\xba\xe2\x89\xbb\xe2\x8a\x82\xe2\x8a\x83\xe2"
+	"\x8a\x86\xe2\x8a\x87\xe2\x8a\xa2\xe2\x8a\xa8\xe2\x8a\xa9\xe2\x8a"
+	"\xab\xe2\x89\xbc\xe2\x89\xbd\xe2\x8a\x91\xe2\x8a\x92\xe2\x8a\xb2"
+	"\xe2\x8a\xb3\xe2\x8a\xb4\xe2\x8a\xb5\xe3\x80\x88\xe3\x80\x89\x31"
+	"\x30\x31\x31\x31\x32\x31\x33\x31\x34\x31\x35\x31\x36\x31\x37\x31"
+	"\x38\x31\x39\x32\x30\x28\x31\x29\x28\x32\x29\x28\x33\x29\x28\x34"
+	"\x29\x28\x35\x29\x28\x36\x29\x28\x37\x29\x28\x38\x29\x28\x39\x29"
+	"\x28\x31\x30\x29\x28\x31\x31\x29\x28\x31\x32\x29\x28\x31\x33\x29"
+	"\x28\x31\x34\x29\x28\x31\x35\x29\x28\x31\x36\x29\x28\x31\x37\x29"
+	"\x28\x31\x38\x29\x28\x31\x39\x29\x28\x32\x30\x29\x31\x2e\x32\x2e"
+	"\x33\x2e\x34\x2e\x35\x2e\x36\x2e\x37\x2e\x38\x2e\x39\x2e\x31\x30"
+	"\x2e\x31\x31\x2e\x31\x32\x2e\x31\x33\x2e\x31\x34\x2e\x31\x35\x2e"
+	"\x31\x36\x2e\x31\x37\x2e\x31\x38\x2e\x31\x39\x2e\x32\x30\x2e\x28"
+	"\x61\x29\x28\x62\x29\x28\x63\x29\x28\x64\x29\x28\x65\x29\x28\x66"
+	"\x29\x28\x67\x29\x28\x68\x29\x28\x69\x29\x28\x6a\x29\x28\x6b\x29"
+	"\x28\x6c\x29\x28\x6d\x29\x28\x6e\x29\x28\x6f\x29\x28\x70\x29\x28"
+	"\x71\x29\x28\x72\x29\x28\x73\x29\x28\x74\x29\x28\x75\x29\x28\x76"
+	"\x29\x28\x77\x29\x28\x78\x29\x28\x79\x29\x28\x7a\x29\xe2\x88\xab"
+	"\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\x3a\x3a\x3d\x3d\x3d\x3d\x3d"
+	"\x3d\xe2\xab\x9d\xe2\xb0\xb0\xe2\xb0\xb1\xe2\xb0\xb2\xe2\xb0\xb3"
+	"\xe2\xb0\xb4\xe2\xb0\xb5\xe2\xb0\xb6\xe2\xb0\xb7\xe2\xb0\xb8\xe2"
+	"\xb0\xb9\xe2\xb0\xba\xe2\xb0\xbb\xe2\xb0\xbc\xe2\xb0\xbd\xe2\xb0"
+	"\xbe\xe2\xb0\xbf\xe2\xb1\x80\xe2\xb1\x81\xe2\xb1\x82\xe2\xb1\x83"
+	"\xe2\xb1\x84\xe2\xb1\x85\xe2\xb1\x86\xe2\xb1\x87\xe2\xb1\x88\xe2"
+	"\xb1\x89\xe2\xb1\x8a\xe2\xb1\x8b\xe2\xb1\x8c\xe2\xb1\x8d\xe2\xb1"
+	"\x8e\xe2\xb1\x8f\xe2\xb1\x90\xe2\xb1\x91\xe2\xb1\x92\xe2\xb1\x93"
+	"\xe2\xb1\x94\xe2\xb1\x95\xe2\xb1\x96\xe2\xb1\x97\xe2\xb1\x98\xe2"
+	"\xb1\x99\xe2\xb1\x9a\xe2\xb1\x9b\xe2\xb1\x9c\xe2\xb1\x9d\xe2\xb1"
+	"\x9e\xe2\xb1\x9f\xe2\xb1\xa1\xc9\xab\xe1\xb5\xbd\xc9\xbd\xe2\xb1"
+	"\xa8\xe2\xb1\xaa\xe2\xb1\xac\xe2\xb1\xb3\xe2\xb1\xb6\xc8\xbf\xc9"
+	"\x80\xe2\xb2\x81\xe2\xb2\x83\xe2\xb2\x85\xe2\xb2\x87\xe2\xb2\x89"
+	"\xe2\xb2\x8b\xe2\xb2\x8d\xe2\xb2\x8f\xe2\xb2\x91\xe2\xb2\x93\xe2"
+	"\xb2\x95\xe2\xb2\x97\xe2\xb2\x99\xe2\xb2\x9b\xe2\xb2\x9d\xe2\xb2"
+	"\x9f\xe2\xb2\xa1\xe2\xb2\xa3\xe2\xb2\xa5\xe2\xb2\xa7\xe2\xb2\xa9"
+	"\xe2\xb2\xab\xe2\xb2\xad\xe2\xb2\xaf\xe2\xb2\xb1\xe2\xb2\xb3\xe2"
+	"\xb2\xb5\xe2\xb2\xb7\xe2\xb2\xb9\xe2\xb2\xbb\xe2\xb2\xbd\xe2\xb2"
+	"\xbf\xe2\xb3\x81\xe2\xb3\x83\xe2\xb3\x85\xe2\xb3\x87\xe2\xb3\x89"
+	"\xe2\xb3\x8b\xe2\xb3\x8d\xe2\xb3\x8f\xe2\xb3\x91\xe2\xb3\x93\xe2"
+	"\xb3\x95\xe2\xb3\x97\xe2\xb3\x99\xe2\xb3\x9b\xe2\xb3\x9d\xe2\xb3"
+	"\x9f\xe2\xb3\xa1\xe2\xb3\xa3\xe2\xb3\xac\xe2\xb3\xae\xe2\xb3\xb3"
+	"\xe2\xb5\xa1\xe6\xaf\x8d\xe9\xbe\x9f\xe4\xb8\x80\xe4\xb8\xa8\xe4"
+	"\xb8\xb6\xe4\xb8\xbf\xe4\xb9\x99\xe4\xba\x85\xe4\xba\x8c\xe4\xba"
+	"\xa0\xe4\xba\xba\xe5\x84\xbf\xe5\x85\xa5\xe5\x85\xab\xe5\x86\x82"
+	"\xe5\x86\x96\xe5\x86\xab\xe5\x87\xa0\xe5\x87\xb5\xe5\x88\x80\xe5"
+	"\x8a\x9b\xe5\x8b\xb9\xe5\x8c\x95\xe5\x8c\x9a\xe5\x8c\xb8\xe5\x8d"
+	"\x81\xe5\x8d\x9c\xe5\x8d\xa9\xe5\x8e\x82\xe5\x8e\xb6\xe5\x8f\x88"
+	"\xe5\x8f\xa3\xe5\x9b\x97\xe5\x9c\x9f\xe5\xa3\xab\xe5\xa4\x82\xe5"
+	"\xa4\x8a\xe5\xa4\x95\xe5\xa4\xa7\xe5\xa5\xb3\xe5\xad\x90\xe5\xae"
+	"\x80\xe5\xaf\xb8\xe5\xb0\x8f\xe5\xb0\xa2\xe5\xb0\xb8\xe5\xb1\xae"
+	"\xe5\xb1\xb1\xe5\xb7\x9b\xe5\xb7\xa5\xe5\xb7\xb1\xe5\xb7\xbe\xe5"
+	"\xb9\xb2\xe5\xb9\xba\xe5\xb9\xbf\xe5\xbb\xb4\xe5\xbb\xbe\xe5\xbc"
+	"\x8b\xe5\xbc\x93\xe5\xbd\x90\xe5\xbd\xa1\xe5\xbd\xb3\xe5\xbf\x83"
+	"\xe6\x88\x88\xe6\x88\xb6\xe6\x89\x8b\xe6\x94\xaf\xe6\x94\xb4\xe6"
+	"\x96\x87\xe6\x96\x97\xe6\x96\xa4\xe6\x96\xb9\xe6\x97\xa0\xe6\x97"
+	"\xa5\xe6\x9b\xb0\xe6\x9c\x88\xe6\x9c\xa8\xe6\xac\xa0\xe6\xad\xa2"
+	"\xe6\xad\xb9\xe6\xae\xb3\xe6\xaf\x8b\xe6\xaf\x94\xe6\xaf\x9b\xe6"
+	"\xb0\x8f\xe6\xb0\x94\xe6\xb0\xb4\xe7\x81\xab\xe7\x88\xaa\xe7\x88"
+	"\xb6\xe7\x88\xbb\xe7\x88\xbf\xe7\x89\x87\xe7\x89\x99\xe7\x89\x9b"
+	"\xe7\x8a\xac\xe7\x8e\x84\xe7\x8e\x89\xe7\x93\x9c\xe7\x93\xa6\xe7"
+	"\x94\x98\xe7\x94\x9f\xe7\x94\xa8\xe7\x94\xb0\xe7\x96\x8b\xe7\x96"
+	"\x92\xe7\x99\xb6\xe7\x99\xbd\xe7\x9a\xae\xe7\x9a\xbf\xe7\x9b\xae"
+	"\xe7\x9f\x9b\xe7\x9f\xa2\xe7\x9f\xb3\xe7\xa4\xba\xe7\xa6\xb8\xe7"
+	"\xa6\xbe\xe7\xa9\xb4\xe7\xab\x8b\xe7\xab\xb9\xe7\xb1\xb3\xe7\xb3"
+	"\xb8\xe7\xbc\xb6\xe7\xbd\x91\xe7\xbe\x8a\xe7\xbe\xbd\xe8\x80\x81"
+	"\xe8\x80\x8c\xe8\x80\x92\xe8\x80\xb3\xe8\x81\xbf\xe8\x82\x89\xe8"
+	"\x87\xa3\xe8\x87\xaa\xe8\x87\xb3\xe8\x87\xbc\xe8\x88\x8c\xe8\x88"
+	"\x9b\xe8\x88\x9f\xe8\x89\xae\xe8\x89\xb2\xe8\x89\xb8\xe8\x99\x8d"
+	"\xe8\x99\xab\xe8\xa1\x80\xe8\xa1\x8c\xe8\xa1\xa3\xe8\xa5\xbe\xe8"
+	"\xa6\x8b\xe8\xa7\x92\xe8\xa8\x80\xe8\xb0\xb7\xe8\xb1\x86\xe8\xb1"
+	"\x95\xe8\xb1\xb8\xe8\xb2\x9d\xe8\xb5\xa4\xe8\xb5\xb0\xe8\xb6\xb3"
+	"\xe8\xba\xab\xe8\xbb\x8a\xe8\xbe\x9b\xe8\xbe\xb0\xe8\xbe\xb5\xe9"
+	"\x82\x91\xe9\x85\x89\xe9\x87\x86\xe9\x87\x8c\xe9\x87\x91\xe9\x95"
+	"\xb7\xe9\x96\x80\xe9\x98\x9c\xe9\x9a\xb6\xe9\x9a\xb9\xe9\x9b\xa8"
+	"\xe9\x9d\x91\xe9\x9d\x9e\xe9\x9d\xa2\xe9\x9d\xa9\xe9\x9f\x8b\xe9"
+	"\x9f\xad\xe9\x9f\xb3\xe9\xa0\x81\xe9\xa2\xa8\xe9\xa3\x9b\xe9\xa3"
+	"\x9f\xe9\xa6\x96\xe9\xa6\x99\xe9\xa6\xac\xe9\xaa\xa8\xe9\xab\x98"
+	"\xe9\xab\x9f\xe9\xac\xa5\xe9\xac\xaf\xe9\xac\xb2\xe9\xac\xbc\xe9"
+	"\xad\x9a\xe9\xb3\xa5\xe9\xb9\xb5\xe9\xb9\xbf\xe9\xba\xa5\xe9\xba"
+	"\xbb\xe9\xbb\x83\xe9\xbb\x8d\xe9\xbb\x91\xe9\xbb\xb9\xe9\xbb\xbd"
+	"\xe9\xbc\x8e\xe9\xbc\x93\xe9\xbc\xa0\xe9\xbc\xbb\xe9\xbd\x8a\xe9"
+	"\xbd\x92\xe9\xbe\x8d\xe9\xbe\x9c\xe9\xbe\xa0\xe3\x80\x92\xe5\x8d"
+	"\x84\xe5\x8d\x85\x20\xe3\x82\x99\x20\xe3\x82\x9a\xe3\x82\x88\xe3"
+	"\x82\x8a\xe3\x82\xb3\xe3\x83\x88\xe1\x84\x80\xe1\x84\x81\xe1\x86"
+	"\xaa\xe1\x84\x82\xe1\x86\xac\xe1\x86\xad\xe1\x84\x83\xe1\x84\x84"
+	"\xe1\x84\x85\xe1\x86\xb0\xe1\x86\xb1\xe1\x86\xb2\xe1\x86\xb3\xe1"
+	"\x86\xb4\xe1\x86\xb5\xe1\x84\x9a\xe1\x84\x86\xe1\x84\x87\xe1\x84"
+	"\x88\xe1\x84\xa1\xe1\x84\x89\xe1\x84\x8a\xe1\x84\x8b\xe1\x84\x8c"
+	"\xe1\x84\x8d\xe1\x84\x8e\xe1\x84\x8f\xe1\x84\x90\xe1\x84\x91\xe1"
+	"\x84\x92\xe1\x85\xa1\xe1\x85\xa2\xe1\x85\xa3\xe1\x85\xa4\xe1\x85"
+	"\xa5\xe1\x85\xa6\xe1\x85\xa7\xe1\x85\xa8\xe1\x85\xa9\xe1\x85\xaa"
+	"\xe1\x85\xab\xe1\x85\xac\xe1\x85\xad\xe1\x85\xae\xe1\x85\xaf\xe1"
+	"\x85\xb0\xe1\x85\xb1\xe1\x85\xb2\xe1\x85\xb3\xe1\x85\xb4\xe1\x85"
+	"\xb5\xe1\x85\xa0\xe1\x84\x94\xe1\x84\x95\xe1\x87\x87\xe1\x87\x88"
+	"\xe1\x87\x8c\xe1\x87\x8e\xe1\x87\x93\xe1\x87\x97\xe1\x87\x99\xe1"
+	"\x84\x9c\xe1\x87\x9d\xe1\x87\x9f\xe1\x84\x9d\xe1\x84\x9e\xe1\x84"
+	"\xa0\xe1\x84\xa2\xe1\x84\xa3\xe1\x84\xa7\xe1\x84\xa9\xe1\x84\xab"
+	"\xe1\x84\xac\xe1\x84\xad\xe1\x84\xae\xe1\x84\xaf\xe1\x84\xb2\xe1"
+	"\x84\xb6\xe1\x85\x80\xe1\x85\x87\xe1\x85\x8c\xe1\x87\xb1\xe1\x87"
+	"\xb2\xe1\x85\x97\xe1\x85\x98\xe1\x85\x99\xe1\x86\x84\xe1\x86\x85"
+	"\xe1\x86\x88\xe1\x86\x91\xe1\x86\x92\xe1\x86\x94\xe1\x86\x9e\xe1"
+	"\x86\xa1\xe4\xb8\x89\xe5\x9b\x9b\xe4\xb8\x8a\xe4\xb8\xad\xe4\xb8"
+	"\x8b\xe7\x94\xb2\xe4\xb8\x99\xe4\xb8\x81\xe5\xa4\xa9\xe5\x9c\xb0"
+	"\x28\xe1\x84\x80\x29\x28\xe1\x84\x82\x29\x28\xe1\x84\x83\x29\x28"
+	"\xe1\x84\x85\x29\x28\xe1\x84\x86\x29\x28\xe1\x84\x87\x29\x28\xe1"
+	"\x84\x89\x29\x28\xe1\x84\x8b\x29\x28\xe1\x84\x8c\x29\x28\xe1\x84"
+	"\x8e\x29\x28\xe1\x84\x8f\x29\x28\xe1\x84\x90\x29\x28\xe1\x84\x91"
+	"\x29\x28\xe1\x84\x92\x29\x28\xea\xb0\x80\x29\x28\xeb\x82\x98\x29"
+	"\x28\xeb\x8b\xa4\x29\x28\xeb\x9d\xbc\x29\x28\xeb\xa7\x88\x29\x28"
+	"\xeb\xb0\x94\x29\x28\xec\x82\xac\x29\x28\xec\x95\x84\x29\x28\xec"
+	"\x9e\x90\x29\x28\xec\xb0\xa8\x29\x28\xec\xb9\xb4\x29\x28\xed\x83"
+	"\x80\x29\x28\xed\x8c\x8c\x29\x28\xed\x95\x98\x29\x28\xec\xa3\xbc"
+	"\x29\x28\xec\x98\xa4\xec\xa0\x84\x29\x28\xec\x98\xa4\xed\x9b\x84"
+	"\x29\x28\xe4\xb8\x80\x29\x28\xe4\xba\x8c\x29\x28\xe4\xb8\x89\x29"
+	"\x28\xe5\x9b\x9b\x29\x28\xe4\xba\x94\x29\x28\xe5\x85\xad\x29\x28"
+	"\xe4\xb8\x83\x29\x28\xe5\x85\xab\x29\x28\xe4\xb9\x9d\x29\x28\xe5"
+	"\x8d\x81\x29\x28\xe6\x9c\x88\x29\x28\xe7\x81\xab\x29\x28\xe6\xb0"
+	"\xb4\x29\x28\xe6\x9c\xa8\x29\x28\xe9\x87\x91\x29\x28\xe5\x9c\x9f"
+	"\x29\x28\xe6\x97\xa5\x29\x28\xe6\xa0\xaa\x29\x28\xe6\x9c\x89\x29"
+	"\x28\xe7\xa4\xbe\x29\x28\xe5\x90\x8d\x29\x28\xe7\x89\xb9\x29\x28"
+	"\xe8\xb2\xa1\x29\x28\xe7\xa5\x9d\x29\x28\xe5\x8a\xb4\x29\x28\xe4"
+	"\xbb\xa3\x29\x28\xe5\x91\xbc\x29\x28\xe5\xad\xa6\x29\x28\xe7\x9b"
+	"\xa3\x29\x28\xe4\xbc\x81\x29\x28\xe8\xb3\x87\x29\x28\xe5\x8d\x94"
+	"\x29\x28\xe7\xa5\xad\x29\x28\xe4\xbc\x91\x29\x28\xe8\x87\xaa\x29"
+	"\x28\xe8\x87\xb3\x29\xe5\x95\x8f\xe5\xb9\xbc\xe7\xae\x8f\x70\x74"
+	"\x65\x32\x31\x32\x32\x32\x33\x32\x34\x32\x35\x32\x36\x32\x37\x32"
+	"\x38\x32\x39\x33\x30\x33\x31\x33\x32\x33\x33\x33\x34\x33\x35\xea"
+	"\xb0\x80\xeb\x82\x98\xeb\x8b\xa4\xeb\x9d\xbc\xeb\xa7\x88\xeb\xb0"
+	"\x94\xec\x82\xac\xec\x95\x84\xec\x9e\x90\xec\xb0\xa8\xec\xb9\xb4"
+	"\xed\x83\x80\xed\x8c\x8c\xed\x95\x98\xec\xb0\xb8\xea\xb3\xa0\xec"
+	"\xa3\xbc\xec\x9d\x98\xec\x9a\xb0\xe4\xba\x94\xe5\x85\xad\xe4\xb8"
+	"\x83\xe4\xb9\x9d\xe6\xa0\xaa\xe6\x9c\x89\xe7\xa4\xbe\xe5\x90\x8d"
+	"\xe7\x89\xb9\xe8\xb2\xa1\xe7\xa5\x9d\xe5\x8a\xb4\xe7\xa7\x98\xe7"
+	"\x94\xb7\xe9\x81\xa9\xe5\x84\xaa\xe5\x8d\xb0\xe6\xb3\xa8\xe9\xa0"
+	"\x85\xe4\xbc\x91\xe5\x86\x99\xe6\xad\xa3\xe5\xb7\xa6\xe5\x8f\xb3"
+	"\xe5\x8c\xbb\xe5\xae\x97\xe5\xad\xa6\xe7\x9b\xa3\xe4\xbc\x81\xe8"
+	"\xb3\x87\xe5\x8d\x94\xe5\xa4\x9c\x33\x36\x33\x37\x33\x38\x33\x39"
+	"\x34\x30\x34\x31\x34\x32\x34\x33\x34\x34\x34\x35\x34\x36\x34\x37"
+	"\x34\x38\x34\x39\x35\x30\x31\xe6\x9c\x88\x32\xe6\x9c\x88\x33\xe6"
+	"\x9c\x88\x34\xe6\x9c\x88\x35\xe6\x9c\x88\x36\xe6\x9c\x88\x37\xe6"
+	"\x9c\x88\x38\xe6\x9c\x88\x39\xe6\x9c\x88\x31\x30\xe6\x9c\x88\x31"
+	"\x31\xe6\x9c\x88\x31\x32\xe6\x9c\x88\x68\x67\x65\x72\x67\x65\x76"
+	"\x6c\x74\x64\xe3\x82\xa2\xe3\x82\xa4\xe3\x82\xa6\xe3\x82\xa8\xe3"
+	"\x82\xaa\xe3\x82\xab\xe3\x82\xad\xe3\x82\xaf\xe3\x82\xb1\xe3\x82"
+	"\xb3\xe3\x82\xb5\xe3\x82\xb7\xe3\x82\xb9\xe3\x82\xbb\xe3\x82\xbd"
+	"\xe3\x82\xbf\xe3\x83\x81\xe3\x83\x84\xe3\x83\x86\xe3\x83\x88\xe3"
+	"\x83\x8a\xe3\x83\x8b\xe3\x83\x8c\xe3\x83\x8d\xe3\x83\x8e\xe3\x83"
+	"\x8f\xe3\x83\x92\xe3\x83\x95\xe3\x83\x98\xe3\x83\x9b\xe3\x83\x9e"
+	"\xe3\x83\x9f\xe3\x83\xa0\xe3\x83\xa1\xe3\x83\xa2\xe3\x83\xa4\xe3"
+	"\x83\xa6\xe3\x83\xa8\xe3\x83\xa9\xe3\x83\xaa\xe3\x83\xab\xe3\x83"
+	"\xac\xe3\x83\xad\xe3\x83\xaf\xe3\x83\xb0\xe3\x83\xb1\xe3\x83\xb2"
+	"\xe4\xbb\xa4\xe5\x92\x8c\xe3\x82\xa2\xe3\x83\x91\xe3\x83\xbc\xe3"
+	"\x83\x88\xe3\x82\xa2\xe3\x83\xab\xe3\x83\x95\xe3\x82\xa1\xe3\x82"
+	"\xa2\xe3\x83\xb3\xe3\x83\x9a\xe3\x82\xa2\xe3\x82\xa2\xe3\x83\xbc"
+	"\xe3\x83\xab\xe3\x82\xa4\xe3\x83\x8b\xe3\x83\xb3\xe3\x82\xb0\xe3"
+	"\x82\xa4\xe3\x83\xb3\xe3\x83\x81\xe3\x82\xa6\xe3\x82\xa9\xe3\x83"
+	"\xb3\xe3\x82\xa8\xe3\x82\xb9\xe3\x82\xaf\xe3\x83\xbc\xe3\x83\x89"
+	"\xe3\x82\xa8\xe3\x83\xbc\xe3\x82\xab\xe3\x83\xbc\xe3\x82\xaa\xe3"
+	"\x83\xb3\xe3\x82\xb9\xe3\x82\xaa\xe3\x83\xbc\xe3\x83\xa0\xe3\x82"
+	"\xab\xe3\x82\xa4\xe3\x83\xaa\xe3\x82\xab\xe3\x83\xa9\xe3\x83\x83"
+	"\xe3\x83\x88\xe3\x82\xab\xe3\x83\xad\xe3\x83\xaa\xe3\x83\xbc\xe3"
+	"\x82\xac\xe3\x83\xad\xe3\x83\xb3\xe3\x82\xac\xe3\x83\xb3\xe3\x83"
+	"\x9e\xe3\x82\xae\xe3\x82\xac\xe3\x82\xae\xe3\x83\x8b\xe3\x83\xbc"
+	"\xe3\x82\xad\xe3\x83\xa5\xe3\x83\xaa\xe3\x83\xbc\xe3\x82\xae\xe3"
+	"\x83\xab\xe3\x83\x80\xe3\x83\xbc\xe3\x82\xad\xe3\x83\xad\xe3\x82"
+	"\xad\xe3\x83\xad\xe3\x82\xb0\xe3\x83\xa9\xe3\x83\xa0\xe3\x82\xad"
+	"\xe3\x83\xad\xe3\x83\xa1\xe3\x83\xbc\xe3\x83\x88\xe3\x83\xab\xe3"
+	"\x82\xad\xe3\x83\xad\xe3\x83\xaf\xe3\x83\x83\xe3\x83\x88\xe3\x82"
+	"\xb0\xe3\x83\xa9\xe3\x83\xa0\xe3\x82\xb0\xe3\x83\xa9\xe3\x83\xa0"
+	"\xe3\x83\x88\xe3\x83\xb3\xe3\x82\xaf\xe3\x83\xab\xe3\x82\xbc\xe3"
+	"\x82\xa4\xe3\x83\xad\xe3\x82\xaf\xe3\x83\xad\xe3\x83\xbc\xe3\x83"
+	"\x8d\xe3\x82\xb1\xe3\x83\xbc\xe3\x82\xb9\xe3\x82\xb3\xe3\x83\xab"
+	"\xe3\x83\x8a\xe3\x82\xb3\xe3\x83\xbc\xe3\x83\x9d\xe3\x82\xb5\xe3"
+	"\x82\xa4\xe3\x82\xaf\xe3\x83\xab\xe3\x82\xb5\xe3\x83\xb3\xe3\x83"
+	"\x81\xe3\x83\xbc\xe3\x83\xa0\xe3\x82\xb7\xe3\x83\xaa\xe3\x83\xb3"
+	"\xe3\x82\xb0\xe3\x82\xbb\xe3\x83\xb3\xe3\x83\x81\xe3\x82\xbb\xe3"
+	"\x83\xb3\xe3\x83\x88\xe3\x83\x80\xe3\x83\xbc\xe3\x82\xb9\xe3\x83"
+	"\x87\xe3\x82\xb7\xe3\x83\x89\xe3\x83\xab\xe3\x83\x88\xe3\x83\xb3"
+	"\xe3\x83\x8a\xe3\x83\x8e\xe3\x83\x8e\xe3\x83\x83\xe3\x83\x88\xe3"
+	"\x83\x8f\xe3\x82\xa4\xe3\x83\x84\xe3\x83\x91\xe3\x83\xbc\xe3\x82"
+	"\xbb\xe3\x83\xb3\xe3\x83\x88\xe3\x83\x91\xe3\x83\xbc\xe3\x83\x84"
+	"\xe3\x83\x90\xe3\x83\xbc\xe3\x83\xac\xe3\x83\xab\xe3\x83\x94\xe3"
+	"\x82\xa2\xe3\x82\xb9\xe3\x83\x88\xe3\x83\xab\xe3\x83\x94\xe3\x82"
+	"\xaf\xe3\x83\xab\xe3\x83\x94\xe3\x82\xb3\xe3\x83\x93\xe3\x83\xab"
+	"\xe3\x83\x95\xe3\x82\xa1\xe3\x83\xa9\xe3\x83\x83\xe3\x83\x89\xe3"
+	"\x83\x95\xe3\x82\xa3\xe3\x83\xbc\xe3\x83\x88\xe3\x83\x96\xe3\x83"
+	"\x83\xe3\x82\xb7\xe3\x82\xa7\xe3\x83\xab\xe3\x83\x95\xe3\x83\xa9"
+	"\xe3\x83\xb3\xe3\x83\x98\xe3\x82\xaf\xe3\x82\xbf\xe3\x83\xbc\xe3"
+	"\x83\xab\xe3\x83\x9a\xe3\x82\xbd\xe3\x83\x9a\xe3\x83\x8b\xe3\x83"
+	"\x92\xe3\x83\x98\xe3\x83\xab\xe3\x83\x84\xe3\x83\x9a\xe3\x83\xb3"
+	"\xe3\x82\xb9\xe3\x83\x9a\xe3\x83\xbc\xe3\x82\xb8\xe3\x83\x99\xe3"
+	"\x83\xbc\xe3\x82\xbf\xe3\x83\x9d\xe3\x82\xa4\xe3\x83\xb3\xe3\x83"
+	"\x88\xe3\x83\x9c\xe3\x83\xab\xe3\x83\x88\xe3\x83\x9b\xe3\x83\xb3"
+	"\xe3\x83\x9d\xe3\x83\xb3\xe3\x83\x89\xe3\x83\x9b\xe3\x83\xbc\xe3"
+	"\x83\xab\xe3\x83\x9b\xe3\x83\xbc\xe3\x83\xb3\xe3\x83\x9e\xe3\x82"
+	"\xa4\xe3\x82\xaf\xe3\x83\xad\xe3\x83\x9e\xe3\x82\xa4\xe3\x83\xab"
+	"\xe3\x83\x9e\xe3\x83\x83\xe3\x83\x8f\xe3\x83\x9e\xe3\x83\xab\xe3"
+	"\x82\xaf\xe3\x83\x9e\xe3\x83\xb3\xe3\x82\xb7\xe3\x83\xa7\xe3\x83"
+	"\xb3\xe3\x83\x9f\xe3\x82\xaf\xe3\x83\xad\xe3\x83\xb3\xe3\x83\x9f"
+	"\xe3\x83\xaa\xe3\x83\x9f\xe3\x83\xaa\xe3\x83\x90\xe3\x83\xbc\xe3"
+	"\x83\xab\xe3\x83\xa1\xe3\x82\xac\xe3\x83\xa1\xe3\x82\xac\xe3\x83"
+	"\x88\xe3\x83\xb3\xe3\x83\xa1\xe3\x83\xbc\xe3\x83\x88\xe3\x83\xab"
+	"\xe3\x83\xa4\xe3\x83\xbc\xe3\x83\x89\xe3\x83\xa4\xe3\x83\xbc\xe3"
+	"\x83\xab\xe3\x83\xa6\xe3\x82\xa2\xe3\x83\xb3\xe3\x83\xaa\xe3\x83"
+	"\x83\xe3\x83\x88\xe3\x83\xab\xe3\x83\xaa\xe3\x83\xa9\xe3\x83\xab"
+	"\xe3\x83\x94\xe3\x83\xbc\xe3\x83\xab\xe3\x83\xbc\xe3\x83\x96\xe3"
+	"\x83\xab\xe3\x83\xac\xe3\x83\xa0\xe3\x83\xac\xe3\x83\xb3\xe3\x83"
+	"\x88\xe3\x82\xb2\xe3\x83\xb3\xe3\x83\xaf\xe3\x83\x83\xe3\x83\x88"
+	"\x30\xe7\x82\xb9\x31\xe7\x82\xb9\x32\xe7\x82\xb9\x33\xe7\x82\xb9"
+	"\x34\xe7\x82\xb9\x35\xe7\x82\xb9\x36\xe7\x82\xb9\x37\xe7\x82\xb9"
+	"\x38\xe7\x82\xb9\x39\xe7\x82\xb9\x31\x30\xe7\x82\xb9\x31\x31\xe7"
+	"\x82\xb9\x31\x32\xe7\x82\xb9\x31\x33\xe7\x82\xb9\x31\x34\xe7\x82"
+	"\xb9\x31\x35\xe7\x82\xb9\x31\x36\xe7\x82\xb9\x31\x37\xe7\x82\xb9"
+	"\x31\x38\xe7\x82\xb9\x31\x39\xe7\x82\xb9\x32\x30\xe7\x82\xb9\x32"
+	"\x31\xe7\x82\xb9\x32\x32\xe7\x82\xb9\x32\x33\xe7\x82\xb9\x32\x34"
+	"\xe7\x82\xb9\x68\x70\x61\x64\x61\x61\x75\x62\x61\x72\x6f\x76\x70"
+	"\x63\x64\x6d\x64\x6d\x32\x64\x6d\x33\x69\x75\xe5\xb9\xb3\xe6\x88"
+	"\x90\xe6\x98\xad\xe5\x92\x8c\xe5\xa4\xa7\xe6\xad\xa3\xe6\x98\x8e"
+	"\xe6\xb2\xbb\xe6\xa0\xaa\xe5\xbc\x8f\xe4\xbc\x9a\xe7\xa4\xbe\x70"
+	"\x61\x6e\x61\xce\xbc\x61\x6d\x61\x6b\x61\x6b\x62\x6d\x62\x67\x62"
+	"\x63\x61\x6c\x6b\x63\x61\x6c\x70\x66\x6e\x66\xce\xbc\x66\xce\xbc"
+	"\x67\x6d\x67\x6b\x67\x68\x7a\x6b\x68\x7a\x6d\x68\x7a\x67\x68\x7a"
+	"\x74\x68\x7a\xce\xbc\x6c\x6d\x6c\x64\x6c\x6b\x6c\x66\x6d\x6e\x6d"
+	"\xce\xbc\x6d\x6d\x6d\x63\x6d\x6b\x6d\x6d\x6d\x32\x63\x6d\x32\x6d"
+	"\x32\x6b\x6d\x32\x6d\x6d\x33\x63\x6d\x33\x6d\x33\x6b\x6d\x33\x6d"
+	"\xe2\x88\x95\x73\x6d\xe2\x88\x95\x73\x32\x6b\x70\x61\x6d\x70\x61"
+	"\x67\x70\x61\x72\x61\x64\x72\x61\x64\xe2\x88\x95\x73\x72\x61\x64"
+	"\xe2\x88\x95\x73\x32\x70\x73\x6e\x73\xce\xbc\x73\x6d\x73\x70\x76"
+	"\x6e\x76\xce\xbc\x76\x6d\x76\x6b\x76\x70\x77\x6e\x77\xce\xbc\x77"
+	"\x6d\x77\x6b\x77\x6b\xcf\x89\x6d\xcf\x89\x61\x2e\x6d\x2e\x62\x71"
+	"\x63\x63\x63\x64\x63\xe2\x88\x95\x6b\x67\x63\x6f\x2e\x64\x62\x67"
+	"\x79\x68\x61\x68\x70\x69\x6e\x6b\x6b\x6b\x74\x6c\x6d\x6c\x6e\x6c"
+	"\x6f\x67\x6c\x78\x6d\x69\x6c\x6d\x6f\x6c\x70\x68\x70\x2e\x6d\x2e"
+	"\x70\x70\x6d\x70\x72\x73\x72\x73\x76\x77\x62\x76\xe2\x88\x95\x6d"
+	"\x61\xe2\x88\x95\x6d\x31\xe6\x97\xa5\x32\xe6\x97\xa5\x33\xe6\x97"
+	"\xa5\x34\xe6\x97\xa5\x35\xe6\x97\xa5\x36\xe6\x97\xa5\x37\xe6\x97"
+	"\xa5\x38\xe6\x97\xa5\x39\xe6\x97\xa5\x31\x30\xe6\x97\xa5\x31\x31"
+	"\xe6\x97\xa5\x31\x32\xe6\x97\xa5\x31\x33\xe6\x97\xa5\x31\x34\xe6"
+	"\x97\xa5\x31\x35\xe6\x97\xa5\x31\x36\xe6\x97\xa5\x31\x37\xe6\x97"
+	"\xa5\x31\x38\xe6\x97\xa5\x31\x39\xe6\x97\xa5\x32\x30\xe6\x97\xa5"
+	"\x32\x31\xe6\x97\xa5\x32\x32\xe6\x97\xa5\x32\x33\xe6\x97\xa5\x32"
+	"\x34\xe6\x97\xa5\x32\x35\xe6\x97\xa5\x32\x36\xe6\x97\xa5\x32\x37"
+	"\xe6\x97\xa5\x32\x38\xe6\x97\xa5\x32\x39\xe6\x97\xa5\x33\x30\xe6"
+	"\x97\xa5\x33\x31\xe6\x97\xa5\x67\x61\x6c\xea\x99\x81\xea\x99\x83"
+	"\xea\x99\x85\xea\x99\x87\xea\x99\x89\xea\x99\x8d\xea\x99\x8f\xea"
+	"\x99\x91\xea\x99\x93\xea\x99\x95\xea\x99\x97\xea\x99\x99\xea\x99"
+	"\x9b\xea\x99\x9d\xea\x99\x9f\xea\x99\xa1\xea\x99\xa3\xea\x99\xa5"
+	"\xea\x99\xa7\xea\x99\xa9\xea\x99\xab\xea\x99\xad\xea\x9a\x81\xea"
+	"\x9a\x83\xea\x9a\x85\xea\x9a\x87\xea\x9a\x89\xea\x9a\x8b\xea\x9a"
+	"\x8d\xea\x9a\x8f\xea\x9a\x91\xea\x9a\x93\xea\x9a\x95\xea\x9a\x97"
+	"\xea\x9a\x99\xea\x9a\x9b\xea\x9c\xa3\xea\x9c\xa5\xea\x9c\xa7\xea"
+	"\x9c\xa9\xea\x9c\xab\xea\x9c\xad\xea\x9c\xaf\xea\x9c\xb3\xea\x9c"
+	"\xb5\xea\x9c\xb7\xea\x9c\xb9\xea\x9c\xbb\xea\x9c\xbd\xea\x9c\xbf"
+	"\xea\x9d\x81\xea\x9d\x83\xea\x9d\x85\xea\x9d\x87\xea\x9d\x89\xea"
+	"\x9d\x8b\xea\x9d\x8d\xea\x9d\x8f\xea\x9d\x91\xea\x9d\x93\xea\x9d"
+	"\x95\xea\x9d\x97\xea\x9d\x99\xea\x9d\x9b\xea\x9d\x9d\xea\x9d\x9f"
+	"\xea\x9d\xa1\xea\x9d\xa3\xea\x9d\xa5\xea\x9d\xa7\xea\x9d\xa9\xea"
+	"\x9d\xab\xea\x9d\xad\xea\x9d\xaf\xea\x9d\xba\xea\x9d\xbc\xe1\xb5"
+	"\xb9\xea\x9d\xbf\xea\x9e\x81\xea\x9e\x83\xea\x9e\x85\xea\x9e\x87"
+	"\xea\x9e\x8c\xea\x9e\x91\xea\x9e\x93\xea\x9e\x97\xea\x9e\x99\xea"
+	"\x9e\x9b\xea\x9e\x9d\xea\x9e\x9f\xea\x9e\xa1\xea\x9e\xa3\xea\x9e"
+	"\xa5\xea\x9e\xa7\xea\x9e\xa9\xc9\xac\xca\x9e\xca\x87\xea\xad\x93"
+	"\xea\x9e\xb5\xea\x9e\xb7\xea\x9e\xb9\xea\x9e\xbb\xea\x9e\xbd\xea"
+	"\x9e\xbf\xea\x9f\x81\xea\x9f\x83\xea\x9e\x94\xe1\xb6\x8e\xea\x9f"
+	"\x88\xea\x9f\x8a\xea\x9f\x91\xea\x9f\x97\xea\x9f\x99\xea\x9f\xb6"
+	"\xea\xac\xb7\xea\xad\x92\xca\x8d\xe1\x8e\xa0\xe1\x8e\xa1\xe1\x8e"
+	"\xa2\xe1\x8e\xa3\xe1\x8e\xa4\xe1\x8e\xa5\xe1\x8e\xa6\xe1\x8e\xa7"
+	"\xe1\x8e\xa8\xe1\x8e\xa9\xe1\x8e\xaa\xe1\x8e\xab\xe1\x8e\xac\xe1"
+	"\x8e\xad\xe1\x8e\xae\xe1\x8e\xaf\xe1\x8e\xb0\xe1\x8e\xb1\xe1\x8e"
+	"\xb2\xe1\x8e\xb3\xe1\x8e\xb4\xe1\x8e\xb5\xe1\x8e\xb6\xe1\x8e\xb7"
+	"\xe1\x8e\xb8\xe1\x8e\xb9\xe1\x8e\xba\xe1\x8e\xbb\xe1\x8e\xbc\xe1"
+	"\x8e\xbd\xe1\x8e\xbe\xe1\x8e\xbf\xe1\x8f\x80\xe1\x8f\x81\xe1\x8f"
+	"\x82\xe1\x8f\x83\xe1\x8f\x84\xe1\x8f\x85\xe1\x8f\x86\xe1\x8f\x87"
+	"\xe1\x8f\x88\xe1\x8f\x89\xe1\x8f\x8a\xe1\x8f\x8b\xe1\x8f\x8c\xe1"
+	"\x8f\x8d\xe1\x8f\x8e\xe1\x8f\x8f\xe1\x8f\x90\xe1\x8f\x91\xe1\x8f"
+	"\x92\xe1\x8f\x93\xe1\x8f\x94\xe1\x8f\x95\xe1\x8f\x96\xe1\x8f\x97"
+	"\xe1\x8f\x98\xe1\x8f\x99\xe1\x8f\x9a\xe1\x8f\x9b\xe1\x8f\x9c\xe1"
+	"\x8f\x9d\xe1\x8f\x9e\xe1\x8f\x9f\xe1\x8f\xa0\xe1\x8f\xa1\xe1\x8f"
+	"\xa2\xe1\x8f\xa3\xe1\x8f\xa4\xe1\x8f\xa5\xe1\x8f\xa6\xe1\x8f\xa7"
+	"\xe1\x8f\xa8\xe1\x8f\xa9\xe1\x8f\xaa\xe1\x8f\xab\xe1\x8f\xac\xe1"
+	"\x8f\xad\xe1\x8f\xae\xe1\x8f\xaf\xe8\xb1\x88\xe6\x9b\xb4\xe8\xb3"
+	"\x88\xe6\xbb\x91\xe4\xb8\xb2\xe5\x8f\xa5\xe5\xa5\x91\xe5\x96\x87"
+	"\xe5\xa5\x88\xe6\x87\xb6\xe7\x99\xa9\xe7\xbe\x85\xe8\x98\xbf\xe8"
+	"\x9e\xba\xe8\xa3\xb8\xe9\x82\x8f\xe6\xa8\x82\xe6\xb4\x9b\xe7\x83"
+	"\x99\xe7\x8f\x9e\xe8\x90\xbd\xe9\x85\xaa\xe9\xa7\xb1\xe4\xba\x82"
+	"\xe5\x8d\xb5\xe6\xac\x84\xe7\x88\x9b\xe8\x98\xad\xe9\xb8\x9e\xe5"
+	"\xb5\x90\xe6\xbf\xab\xe8\x97\x8d\xe8\xa5\xa4\xe6\x8b\x89\xe8\x87"
+	"\x98\xe8\xa0\x9f\xe5\xbb\x8a\xe6\x9c\x97\xe6\xb5\xaa\xe7\x8b\xbc"
+	"\xe9\x83\x8e\xe4\xbe\x86\xe5\x86\xb7\xe5\x8b\x9e\xe6\x93\x84\xe6"
+	"\xab\x93\xe7\x88\x90\xe7\x9b\xa7\xe8\x98\x86\xe8\x99\x9c\xe8\xb7"
+	"\xaf\xe9\x9c\xb2\xe9\xad\xaf\xe9\xb7\xba\xe7\xa2\x8c\xe7\xa5\xbf"
+	"\xe7\xb6\xa0\xe8\x8f\x89\xe9\x8c\x84\xe8\xab\x96\xe5\xa3\x9f\xe5"
+	"\xbc\x84\xe7\xb1\xa0\xe8\x81\xbe\xe7\x89\xa2\xe7\xa3\x8a\xe8\xb3"
+	"\x82\xe9\x9b\xb7\xe5\xa3\x98\xe5\xb1\xa2\xe6\xa8\x93\xe6\xb7\x9a"
+	"\xe6\xbc\x8f\xe7\xb4\xaf\xe7\xb8\xb7\xe9\x99\x8b\xe5\x8b\x92\xe8"
+	"\x82\x8b\xe5\x87\x9c\xe5\x87\x8c\xe7\xa8\x9c\xe7\xb6\xbe\xe8\x8f"
+	"\xb1\xe9\x99\xb5\xe8\xae\x80\xe6\x8b\x8f\xe8\xab\xbe\xe4\xb8\xb9"
+	"\xe5\xaf\xa7\xe6\x80\x92\xe7\x8e\x87\xe7\x95\xb0\xe5\x8c\x97\xe7"
+	"\xa3\xbb\xe4\xbe\xbf\xe5\xbe\xa9\xe4\xb8\x8d\xe6\xb3\x8c\xe6\x95"
+	"\xb8\xe7\xb4\xa2\xe5\x8f\x83\xe5\xa1\x9e\xe7\x9c\x81\xe8\x91\x89"
+	"\xe8\xaa\xaa\xe6\xae\xba\xe6\xb2\x88\xe6\x8b\xbe\xe8\x8b\xa5\xe6"
+	"\x8e\xa0\xe7\x95\xa5\xe4\xba\xae\xe5\x85\xa9\xe5\x87\x89\xe6\xa2"
+	"\x81\xe7\xb3\xa7\xe8\x89\xaf\xe8\xab\x92\xe9\x87\x8f\xe5\x8b\xb5"
+	"\xe5\x91\x82\xe5\xbb\xac\xe6\x97\x85\xe6\xbf\xbe\xe7\xa4\xaa\xe9"
+	"\x96\xad\xe9\xa9\xaa\xe9\xba\x97\xe9\xbb\x8e\xe6\x9b\x86\xe6\xad"
+	"\xb7\xe8\xbd\xa2\xe5\xb9\xb4\xe6\x86\x90\xe6\x88\x80\xe6\x92\x9a"
+	"\xe6\xbc\xa3\xe7\x85\x89\xe7\x92\x89\xe7\xa7\x8a\xe7\xb7\xb4\xe8"
+	"\x81\xaf\xe8\xbc\xa6\xe8\x93\xae\xe9\x80\xa3\xe9\x8d\x8a\xe5\x88"
+	"\x97\xe5\x8a\xa3\xe5\x92\xbd\xe7\x83\x88\xe8\xa3\x82\xe5\xbb\x89"
+	"\xe5\xbf\xb5\xe6\x8d\xbb\xe6\xae\xae\xe7\xb0\xbe\xe7\x8d\xb5\xe4"
+	"\xbb\xa4\xe5\x9b\xb9\xe5\xb6\xba\xe6\x80\x9c\xe7\x8e\xb2\xe7\x91"
+	"\xa9\xe7\xbe\x9a\xe8\x81\x86\xe9\x88\xb4\xe9\x9b\xb6\xe9\x9d\x88"
+	"\xe9\xa0\x98\xe4\xbe\x8b\xe7\xa6\xae\xe9\x86\xb4\xe9\x9a\xb8\xe6"
+	"\x83\xa1\xe4\xba\x86\xe5\x83\x9a\xe5\xaf\xae\xe5\xb0\xbf\xe6\x96"
+	"\x99\xe7\x87\x8e\xe7\x99\x82\xe8\x93\xbc\xe9\x81\xbc\xe6\x9a\x88"
+	"\xe9\x98\xae\xe5\x8a\x89\xe6\x9d\xbb\xe6\x9f\xb3\xe6\xb5\x81\xe6"
+	"\xba\x9c\xe7\x90\x89\xe7\x95\x99\xe7\xa1\xab\xe7\xb4\x90\xe9\xa1"
+	"\x9e\xe6\x88\xae\xe9\x99\xb8\xe5\x80\xab\xe5\xb4\x99\xe6\xb7\xaa"
+	"\xe8\xbc\xaa\xe5\xbe\x8b\xe6\x85\x84\xe6\xa0\x97\xe9\x9a\x86\xe5"
+	"\x88\xa9\xe5\x90\x8f\xe5\xb1\xa5\xe6\x98\x93\xe6\x9d\x8e\xe6\xa2"
+	"\xa8\xe6\xb3\xa5\xe7\x90\x86\xe7\x97\xa2\xe7\xbd\xb9\xe8\xa3\x8f"
+	"\xe8\xa3\xa1\xe9\x9b\xa2\xe5\x8c\xbf\xe6\xba\xba\xe5\x90\x9d\xe7"
+	"\x87\x90\xe7\x92\x98\xe8\x97\xba\xe9\x9a\xa3\xe9\xb1\x97\xe9\xba"
+	"\x9f\xe6\x9e\x97\xe6\xb7\x8b\xe8\x87\xa8\xe7\xac\xa0\xe7\xb2\x92"
+	"\xe7\x8b\x80\xe7\x82\x99\xe8\xad\x98\xe4\xbb\x80\xe8\x8c\xb6\xe5"
+	"\x88\xba\xe5\x88\x87\xe5\xba\xa6\xe6\x8b\x93\xe7\xb3\x96\xe5\xae"
+	"\x85\xe6\xb4\x9e\xe6\x9a\xb4\xe8\xbc\xbb\xe9\x99\x8d\xe5\xbb\x93"
+	"\xe5\x85\x80\xe5\x97\x80\xe5\xa1\x9a\xe6\x99\xb4\xe5\x87\x9e\xe7"
+	"\x8c\xaa\xe7\x9b\x8a\xe7\xa4\xbc\xe7\xa5\x9e\xe7\xa5\xa5\xe7\xa6"
+	"\x8f\xe9\x9d\x96\xe7\xb2\xbe\xe8\x98\x92\xe8\xab\xb8\xe9\x80\xb8"
+	"\xe9\x83\xbd\xe9\xa3\xaf\xe9\xa3\xbc\xe9\xa4\xa8\xe9\xb6\xb4\xe9"
+	"\x83\x9e\xe9\x9a\xb7\xe4\xbe\xae\xe5\x83\xa7\xe5\x85\x8d\xe5\x8b"
+	"\x89\xe5\x8b\xa4\xe5\x8d\x91\xe5\x96\x9d\xe5\x98\x86\xe5\x99\xa8"
+	"\xe5\xa1\x80\xe5\xa2\xa8\xe5\xb1\xa4\xe6\x82\x94\xe6\x85\xa8\xe6"
+	"\x86\x8e\xe6\x87\xb2\xe6\x95\x8f\xe6\x97\xa2\xe6\x9a\x91\xe6\xa2"
+	"\x85\xe6\xb5\xb7\xe6\xb8\x9a\xe6\xbc\xa2\xe7\x85\xae\xe7\x88\xab"
+	"\xe7\x90\xa2\xe7\xa2\x91\xe7\xa5\x89\xe7\xa5\x88\xe7\xa5\x90\xe7"
+	"\xa5\x96\xe7\xa6\x8d\xe7\xa6\x8e\xe7\xa9\x80\xe7\xaa\x81\xe7\xaf"
+	"\x80\xe7\xb8\x89\xe7\xb9\x81\xe7\xbd\xb2\xe8\x80\x85\xe8\x87\xad"
+	"\xe8\x89\xb9\xe8\x91\x97\xe8\xa4\x90\xe8\xa6\x96\xe8\xac\x81\xe8"
+	"\xac\xb9\xe8\xb3\x93\xe8\xb4\x88\xe8\xbe\xb6\xe9\x9b\xa3\xe9\x9f"
+	"\xbf\xe9\xa0\xbb\xe6\x81\xb5\xf0\xa4\x8b\xae\xe8\x88\x98\xe4\xb8"
+	"\xa6\xe5\x86\xb5\xe5\x85\xa8\xe4\xbe\x80\xe5\x85\x85\xe5\x86\x80"
+	"\xe5\x8b\x87\xe5\x8b\xba\xe5\x95\x95\xe5\x96\x99\xe5\x97\xa2\xe5"
+	"\xa2\xb3\xe5\xa5\x84\xe5\xa5\x94\xe5\xa9\xa2\xe5\xac\xa8\xe5\xbb"
+	"\x92\xe5\xbb\x99\xe5\xbd\xa9\xe5\xbe\xad\xe6\x83\x98\xe6\x85\x8e"
+	"\xe6\x84\x88\xe6\x85\xa0\xe6\x88\xb4\xe6\x8f\x84\xe6\x90\x9c\xe6"
+	"\x91\x92\xe6\x95\x96\xe6\x9c\x9b\xe6\x9d\x96\xe6\xbb\x9b\xe6\xbb"
+	"\x8b\xe7\x80\x9e\xe7\x9e\xa7\xe7\x88\xb5\xe7\x8a\xaf\xe7\x91\xb1"
+	"\xe7\x94\x86\xe7\x94\xbb\xe7\x98\x9d\xe7\x98\x9f\xe7\x9b\x9b\xe7"
+	"\x9b\xb4\xe7\x9d\x8a\xe7\x9d\x80\xe7\xa3\x8c\xe7\xaa\xb1\xe7\xb1"
+	"\xbb\xe7\xb5\x9b\xe7\xbc\xbe\xe8\x8d\x92\xe8\x8f\xaf\xe8\x9d\xb9"
+	"\xe8\xa5\x81\xe8\xa6\x86\xe8\xaa\xbf\xe8\xab\x8b\xe8\xab\xad\xe8"
+	"\xae\x8a\xe8\xbc\xb8\xe9\x81\xb2\xe9\x86\x99\xe9\x89\xb6\xe9\x99"
+	"\xbc\xe9\x9f\x9b\xe9\xa0\x8b\xe9\xac\x92\xf0\xa2\xa1\x8a\xf0\xa2"
+	"\xa1\x84\xf0\xa3\x8f\x95\xe3\xae\x9d\xe4\x80\x98\xe4\x80\xb9\xf0"
+	"\xa5\x89\x89\xf0\xa5\xb3\x90\xf0\xa7\xbb\x93\xe9\xbd\x83\xe9\xbe"
+	"\x8e\x66\x66\x66\x69\x66\x6c\x66\x66\x69\x66\x66\x6c\x73\x74\xd5"
+	"\xb4\xd5\xb6\xd5\xb4\xd5\xa5\xd5\xb4\xd5\xab\xd5\xbe\xd5\xb6\xd5"
+	"\xb4\xd5\xad\xd7\x99\xd6\xb4\xd7\xb2\xd6\xb7\xd7\xa2\xd7\x94\xd7"
+	"\x9b\xd7\x9c\xd7\x9d\xd7\xa8\xd7\xaa\xd7\xa9\xd7\x81\xd7\xa9\xd7"
+	"\x82\xd7\xa9\xd6\xbc\xd7\x81\xd7\xa9\xd6\xbc\xd7\x82\xd7\x90\xd6"
+	"\xb7\xd7\x90\xd6\xb8\xd7\x90\xd6\xbc\xd7\x91\xd6\xbc\xd7\x92\xd6"
+	"\xbc\xd7\x93\xd6\xbc\xd7\x94\xd6\xbc\xd7\x95\xd6\xbc\xd7\x96\xd6"
+	"\xbc\xd7\x98\xd6\xbc\xd7\x99\xd6\xbc\xd7\x9a\xd6\xbc\xd7\x9b\xd6"
+	"\xbc\xd7\x9c\xd6\xbc\xd7\x9e\xd6\xbc\xd7\xa0\xd6\xbc\xd7\xa1\xd6"
+	"\xbc\xd7\xa3\xd6\xbc\xd7\xa4\xd6\xbc\xd7\xa6\xd6\xbc\xd7\xa7\xd6"
+	"\xbc\xd7\xa8\xd6\xbc\xd7\xa9\xd6\xbc\xd7\xaa\xd6\xbc\xd7\x95\xd6"
+	"\xb9\xd7\x91\xd6\xbf\xd7\x9b\xd6\xbf\xd7\xa4\xd6\xbf\xd7\x90\xd7"
+	"\x9c\xd9\xb1\xd9\xbb\xd9\xbe\xda\x80\xd9\xba\xd9\xbf\xd9\xb9\xda"
+	"\xa4\xda\xa6\xda\x84\xda\x83\xda\x86\xda\x87\xda\x8d\xda\x8c\xda"
+	"\x8e\xda\x88\xda\x98\xda\x91\xda\xa9\xda\xaf\xda\xb3\xda\xb1\xda"
+	"\xba\xda\xbb\xdb\x80\xdb\x81\xda\xbe\xdb\x92\xdb\x93\xda\xad\xdb"
+	"\x87\xdb\x86\xdb\x88\xdb\x8b\xdb\x85\xdb\x89\xdb\x90\xd9\x89\xd8"
+	"\xa6\xd8\xa7\xd8\xa6\xdb\x95\xd8\xa6\xd9\x88\xd8\xa6\xdb\x87\xd8"
+	"\xa6\xdb\x86\xd8\xa6\xdb\x88\xd8\xa6\xdb\x90\xd8\xa6\xd9\x89\xdb"
+	"\x8c\xd8\xa6\xd8\xac\xd8\xa6\xd8\xad\xd8\xa6\xd9\x85\xd8\xa6\xd9"
+	"\x8a\xd8\xa8\xd8\xac\xd8\xa8\xd8\xad\xd8\xa8\xd8\xae\xd8\xa8\xd9"
+	"\x85\xd8\xa8\xd9\x89\xd8\xa8\xd9\x8a\xd8\xaa\xd8\xac\xd8\xaa\xd8"
+	"\xad\xd8\xaa\xd8\xae\xd8\xaa\xd9\x85\xd8\xaa\xd9\x89\xd8\xaa\xd9"
+	"\x8a\xd8\xab\xd8\xac\xd8\xab\xd9\x85\xd8\xab\xd9\x89\xd8\xab\xd9"
+	"\x8a\xd8\xac\xd8\xad\xd8\xac\xd9\x85\xd8\xad\xd8\xac\xd8\xad\xd9"
+	"\x85\xd8\xae\xd8\xac\xd8\xae\xd8\xad\xd8\xae\xd9\x85\xd8\xb3\xd8"
+	"\xac\xd8\xb3\xd8\xad\xd8\xb3\xd8\xae\xd8\xb3\xd9\x85\xd8\xb5\xd8"
+	"\xad\xd8\xb5\xd9\x85\xd8\xb6\xd8\xac\xd8\xb6\xd8\xad\xd8\xb6\xd8"
+	"\xae\xd8\xb6\xd9\x85\xd8\xb7\xd8\xad\xd8\xb7\xd9\x85\xd8\xb8\xd9"
+	"\x85\xd8\xb9\xd8\xac\xd8\xb9\xd9\x85\xd8\xba\xd8\xac\xd8\xba\xd9"
+	"\x85\xd9\x81\xd8\xac\xd9\x81\xd8\xad\xd9\x81\xd8\xae\xd9\x81\xd9"
+	"\x85\xd9\x81\xd9\x89\xd9\x81\xd9\x8a\xd9\x82\xd8\xad\xd9\x82\xd9"
+	"\x85\xd9\x82\xd9\x89\xd9\x82\xd9\x8a\xd9\x83\xd8\xa7\xd9\x83\xd8"
+	"\xac\xd9\x83\xd8\xad\xd9\x83\xd8\xae\xd9\x83\xd9\x84\xd9\x83\xd9"
+	"\x85\xd9\x83\xd9\x89\xd9\x83\xd9\x8a\xd9\x84\xd8\xac\xd9\x84\xd8"
+	"\xad\xd9\x84\xd8\xae\xd9\x84\xd9\x85\xd9\x84\xd9\x89\xd9\x84\xd9"
+	"\x8a\xd9\x85\xd8\xac\xd9\x85\xd8\xad\xd9\x85\xd8\xae\xd9\x85\xd9"
+	"\x85\xd9\x85\xd9\x89\xd9\x85\xd9\x8a\xd9\x86\xd8\xac\xd9\x86\xd8"
+	"\xad\xd9\x86\xd8\xae\xd9\x86\xd9\x85\xd9\x86\xd9\x89\xd9\x86\xd9"
+	"\x8a\xd9\x87\xd8\xac\xd9\x87\xd9\x85\xd9\x87\xd9\x89\xd9\x87\xd9"
+	"\x8a\xd9\x8a\xd8\xac\xd9\x8a\xd8\xad\xd9\x8a\xd8\xae\xd9\x8a\xd9"
+	"\x85\xd9\x8a\xd9\x89\xd9\x8a\xd9\x8a\xd8\xb0\xd9\xb0\xd8\xb1\xd9"
+	"\xb0\xd9\x89\xd9\xb0\x20\xd9\x8c\xd9\x91\x20\xd9\x8d\xd9\x91\x20"
+	"\xd9\x8e\xd9\x91\x20\xd9\x8f\xd9\x91\x20\xd9\x90\xd9\x91\x20\xd9"
+	"\x91\xd9\xb0\xd8\xa6\xd8\xb1\xd8\xa6\xd8\xb2\xd8\xa6\xd9\x86\xd8"
+	"\xa8\xd8\xb1\xd8\xa8\xd8\xb2\xd8\xa8\xd9\x86\xd8\xaa\xd8\xb1\xd8"
+	"\xaa\xd8\xb2\xd8\xaa\xd9\x86\xd8\xab\xd8\xb1\xd8\xab\xd8\xb2\xd8"
+	"\xab\xd9\x86\xd9\x85\xd8\xa7\xd9\x86\xd8\xb1\xd9\x86\xd8\xb2\xd9"
+	"\x86\xd9\x86\xd9\x8a\xd8\xb1\xd9\x8a\xd8\xb2\xd9\x8a\xd9\x86\xd8"
+	"\xa6\xd8\xae\xd8\xa6\xd9\x87\xd8\xa8\xd9\x87\xd8\xaa\xd9\x87\xd8"
+	"\xb5\xd8\xae\xd9\x84\xd9\x87\xd9\x86\xd9\x87\xd9\x87\xd9\xb0\xd9"
+	"\x8a\xd9\x87\xd8\xab\xd9\x87\xd8\xb3\xd9\x87\xd8\xb4\xd9\x85\xd8"
+	"\xb4\xd9\x87\xd9\x80\xd9\x8e\xd9\x91\xd9\x80\xd9\x8f\xd9\x91\xd9"
+	"\x80\xd9\x90\xd9\x91\xd8\xb7\xd9\x89\xd8\xb7\xd9\x8a\xd8\xb9\xd9"
+	"\x89\xd8\xb9\xd9\x8a\xd8\xba\xd9\x89\xd8\xba\xd9\x8a\xd8\xb3\xd9"
+	"\x89\xd8\xb3\xd9\x8a\xd8\xb4\xd9\x89\xd8\xb4\xd9\x8a\xd8\xad\xd9"
+	"\x89\xd8\xad\xd9\x8a\xd8\xac\xd9\x89\xd8\xac\xd9\x8a\xd8\xae\xd9"
+	"\x89\xd8\xae\xd9\x8a\xd8\xb5\xd9\x89\xd8\xb5\xd9\x8a\xd8\xb6\xd9"
+	"\x89\xd8\xb6\xd9\x8a\xd8\xb4\xd8\xac\xd8\xb4\xd8\xad\xd8\xb4\xd8"
+	"\xae\xd8\xb4\xd8\xb1\xd8\xb3\xd8\xb1\xd8\xb5\xd8\xb1\xd8\xb6\xd8"
+	"\xb1\xd8\xa7\xd9\x8b\xd8\xaa\xd8\xac\xd9\x85\xd8\xaa\xd8\xad\xd8"
+	"\xac\xd8\xaa\xd8\xad\xd9\x85\xd8\xaa\xd8\xae\xd9\x85\xd8\xaa\xd9"
+	"\x85\xd8\xac\xd8\xaa\xd9\x85\xd8\xad\xd8\xaa\xd9\x85\xd8\xae\xd8"
+	"\xac\xd9\x85\xd8\xad\xd8\xad\xd9\x85\xd9\x8a\xd8\xad\xd9\x85\xd9"
+	"\x89\xd8\xb3\xd8\xad\xd8\xac\xd8\xb3\xd8\xac\xd8\xad\xd8\xb3\xd8"
+	"\xac\xd9\x89\xd8\xb3\xd9\x85\xd8\xad\xd8\xb3\xd9\x85\xd8\xac\xd8"
+	"\xb3\xd9\x85\xd9\x85\xd8\xb5\xd8\xad\xd8\xad\xd8\xb5\xd9\x85\xd9"
+	"\x85\xd8\xb4\xd8\xad\xd9\x85\xd8\xb4\xd8\xac\xd9\x8a\xd8\xb4\xd9"
+	"\x85\xd8\xae\xd8\xb4\xd9\x85\xd9\x85\xd8\xb6\xd8\xad\xd9\x89\xd8"
+	"\xb6\xd8\xae\xd9\x85\xd8\xb7\xd9\x85\xd8\xad\xd8\xb7\xd9\x85\xd9"
+	"\x85\xd8\xb7\xd9\x85\xd9\x8a\xd8\xb9\xd8\xac\xd9\x85\xd8\xb9\xd9"
+	"\x85\xd9\x85\xd8\xb9\xd9\x85\xd9\x89\xd8\xba\xd9\x85\xd9\x85\xd8"
+	"\xba\xd9\x85\xd9\x8a\xd8\xba\xd9\x85\xd9\x89\xd9\x81\xd8\xae\xd9"
+	"\x85\xd9\x82\xd9\x85\xd8\xad\xd9\x82\xd9\x85\xd9\x85\xd9\x84\xd8"
+	"\xad\xd9\x85\xd9\x84\xd8\xad\xd9\x8a\xd9\x84\xd8\xad\xd9\x89\xd9"
+	"\x84\xd8\xac\xd8\xac\xd9\x84\xd8\xae\xd9\x85\xd9\x84\xd9\x85\xd8"
+	"\xad\xd9\x85\xd8\xad\xd8\xac\xd9\x85\xd8\xad\xd9\x85\xd9\x85\xd8"
+	"\xad\xd9\x8a\xd9\x85\xd8\xac\xd8\xad\xd9\x85\xd8\xac\xd9\x85\xd9"
+	"\x85\xd8\xae\xd8\xac\xd9\x85\xd8\xae\xd9\x85\xd9\x85\xd8\xac\xd8"
+	"\xae\xd9\x87\xd9\x85\xd8\xac\xd9\x87\xd9\x85\xd9\x85\xd9\x86\xd8"
+	"\xad\xd9\x85\xd9\x86\xd8\xad\xd9\x89\xd9\x86\xd8\xac\xd9\x85\xd9"
+	"\x86\xd8\xac\xd9\x89\xd9\x86\xd9\x85\xd9\x8a\xd9\x86\xd9\x85\xd9"
+	"\x89\xd9\x8a\xd9\x85\xd9\x85\xd8\xa8\xd8\xae\xd9\x8a\xd8\xaa\xd8"
+	"\xac\xd9\x8a\xd8\xaa\xd8\xac\xd9\x89\xd8\xaa\xd8\xae\xd9\x8a\xd8"
+	"\xaa\xd8\xae\xd9\x89\xd8\xaa\xd9\x85\xd9\x8a\xd8\xaa\xd9\x85\xd9"
+	"\x89\xd8\xac\xd9\x85\xd9\x8a\xd8\xac\xd8\xad\xd9\x89\xd8\xac\xd9"
+	"\x85\xd9\x89\xd8\xb3\xd8\xae\xd9\x89\xd8\xb5\xd8\xad\xd9\x8a\xd8"
+	"\xb4\xd8\xad\xd9\x8a\xd8\xb6\xd8\xad\xd9\x8a\xd9\x84\xd8\xac\xd9"
+	"\x8a\xd9\x84\xd9\x85\xd9\x8a\xd9\x8a\xd8\xad\xd9\x8a\xd9\x8a\xd8"
+	"\xac\xd9\x8a\xd9\x8a\xd9\x85\xd9\x8a\xd9\x85\xd9\x85\xd9\x8a\xd9"
+	"\x82\xd9\x85\xd9\x8a\xd9\x86\xd8\xad\xd9\x8a\xd8\xb9\xd9\x85\xd9"
+	"\x8a\xd9\x83\xd9\x85\xd9\x8a\xd9\x86\xd8\xac\xd8\xad\xd9\x85\xd8"
+	"\xae\xd9\x8a\xd9\x84\xd8\xac\xd9\x85\xd9\x83\xd9\x85\xd9\x85\xd8"
+	"\xac\xd8\xad\xd9\x8a\xd8\xad\xd8\xac\xd9\x8a\xd9\x85\xd8\xac\xd9"
+	"\x8a\xd9\x81\xd9\x85\xd9\x8a\xd8\xa8\xd8\xad\xd9\x8a\xd8\xb3\xd8"
+	"\xae\xd9\x8a\xd9\x86\xd8\xac\xd9\x8a\xd8\xb5\xd9\x84\xdb\x92\xd9"
+	"\x82\xd9\x84\xdb\x92\xd8\xa7\xd9\x84\xd9\x84\xd9\x87\xd8\xa7\xd9"
+	"\x83\xd8\xa8\xd8\xb1\xd9\x85\xd8\xad\xd9\x85\xd8\xaf\xd8\xb5\xd9"
+	"\x84\xd8\xb9\xd9\x85\xd8\xb1\xd8\xb3\xd9\x88\xd9\x84\xd8\xb9\xd9"
+	"\x84\xd9\x8a\xd9\x87\xd9\x88\xd8\xb3\xd9\x84\xd9\x85\xd8\xb5\xd9"
+	"\x84\xd9\x89\xd8\xb5\xd9\x84\xd9\x89\x20\xd8\xa7\xd9\x84\xd9\x84"
+	"\xd9\x87\x20\xd8\xb9\xd9\x84\xd9\x8a\xd9\x87\x20\xd9\x88\xd8\xb3"
+	"\xd9\x84\xd9\x85\xd8\xac\xd9\x84\x20\xd8\xac\xd9\x84\xd8\xa7\xd9"
+	"\x84\xd9\x87\xd8\xb1\xdb\x8c\xd8\xa7\xd9\x84\x2c\xe3\x80\x81\xe3"
+	"\x80\x82\x3a\x21\x3f\xe3\x80\x96\xe3\x80\x97\xe2\x80\x94\xe2\x80"
+	"\x93\x5f\x7b\x7d\xe3\x80\x94\xe3\x80\x95\xe3\x80\x90\xe3\x80\x91"
+	"\xe3\x80\x8a\xe3\x80\x8b\xe3\x80\x8c\xe3\x80\x8d\xe3\x80\x8e\xe3"
+	"\x80\x8f\x5b\x5d\x23\x26\x2a\x2d\x5c\x24\x25\x40\x20\xd9\x8b\xd9"
+	"\x80\xd9\x8b\x20\xd9\x8c\x20\xd9\x8d\x20\xd9\x8e\xd9\x80\xd9\x8e"
+	"\x20\xd9\x8f\xd9\x80\xd9\x8f\x20\xd9\x90\xd9\x80\xd9\x90\x20\xd9"
+	"\x91\xd9\x80\xd9\x91\x20\xd9\x92\xd9\x80\xd9\x92\xd8\xa1\xd8\xa2"
+	"\xd8\xa3\xd8\xa4\xd8\xa5\xd8\xa6\xd8\xa7\xd8\xa8\xd8\xa9\xd8\xaa"
+	"\xd8\xab\xd8\xac\xd8\xad\xd8\xae\xd8\xaf\xd8\xb0\xd8\xb1\xd8\xb2"
+	"\xd8\xb3\xd8\xb4\xd8\xb5\xd8\xb6\xd8\xb7\xd8\xb8\xd8\xb9\xd8\xba"
+	"\xd9\x81\xd9\x82\xd9\x83\xd9\x84\xd9\x85\xd9\x86\xd9\x87\xd9\x88"
+	"\xd9\x8a\xd9\x84\xd8\xa2\xd9\x84\xd8\xa3\xd9\x84\xd8\xa5\xd9\x84"
+	"\xd8\xa7\x22\x27\x2f\x5e\x7c\x7e\xe2\xa6\x85\xe2\xa6\x86\xe3\x83"
+	"\xbb\xe3\x82\xa1\xe3\x82\xa3\xe3\x82\xa5\xe3\x82\xa7\xe3\x82\xa9"
+	"\xe3\x83\xa3\xe3\x83\xa5\xe3\x83\xa7\xe3\x83\x83\xe3\x83\xbc\xe3"
+	"\x83\xb3\xe3\x82\x99\xe3\x82\x9a\xc2\xa2\xc2\xa3\xc2\xac\xc2\xa6"
+	"\xc2\xa5\xe2\x82\xa9\xe2\x94\x82\xe2\x86\x91\xe2\x86\x93\xe2\x96"
+	"\xa0\xe2\x97\x8b\xf0\x90\x90\xa8\xf0\x90\x90\xa9\xf0\x90\x90\xaa"
+	"\xf0\x90\x90\xab\xf0\x90\x90\xac\xf0\x90\x90\xad\xf0\x90\x90\xae"
+	"\xf0\x90\x90\xaf\xf0\x90\x90\xb0\xf0\x90\x90\xb1\xf0\x90\x90\xb2"
+	"\xf0\x90\x90\xb3\xf0\x90\x90\xb4\xf0\x90\x90\xb5\xf0\x90\x90\xb6"
+	"\xf0\x90\x90\xb7\xf0\x90\x90\xb8\xf0\x90\x90\xb9\xf0\x90\x90\xba"
+	"\xf0\x90\x90\xbb\xf0\x90\x90\xbc\xf0\x90\x90\xbd\xf0\x90\x90\xbe"
+	"\xf0\x90\x90\xbf\xf0\x90\x91\x80\xf0\x90\x91\x81\xf0\x90\x91\x82"
+	"\xf0\x90\x91\x83\xf0\x90\x91\x84\xf0\x90\x91\x85\xf0\x90\x91\x86"
+	"\xf0\x90\x91\x87\xf0\x90\x91\x88\xf0\x90\x91\x89\xf0\x90\x91\x8a"
+	"\xf0\x90\x91\x8b\xf0\x90\x91\x8c\xf0\x90\x91\x8d\xf0\x90\x91\x8e"
+	"\xf0\x90\x91\x8f\xf0\x90\x93\x98\xf0\x90\x93\x99\xf0\x90\x93\x9a"
+	"\xf0\x90\x93\x9b\xf0\x90\x93\x9c\xf0\x90\x93\x9d\xf0\x90\x93\x9e"
+	"\xf0\x90\x93\x9f\xf0\x90\x93\xa0\xf0\x90\x93\xa1\xf0\x90\x93\xa2"
+	"\xf0\x90\x93\xa3\xf0\x90\x93\xa4\xf0\x90\x93\xa5\xf0\x90\x93\xa6"
+	"\xf0\x90\x93\xa7\xf0\x90\x93\xa8\xf0\x90\x93\xa9\xf0\x90\x93\xaa"
+	"\xf0\x90\x93\xab\xf0\x90\x93\xac\xf0\x90\x93\xad\xf0\x90\x93\xae"
+	"\xf0\x90\x93\xaf\xf0\x90\x93\xb0\xf0\x90\x93\xb1\xf0\x90\x93\xb2"
+	"\xf0\x90\x93\xb3\xf0\x90\x93\xb4\xf0\x90\x93\xb5\xf0\x90\x93\xb6"
+	"\xf0\x90\x93\xb7\xf0\x90\x93\xb8\xf0\x90\x93\xb9\xf0\x90\x93\xba"
+	"\xf0\x90\x93\xbb\xf0\x90\x96\x97\xf0\x90\x96\x98\xf0\x90\x96\x99"
+	"\xf0\x90\x96\x9a\xf0\x90\x96\x9b\xf0\x90\x96\x9c\xf0\x90\x96\x9d"
+	"\xf0\x90\x96\x9e\xf0\x90\x96\x9f\xf0\x90\x96\xa0\xf0\x90\x96\xa1"
+	"\xf0\x90\x96\xa3\xf0\x90\x96\xa4\xf0\x90\x96\xa5\xf0\x90\x96\xa6"
+	"\xf0\x90\x96\xa7\xf0\x90\x96\xa8\xf0\x90\x96\xa9\xf0\x90\x96\xaa"
+	"\xf0\x90\x96\xab\xf0\x90\x96\xac\xf0\x90\x96\xad\xf0\x90\x96\xae"
+	"\xf0\x90\x96\xaf\xf0\x90\x96\xb0\xf0\x90\x96\xb1\xf0\x90\x96\xb3"
+	"\xf0\x90\x96\xb4\xf0\x90\x96\xb5\xf0\x90\x96\xb6\xf0\x90\x96\xb7"
+	"\xf0\x90\x96\xb8\xf0\x90\x96\xb9\xf0\x90\x96\xbb\xf0\x90\x96\xbc"
+	"\xcb\x90\xcb\x91\xca\x99\xca\xa3\xea\xad\xa6\xca\xa5\xca\xa4\xe1"
+	"\xb6\x91\xc9\x98\xc9\x9e\xca\xa9\xc9\xa4\xc9\xa2\xca\x9b\xca\x9c"
+	"\xc9\xa7\xca\x84\xca\xaa\xca\xab\xf0\x9d\xbc\x84\xea\x9e\x8e\xc9"
+	"\xae\xf0\x9d\xbc\x85\xca\x8e\xf0\x9d\xbc\x86\xc9\xb6\xc9\xb7\xc9"
+	"\xba\xf0\x9d\xbc\x88\xc9\xbe\xca\xa8\xca\xa6\xea\xad\xa7\xca\xa7"
+	"\xe2\xb1\xb1\xca\x8f\xca\xa1\xca\xa2\xca\x98\xc7\x80\xc7\x81\xc7"
+	"\x82\xf0\x9d\xbc\x8a\xf0\x9d\xbc\x9e\xf0\x90\xb3\x80\xf0\x90\xb3"
+	"\x81\xf0\x90\xb3\x82\xf0\x90\xb3\x83\xf0\x90\xb3\x84\xf0\x90\xb3"
+	"\x85\xf0\x90\xb3\x86\xf0\x90\xb3\x87\xf0\x90\xb3\x88\xf0\x90\xb3"
+	"\x89\xf0\x90\xb3\x8a\xf0\x90\xb3\x8b\xf0\x90\xb3\x8c\xf0\x90\xb3"
+	"\x8d\xf0\x90\xb3\x8e\xf0\x90\xb3\x8f\xf0\x90\xb3\x90\xf0\x90\xb3"
+	"\x91\xf0\x90\xb3\x92\xf0\x90\xb3\x93\xf0\x90\xb3\x94\xf0\x90\xb3"
+	"\x95\xf0\x90\xb3\x96\xf0\x90\xb3\x97\xf0\x90\xb3\x98\xf0\x90\xb3"
+	"\x99\xf0\x90\xb3\x9a\xf0\x90\xb3\x9b\xf0\x90\xb3\x9c\xf0\x90\xb3"
+	"\x9d\xf0\x90\xb3\x9e\xf0\x90\xb3\x9f\xf0\x90\xb3\xa0\xf0\x90\xb3"
+	"\xa1\xf0\x90\xb3\xa2\xf0\x90\xb3\xa3\xf0\x90\xb3\xa4\xf0\x90\xb3"
+	"\xa5\xf0\x90\xb3\xa6\xf0\x90\xb3\xa7\xf0\x90\xb3\xa8\xf0\x90\xb3"
+	"\xa9\xf0\x90\xb3\xaa\xf0\x90\xb3\xab\xf0\x90\xb3\xac\xf0\x90\xb3"
+	"\xad\xf0\x90\xb3\xae\xf0\x90\xb3\xaf\xf0\x90\xb3\xb0\xf0\x90\xb3"
+	"\xb1\xf0\x90\xb3\xb2\xf0\x91\xa3\x80\xf0\x91\xa3\x81\xf0\x91\xa3"
+	"\x82\xf0\x91\xa3\x83\xf0\x91\xa3\x84\xf0\x91\xa3\x85\xf0\x91\xa3"
+	"\x86\xf0\x91\xa3\x87\xf0\x91\xa3\x88\xf0\x91\xa3\x89\xf0\x91\xa3"
+	"\x8a\xf0\x91\xa3\x8b\xf0\x91\xa3\x8c\xf0\x91\xa3\x8d\xf0\x91\xa3"
+	"\x8e\xf0\x91\xa3\x8f\xf0\x91\xa3\x90\xf0\x91\xa3\x91\xf0\x91\xa3"
+	"\x92\xf0\x91\xa3\x93\xf0\x91\xa3\x94\xf0\x91\xa3\x95\xf0\x91\xa3"
+	"\x96\xf0\x91\xa3\x97\xf0\x91\xa3\x98\xf0\x91\xa3\x99\xf0\x91\xa3"
+	"\x9a\xf0\x91\xa3\x9b\xf0\x91\xa3\x9c\xf0\x91\xa3\x9d\xf0\x91\xa3"
+	"\x9e\xf0\x91\xa3\x9f\xf0\x96\xb9\xa0\xf0\x96\xb9\xa1\xf0\x96\xb9"
+	"\xa2\xf0\x96\xb9\xa3\xf0\x96\xb9\xa4\xf0\x96\xb9\xa5\xf0\x96\xb9"
+	"\xa6\xf0\x96\xb9\xa7\xf0\x96\xb9\xa8\xf0\x96\xb9\xa9\xf0\x96\xb9"
+	"\xaa\xf0\x96\xb9\xab\xf0\x96\xb9\xac\xf0\x96\xb9\xad\xf0\x96\xb9"
+	"\xae\xf0\x96\xb9\xaf\xf0\x96\xb9\xb0\xf0\x96\xb9\xb1\xf0\x96\xb9"
+	"\xb2\xf0\x96\xb9\xb3\xf0\x96\xb9\xb4\xf0\x96\xb9\xb5\xf0\x96\xb9"
+	"\xb6\xf0\x96\xb9\xb7\xf0\x96\xb9\xb8\xf0\x96\xb9\xb9\xf0\x96\xb9"
+	"\xba\xf0\x96\xb9\xbb\xf0\x96\xb9\xbc\xf0\x96\xb9\xbd\xf0\x96\xb9"
+	"\xbe\xf0\x96\xb9\xbf\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xf0\x9d\x85"
+	"\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85"
+	"\xae\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xaf\xf0\x9d\x85"
+	"\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xb0\xf0\x9d\x85\x98\xf0\x9d\x85"
+	"\xa5\xf0\x9d\x85\xb1\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85"
+	"\xb2\xf0\x9d\x86\xb9\xf0\x9d\x85\xa5\xf0\x9d\x86\xba\xf0\x9d\x85"
+	"\xa5\xf0\x9d\x86\xb9\xf0\x9d\x85\xa5\xf0\x9d\x85\xae\xf0\x9d\x86"
+	"\xba\xf0\x9d\x85\xa5\xf0\x9d\x85\xae\xf0\x9d\x86\xb9\xf0\x9d\x85"
+	"\xa5\xf0\x9d\x85\xaf\xf0\x9d\x86\xba\xf0\x9d\x85\xa5\xf0\x9d\x85"
+	"\xaf\xc4\xb1\xc8\xb7\xe2\x88\x87\xe2\x88\x82\xf0\x9e\xa4\xa2\xf0"
+	"\x9e\xa4\xa3\xf0\x9e\xa4\xa4\xf0\x9e\xa4\xa5\xf0\x9e\xa4\xa6\xf0"
+	"\x9e\xa4\xa7\xf0\x9e\xa4\xa8\xf0\x9e\xa4\xa9\xf0\x9e\xa4\xaa\xf0"
+	"\x9e\xa4\xab\xf0\x9e\xa4\xac\xf0\x9e\xa4\xad\xf0\x9e\xa4\xae\xf0"
+	"\x9e\xa4\xaf\xf0\x9e\xa4\xb0\xf0\x9e\xa4\xb1\xf0\x9e\xa4\xb2\xf0"
+	"\x9e\xa4\xb3\xf0\x9e\xa4\xb4\xf0\x9e\xa4\xb5\xf0\x9e\xa4\xb6\xf0"
+	"\x9e\xa4\xb7\xf0\x9e\xa4\xb8\xf0\x9e\xa4\xb9\xf0\x9e\xa4\xba\xf0"
+	"\x9e\xa4\xbb\xf0\x9e\xa4\xbc\xf0\x9e\xa4\xbd\xf0\x9e\xa4\xbe\xf0"
+	"\x9e\xa4\xbf\xf0\x9e\xa5\x80\xf0\x9e\xa5\x81\xf0\x9e\xa5\x82\xf0"
+	"\x9e\xa5\x83\xd9\xae\xda\xa1\xd9\xaf\x30\x2e\x30\x2c\x31\x2c\x32"
+	"\x2c\x33\x2c\x34\x2c\x35\x2c\x36\x2c\x37\x2c\x38\x2c\x39\x2c\xe3"
+	"\x80\x94\x73\xe3\x80\x95\x77\x7a\x68\x76\x73\x64\x70\x70\x76\x77"
+	"\x63\x6d\x63\x6d\x64\x6d\x72\x64\x6a\xe3\x81\xbb\xe3\x81\x8b\xe3"
+	"\x82\xb3\xe3\x82\xb3\xe5\xad\x97\xe5\x8f\x8c\xe3\x83\x87\xe5\xa4"
+	"\x9a\xe8\xa7\xa3\xe4\xba\xa4\xe6\x98\xa0\xe7\x84\xa1\xe5\x89\x8d"
+	"\xe5\xbe\x8c\xe5\x86\x8d\xe6\x96\xb0\xe5\x88\x9d\xe7\xb5\x82\xe8"
+	"\xb2\xa9\xe5\xa3\xb0\xe5\x90\xb9\xe6\xbc\x94\xe6\x8a\x95\xe6\x8d"
+	"\x95\xe9\x81\x8a\xe6\x8c\x87\xe6\x89\x93\xe7\xa6\x81\xe7\xa9\xba"
+	"\xe5\x90\x88\xe6\xba\x80\xe7\x94\xb3\xe5\x89\xb2\xe5\x96\xb6\xe9"
+	"\x85\x8d\xe3\x80\x94\xe6\x9c\xac\xe3\x80\x95\xe3\x80\x94\xe4\xb8"
+	"\x89\xe3\x80\x95\xe3\x80\x94\xe4\xba\x8c\xe3\x80\x95\xe3\x80\x94"
+	"\xe5\xae\x89\xe3\x80\x95\xe3\x80\x94\xe7\x82\xb9\xe3\x80\x95\xe3"
+	"\x80\x94\xe6\x89\x93\xe3\x80\x95\xe3\x80\x94\xe7\x9b\x97\xe3\x80"
+	"\x95\xe3\x80\x94\xe5\x8b\x9d\xe3\x80\x95\xe3\x80\x94\xe6\x95\x97"
+	"\xe3\x80\x95\xe5\xbe\x97\xe5\x8f\xaf\xe4\xb8\xbd\xe4\xb8\xb8\xe4"
+	"\xb9\x81\xf0\xa0\x84\xa2\xe4\xbd\xa0\xe4\xbe\xbb\xe5\x80\x82\xe5"
+	"\x81\xba\xe5\x82\x99\xe5\x83\x8f\xe3\x92\x9e\xf0\xa0\x98\xba\xe5"
+	"\x85\x94\xe5\x85\xa4\xe5\x85\xb7\xf0\xa0\x94\x9c\xe3\x92\xb9\xe5"
+	"\x85\xa7\xf0\xa0\x95\x8b\xe5\x86\x97\xe5\x86\xa4\xe4\xbb\x8c\xe5"
+	"\x86\xac\xf0\xa9\x87\x9f\xe5\x88\x83\xe3\x93\x9f\xe5\x88\xbb\xe5"
+	"\x89\x86\xe5\x89\xb7\xe3\x94\x95\xe5\x8c\x85\xe5\x8c\x86\xe5\x8d"
+	"\x89\xe5\x8d\x9a\xe5\x8d\xb3\xe5\x8d\xbd\xe5\x8d\xbf\xf0\xa0\xa8"
+	"\xac\xe7\x81\xb0\xe5\x8f\x8a\xe5\x8f\x9f\xf0\xa0\xad\xa3\xe5\x8f"
+	"\xab\xe5\x8f\xb1\xe5\x90\x86\xe5\x92\x9e\xe5\x90\xb8\xe5\x91\x88"
+	"\xe5\x91\xa8\xe5\x92\xa2\xe5\x93\xb6\xe5\x94\x90\xe5\x95\x93\xe5"
+	"\x95\xa3\xe5\x96\x84\xe5\x96\xab\xe5\x96\xb3\xe5\x97\x82\xe5\x9c"
+	"\x96\xe5\x9c\x97\xe5\x99\x91\xe5\x99\xb4\xe5\xa3\xae\xe5\x9f\x8e"
+	"\xe5\x9f\xb4\xe5\xa0\x8d\xe5\x9e\x8b\xe5\xa0\xb2\xe5\xa0\xb1\xe5"
+	"\xa2\xac\xf0\xa1\x93\xa4\xe5\xa3\xb2\xe5\xa3\xb7\xe5\xa4\x86\xe5"
+	"\xa4\xa2\xe5\xa5\xa2\xf0\xa1\x9a\xa8\xf0\xa1\x9b\xaa\xe5\xa7\xac"
+	"\xe5\xa8\x9b\xe5\xa8\xa7\xe5\xa7\x98\xe5\xa9\xa6\xe3\x9b\xae\xe3"
+	"\x9b\xbc\xe5\xac\x88\xe5\xac\xbe\xf0\xa1\xa7\x88\xe5\xaf\x83\xe5"
+	"\xaf\x98\xe5\xaf\xb3\xf0\xa1\xac\x98\xe5\xaf\xbf\xe5\xb0\x86\xe5"
+	"\xbd\x93\xe3\x9e\x81\xe5\xb1\xa0\xe5\xb3\x80\xe5\xb2\x8d\xf0\xa1"
+	"\xb7\xa4\xe5\xb5\x83\xf0\xa1\xb7\xa6\xe5\xb5\xae\xe5\xb5\xab\xe5"
+	"\xb5\xbc\xe5\xb7\xa1\xe5\xb7\xa2\xe3\xa0\xaf\xe5\xb7\xbd\xe5\xb8"
+	"\xa8\xe5\xb8\xbd\xe5\xb9\xa9\xe3\xa1\xa2\xf0\xa2\x86\x83\xe3\xa1"
+	"\xbc\xe5\xba\xb0\xe5\xba\xb3\xe5\xba\xb6\xf0\xaa\x8e\x92\xf0\xa2"
+	"\x8c\xb1\xe8\x88\x81\xe5\xbc\xa2\xe3\xa3\x87\xf0\xa3\x8a\xb8\xf0"
+	"\xa6\x87\x9a\xe5\xbd\xa2\xe5\xbd\xab\xe3\xa3\xa3\xe5\xbe\x9a\xe5"
+	"\xbf\x8d\xe5\xbf\x97\xe5\xbf\xb9\xe6\x82\x81\xe3\xa4\xba\xe3\xa4"
+	"\x9c\xf0\xa2\x9b\x94\xe6\x83\x87\xe6\x85\x88\xe6\x85\x8c\xe6\x85"
+	"\xba\xe6\x86\xb2\xe6\x86\xa4\xe6\x86\xaf\xe6\x87\x9e\xe6\x88\x90"
+	"\xe6\x88\x9b\xe6\x89\x9d\xe6\x8a\xb1\xe6\x8b\x94\xe6\x8d\x90\xf0"
+	"\xa2\xac\x8c\xe6\x8c\xbd\xe6\x8b\xbc\xe6\x8d\xa8\xe6\x8e\x83\xe6"
+	"\x8f\xa4\xf0\xa2\xaf\xb1\xe6\x90\xa2\xe6\x8f\x85\xe6\x8e\xa9\xe3"
+	"\xa8\xae\xe6\x91\xa9\xe6\x91\xbe\xe6\x92\x9d\xe6\x91\xb7\xe3\xa9"
+	"\xac\xe6\x95\xac\xf0\xa3\x80\x8a\xe6\x97\xa3\xe6\x9b\xb8\xe6\x99"
+	"\x89\xe3\xac\x99\xe3\xac\x88\xe3\xab\xa4\xe5\x86\x92\xe5\x86\x95"
+	"\xe6\x9c\x80\xe6\x9a\x9c\xe8\x82\xad\xe4\x8f\x99\xe6\x9c\xa1\xe6"
+	"\x9d\x9e\xe6\x9d\x93\xf0\xa3\x8f\x83\xe3\xad\x89\xe6\x9f\xba\xe6"
+	"\x9e\x85\xe6\xa1\x92\xf0\xa3\x91\xad\xe6\xa2\x8e\xe6\xa0\x9f\xe6"
+	"\xa4\x94\xe6\xa5\x82\xe6\xa6\xa3\xe6\xa7\xaa\xe6\xaa\xa8\xf0\xa3"
+	"\x9a\xa3\xe6\xab\x9b\xe3\xb0\x98\xe6\xac\xa1\xf0\xa3\xa2\xa7\xe6"
+	"\xad\x94\xe3\xb1\x8e\xe6\xad\xb2\xe6\xae\x9f\xe6\xae\xbb\xf0\xa3"
+	"\xaa\x8d\xf0\xa1\xb4\x8b\xf0\xa3\xab\xba\xe6\xb1\x8e\xf0\xa3\xb2"
+	"\xbc\xe6\xb2\xbf\xe6\xb3\x8d\xe6\xb1\xa7\xe6\xb4\x96\xe6\xb4\xbe"
+	"\xe6\xb5\xa9\xe6\xb5\xb8\xe6\xb6\x85\xf0\xa3\xb4\x9e\xe6\xb4\xb4"
+	"\xe6\xb8\xaf\xe6\xb9\xae\xe3\xb4\xb3\xe6\xbb\x87\xf0\xa3\xbb\x91"
+	"\xe6\xb7\xb9\xe6\xbd\xae\xf0\xa3\xbd\x9e\xf0\xa3\xbe\x8e\xe6\xbf"
+	"\x86\xe7\x80\xb9\xe7\x80\x9b\xe3\xb6\x96\xe7\x81\x8a\xe7\x81\xbd"
+	"\xe7\x81\xb7\xe7\x82\xad\xf0\xa0\x94\xa5\xe7\x85\x85\xf0\xa4\x89"
+	"\xa3\xe7\x86\x9c\xf0\xa4\x8e\xab\xe7\x88\xa8\xe7\x89\x90\xf0\xa4"
+	"\x98\x88\xe7\x8a\x80\xe7\x8a\x95\xf0\xa4\x9c\xb5\xf0\xa4\xa0\x94"
+	"\xe7\x8d\xba\xe7\x8e\x8b\xe3\xba\xac\xe7\x8e\xa5\xe3\xba\xb8\xe7"
+	"\x91\x87\xe7\x91\x9c\xe7\x92\x85\xe7\x93\x8a\xe3\xbc\x9b\xe7\x94"
+	"\xa4\xf0\xa4\xb0\xb6\xe7\x94\xbe\xf0\xa4\xb2\x92\xf0\xa2\x86\x9f"
+	"\xe7\x98\x90\xf0\xa4\xbe\xa1\xf0\xa4\xbe\xb8\xf0\xa5\x81\x84\xe3"
+	"\xbf\xbc\xe4\x80\x88\xf0\xa5\x83\xb3\xf0\xa5\x83\xb2\xf0\xa5\x84"
+	"\x99\xf0\xa5\x84\xb3\xe7\x9c\x9e\xe7\x9c\x9f\xe7\x9e\x8b\xe4\x81"
+	"\x86\xe4\x82\x96\xf0\xa5\x90\x9d\xe7\xa1\x8e\xe4\x83\xa3\xf0\xa5"
+	"\x98\xa6\xf0\xa5\x9a\x9a\xf0\xa5\x9b\x85\xe7\xa7\xab\xe4\x84\xaf"
+	"\xe7\xa9\x8a\xe7\xa9\x8f\xf0\xa5\xa5\xbc\xf0\xa5\xaa\xa7\xe7\xab"
+	"\xae\xe4\x88\x82\xf0\xa5\xae\xab\xe7\xaf\x86\xe7\xaf\x89\xe4\x88"
+	"\xa7\xf0\xa5\xb2\x80\xe7\xb3\x92\xe4\x8a\xa0\xe7\xb3\xa8\xe7\xb3"
+	"\xa3\xe7\xb4\x80\xf0\xa5\xbe\x86\xe7\xb5\xa3\xe4\x8c\x81\xe7\xb7"
+	"\x87\xe7\xb8\x82\xe7\xb9\x85\xe4\x8c\xb4\xf0\xa6\x88\xa8\xf0\xa6"
+	"\x89\x87\xe4\x8d\x99\xf0\xa6\x8b\x99\xe7\xbd\xba\xf0\xa6\x8c\xbe"
+	"\xe7\xbe\x95\xe7\xbf\xba\xf0\xa6\x93\x9a\xf0\xa6\x94\xa3\xe8\x81"
+	"\xa0\xf0\xa6\x96\xa8\xe8\x81\xb0\xf0\xa3\x8d\x9f\xe4\x8f\x95\xe8"
+	"\x82\xb2\xe8\x84\x83\xe4\x90\x8b\xe8\x84\xbe\xe5\xaa\xb5\xf0\xa6"
+	"\x9e\xa7\xf0\xa6\x9e\xb5\xf0\xa3\x8e\x93\xf0\xa3\x8e\x9c\xe8\x88"
+	"\x84\xe8\xbe\x9e\xe4\x91\xab\xe8\x8a\x91\xe8\x8a\x8b\xe8\x8a\x9d"
+	"\xe5\x8a\xb3\xe8\x8a\xb1\xe8\x8a\xb3\xe8\x8a\xbd\xe8\x8b\xa6\xf0"
+	"\xa6\xac\xbc\xe8\x8c\x9d\xe8\x8d\xa3\xe8\x8e\xad\xe8\x8c\xa3\xe8"
+	"\x8e\xbd\xe8\x8f\xa7\xe8\x8d\x93\xe8\x8f\x8a\xe8\x8f\x8c\xe8\x8f"
+	"\x9c\xf0\xa6\xb0\xb6\xf0\xa6\xb5\xab\xf0\xa6\xb3\x95\xe4\x94\xab"
+	"\xe8\x93\xb1\xe8\x93\xb3\xe8\x94\x96\xf0\xa7\x8f\x8a\xe8\x95\xa4"
+	"\xf0\xa6\xbc\xac\xe4\x95\x9d\xe4\x95\xa1\xf0\xa6\xbe\xb1\xf0\xa7"
+	"\x83\x92\xe4\x95\xab\xe8\x99\x90\xe8\x99\xa7\xe8\x99\xa9\xe8\x9a"
+	"\xa9\xe8\x9a\x88\xe8\x9c\x8e\xe8\x9b\xa2\xe8\x9c\xa8\xe8\x9d\xab"
+	"\xe8\x9e\x86\xe4\x97\x97\xe8\x9f\xa1\xe8\xa0\x81\xe4\x97\xb9\xe8"
+	"\xa1\xa0\xf0\xa7\x99\xa7\xe8\xa3\x97\xe8\xa3\x9e\xe4\x98\xb5\xe8"
+	"\xa3\xba\xe3\x92\xbb\xf0\xa7\xa2\xae\xf0\xa7\xa5\xa6\xe4\x9a\xbe"
+	"\xe4\x9b\x87\xe8\xaa\xa0\xf0\xa7\xb2\xa8\xe8\xb2\xab\xe8\xb3\x81"
+	"\xe8\xb4\x9b\xe8\xb5\xb7\xf0\xa7\xbc\xaf\xf0\xa0\xa0\x84\xe8\xb7"
+	"\x8b\xe8\xb6\xbc\xe8\xb7\xb0\xf0\xa0\xa3\x9e\xe8\xbb\x94\xf0\xa8"
+	"\x97\x92\xf0\xa8\x97\xad\xe9\x82\x94\xe9\x83\xb1\xe9\x84\x91\xf0"
+	"\xa8\x9c\xae\xe9\x84\x9b\xe9\x88\xb8\xe9\x8b\x97\xe9\x8b\x98\xe9"
+	"\x89\xbc\xe9\x8f\xb9\xe9\x90\x95\xf0\xa8\xaf\xba\xe9\x96\x8b\xe4"
+	"\xa6\x95\xe9\x96\xb7\xf0\xa8\xb5\xb7\xe4\xa7\xa6\xe9\x9b\x83\xe5"
+	"\xb6\xb2\xe9\x9c\xa3\xf0\xa9\x85\x85\xf0\xa9\x88\x9a\xe4\xa9\xae"
+	"\xe4\xa9\xb6\xe9\x9f\xa0\xf0\xa9\x90\x8a\xe4\xaa\xb2\xf0\xa9\x92"
+	"\x96\xe9\xa0\xa9\xf0\xa9\x96\xb6\xe9\xa3\xa2\xe4\xac\xb3\xe9\xa4"
+	"\xa9\xe9\xa6\xa7\xe9\xa7\x82\xe9\xa7\xbe\xe4\xaf\x8e\xf0\xa9\xac"
+	"\xb0\xe9\xb1\x80\xe9\xb3\xbd\xe4\xb3\x8e\xe4\xb3\xad\xe9\xb5\xa7"
+	"\xf0\xaa\x83\x8e\xe4\xb3\xb8\xf0\xaa\x84\x85\xf0\xaa\x88\x8e\xf0"
+	"\xaa\x8a\x91\xe4\xb5\x96\xe9\xbb\xbe\xe9\xbc\x85\xe9\xbc\x8f\xe9"
+	"\xbc\x96\xf0\xaa\x98\x80"
+	;
+
+static const FoldEntry _fold_table[] = {
+	{ 0xa0, 0, 1 },
+	{ 0xa8, 0, 1 },
+	{ 0xaa, 1, 1 },
+	{ 0xaf, 0, 1 },
+	{ 0xb2, 2, 1 },
+	{ 0xb3, 3, 1 },
+	{ 0xb4, 0, 1 },
+	{ 0xb5, 4, 2 },
+	{ 0xb8, 0, 1 },
+	{ 0xb9, 6, 1 },
+	{ 0xba, 7, 1 },
+	{ 0xbc, 8, 5 },
+	{ 0xbd, 13, 5 },
+	{ 0xbe, 18, 5 },
+	{ 0xc0, 1, 1 },
+	{ 0xc1, 1, 1 },
+	{ 0xc2, 1, 1 },
+	{ 0xc3, 1, 1 },
+	{ 0xc4, 1, 1 },
+	{ 0xc5, 1, 1 },
+	{ 0xc6, 23, 2 },
+	{ 0xc7, 25, 1 },
+	{ 0xc8, 26, 1 },
+	{ 0xc9, 26, 1 },
+	{ 0xca, 26, 1 },
+	{ 0xcb, 26, 1 },
+	{ 0xcc, 27, 1 },
+	{ 0xcd, 27, 1 },
+	{ 0xce, 27, 1 },
+	{ 0xcf, 27, 1 },
+	{ 0xd0, 28, 2 },
+	{ 0xd1, 30, 1 },
+	{ 0xd2, 7, 1 },
+	{ 0xd3, 7, 1 },
+	{ 0xd4, 7, 1 },
+	{ 0xd5, 7, 1 },
+	{ 0xd6, 7, 1 },
+	{ 0xd8, 31, 2 },
+	{ 0xd9, 33, 1 },
+	{ 0xda, 33, 1 },
+	{ 0xdb, 33, 1 },
+	{ 0xdc, 33, 1 },
+	{ 0xdd, 34, 1 },
+	{ 0xde, 35, 2 },
+	{ 0xdf, 37, 2 },
+	{ 0xe0, 1, 1 },
+	{ 0xe1, 1, 1 },
+	{ 0xe2, 1, 1 },
+	{ 0xe3, 1, 1 },
+	{ 0xe4, 1, 1 },
+	{ 0xe5, 1, 1 },
+	{ 0xe7, 25, 1 },
+	{ 0xe8, 26, 1 },
+	{ 0xe9, 26, 1 },
+	{ 0xea, 26, 1 },
+	{ 0xeb, 26, 1 },
+	{ 0xec, 27, 1 },
+	{ 0xed, 27, 1 },
+	{ 0xee, 27, 1 },
+	{ 0xef, 27, 1 },
+	{ 0xf1, 30, 1 },
+	{ 0xf2, 7, 1 },
+	{ 0xf3, 7, 1 },
+	{ 0xf4, 7, 1 },
+	{ 0xf5, 7, 1 },
+	{ 0xf6, 7, 1 },
+	{ 0xf9, 33, 1 },
+	{ 0xfa, 33, 1 },
+	{ 0xfb, 33, 1 },
+	{ 0xfc, 33, 1 },
+	{ 0xfd, 34, 1 },
+	{ 0xff, 34, 1 },
+	{ 0x100, 1, 1 },
+	{ 0x101, 1, 1 },
+	{ 0x102, 1, 1 },
+	{ 0x103, 1, 1 },
+	{ 0x104, 1, 1 },
+	{ 0x105, 1, 1 },
+	{ 0x106, 25, 1 },
+	{ 0x107, 25, 1 },
+	{ 0x108, 25, 1 },
+	{ 0x109, 25, 1 },
+	{ 0x10a, 25, 1 },
+	{ 0x10b, 25, 1 },
+	{ 0x10c, 25, 1 },
+	{ 0x10d, 25, 1 },
+	{ 0x10e, 39, 1 },
+	{ 0x10f, 39, 1 },
+	{ 0x110, 40, 2 },
+	{ 0x112, 26, 1 },
+	{ 0x113, 26, 1 },
+	{ 0x114, 26, 1 },
+	{ 0x115, 26, 1 },
+	{ 0x116, 26, 1 },
+	{ 0x117, 26, 1 },
+	{ 0x118, 26, 1 },
+	{ 0x119, 26, 1 },
+	{ 0x11a, 26, 1 },
+	{ 0x11b, 26, 1 },
+	{ 0x11c, 42, 1 },
+	{ 0x11d, 42, 1 },
+	{ 0x11e, 42, 1 },
+	{ 0x11f, 42, 1 },
+	{ 0x120, 42, 1 },
+	{ 0x121, 42, 1 },
+	{ 0x122, 42, 1 },
+	{ 0x123, 42, 1 },
+	{ 0x124, 43, 1 },
+	{ 0x125, 43, 1 },
+	{ 0x126, 44, 2 },
+	{ 0x128, 27, 1 },
+	{ 0x129, 27, 1 },
+	{ 0x12a, 27, 1 },
+	{ 0x12b, 27, 1 },
+	{ 0x12c, 27, 1 },
+	{ 0x12d, 27, 1 },
+	{ 0x12e, 27, 1 },
+	{ 0x12f, 27, 1 },
+	{ 0x130, 27, 1 },
+	{ 0x132, 46, 2 },
+	{ 0x133, 46, 2 },
+	{ 0x134, 48, 1 },
+	{ 0x135, 48, 1 },
+	{ 0x136, 49, 1 },
+	{ 0x137, 49, 1 },
+	{ 0x139, 50, 1 },
+	{ 0x13a, 50, 1 },
+	{ 0x13b, 50, 1 },
+	{ 0x13c, 50, 1 },
+	{ 0x13d, 50, 1 },
+	{ 0x13e, 50, 1 },
+	{ 0x13f, 51, 3 },
+	{ 0x140, 51, 3 },
+	{ 0x141, 54, 2 },
+	{ 0x143, 30, 1 },
+	{ 0x144, 30, 1 },
+	{ 0x145, 30, 1 },
+	{ 0x146, 30, 1 },
+	{ 0x147, 30, 1 },
+	{ 0x148, 30, 1 },
+	{ 0x149, 56, 3 },
+	{ 0x14a, 59, 2 },
+	{ 0x14c, 7, 1 },
+	{ 0x14d, 7, 1 },
+	{ 0x14e, 7, 1 },
+	{ 0x14f, 7, 1 },
+	{ 0x150, 7, 1 },
+	{ 0x151, 7, 1 },
+	{ 0x152, 61, 2 },
+	{ 0x154, 63, 1 },
+	{ 0x155, 63, 1 },
+	{ 0x156, 63, 1 },
+	{ 0x157, 63, 1 },
+	{ 0x158, 63, 1 },
+	{ 0x159, 63, 1 },
+	{ 0x15a, 64, 1 },
+	{ 0x15b, 64, 1 },
+	{ 0x15c, 64, 1 },
+	{ 0x15d, 64, 1 },
+	{ 0x15e, 64, 1 },
+	{ 0x15f, 64, 1 },
+	{ 0x160, 64, 1 },
+	{ 0x161, 64, 1 },
+	{ 0x162, 65, 1 },
+	{ 0x163, 65, 1 },
+	{ 0x164, 65, 1 },
+	{ 0x165, 65, 1 },
+	{ 0x166, 66, 2 },
+	{ 0x168, 33, 1 },
+	{ 0x169, 33, 1 },
+	{ 0x16a, 33, 1 },
+	{ 0x16b, 33, 1 },
+	{ 0x16c, 33, 1 },
+	{ 0x16d, 33, 1 },
+	{ 0x16e, 33, 1 },
+	{ 0x16f, 33, 1 },
+	{ 0x170, 33, 1 },
+	{ 0x171, 33, 1 },
+	{ 0x172, 33, 1 },
+	{ 0x173, 33, 1 },
+	{ 0x174, 68, 1 },
+	{ 0x175, 68, 1 },
+	{ 0x176, 34, 1 },
+	{ 0x177, 34, 1 },
+	{ 0x178, 34, 1 },
+	{ 0x179, 69, 1 },
+	{ 0x17a, 69, 1 },
+	{ 0x17b, 69, 1 },
+	{ 0x17c, 69, 1 },
+	{ 0x17d, 69, 1 },
+	{ 0x17e, 69, 1 },
+	{ 0x17f, 64, 1 },
+	{ 0x181, 70, 2 },
+	{ 0x182, 72, 2 },
+	{ 0x184, 74, 2 },
+	{ 0x186, 76, 2 },
+	{ 0x187, 78, 2 },
+	{ 0x189, 80, 2 },
+	{ 0x18a, 82, 2 },
+	{ 0x18b, 84, 2 },
+	{ 0x18e, 86, 2 },
+	{ 0x18f, 88, 2 },
+	{ 0x190, 90, 2 },
+	{ 0x191, 92, 2 },
+	{ 0x193, 94, 2 },
+	{ 0x194, 96, 2 },
+	{ 0x196, 98, 2 },
+	{ 0x197, 100, 2 },
+	{ 0x198, 102, 2 },
+	{ 0x19c, 104, 2 },
+	{ 0x19d, 106, 2 },
+	{ 0x19f, 108, 2 },
+	{ 0x1a0, 7, 1 },
+	{ 0x1a1, 7, 1 },
+	{ 0x1a2, 110, 2 },
+	{ 0x1a4, 112, 2 },
+	{ 0x1a6, 114, 2 },
+	{ 0x1a7, 116, 2 },
+	{ 0x1a9, 118, 2 },
+	{ 0x1ac, 120, 2 },
+	{ 0x1ae, 122, 2 },
+	{ 0x1af, 33, 1 },
+	{ 0x1b0, 33, 1 },
+	{ 0x1b1, 124, 2 },
+	{ 0x1b2, 126, 2 },
+	{ 0x1b3, 128, 2 },
+	{ 0x1b5, 130, 2 },
+	{ 0x1b7, 132, 2 },
+	{ 0x1b8, 134, 2 },
+	{ 0x1bc, 136, 2 },
+	{ 0x1c4, 138, 2 },
+	{ 0x1c5, 138, 2 },
+	{ 0x1c6, 138, 2 },
+	{ 0x1c7, 140, 2 },
+	{ 0x1c8, 140, 2 },
+	{ 0x1c9, 140, 2 },
+	{ 0x1ca, 142, 2 },
+	{ 0x1cb, 142, 2 },
+	{ 0x1cc, 142, 2 },
+	{ 0x1cd, 1, 1 },
+	{ 0x1ce, 1, 1 },
+	{ 0x1cf, 27, 1 },
+	{ 0x1d0, 27, 1 },
+	{ 0x1d1, 7, 1 },
+	{ 0x1d2, 7, 1 },
+	{ 0x1d3, 33, 1 },
+	{ 0x1d4, 33, 1 },
+	{ 0x1d5, 33, 1 },
+	{ 0x1d6, 33, 1 },
+	{ 0x1d7, 33, 1 },
+	{ 0x1d8, 33, 1 },
+	{ 0x1d9, 33, 1 },
+	{ 0x1da, 33, 1 },
+	{ 0x1db, 33, 1 },
+	{ 0x1dc, 33, 1 },
+	{ 0x1de, 1, 1 },
+	{ 0x1df, 1, 1 },
+	{ 0x1e0, 1, 1 },
+	{ 0x1e1, 1, 1 },
+	{ 0x1e2, 23, 2 },
+	{ 0x1e3, 23, 2 },
+	{ 0x1e4, 144, 2 },
+	{ 0x1e6, 42, 1 },
+	{ 0x1e7, 42, 1 },
+	{ 0x1e8, 49, 1 },
+	{ 0x1e9, 49, 1 },
+	{ 0x1ea, 7, 1 },
+	{ 0x1eb, 7, 1 },
+	{ 0x1ec, 7, 1 },
+	{ 0x1ed, 7, 1 },
+	{ 0x1ee, 132, 2 },
+	{ 0x1ef, 132, 2 },
+	{ 0x1f0, 48, 1 },
+	{ 0x1f1, 138, 2 },
+	{ 0x1f2, 138, 2 },
+	{ 0x1f3, 138, 2 },
+	{ 0x1f4, 42, 1 },
+	{ 0x1f5, 42, 1 },
+	{ 0x1f6, 146, 2 },
+	{ 0x1f7, 148, 2 },
+	{ 0x1f8, 30, 1 },
+	{ 0x1f9, 30, 1 },
+	{ 0x1fa, 1, 1 },
+	{ 0x1fb, 1, 1 },
+	{ 0x1fc, 23, 2 },
+	{ 0x1fd, 23, 2 },
+	{ 0x1fe, 31, 2 },
+	{ 0x1ff, 31, 2 },
+	{ 0x200, 1, 1 },
+	{ 0x201, 1, 1 },
+	{ 0x202, 1, 1 },
+	{ 0x203, 1, 1 },
+	{ 0x204, 26, 1 },
+	{ 0x205, 26, 1 },
+	{ 0x206, 26, 1 },
+	{ 0x207, 26, 1 },
+	{ 0x208, 27, 1 },
+	{ 0x209, 27, 1 },
+	{ 0x20a, 27, 1 },
+	{ 0x20b, 27, 1 },
+	{ 0x20c, 7, 1 },
+	{ 0x20d, 7, 1 },
+	{ 0x20e, 7, 1 },
+	{ 0x20f, 7, 1 },
+	{ 0x210, 63, 1 },
+	{ 0x211, 63, 1 },
+	{ 0x212, 63, 1 },
+	{ 0x213, 63, 1 },
+	{ 0x214, 33, 1 },
+	{ 0x215, 33, 1 },
+	{ 0x216, 33, 1 },
+	{ 0x217, 33, 1 },
+	{ 0x218, 64, 1 },
+	{ 0x219, 64, 1 },
+	{ 0x21a, 65, 1 },
+	{ 0x21b, 65, 1 },
+	{ 0x21c, 150, 2 },
+	{ 0x21e, 43, 1 },
+	{ 0x21f, 43, 1 },
+	{ 0x220, 152, 2 },
+	{ 0x222, 154, 2 },
+	{ 0x224, 156, 2 },
+	{ 0x226, 1, 1 },
+	{ 0x227, 1, 1 },
+	{ 0x228, 26, 1 },
+	{ 0x229, 26, 1 },
+	{ 0x22a, 7, 1 },
+	{ 0x22b, 7, 1 },
+	{ 0x22c, 7, 1 },
+	{ 0x22d, 7, 1 },
+	{ 0x22e, 7, 1 },
+	{ 0x22f, 7, 1 },
+	{ 0x230, 7, 1 },
+	{ 0x231, 7, 1 },
+	{ 0x232, 34, 1 },
+	{ 0x233, 34, 1 },
+	{ 0x23a, 158, 3 },
+	{ 0x23b, 161, 2 },
+	{ 0x23d, 163, 2 },
+	{ 0x23e, 165, 3 },
+	{ 0x241, 168, 2 },
+	{ 0x243, 170, 2 },
+	{ 0x244, 172, 2 },
+	{ 0x245, 174, 2 },
+	{ 0x246, 176, 2 },
+	{ 0x248, 178, 2 },
+	{ 0x24a, 180, 2 },
+	{ 0x24c, 182, 2 },
+	{ 0x24e, 184, 2 },
+	{ 0x2b0, 43, 1 },
+	{ 0x2b1, 186, 2 },
+	{ 0x2b2, 48, 1 },
+	{ 0x2b3, 63, 1 },
+	{ 0x2b4, 188, 2 },
+	{ 0x2b5, 190, 2 },
+	{ 0x2b6, 192, 2 },
+	{ 0x2b7, 68, 1 },
+	{ 0x2b8, 34, 1 },
+	{ 0x2d8, 0, 1 },
+	{ 0x2d9, 0, 1 },
+	{ 0x2da, 0, 1 },
+	{ 0x2db, 0, 1 },
+	{ 0x2dc, 0, 1 },
+	{ 0x2dd, 0, 1 },
+	{ 0x2e0, 96, 2 },
+	{ 0x2e1, 50, 1 },
+	{ 0x2e2, 64, 1 },
+	{ 0x2e3, 194, 1 },
+	{ 0x2e4, 195, 2 },
+	{ 0x300, 197, 0 },
+	{ 0x301, 197, 0 },
+	{ 0x302, 197, 0 },
+	{ 0x303, 197, 0 },
+	{ 0x304, 197, 0 },
+	{ 0x305, 197, 0 },
+	{ 0x306, 197, 0 },
+	{ 0x307, 197, 0 },
+	{ 0x308, 197, 0 },
+	{ 0x309, 197, 0 },
+	{ 0x30a, 197, 0 },
+	{ 0x30b, 197, 0 },
+	{ 0x30c, 197, 0 },
+	{ 0x30d, 197, 0 },
+	{ 0x30e, 197, 0 },
+	{ 0x30f, 197, 0 },
+	{ 0x310, 197, 0 },
+	{ 0x311, 197, 0 },
+	{ 0x312, 197, 0 },
+	{ 0x313, 197, 0 },
+	{ 0x314, 197, 0 },
+	{ 0x315, 197, 0 },
+	{ 0x316, 197, 0 },
+	{ 0x317, 197, 0 },
+	{ 0x318, 197, 0 },
+	{ 0x319, 197, 0 },
+	{ 0x31a, 197, 0 },
+	{ 0x31b, 197, 0 },
+	{ 0x31c, 197, 0 },
+	{ 0x31d, 197, 0 },
+	{ 0x31e, 197, 0 },
+	{ 0x31f, 197, 0 },
+	{ 0x320, 197, 0 },
+	{ 0x321, 197, 0 },
+	{ 0x322, 197, 0 },
+	{ 0x323, 197, 0 },
+	{ 0x324, 197, 0 },
+	{ 0x325, 197, 0 },
+	{ 0x326, 197, 0 },
+	{ 0x327, 197, 0 },
+	{ 0x328, 197, 0 },
+	{ 0x329, 197, 0 },
+	{ 0x32a, 197, 0 },
+	{ 0x32b, 197, 0 },
+	{ 0x32c, 197, 0 },
+	{ 0x32d, 197, 0 },
+	{ 0x32e, 197, 0 },
+	{ 0x32f, 197, 0 },
+	{ 0x330, 197, 0 },
+	{ 0x331, 197, 0 },
+	{ 0x332, 197, 0 },
+	{ 0x333, 197, 0 },
+	{ 0x334, 197, 0 },
+	{ 0x335, 197, 0 },
+	{ 0x336, 197, 0 },
+	{ 0x337, 197, 0 },
+	{ 0x338, 197, 0 },
+	{ 0x339, 197, 0 },
+	{ 0x33a, 197, 0 },
+	{ 0x33b, 197, 0 },
+	{ 0x33c, 197, 0 },
+	{ 0x33d, 197, 0 },
+	{ 0x33e, 197, 0 },
+	{ 0x33f, 197, 0 },
+	{ 0x340, 197, 0 },
+	{ 0x341, 197, 0 },
+	{ 0x342, 197, 0 },
+	{ 0x343, 197, 0 },
+	{ 0x344, 197, 0 },
+	{ 0x345, 197, 2 },
+	{ 0x346, 197, 0 },
+	{ 0x347, 197, 0 },
+	{ 0x348, 197, 0 },
+	{ 0x349, 197, 0 },
+	{ 0x34a, 197, 0 },
+	{ 0x34b, 197, 0 },
+	{ 0x34c, 197, 0 },
+	{ 0x34d, 197, 0 },
+	{ 0x34e, 197, 0 },
+	{ 0x34f, 197, 0 },
+	{ 0x350, 197, 0 },
+	{ 0x351, 197, 0 },
+	{ 0x352, 197, 0 },
+	{ 0x353, 197, 0 },
+	{ 0x354, 197, 0 },
+	{ 0x355, 197, 0 },
+	{ 0x356, 197, 0 },
+	{ 0x357, 197, 0 },
+	{ 0x358, 197, 0 },
+	{ 0x359, 197, 0 },
+	{ 0x35a, 197, 0 },
+	{ 0x35b, 197, 0 },
+	{ 0x35c, 197, 0 },
+	{ 0x35d, 197, 0 },
+	{ 0x35e, 197, 0 },
+	{ 0x35f, 197, 0 },
+	{ 0x360, 197, 0 },
+	{ 0x361, 197, 0 },
+	{ 0x362, 197, 0 },
+	{ 0x363, 197, 0 },
+	{ 0x364, 197, 0 },
+	{ 0x365, 197, 0 },
+	{ 0x366, 197, 0 },
+	{ 0x367, 197, 0 },
+	{ 0x368, 197, 0 },
+	{ 0x369, 197, 0 },
+	{ 0x36a, 197, 0 },
+	{ 0x36b, 197, 0 },
+	{ 0x36c, 197, 0 },
+	{ 0x36d, 197, 0 },
+	{ 0x36e, 197, 0 },
+	{ 0x36f, 197, 0 },
+	{ 0x370, 199, 2 },
+	{ 0x372, 201, 2 },
+	{ 0x374, 203, 2 },
+	{ 0x376, 205, 2 },
+	{ 0x37a, 207, 3 },
+	{ 0x37e, 210, 1 },
+	{ 0x37f, 211, 2 },
+	{ 0x384, 0, 1 },
+	{ 0x385, 0, 1 },
+	{ 0x386, 213, 2 },
+	{ 0x387, 215, 2 },
+	{ 0x388, 217, 2 },
+	{ 0x389, 219, 2 },
+	{ 0x38a, 197, 2 },
+	{ 0x38c, 221, 2 },
+	{ 0x38e, 223, 2 },
+	{ 0x38f, 225, 2 },
+	{ 0x390, 197, 2 },
+	{ 0x391, 213, 2 },
+	{ 0x392, 227, 2 },
+	{ 0x393, 229, 2 },
+	{ 0x394, 231, 2 },
+	{ 0x395, 217, 2 },
+	{ 0x396, 233, 2 },
+	{ 0x397, 219, 2 },
+	{ 0x398, 235, 2 },
+	{ 0x399, 197, 2 },
+	{ 0x39a, 237, 2 },
+	{ 0x39b, 239, 2 },
+	{ 0x39c, 4, 2 },
+	{ 0x39d, 241, 2 },
+	{ 0x39e, 243, 2 },
+	{ 0x39f, 221, 2 },
+	{ 0x3a0, 245, 2 },
+	{ 0x3a1, 247, 2 },
+	{ 0x3a3, 249, 2 },
+	{ 0x3a4, 251, 2 },
+	{ 0x3a5, 223, 2 },
+	{ 0x3a6, 253, 2 },
+	{ 0x3a7, 255, 2 },
+	{ 0x3a8, 257, 2 },
+	{ 0x3a9, 225, 2 },
+	{ 0x3aa, 197, 2 },
+	{ 0x3ab, 223, 2 },
+	{ 0x3ac, 213, 2 },
+	{ 0x3ad, 217, 2 },
+	{ 0x3ae, 219, 2 },
+	{ 0x3af, 197, 2 },
+	{ 0x3b0, 223, 2 },
+	{ 0x3c2, 249, 2 },
+	{ 0x3ca, 197, 2 },
+	{ 0x3cb, 223, 2 },
+	{ 0x3cc, 221, 2 },
+	{ 0x3cd, 223, 2 },
+	{ 0x3ce, 225, 2 },
+	{ 0x3cf, 259, 2 },
+	{ 0x3d0, 227, 2 },
+	{ 0x3d1, 235, 2 },
+	{ 0x3d2, 223, 2 },
+	{ 0x3d3, 223, 2 },
+	{ 0x3d4, 223, 2 },
+	{ 0x3d5, 253, 2 },
+	{ 0x3d6, 245, 2 },
+	{ 0x3d8, 261, 2 },
+	{ 0x3da, 263, 2 },
+	{ 0x3dc, 265, 2 },
+	{ 0x3de, 267, 2 },
+	{ 0x3e0, 269, 2 },
+	{ 0x3e2, 271, 2 },
+	{ 0x3e4, 273, 2 },
+	{ 0x3e6, 275, 2 },
+	{ 0x3e8, 277, 2 },
+	{ 0x3ea, 279, 2 },
+	{ 0x3ec, 281, 2 },
+	{ 0x3ee, 283, 2 },
+	{ 0x3f0, 237, 2 },
+	{ 0x3f1, 247, 2 },
+	{ 0x3f2, 249, 2 },
+	{ 0x3f4, 235, 2 },
+	{ 0x3f5, 217, 2 },
+	{ 0x3f7, 285, 2 },
+	{ 0x3f9, 249, 2 },
+	{ 0x3fa, 287, 2 },
+	{ 0x3fd, 289, 2 },
+	{ 0x3fe, 291, 2 },
+	{ 0x3ff, 293, 2 },
+	{ 0x400, 295, 2 },
+	{ 0x401, 295, 2 },
+	{ 0x402, 297, 2 },
+	{ 0x403, 299, 2 },
+	{ 0x404, 301, 2 },
+	{ 0x405, 303, 2 },
+	{ 0x406, 305, 2 },
+	{ 0x407, 305, 2 },
+	{ 0x408, 307, 2 },
+	{ 0x409, 309, 2 },
+	{ 0x40a, 311, 2 },
+	{ 0x40b, 313, 2 },
+	{ 0x40c, 315, 2 },
+	{ 0x40d, 317, 2 },
+	{ 0x40e, 319, 2 },
+	{ 0x40f, 321, 2 },
+	{ 0x410, 323, 2 },
+	{ 0x411, 325, 2 },
+	{ 0x412, 327, 2 },
+	{ 0x413, 299, 2 },
+	{ 0x414, 329, 2 },
+	{ 0x415, 295, 2 },
+	{ 0x416, 331, 2 },
+	{ 0x417, 333, 2 },
+	{ 0x418, 317, 2 },
+	{ 0x419, 317, 2 },
+	{ 0x41a, 315, 2 },
+	{ 0x41b, 335, 2 },
+	{ 0x41c, 337, 2 },
+	{ 0x41d, 339, 2 },
+	{ 0x41e, 341, 2 },
+	{ 0x41f, 343, 2 },
+	{ 0x420, 345, 2 },
+	{ 0x421, 347, 2 },
+	{ 0x422, 349, 2 },
+	{ 0x423, 319, 2 },
+	{ 0x424, 351, 2 },
+	{ 0x425, 353, 2 },
+	{ 0x426, 355, 2 },
+	{ 0x427, 357, 2 },
+	{ 0x428, 359, 2 },
+	{ 0x429, 361, 2 },
+	{ 0x42a, 363, 2 },
+	{ 0x42b, 365, 2 },
+	{ 0x42c, 367, 2 },
+	{ 0x42d, 369, 2 },
+	{ 0x42e, 371, 2 },
+	{ 0x42f, 373, 2 },
+	{ 0x439, 317, 2 },
+	{ 0x450, 295, 2 },
+	{ 0x451, 295, 2 },
+	{ 0x453, 299, 2 },
+	{ 0x457, 305, 2 },
+	{ 0x45c, 315, 2 },
+	{ 0x45d, 317, 2 },
+	{ 0x45e, 319, 2 },
+	{ 0x460, 375, 2 },
+	{ 0x462, 377, 2 },
+	{ 0x464, 379, 2 },
+	{ 0x466, 381, 2 },
+	{ 0x468, 383, 2 },
+	{ 0x46a, 385, 2 },
+	{ 0x46c, 387, 2 },
+	{ 0x46e, 389, 2 },
+	{ 0x470, 391, 2 },
+	{ 0x472, 393, 2 },
+	{ 0x474, 395, 2 },
+	{ 0x476, 395, 2 },
+	{ 0x477, 395, 2 },
+	{ 0x478, 397, 2 },
+	{ 0x47a, 399, 2 },
+	{ 0x47c, 401, 2 },
+	{ 0x47e, 403, 2 },
+	{ 0x480, 405, 2 },
+	{ 0x48a, 407, 2 },
+	{ 0x48c, 409, 2 },
+	{ 0x48e, 411, 2 },
+	{ 0x490, 413, 2 },
+	{ 0x492, 415, 2 },
+	{ 0x494, 417, 2 },
+	{ 0x496, 419, 2 },
+	{ 0x498, 421, 2 },
+	{ 0x49a, 423, 2 },
+	{ 0x49c, 425, 2 },
+	{ 0x49e, 427, 2 },
+	{ 0x4a0, 429, 2 },
+	{ 0x4a2, 431, 2 },
+	{ 0x4a4, 433, 2 },
+	{ 0x4a6, 435, 2 },
+	{ 0x4a8, 437, 2 },
+	{ 0x4aa, 439, 2 },
+	{ 0x4ac, 441, 2 },
+	{ 0x4ae, 443, 2 },
+	{ 0x4b0, 445, 2 },
+	{ 0x4b2, 447, 2 },
+	{ 0x4b4, 449, 2 },
+	{ 0x4b6, 451, 2 },
+	{ 0x4b8, 453, 2 },
+	{ 0x4ba, 455, 2 },
+	{ 0x4bc, 457, 2 },
+	{ 0x4be, 459, 2 },
+	{ 0x4c0, 461, 2 },
+	{ 0x4c1, 331, 2 },
+	{ 0x4c2, 331, 2 },
+	{ 0x4c3, 463, 2 },
+	{ 0x4c5, 465, 2 },
+	{ 0x4c7, 467, 2 },
+	{ 0x4c9, 469, 2 },
+	{ 0x4cb, 471, 2 },
+	{ 0x4cd, 473, 2 },
+	{ 0x4d0, 323, 2 },
+	{ 0x4d1, 323, 2 },
+	{ 0x4d2, 323, 2 },
+	{ 0x4d3, 323, 2 },
+	{ 0x4d4, 475, 2 },
+	{ 0x4d6, 295, 2 },
+	{ 0x4d7, 295, 2 },
+	{ 0x4d8, 477, 2 },
+	{ 0x4da, 477, 2 },
+	{ 0x4db, 477, 2 },
+	{ 0x4dc, 331, 2 },
+	{ 0x4dd, 331, 2 },
+	{ 0x4de, 333, 2 },
+	{ 0x4df, 333, 2 },
+	{ 0x4e0, 479, 2 },
+	{ 0x4e2, 317, 2 },
+	{ 0x4e3, 317, 2 },
+	{ 0x4e4, 317, 2 },
+	{ 0x4e5, 317, 2 },
+	{ 0x4e6, 341, 2 },
+	{ 0x4e7, 341, 2 },
+	{ 0x4e8, 481, 2 },
+	{ 0x4ea, 481, 2 },
+	{ 0x4eb, 481, 2 },
+	{ 0x4ec, 369, 2 },
+	{ 0x4ed, 369, 2 },
+	{ 0x4ee, 319, 2 },
+	{ 0x4ef, 319, 2 },
+	{ 0x4f0, 319, 2 },
+	{ 0x4f1, 319, 2 },
+	{ 0x4f2, 319, 2 },
+	{ 0x4f3, 319, 2 },
+	{ 0x4f4, 357, 2 },
+	{ 0x4f5, 357, 2 },
+	{ 0x4f6, 483, 2 },
+	{ 0x4f8, 365, 2 },
+	{ 0x4f9, 365, 2 },
+	{ 0x4fa, 485, 2 },
+	{ 0x4fc, 487, 2 },
+	{ 0x4fe, 489, 2 },
+	{ 0x500, 491, 2 },
+	{ 0x502, 493, 2 },
+	{ 0x504, 495, 2 },
+	{ 0x506, 497, 2 },
+	{ 0x508, 499, 2 },
+	{ 0x50a, 501, 2 },
+	{ 0x50c, 503, 2 },
+	{ 0x50e, 505, 2 },
+	{ 0x510, 507, 2 },
+	{ 0x512, 509, 2 },
+	{ 0x514, 511, 2 },
+	{ 0x516, 513, 2 },
+	{ 0x518, 515, 2 },
+	{ 0x51a, 517, 2 },
+	{ 0x51c, 519, 2 },
+	{ 0x51e, 521, 2 },
+	{ 0x520, 523, 2 },
+	{ 0x522, 525, 2 },
+	{ 0x524, 527, 2 },
+	{ 0x526, 529, 2 },
+	{ 0x528, 531, 2 },
+	{ 0x52a, 533, 2 },
+	{ 0x52c, 535, 2 },
+	{ 0x52e, 537, 2 },
+	{ 0x531, 539, 2 },
+	{ 0x532, 541, 2 },
+	{ 0x533, 543, 2 },
+	{ 0x534, 545, 2 },
+	{ 0x535, 547, 2 },
+	{ 0x536, 549, 2 },
+	{ 0x537, 551, 2 },
+	{ 0x538, 553, 2 },
+	{ 0x539, 555, 2 },
+	{ 0x53a, 557, 2 },
+	{ 0x53b, 559, 2 },
+	{ 0x53c, 561, 2 },
+	{ 0x53d, 563, 2 },
+	{ 0x53e, 565, 2 },
+	{ 0x53f, 567, 2 },
+	{ 0x540, 569, 2 },
+	{ 0x541, 571, 2 },
+	{ 0x542, 573, 2 },
+	{ 0x543, 575, 2 },
+	{ 0x544, 577, 2 },
+	{ 0x545, 579, 2 },
+	{ 0x546, 581, 2 },
+	{ 0x547, 583, 2 },
+	{ 0x548, 585, 2 },
+	{ 0x549, 587, 2 },
+	{ 0x54a, 589, 2 },
+	{ 0x54b, 591, 2 },
+	{ 0x54c, 593, 2 },
+	{ 0x54d, 595, 2 },
+	{ 0x54e, 597, 2 },
+	{ 0x54f, 599, 2 },
+	{ 0x550, 601, 2 },
+	{ 0x551, 603, 2 },
+	{ 0x552, 605, 2 },
+	{ 0x553, 607, 2 },
+	{ 0x554, 609, 2 },
+	{ 0x555, 611, 2 },
+	{ 0x556, 613, 2 },
+	{ 0x587, 615, 4 },
+	{ 0x675, 619, 4 },
+	{ 0x676, 623, 4 },
+	{ 0x677, 627, 4 },
+	{ 0x678, 631, 4 },
+	{ 0x958, 635, 6 },
+	{ 0x959, 641, 6 },
+	{ 0x95a, 647, 6 },
+	{ 0x95b, 653, 6 },
+	{ 0x95c, 659, 6 },
+	{ 0x95d, 665, 6 },
+	{ 0x95e, 671, 6 },
+	{ 0x95f, 677, 6 },
+	{ 0x9dc, 683, 6 },
+	{ 0x9dd, 689, 6 },
+	{ 0x9df, 695, 6 },
+	{ 0xa33, 701, 6 },
+	{ 0xa36, 707, 6 },
+	{ 0xa59, 713, 6 },
+	{ 0xa5a, 719, 6 },
+	{ 0xa5b, 725, 6 },
+	{ 0xa5e, 731, 6 },
+	{ 0xb5c, 737, 6 },
+	{ 0xb5d, 743, 6 },
+	{ 0xe33, 749, 6 },
+	{ 0xeb3, 755, 6 },
+	{ 0xedc, 761, 6 },
+	{ 0xedd, 767, 6 },
+	{ 0xf0c, 773, 3 },
+	{ 0xf43, 776, 6 },
+	{ 0xf4d, 782, 6 },
+	{ 0xf52, 788, 6 },
+	{ 0xf57, 794, 6 },
+	{ 0xf5c, 800, 6 },
+	{ 0xf69, 806, 6 },
+	{ 0xf73, 812, 6 },
+	{ 0xf75, 818, 6 },
+	{ 0xf76, 824, 6 },
+	{ 0xf77, 830, 9 },
+	{ 0xf78, 839, 6 },
+	{ 0xf79, 845, 9 },
+	{ 0xf81, 854, 6 },
+	{ 0xf93, 860, 6 },
+	{ 0xf9d, 866, 6 },
+	{ 0xfa2, 872, 6 },
+	{ 0xfa7, 878, 6 },
+	{ 0xfac, 884, 6 },
+	{ 0xfb9, 890, 6 },
+	{ 0x10a0, 896, 3 },
+	{ 0x10a1, 899, 3 },
+	{ 0x10a2, 902, 3 },
+	{ 0x10a3, 905, 3 },
+	{ 0x10a4, 908, 3 },
+	{ 0x10a5, 911, 3 },
+	{ 0x10a6, 914, 3 },
+	{ 0x10a7, 917, 3 },
+	{ 0x10a8, 920, 3 },
+	{ 0x10a9, 923, 3 },
+	{ 0x10aa, 926, 3 },
+	{ 0x10ab, 929, 3 },
+	{ 0x10ac, 932, 3 },
+	{ 0x10ad, 935, 3 },
+	{ 0x10ae, 938, 3 },
+	{ 0x10af, 941, 3 },
+	{ 0x10b0, 944, 3 },
+	{ 0x10b1, 947, 3 },
+	{ 0x10b2, 950, 3 },
+	{ 0x10b3, 953, 3 },
+	{ 0x10b4, 956, 3 },
+	{ 0x10b5, 959, 3 },
+	{ 0x10b6, 962, 3 },
+	{ 0x10b7, 965, 3 },
+	{ 0x10b8, 968, 3 },
+	{ 0x10b9, 971, 3 },
+	{ 0x10ba, 974, 3 },
+	{ 0x10bb, 977, 3 },
+	{ 0x10bc, 980, 3 },
+	{ 0x10bd, 983, 3 },
+	{ 0x10be, 986, 3 },
+	{ 0x10bf, 989, 3 },
+	{ 0x10c0, 992, 3 },
+	{ 0x10c1, 995, 3 },
+	{ 0x10c2, 998, 3 },
+	{ 0x10c3, 1001, 3 },
+	{ 0x10c4, 1004, 3 },
+	{ 0x10c5, 1007, 3 },
+	{ 0x10c7, 1010, 3 },
+	{ 0x10cd, 1013, 3 },
+	{ 0x10fc, 1016, 3 },
+	{ 0x13f8, 1019, 3 },
+	{ 0x13f9, 1022, 3 },
+	{ 0x13fa, 1025, 3 },
+	{ 0x13fb, 1028, 3 },
+	{ 0x13fc, 1031, 3 },
+	{ 0x13fd, 1034, 3 },
+	{ 0x1c80, 327, 2 },
+	{ 0x1c81, 329, 2 },
+	{ 0x1c82, 341, 2 },
+	{ 0x1c83, 347, 2 },
+	{ 0x1c84, 349, 2 },
+	{ 0x1c85, 349, 2 },
+	{ 0x1c86, 363, 2 },
+	{ 0x1c87, 377, 2 },
+	{ 0x1c88, 1037, 3 },
+	{ 0x1c90, 1040, 3 },
+	{ 0x1c91, 1043, 3 },
+	{ 0x1c92, 1046, 3 },
+	{ 0x1c93, 1049, 3 },
+	{ 0x1c94, 1052, 3 },
+	{ 0x1c95, 1055, 3 },
+	{ 0x1c96, 1058, 3 },
+	{ 0x1c97, 1061, 3 },
+	{ 0x1c98, 1064, 3 },
+	{ 0x1c99, 1067, 3 },
+	{ 0x1c9a, 1070, 3 },
+	{ 0x1c9b, 1073, 3 },
+	{ 0x1c9c, 1016, 3 },
+	{ 0x1c9d, 1076, 3 },
+	{ 0x1c9e, 1079, 3 },
+	{ 0x1c9f, 1082, 3 },
+	{ 0x1ca0, 1085, 3 },
+	{ 0x1ca1, 1088, 3 },
+	{ 0x1ca2, 1091, 3 },
+	{ 0x1ca3, 1094, 3 },
+	{ 0x1ca4, 1097, 3 },
+	{ 0x1ca5, 1100, 3 },
+	{ 0x1ca6, 1103, 3 },
+	{ 0x1ca7, 1106, 3 },
+	{ 0x1ca8, 1109, 3 },
+	{ 0x1ca9, 1112, 3 },
+	{ 0x1caa, 1115, 3 },
+	{ 0x1cab, 1118, 3 },
+	{ 0x1cac, 1121, 3 },
+	{ 0x1cad, 1124, 3 },
+	{ 0x1cae, 1127, 3 },
+	{ 0x1caf, 1130, 3 },
+	{ 0x1cb0, 1133, 3 },
+	{ 0x1cb1, 1136, 3 },
+	{ 0x1cb2, 1139, 3 },
+	{ 0x1cb3, 1142, 3 },
+	{ 0x1cb4, 1145, 3 },
+	{ 0x1cb5, 1148, 3 },
+	{ 0x1cb6, 1151, 3 },
+	{ 0x1cb7, 1154, 3 },
+	{ 0x1cb8, 1157, 3 },
+	{ 0x1cb9, 1160, 3 },
+	{ 0x1cba, 1163, 3 },
+	{ 0x1cbd, 1166, 3 },
+	{ 0x1cbe, 1169, 3 },
+	{ 0x1cbf, 1172, 3 },
+	{ 0x1d2c, 1, 1 },
+	{ 0x1d2d, 23, 2 },
+	{ 0x1d2e, 1175, 1 },
+	{ 0x1d30, 39, 1 },
+	{ 0x1d31, 26, 1 },
+	{ 0x1d32, 86, 2 },
+	{ 0x1d33, 42, 1 },
+	{ 0x1d34, 43, 1 },
+	{ 0x1d35, 27, 1 },
+	{ 0x1d36, 48, 1 },
+	{ 0x1d37, 49, 1 },
+	{ 0x1d38, 50, 1 },
+	{ 0x1d39, 1176, 1 },
+	{ 0x1d3a, 30, 1 },
+	{ 0x1d3c, 7, 1 },
+	{ 0x1d3d, 154, 2 },
+	{ 0x1d3e, 1177, 1 },
+	{ 0x1d3f, 63, 1 },
+	{ 0x1d40, 65, 1 },
+	{ 0x1d41, 33, 1 },
+	{ 0x1d42, 68, 1 },
+	{ 0x1d43, 1, 1 },
+	{ 0x1d44, 1178, 2 },
+	{ 0x1d45, 1180, 2 },
+	{ 0x1d46, 1182, 3 },
+	{ 0x1d47, 1175, 1 },
+	{ 0x1d48, 39, 1 },
+	{ 0x1d49, 26, 1 },
+	{ 0x1d4a, 88, 2 },
+	{ 0x1d4b, 90, 2 },
+	{ 0x1d4c, 1185, 2 },
+	{ 0x1d4d, 42, 1 },
+	{ 0x1d4f, 49, 1 },
+	{ 0x1d50, 1176, 1 },
+	{ 0x1d51, 59, 2 },
+	{ 0x1d52, 7, 1 },
+	{ 0x1d53, 76, 2 },
+	{ 0x1d54, 1187, 3 },
+	{ 0x1d55, 1190, 3 },
+	{ 0x1d56, 1177, 1 },
+	{ 0x1d57, 65, 1 },
+	{ 0x1d58, 33, 1 },
+	{ 0x1d59, 1193, 3 },
+	{ 0x1d5a, 104, 2 },
+	{ 0x1d5b, 1196, 1 },
+	{ 0x1d5c, 1197, 3 },
+	{ 0x1d5d, 227, 2 },
+	{ 0x1d5e, 229, 2 },
+	{ 0x1d5f, 231, 2 },
+	{ 0x1d60, 253, 2 },
+	{ 0x1d61, 255, 2 },
+	{ 0x1d62, 27, 1 },
+	{ 0x1d63, 63, 1 },
+	{ 0x1d64, 33, 1 },
+	{ 0x1d65, 1196, 1 },
+	{ 0x1d66, 227, 2 },
+	{ 0x1d67, 229, 2 },
+	{ 0x1d68, 247, 2 },
+	{ 0x1d69, 253, 2 },
+	{ 0x1d6a, 255, 2 },
+	{ 0x1d78, 339, 2 },
+	{ 0x1d9b, 1200, 2 },
+	{ 0x1d9c, 25, 1 },
+	{ 0x1d9d, 1202, 2 },
+	{ 0x1d9e, 28, 2 },
+	{ 0x1d9f, 1185, 2 },
+	{ 0x1da0, 1204, 1 },
+	{ 0x1da1, 1205, 2 },
+	{ 0x1da2, 1207, 2 },
+	{ 0x1da3, 1209, 2 },
+	{ 0x1da4, 100, 2 },
+	{ 0x1da5, 98, 2 },
+	{ 0x1da6, 1211, 2 },
+	{ 0x1da7, 1213, 3 },
+	{ 0x1da8, 1216, 2 },
+	{ 0x1da9, 1218, 2 },
+	{ 0x1daa, 1220, 3 },
+	{ 0x1dab, 1223, 2 },
+	{ 0x1dac, 1225, 2 },
+	{ 0x1dad, 1227, 2 },
+	{ 0x1dae, 106, 2 },
+	{ 0x1daf, 1229, 2 },
+	{ 0x1db0, 1231, 2 },
+	{ 0x1db1, 108, 2 },
+	{ 0x1db2, 1233, 2 },
+	{ 0x1db3, 1235, 2 },
+	{ 0x1db4, 118, 2 },
+	{ 0x1db5, 1237, 2 },
+	{ 0x1db6, 172, 2 },
+	{ 0x1db7, 124, 2 },
+	{ 0x1db8, 1239, 3 },
+	{ 0x1db9, 126, 2 },
+	{ 0x1dba, 174, 2 },
+	{ 0x1dbb, 69, 1 },
+	{ 0x1dbc, 1242, 2 },
+	{ 0x1dbd, 1244, 2 },
+	{ 0x1dbe, 132, 2 },
+	{ 0x1dbf, 235, 2 },
+	{ 0x1e00, 1, 1 },
+	{ 0x1e01, 1, 1 },
+	{ 0x1e02, 1175, 1 },
+	{ 0x1e03, 1175, 1 },
+	{ 0x1e04, 1175, 1 },
+	{ 0x1e05, 1175, 1 },
+	{ 0x1e06, 1175, 1 },
+	{ 0x1e07, 1175, 1 },
+	{ 0x1e08, 25, 1 },
+	{ 0x1e09, 25, 1 },
+	{ 0x1e0a, 39, 1 },
+	{ 0x1e0b, 39, 1 },
+	{ 0x1e0c, 39, 1 },
+	{ 0x1e0d, 39, 1 },
+	{ 0x1e0e, 39, 1 },
+	{ 0x1e0f, 39, 1 },
+	{ 0x1e10, 39, 1 },
+	{ 0x1e11, 39, 1 },
+	{ 0x1e12, 39, 1 },
+	{ 0x1e13, 39, 1 },
+	{ 0x1e14, 26, 1 },
+	{ 0x1e15, 26, 1 },
+	{ 0x1e16, 26, 1 },
+	{ 0x1e17, 26, 1 },
+	{ 0x1e18, 26, 1 },
+	{ 0x1e19, 26, 1 },
+	{ 0x1e1a, 26, 1 },
+	{ 0x1e1b, 26, 1 },
+	{ 0x1e1c, 26, 1 },
+	{ 0x1e1d, 26, 1 },
+	{ 0x1e1e, 1204, 1 },
+	{ 0x1e1f, 1204, 1 },
+	{ 0x1e20, 42, 1 },
+	{ 0x1e21, 42, 1 },
+	{ 0x1e22, 43, 1 },
+	{ 0x1e23, 43, 1 },
+	{ 0x1e24, 43, 1 },
+	{ 0x1e25, 43, 1 },
+	{ 0x1e26, 43, 1 },
+	{ 0x1e27, 43, 1 },
+	{ 0x1e28, 43, 1 },
+	{ 0x1e29, 43, 1 },
+	{ 0x1e2a, 43, 1 },
+	{ 0x1e2b, 43, 1 },
+	{ 0x1e2c, 27, 1 },
+	{ 0x1e2d, 27, 1 },
+	{ 0x1e2e, 27, 1 },
+	{ 0x1e2f, 27, 1 },
+	{ 0x1e30, 49, 1 },
+	{ 0x1e31, 49, 1 },
+	{ 0x1e32, 49, 1 },
+	{ 0x1e33, 49, 1 },
+	{ 0x1e34, 49, 1 },
+	{ 0x1e35, 49, 1 },
+	{ 0x1e36, 50, 1 },
+	{ 0x1e37, 50, 1 },
+	{ 0x1e38, 50, 1 },
+	{ 0x1e39, 50, 1 },
+	{ 0x1e3a, 50, 1 },
+	{ 0x1e3b, 50, 1 },
+	{ 0x1e3c, 50, 1 },
+	{ 0x1e3d, 50, 1 },
+	{ 0x1e3e, 1176, 1 },
+	{ 0x1e3f, 1176, 1 },
+	{ 0x1e40, 1176, 1 },
+	{ 0x1e41, 1176, 1 },
+	{ 0x1e42, 1176, 1 },
+	{ 0x1e43, 1176, 1 },
+	{ 0x1e44, 30, 1 },
+	{ 0x1e45, 30, 1 },
+	{ 0x1e46, 30, 1 },
+	{ 0x1e47, 30, 1 },
+	{ 0x1e48, 30, 1 },
+	{ 0x1e49, 30, 1 },
+	{ 0x1e4a, 30, 1 },
+	{ 0x1e4b, 30, 1 },
+	{ 0x1e4c, 7, 1 },
+	{ 0x1e4d, 7, 1 },
+	{ 0x1e4e, 7, 1 },
+	{ 0x1e4f, 7, 1 },
+	{ 0x1e50, 7, 1 },
+	{ 0x1e51, 7, 1 },
+	{ 0x1e52, 7, 1 },
+	{ 0x1e53, 7, 1 },
+	{ 0x1e54, 1177, 1 },
+	{ 0x1e55, 1177, 1 },
+	{ 0x1e56, 1177, 1 },
+	{ 0x1e57, 1177, 1 },
+	{ 0x1e58, 63, 1 },
+	{ 0x1e59, 63, 1 },
+	{ 0x1e5a, 63, 1 },
+	{ 0x1e5b, 63, 1 },
+	{ 0x1e5c, 63, 1 },
+	{ 0x1e5d, 63, 1 },
+	{ 0x1e5e, 63, 1 },
+	{ 0x1e5f, 63, 1 },
+	{ 0x1e60, 64, 1 },
+	{ 0x1e61, 64, 1 },
+	{ 0x1e62, 64, 1 },
+	{ 0x1e63, 64, 1 },
+	{ 0x1e64, 64, 1 },
+	{ 0x1e65, 64, 1 },
+	{ 0x1e66, 64, 1 },
+	{ 0x1e67, 64, 1 },
+	{ 0x1e68, 64, 1 },
+	{ 0x1e69, 64, 1 },
+	{ 0x1e6a, 65, 1 },
+	{ 0x1e6b, 65, 1 },
+	{ 0x1e6c, 65, 1 },
+	{ 0x1e6d, 65, 1 },
+	{ 0x1e6e, 65, 1 },
+	{ 0x1e6f, 65, 1 },
+	{ 0x1e70, 65, 1 },
+	{ 0x1e71, 65, 1 },
+	{ 0x1e72, 33, 1 },
+	{ 0x1e73, 33, 1 },
+	{ 0x1e74, 33, 1 },
+	{ 0x1e75, 33, 1 },
+	{ 0x1e76, 33, 1 },
+	{ 0x1e77, 33, 1 },
+	{ 0x1e78, 33, 1 },
+	{ 0x1e79, 33, 1 },
+	{ 0x1e7a, 33, 1 },
+	{ 0x1e7b, 33, 1 },
+	{ 0x1e7c, 1196, 1 },
+	{ 0x1e7d, 1196, 1 },
+	{ 0x1e7e, 1196, 1 },
+	{ 0x1e7f, 1196, 1 },
+	{ 0x1e80, 68, 1 },
+	{ 0x1e81, 68, 1 },
+	{ 0x1e82, 68, 1 },
+	{ 0x1e83, 68, 1 },
+	{ 0x1e84, 68, 1 },
+	{ 0x1e85, 68, 1 },
+	{ 0x1e86, 68, 1 },
+	{ 0x1e87, 68, 1 },
+	{ 0x1e88, 68, 1 },
+	{ 0x1e89, 68, 1 },
+	{ 0x1e8a, 194, 1 },
+	{ 0x1e8b, 194, 1 },
+	{ 0x1e8c, 194, 1 },
+	{ 0x1e8d, 194, 1 },
+	{ 0x1e8e, 34, 1 },
+	{ 0x1e8f, 34, 1 },
+	{ 0x1e90, 69, 1 },
+	{ 0x1e91, 69, 1 },
+	{ 0x1e92, 69, 1 },
+	{ 0x1e93, 69, 1 },
+	{ 0x1e94, 69, 1 },
+	{ 0x1e95, 69, 1 },
+	{ 0x1e96, 43, 1 },
+	{ 0x1e97, 65, 1 },
+	{ 0x1e98, 68, 1 },
+	{ 0x1e99, 34, 1 },
+	{ 0x1e9a, 1246, 3 },
+	{ 0x1e9b, 64, 1 },
+	{ 0x1e9e, 37, 2 },
+	{ 0x1ea0, 1, 1 },
+	{ 0x1ea1, 1, 1 },
+	{ 0x1ea2, 1, 1 },
+	{ 0x1ea3, 1, 1 },
+	{ 0x1ea4, 1, 1 },
+	{ 0x1ea5, 1, 1 },
+	{ 0x1ea6, 1, 1 },
+	{ 0x1ea7, 1, 1 },
+	{ 0x1ea8, 1, 1 },
+	{ 0x1ea9, 1, 1 },
+	{ 0x1eaa, 1, 1 },
+	{ 0x1eab, 1, 1 },
+	{ 0x1eac, 1, 1 },
+	{ 0x1ead, 1, 1 },
+	{ 0x1eae, 1, 1 },
+	{ 0x1eaf, 1, 1 },
+	{ 0x1eb0, 1, 1 },
+	{ 0x1eb1, 1, 1 },
+	{ 0x1eb2, 1, 1 },
+	{ 0x1eb3, 1, 1 },
+	{ 0x1eb4, 1, 1 },
+	{ 0x1eb5, 1, 1 },
+	{ 0x1eb6, 1, 1 },
+	{ 0x1eb7, 1, 1 },
+	{ 0x1eb8, 26, 1 },
+	{ 0x1eb9, 26, 1 },
+	{ 0x1eba, 26, 1 },
+	{ 0x1ebb, 26, 1 },
+	{ 0x1ebc, 26, 1 },
+	{ 0x1ebd, 26, 1 },
+	{ 0x1ebe, 26, 1 },
+	{ 0x1ebf, 26, 1 },
+	{ 0x1ec0, 26, 1 },
+	{ 0x1ec1, 26, 1 },
+	{ 0x1ec2, 26, 1 },
+	{ 0x1ec3, 26, 1 },
+	{ 0x1ec4, 26, 1 },
+	{ 0x1ec5, 26, 1 },
+	{ 0x1ec6, 26, 1 },
+	{ 0x1ec7, 26, 1 },
+	{ 0x1ec8, 27, 1 },
+	{ 0x1ec9, 27, 1 },
+	{ 0x1eca, 27, 1 },
+	{ 0x1ecb, 27, 1 },
+	{ 0x1ecc, 7, 1 },
+	{ 0x1ecd, 7, 1 },
+	{ 0x1ece, 7, 1 },
+	{ 0x1ecf, 7, 1 },
+	{ 0x1ed0, 7, 1 },
+	{ 0x1ed1, 7, 1 },
+	{ 0x1ed2, 7, 1 },
+	{ 0x1ed3, 7, 1 },
+	{ 0x1ed4, 7, 1 },
+	{ 0x1ed5, 7, 1 },
+	{ 0x1ed6, 7, 1 },
+	{ 0x1ed7, 7, 1 },
+	{ 0x1ed8, 7, 1 },
+	{ 0x1ed9, 7, 1 },
+	{ 0x1eda, 7, 1 },
+	{ 0x1edb, 7, 1 },
+	{ 0x1edc, 7, 1 },
+	{ 0x1edd, 7, 1 },
+	{ 0x1ede, 7, 1 },
+	{ 0x1edf, 7, 1 },
+	{ 0x1ee0, 7, 1 },
+	{ 0x1ee1, 7, 1 },
+	{ 0x1ee2, 7, 1 },
+	{ 0x1ee3, 7, 1 },
+	{ 0x1ee4, 33, 1 },
+	{ 0x1ee5, 33, 1 },
+	{ 0x1ee6, 33, 1 },
+	{ 0x1ee7, 33, 1 },
+	{ 0x1ee8, 33, 1 },
+	{ 0x1ee9, 33, 1 },
+	{ 0x1eea, 33, 1 },
+	{ 0x1eeb, 33, 1 },
+	{ 0x1eec, 33, 1 },
+	{ 0x1eed, 33, 1 },
+	{ 0x1eee, 33, 1 },
+	{ 0x1eef, 33, 1 },
+	{ 0x1ef0, 33, 1 },
+	{ 0x1ef1, 33, 1 },
+	{ 0x1ef2, 34, 1 },
+	{ 0x1ef3, 34, 1 },
+	{ 0x1ef4, 34, 1 },
+	{ 0x1ef5, 34, 1 },
+	{ 0x1ef6, 34, 1 },
+	{ 0x1ef7, 34, 1 },
+	{ 0x1ef8, 34, 1 },
+	{ 0x1ef9, 34, 1 },
+	{ 0x1efa, 1249, 3 },
+	{ 0x1efc, 1252, 3 },
+	{ 0x1efe, 1255, 3 },
+	{ 0x1f00, 213, 2 },
+	{ 0x1f01, 213, 2 },
+	{ 0x1f02, 213, 2 },
+	{ 0x1f03, 213, 2 },
+	{ 0x1f04, 213, 2 },
+	{ 0x1f05, 213, 2 },
+	{ 0x1f06, 213, 2 },
+	{ 0x1f07, 213, 2 },
+	{ 0x1f08, 213, 2 },
+	{ 0x1f09, 213, 2 },
+	{ 0x1f0a, 213, 2 },
+	{ 0x1f0b, 213, 2 },
+	{ 0x1f0c, 213, 2 },
+	{ 0x1f0d, 213, 2 },
+	{ 0x1f0e, 213, 2 },
+	{ 0x1f0f, 213, 2 },
+	{ 0x1f10, 217, 2 },
+	{ 0x1f11, 217, 2 },
+	{ 0x1f12, 217, 2 },
+	{ 0x1f13, 217, 2 },
+	{ 0x1f14, 217, 2 },
+	{ 0x1f15, 217, 2 },
+	{ 0x1f18, 217, 2 },
+	{ 0x1f19, 217, 2 },
+	{ 0x1f1a, 217, 2 },
+	{ 0x1f1b, 217, 2 },
+	{ 0x1f1c, 217, 2 },
+	{ 0x1f1d, 217, 2 },
+	{ 0x1f20, 219, 2 },
+	{ 0x1f21, 219, 2 },
+	{ 0x1f22, 219, 2 },
+	{ 0x1f23, 219, 2 },
+	{ 0x1f24, 219, 2 },
+	{ 0x1f25, 219, 2 },
+	{ 0x1f26, 219, 2 },
+	{ 0x1f27, 219, 2 },
+	{ 0x1f28, 219, 2 },
+	{ 0x1f29, 219, 2 },
+	{ 0x1f2a, 219, 2 },
+	{ 0x1f2b, 219, 2 },
+	{ 0x1f2c, 219, 2 },
+	{ 0x1f2d, 219, 2 },
+	{ 0x1f2e, 219, 2 },
+	{ 0x1f2f, 219, 2 },
+	{ 0x1f30, 197, 2 },
+	{ 0x1f31, 197, 2 },
+	{ 0x1f32, 197, 2 },
+	{ 0x1f33, 197, 2 },
+	{ 0x1f34, 197, 2 },
+	{ 0x1f35, 197, 2 },
+	{ 0x1f36, 197, 2 },
+	{ 0x1f37, 197, 2 },
+	{ 0x1f38, 197, 2 },
+	{ 0x1f39, 197, 2 },
+	{ 0x1f3a, 197, 2 },
+	{ 0x1f3b, 197, 2 },
+	{ 0x1f3c, 197, 2 },
+	{ 0x1f3d, 197, 2 },
+	{ 0x1f3e, 197, 2 },
+	{ 0x1f3f, 197, 2 },
+	{ 0x1f40, 221, 2 },
+	{ 0x1f41, 221, 2 },
+	{ 0x1f42, 221, 2 },
+	{ 0x1f43, 221, 2 },
+	{ 0x1f44, 221, 2 },
+	{ 0x1f45, 221, 2 },
+	{ 0x1f48, 221, 2 },
+	{ 0x1f49, 221, 2 },
+	{ 0x1f4a, 221, 2 },
+	{ 0x1f4b, 221, 2 },
+	{ 0x1f4c, 221, 2 },
+	{ 0x1f4d, 221, 2 },
+	{ 0x1f50, 223, 2 },
+	{ 0x1f51, 223, 2 },
+	{ 0x1f52, 223, 2 },
+	{ 0x1f53, 223, 2 },
+	{ 0x1f54, 223, 2 },
+	{ 0x1f55, 223, 2 },
+	{ 0x1f56, 223, 2 },
+	{ 0x1f57, 223, 2 },
+	{ 0x1f59, 223, 2 },
+	{ 0x1f5b, 223, 2 },
+	{ 0x1f5d, 223, 2 },
+	{ 0x1f5f, 223, 2 },
+	{ 0x1f60, 225, 2 },
+	{ 0x1f61, 225, 2 },
+	{ 0x1f62, 225, 2 },
+	{ 0x1f63, 225, 2 },
+	{ 0x1f64, 225, 2 },
+	{ 0x1f65, 225, 2 },
+	{ 0x1f66, 225, 2 },
+	{ 0x1f67, 225, 2 },
+	{ 0x1f68, 225, 2 },
+	{ 0x1f69, 225, 2 },
+	{ 0x1f6a, 225, 2 },
+	{ 0x1f6b, 225, 2 },
+	{ 0x1f6c, 225, 2 },
+	{ 0x1f6d, 225, 2 },
+	{ 0x1f6e, 225, 2 },
+	{ 0x1f6f, 225, 2 },
+	{ 0x1f70, 213, 2 },
+	{ 0x1f71, 213, 2 },
+	{ 0x1f72, 217, 2 },
+	{ 0x1f73, 217, 2 },
+	{ 0x1f74, 219, 2 },
+	{ 0x1f75, 219, 2 },
+	{ 0x1f76, 197, 2 },
+	{ 0x1f77, 197, 2 },
+	{ 0x1f78, 221, 2 },
+	{ 0x1f79, 221, 2 },
+	{ 0x1f7a, 223, 2 },
+	{ 0x1f7b, 223, 2 },
+	{ 0x1f7c, 225, 2 },
+	{ 0x1f7d, 225, 2 },
+	{ 0x1f80, 1258, 4 },
+	{ 0x1f81, 1258, 4 },
+	{ 0x1f82, 1258, 4 },
+	{ 0x1f83, 1258, 4 },
+	{ 0x1f84, 1258, 4 },
+	{ 0x1f85, 1258, 4 },
+	{ 0x1f86, 1258, 4 },
+	{ 0x1f87, 1258, 4 },
+	{ 0x1f88, 1258, 4 },
+	{ 0x1f89, 1258, 4 },
+	{ 0x1f8a, 1258, 4 },
+	{ 0x1f8b, 1258, 4 },
+	{ 0x1f8c, 1258, 4 },
+	{ 0x1f8d, 1258, 4 },
+	{ 0x1f8e, 1258, 4 },
+	{ 0x1f8f, 1258, 4 },
+	{ 0x1f90, 1262, 4 },
+	{ 0x1f91, 1262, 4 },
+	{ 0x1f92, 1262, 4 },
+	{ 0x1f93, 1262, 4 },
+	{ 0x1f94, 1262, 4 },
+	{ 0x1f95, 1262, 4 },
+	{ 0x1f96, 1262, 4 },
+	{ 0x1f97, 1262, 4 },
+	{ 0x1f98, 1262, 4 },
+	{ 0x1f99, 1262, 4 },
+	{ 0x1f9a, 1262, 4 },
+	{ 0x1f9b, 1262, 4 },
+	{ 0x1f9c, 1262, 4 },
+	{ 0x1f9d, 1262, 4 },
+	{ 0x1f9e, 1262, 4 },
+	{ 0x1f9f, 1262, 4 },
+	{ 0x1fa0, 1266, 4 },
+	{ 0x1fa1, 1266, 4 },
+	{ 0x1fa2, 1266, 4 },
+	{ 0x1fa3, 1266, 4 },
+	{ 0x1fa4, 1266, 4 },
+	{ 0x1fa5, 1266, 4 },
+	{ 0x1fa6, 1266, 4 },
+	{ 0x1fa7, 1266, 4 },
+	{ 0x1fa8, 1266, 4 },
+	{ 0x1fa9, 1266, 4 },
+	{ 0x1faa, 1266, 4 },
+	{ 0x1fab, 1266, 4 },
+	{ 0x1fac, 1266, 4 },
+	{ 0x1fad, 1266, 4 },
+	{ 0x1fae, 1266, 4 },
+	{ 0x1faf, 1266, 4 },
+	{ 0x1fb0, 213, 2 },
+	{ 0x1fb1, 213, 2 },
+	{ 0x1fb2, 1258, 4 },
+	{ 0x1fb3, 1258, 4 },
+	{ 0x1fb4, 1258, 4 },
+	{ 0x1fb6, 213, 2 },
+	{ 0x1fb7, 1258, 4 },
+	{ 0x1fb8, 213, 2 },
+	{ 0x1fb9, 213, 2 },
+	{ 0x1fba, 213, 2 },
+	{ 0x1fbb, 213, 2 },
+	{ 0x1fbc, 1258, 4 },
+	{ 0x1fbd, 0, 1 },
+	{ 0x1fbe, 197, 2 },
+	{ 0x1fbf, 0, 1 },
+	{ 0x1fc0, 0, 1 },
+	{ 0x1fc1, 0, 1 },
+	{ 0x1fc2, 1262, 4 },
+	{ 0x1fc3, 1262, 4 },
+	{ 0x1fc4, 1262, 4 },
+	{ 0x1fc6, 219, 2 },
+	{ 0x1fc7, 1262, 4 },
+	{ 0x1fc8, 217, 2 },
+	{ 0x1fc9, 217, 2 },
+	{ 0x1fca, 219, 2 },
+	{ 0x1fcb, 219, 2 },
+	{ 0x1fcc, 1262, 4 },
+	{ 0x1fcd, 0, 1 },
+	{ 0x1fce, 0, 1 },
+	{ 0x1fcf, 0, 1 },
+	{ 0x1fd0, 197, 2 },
+	{ 0x1fd1, 197, 2 },
+	{ 0x1fd2, 197, 2 },
+	{ 0x1fd3, 197, 2 },
+	{ 0x1fd6, 197, 2 },
+	{ 0x1fd7, 197, 2 },
+	{ 0x1fd8, 197, 2 },
+	{ 0x1fd9, 197, 2 },
+	{ 0x1fda, 197, 2 },
+	{ 0x1fdb, 197, 2 },
+	{ 0x1fdd, 0, 1 },
+	{ 0x1fde, 0, 1 },
+	{ 0x1fdf, 0, 1 },
+	{ 0x1fe0, 223, 2 },
+	{ 0x1fe1, 223, 2 },
+	{ 0x1fe2, 223, 2 },
+	{ 0x1fe3, 223, 2 },
+	{ 0x1fe4, 247, 2 },
+	{ 0x1fe5, 247, 2 },
+	{ 0x1fe6, 223, 2 },
+	{ 0x1fe7, 223, 2 },
+	{ 0x1fe8, 223, 2 },
+	{ 0x1fe9, 223, 2 },
+	{ 0x1fea, 223, 2 },
+	{ 0x1feb, 223, 2 },
+	{ 0x1fec, 247, 2 },
+	{ 0x1fed, 0, 1 },
+	{ 0x1fee, 0, 1 },
+	{ 0x1fef, 1270, 1 },
+	{ 0x1ff2, 1266, 4 },
+	{ 0x1ff3, 1266, 4 },
+	{ 0x1ff4, 1266, 4 },
+	{ 0x1ff6, 225, 2 },
+	{ 0x1ff7, 1266, 4 },
+	{ 0x1ff8, 221, 2 },
+	{ 0x1ff9, 221, 2 },
+	{ 0x1ffa, 225, 2 },
+	{ 0x1ffb, 225, 2 },
+	{ 0x1ffc, 1266, 4 },
+	{ 0x1ffd, 0, 1 },
+	{ 0x1ffe, 0, 1 },
+	{ 0x2000, 0, 1 },
+	{ 0x2001, 0, 1 },
+	{ 0x2002, 0, 1 },
+	{ 0x2003, 0, 1 },
+	{ 0x2004, 0, 1 },
+	{ 0x2005, 0, 1 },
+	{ 0x2006, 0, 1 },
+	{ 0x2007, 0, 1 },
+	{ 0x2008, 0, 1 },
+	{ 0x2009, 0, 1 },
+	{ 0x200a, 0, 1 },
+	{ 0x2011, 1271, 3 },
+	{ 0x2017, 0, 1 },
+	{ 0x2024, 1274, 1 },
+	{ 0x2025, 1275, 2 },
+	{ 0x2026, 1277, 3 },
+	{ 0x202f, 0, 1 },
+	{ 0x2033, 1280, 6 },
+	{ 0x2034, 1286, 9 },
+	{ 0x2036, 1295, 6 },
+	{ 0x2037, 1301, 9 },
+	{ 0x203c, 1310, 2 },
+	{ 0x203e, 0, 1 },
+	{ 0x2047, 1312, 2 },
+	{ 0x2048, 1314, 2 },
+	{ 0x2049, 1316, 2 },
+	{ 0x2057, 1318, 12 },
+	{ 0x205f, 0, 1 },
+	{ 0x2070, 1330, 1 },
+	{ 0x2071, 27, 1 },
+	{ 0x2074, 1331, 1 },
+	{ 0x2075, 1332, 1 },
+	{ 0x2076, 1333, 1 },
+	{ 0x2077, 1334, 1 },
+	{ 0x2078, 1335, 1 },
+	{ 0x2079, 1336, 1 },
+	{ 0x207a, 1337, 1 },
+	{ 0x207b, 1338, 3 },
+	{ 0x207c, 1341, 1 },
+	{ 0x207d, 1342, 1 },
+	{ 0x207e, 1343, 1 },
+	{ 0x207f, 30, 1 },
+	{ 0x2080, 1330, 1 },
+	{ 0x2081, 6, 1 },
+	{ 0x2082, 2, 1 },
+	{ 0x2083, 3, 1 },
+	{ 0x2084, 1331, 1 },
+	{ 0x2085, 1332, 1 },
+	{ 0x2086, 1333, 1 },
+	{ 0x2087, 1334, 1 },
+	{ 0x2088, 1335, 1 },
+	{ 0x2089, 1336, 1 },
+	{ 0x208a, 1337, 1 },
+	{ 0x208b, 1338, 3 },
+	{ 0x208c, 1341, 1 },
+	{ 0x208d, 1342, 1 },
+	{ 0x208e, 1343, 1 },
+	{ 0x2090, 1, 1 },
+	{ 0x2091, 26, 1 },
+	{ 0x2092, 7, 1 },
+	{ 0x2093, 194, 1 },
+	{ 0x2094, 88, 2 },
+	{ 0x2095, 43, 1 },
+	{ 0x2096, 49, 1 },
+	{ 0x2097, 50, 1 },
+	{ 0x2098, 1176, 1 },
+	{ 0x2099, 30, 1 },
+	{ 0x209a, 1177, 1 },
+	{ 0x209b, 64, 1 },
+	{ 0x209c, 65, 1 },
+	{ 0x20a8, 1344, 2 },
+	{ 0x2100, 1346, 3 },
+	{ 0x2101, 1349, 3 },
+	{ 0x2102, 25, 1 },
+	{ 0x2103, 1352, 3 },
+	{ 0x2105, 1355, 3 },
+	{ 0x2106, 1358, 3 },
+	{ 0x2107, 90, 2 },
+	{ 0x2109, 1361, 3 },
+	{ 0x210a, 42, 1 },
+	{ 0x210b, 43, 1 },
+	{ 0x210c, 43, 1 },
+	{ 0x210d, 43, 1 },
+	{ 0x210e, 43, 1 },
+	{ 0x210f, 44, 2 },
+	{ 0x2110, 27, 1 },
+	{ 0x2111, 27, 1 },
+	{ 0x2112, 50, 1 },
+	{ 0x2113, 50, 1 },
+	{ 0x2115, 30, 1 },
+	{ 0x2116, 1364, 2 },
+	{ 0x2119, 1177, 1 },
+	{ 0x211a, 1366, 1 },
+	{ 0x211b, 63, 1 },
+	{ 0x211c, 63, 1 },
+	{ 0x211d, 63, 1 },
+	{ 0x2120, 1367, 2 },
+	{ 0x2121, 1369, 3 },
+	{ 0x2122, 1372, 2 },
+	{ 0x2124, 69, 1 },
+	{ 0x2126, 225, 2 },
+	{ 0x2128, 69, 1 },
+	{ 0x212a, 49, 1 },
+	{ 0x212b, 1, 1 },
+	{ 0x212c, 1175, 1 },
+	{ 0x212d, 25, 1 },
+	{ 0x212f, 26, 1 },
+	{ 0x2130, 26, 1 },
+	{ 0x2131, 1204, 1 },
+	{ 0x2132, 1374, 3 },
+	{ 0x2133, 1176, 1 },
+	{ 0x2134, 7, 1 },
+	{ 0x2135, 1377, 2 },
+	{ 0x2136, 1379, 2 },
+	{ 0x2137, 1381, 2 },
+	{ 0x2138, 1383, 2 },
+	{ 0x2139, 27, 1 },
+	{ 0x213b, 1385, 3 },
+	{ 0x213c, 245, 2 },
+	{ 0x213d, 229, 2 },
+	{ 0x213e, 229, 2 },
+	{ 0x213f, 245, 2 },
+	{ 0x2140, 1388, 3 },
+	{ 0x2145, 39, 1 },
+	{ 0x2146, 39, 1 },
+	{ 0x2147, 26, 1 },
+	{ 0x2148, 27, 1 },
+	{ 0x2149, 48, 1 },
+	{ 0x2150, 1391, 5 },
+	{ 0x2151, 1396, 5 },
+	{ 0x2152, 1401, 6 },
+	{ 0x2153, 1407, 5 },
+	{ 0x2154, 1412, 5 },
+	{ 0x2155, 1417, 5 },
+	{ 0x2156, 1422, 5 },
+	{ 0x2157, 1427, 5 },
+	{ 0x2158, 1432, 5 },
+	{ 0x2159, 1437, 5 },
+	{ 0x215a, 1442, 5 },
+	{ 0x215b, 1447, 5 },
+	{ 0x215c, 1452, 5 },
+	{ 0x215d, 1457, 5 },
+	{ 0x215e, 1462, 5 },
+	{ 0x215f, 1467, 4 },
+	{ 0x2160, 27, 1 },
+	{ 0x2161, 1471, 2 },
+	{ 0x2162, 1473, 3 },
+	{ 0x2163, 1476, 2 },
+	{ 0x2164, 1196, 1 },
+	{ 0x2165, 1478, 2 },
+	{ 0x2166, 1480, 3 },
+	{ 0x2167, 1483, 4 },
+	{ 0x2168, 1487, 2 },
+	{ 0x2169, 194, 1 },
+	{ 0x216a, 1489, 2 },
+	{ 0x216b, 1491, 3 },
+	{ 0x216c, 50, 1 },
+	{ 0x216d, 25, 1 },
+	{ 0x216e, 39, 1 },
+	{ 0x216f, 1176, 1 },
+	{ 0x2170, 27, 1 },
+	{ 0x2171, 1471, 2 },
+	{ 0x2172, 1473, 3 },
+	{ 0x2173, 1476, 2 },
+	{ 0x2174, 1196, 1 },
+	{ 0x2175, 1478, 2 },
+	{ 0x2176, 1480, 3 },
+	{ 0x2177, 1483, 4 },
+	{ 0x2178, 1487, 2 },
+	{ 0x2179, 194, 1 },
+	{ 0x217a, 1489, 2 },
+	{ 0x217b, 1491, 3 },
+	{ 0x217c, 50, 1 },
+	{ 0x217d, 25, 1 },
+	{ 0x217e, 39, 1 },
+	{ 0x217f, 1176, 1 },
+	{ 0x2183, 1494, 3 },
+	{ 0x2189, 1497, 5 },
+	{ 0x219a, 1502, 3 },
+	{ 0x219b, 1505, 3 },
+	{ 0x21ae, 1508, 3 },
+	{ 0x21cd, 1511, 3 },
+	{ 0x21ce, 1514, 3 },
+	{ 0x21cf, 1517, 3 },
+	{ 0x2204, 1520, 3 },
+	{ 0x2209, 1523, 3 },
+	{ 0x220c, 1526, 3 },
+	{ 0x2224, 1529, 3 },
+	{ 0x2226, 1532, 3 },
+	{ 0x222c, 1535, 6 },
+	{ 0x222d, 1541, 9 },
+	{ 0x222f, 1550, 6 },
+	{ 0x2230, 1556, 9 },
+	{ 0x2241, 1565, 3 },
+	{ 0x2244, 1568, 3 },
+	{ 0x2247, 1571, 3 },
+	{ 0x2249, 1574, 3 },
+	{ 0x2260, 1341, 1 },
+	{ 0x2262, 1577, 3 },
+	{ 0x226d, 1580, 3 },
+	{ 0x226e, 1583, 1 },
+	{ 0x226f, 1584, 1 },
+	{ 0x2270, 1585, 3 },
+	{ 0x2271, 1588, 3 },
+	{ 0x2274, 1591, 3 },
+	{ 0x2275, 1594, 3 },
+	{ 0x2278, 1597, 3 },
+	{ 0x2279, 1600, 3 },
+	{ 0x2280, 1603, 3 },
+	{ 0x2281, 1606, 3 },
+	{ 0x2284, 1609, 3 },
+	{ 0x2285, 1612, 3 },
+	{ 0x2288, 1615, 3 },
+	{ 0x2289, 1618, 3 },
+	{ 0x22ac, 1621, 3 },
+	{ 0x22ad, 1624, 3 },
+	{ 0x22ae, 1627, 3 },
+	{ 0x22af, 1630, 3 },
+	{ 0x22e0, 1633, 3 },
+	{ 0x22e1, 1636, 3 },
+	{ 0x22e2, 1639, 3 },
+	{ 0x22e3, 1642, 3 },
+	{ 0x22ea, 1645, 3 },
+	{ 0x22eb, 1648, 3 },
+	{ 0x22ec, 1651, 3 },
+	{ 0x22ed, 1654, 3 },
+	{ 0x2329, 1657, 3 },
+	{ 0x232a, 1660, 3 },
+	{ 0x2460, 6, 1 },
+	{ 0x2461, 2, 1 },
+	{ 0x2462, 3, 1 },
+	{ 0x2463, 1331, 1 },
+	{ 0x2464, 1332, 1 },
+	{ 0x2465, 1333, 1 },
+	{ 0x2466, 1334, 1 },
+	{ 0x2467, 1335, 1 },
+	{ 0x2468, 1336, 1 },
+	{ 0x2469, 1663, 2 },
+	{ 0x246a, 1665, 2 },
+	{ 0x246b, 1667, 2 },
+	{ 0x246c, 1669, 2 },
+	{ 0x246d, 1671, 2 },
+	{ 0x246e, 1673, 2 },
+	{ 0x246f, 1675, 2 },
+	{ 0x2470, 1677, 2 },
+	{ 0x2471, 1679, 2 },
+	{ 0x2472, 1681, 2 },
+	{ 0x2473, 1683, 2 },
+	{ 0x2474, 1685, 3 },
+	{ 0x2475, 1688, 3 },
+	{ 0x2476, 1691, 3 },
+	{ 0x2477, 1694, 3 },
+	{ 0x2478, 1697, 3 },
+	{ 0x2479, 1700, 3 },
+	{ 0x247a, 1703, 3 },
+	{ 0x247b, 1706, 3 },
+	{ 0x247c, 1709, 3 },
+	{ 0x247d, 1712, 4 },
+	{ 0x247e, 1716, 4 },
+	{ 0x247f, 1720, 4 },
+	{ 0x2480, 1724, 4 },
+	{ 0x2481, 1728, 4 },
+	{ 0x2482, 1732, 4 },
+	{ 0x2483, 1736, 4 },
+	{ 0x2484, 1740, 4 },
+	{ 0x2485, 1744, 4 },
+	{ 0x2486, 1748, 4 },
+	{ 0x2487, 1752, 4 },
+	{ 0x2488, 1756, 2 },
+	{ 0x2489, 1758, 2 },
+	{ 0x248a, 1760, 2 },
+	{ 0x248b, 1762, 2 },
+	{ 0x248c, 1764, 2 },
+	{ 0x248d, 1766, 2 },
+	{ 0x248e, 1768, 2 },
+	{ 0x248f, 1770, 2 },
+	{ 0x2490, 1772, 2 },
+	{ 0x2491, 1774, 3 },
+	{ 0x2492, 1777, 3 },
+	{ 0x2493, 1780, 3 },
+	{ 0x2494, 1783, 3 },
+	{ 0x2495, 1786, 3 },
+	{ 0x2496, 1789, 3 },
+	{ 0x2497, 1792, 3 },
+	{ 0x2498, 1795, 3 },
+	{ 0x2499, 1798, 3 },
+	{ 0x249a, 1801, 3 },
+	{ 0x249b, 1804, 3 },
+	{ 0x249c, 1807, 3 },
+	{ 0x249d, 1810, 3 },
+	{ 0x249e, 1813, 3 },
+	{ 0x249f, 1816, 3 },
+	{ 0x24a0, 1819, 3 },
+	{ 0x24a1, 1822, 3 },
+	{ 0x24a2, 1825, 3 },
+	{ 0x24a3, 1828, 3 },
+	{ 0x24a4, 1831, 3 },
+	{ 0x24a5, 1834, 3 },
+	{ 0x24a6, 1837, 3 },
+	{ 0x24a7, 1840, 3 },
+	{ 0x24a8, 1843, 3 },
+	{ 0x24a9, 1846, 3 },
+	{ 0x24aa, 1849, 3 },
+	{ 0x24ab, 1852, 3 },
+	{ 0x24ac, 1855, 3 },
+	{ 0x24ad, 1858, 3 },
+	{ 0x24ae, 1861, 3 },
+	{ 0x24af, 1864, 3 },
+	{ 0x24b0, 1867, 3 },
+	{ 0x24b1, 1870, 3 },
+	{ 0x24b2, 1873, 3 },
+	{ 0x24b3, 1876, 3 },
+	{ 0x24b4, 1879, 3 },
+	{ 0x24b5, 1882, 3 },
+	{ 0x24b6, 1, 1 },
+	{ 0x24b7, 1175, 1 },
+	{ 0x24b8, 25, 1 },
+	{ 0x24b9, 39, 1 },
+	{ 0x24ba, 26, 1 },
+	{ 0x24bb, 1204, 1 },
+	{ 0x24bc, 42, 1 },
+	{ 0x24bd, 43, 1 },
+	{ 0x24be, 27, 1 },
+	{ 0x24bf, 48, 1 },
+	{ 0x24c0, 49, 1 },
+	{ 0x24c1, 50, 1 },
+	{ 0x24c2, 1176, 1 },
+	{ 0x24c3, 30, 1 },
+	{ 0x24c4, 7, 1 },
+	{ 0x24c5, 1177, 1 },
+	{ 0x24c6, 1366, 1 },
+	{ 0x24c7, 63, 1 },
+	{ 0x24c8, 64, 1 },
+	{ 0x24c9, 65, 1 },
+	{ 0x24ca, 33, 1 },
+	{ 0x24cb, 1196, 1 },
+	{ 0x24cc, 68, 1 },
+	{ 0x24cd, 194, 1 },
+	{ 0x24ce, 34, 1 },
+	{ 0x24cf, 69, 1 },
+	{ 0x24d0, 1, 1 },
+	{ 0x24d1, 1175, 1 },
+	{ 0x24d2, 25, 1 },
+	{ 0x24d3, 39, 1 },
+	{ 0x24d4, 26, 1 },
+	{ 0x24d5, 1204, 1 },
+	{ 0x24d6, 42, 1 },
+	{ 0x24d7, 43, 1 },
+	{ 0x24d8, 27, 1 },
+	{ 0x24d9, 48, 1 },
+	{ 0x24da, 49, 1 },
+	{ 0x24db, 50, 1 },
+	{ 0x24dc, 1176, 1 },
+	{ 0x24dd, 30, 1 },
+	{ 0x24de, 7, 1 },
+	{ 0x24df, 1177, 1 },
+	{ 0x24e0, 1366, 1 },
+	{ 0x24e1, 63, 1 },
+	{ 0x24e2, 64, 1 },
+	{ 0x24e3, 65, 1 },
+	{ 0x24e4, 33, 1 },
+	{ 0x24e5, 1196, 1 },
+	{ 0x24e6, 68, 1 },
+	{ 0x24e7, 194, 1 },
+	{ 0x24e8, 34, 1 },
+	{ 0x24e9, 69, 1 },
+	{ 0x24ea, 1330, 1 },
+	{ 0x2a0c, 1885, 12 },
+	{ 0x2a74, 1897, 3 },
+	{ 0x2a75, 1900, 2 },
+	{ 0x2a76, 1902, 3 },
+	{ 0x2adc, 1905, 3 },
+	{ 0x2c00, 1908, 3 },
+	{ 0x2c01, 1911, 3 },
+	{ 0x2c02, 1914, 3 },
+	{ 0x2c03, 1917, 3 },
+	{ 0x2c04, 1920, 3 },
+	{ 0x2c05, 1923, 3 },
+	{ 0x2c06, 1926, 3 },
+	{ 0x2c07, 1929, 3 },
+	{ 0x2c08, 1932, 3 },
+	{ 0x2c09, 1935, 3 },
+	{ 0x2c0a, 1938, 3 },
+	{ 0x2c0b, 1941, 3 },
+	{ 0x2c0c, 1944, 3 },
+	{ 0x2c0d, 1947, 3 },
+	{ 0x2c0e, 1950, 3 },
+	{ 0x2c0f, 1953, 3 },
+	{ 0x2c10, 1956, 3 },
+	{ 0x2c11, 1959, 3 },
+	{ 0x2c12, 1962, 3 },
+	{ 0x2c13, 1965, 3 },
+	{ 0x2c14, 1968, 3 },
+	{ 0x2c15, 1971, 3 },
+	{ 0x2c16, 1974, 3 },
+	{ 0x2c17, 1977, 3 },
+	{ 0x2c18, 1980, 3 },
+	{ 0x2c19, 1983, 3 },
+	{ 0x2c1a, 1986, 3 },
+	{ 0x2c1b, 1989, 3 },
+	{ 0x2c1c, 1992, 3 },
+	{ 0x2c1d, 1995, 3 },
+	{ 0x2c1e, 1998, 3 },
+	{ 0x2c1f, 2001, 3 },
+	{ 0x2c20, 2004, 3 },
+	{ 0x2c21, 2007, 3 },
+	{ 0x2c22, 2010, 3 },
+	{ 0x2c23, 2013, 3 },
+	{ 0x2c24, 2016, 3 },
+	{ 0x2c25, 2019, 3 },
+	{ 0x2c26, 2022, 3 },
+	{ 0x2c27, 2025, 3 },
+	{ 0x2c28, 2028, 3 },
+	{ 0x2c29, 2031, 3 },
+	{ 0x2c2a, 2034, 3 },
+	{ 0x2c2b, 2037, 3 },
+	{ 0x2c2c, 2040, 3 },
+	{ 0x2c2d, 2043, 3 },
+	{ 0x2c2e, 2046, 3 },
+	{ 0x2c2f, 2049, 3 },
+	{ 0x2c60, 2052, 3 },
+	{ 0x2c62, 2055, 2 },
+	{ 0x2c63, 2057, 3 },
+	{ 0x2c64, 2060, 2 },
+	{ 0x2c67, 2062, 3 },
+	{ 0x2c69, 2065, 3 },
+	{ 0x2c6b, 2068, 3 },
+	{ 0x2c6d, 1180, 2 },
+	{ 0x2c6e, 1225, 2 },
+	{ 0x2c6f, 1178, 2 },
+	{ 0x2c70, 1200, 2 },
+	{ 0x2c72, 2071, 3 },
+	{ 0x2c75, 2074, 3 },
+	{ 0x2c7c, 48, 1 },
+	{ 0x2c7d, 1196, 1 },
+	{ 0x2c7e, 2077, 2 },
+	{ 0x2c7f, 2079, 2 },
+	{ 0x2c80, 2081, 3 },
+	{ 0x2c82, 2084, 3 },
+	{ 0x2c84, 2087, 3 },
+	{ 0x2c86, 2090, 3 },
+	{ 0x2c88, 2093, 3 },
+	{ 0x2c8a, 2096, 3 },
+	{ 0x2c8c, 2099, 3 },
+	{ 0x2c8e, 2102, 3 },
+	{ 0x2c90, 2105, 3 },
+	{ 0x2c92, 2108, 3 },
+	{ 0x2c94, 2111, 3 },
+	{ 0x2c96, 2114, 3 },
+	{ 0x2c98, 2117, 3 },
+	{ 0x2c9a, 2120, 3 },
+	{ 0x2c9c, 2123, 3 },
+	{ 0x2c9e, 2126, 3 },
+	{ 0x2ca0, 2129, 3 },
+	{ 0x2ca2, 2132, 3 },
+	{ 0x2ca4, 2135, 3 },
+	{ 0x2ca6, 2138, 3 },
+	{ 0x2ca8, 2141, 3 },
+	{ 0x2caa, 2144, 3 },
+	{ 0x2cac, 2147, 3 },
+	{ 0x2cae, 2150, 3 },
+	{ 0x2cb0, 2153, 3 },
+	{ 0x2cb2, 2156, 3 },
+	{ 0x2cb4, 2159, 3 },
+	{ 0x2cb6, 2162, 3 },
+	{ 0x2cb8, 2165, 3 },
+	{ 0x2cba, 2168, 3 },
+	{ 0x2cbc, 2171, 3 },
+	{ 0x2cbe, 2174, 3 },
+	{ 0x2cc0, 2177, 3 },
+	{ 0x2cc2, 2180, 3 },
+	{ 0x2cc4, 2183, 3 },
+	{ 0x2cc6, 2186, 3 },
+	{ 0x2cc8, 2189, 3 },
+	{ 0x2cca, 2192, 3 },
+	{ 0x2ccc, 2195, 3 },
+	{ 0x2cce, 2198, 3 },
+	{ 0x2cd0, 2201, 3 },
+	{ 0x2cd2, 2204, 3 },
+	{ 0x2cd4, 2207, 3 },
+	{ 0x2cd6, 2210, 3 },
+	{ 0x2cd8, 2213, 3 },
+	{ 0x2cda, 2216, 3 },
+	{ 0x2cdc, 2219, 3 },
+	{ 0x2cde, 2222, 3 },
+	{ 0x2ce0, 2225, 3 },
+	{ 0x2ce2, 2228, 3 },
+	{ 0x2ceb, 2231, 3 },
+	{ 0x2ced, 2234, 3 },
+	{ 0x2cf2, 2237, 3 },
+	{ 0x2d6f, 2240, 3 },
+	{ 0x2e9f, 2243, 3 },
+	{ 0x2ef3, 2246, 3 },
+	{ 0x2f00, 2249, 3 },
+	{ 0x2f01, 2252, 3 },
+	{ 0x2f02, 2255, 3 },
+	{ 0x2f03, 2258, 3 },
+	{ 0x2f04, 2261, 3 },
+	{ 0x2f05, 2264, 3 },
+	{ 0x2f06, 2267, 3 },
+	{ 0x2f07, 2270, 3 },
+	{ 0x2f08, 2273, 3 },
+	{ 0x2f09, 2276, 3 },
+	{ 0x2f0a, 2279, 3 },
+	{ 0x2f0b, 2282, 3 },
+	{ 0x2f0c, 2285, 3 },
+	{ 0x2f0d, 2288, 3 },
+	{ 0x2f0e, 2291, 3 },
+	{ 0x2f0f, 2294, 3 },
+	{ 0x2f10, 2297, 3 },
+	{ 0x2f11, 2300, 3 },
+	{ 0x2f12, 2303, 3 },
+	{ 0x2f13, 2306, 3 },
+	{ 0x2f14, 2309, 3 },
+	{ 0x2f15, 2312, 3 },
+	{ 0x2f16, 2315, 3 },
+	{ 0x2f17, 2318, 3 },
+	{ 0x2f18, 2321, 3 },
+	{ 0x2f19, 2324, 3 },
+	{ 0x2f1a, 2327, 3 },
+	{ 0x2f1b, 2330, 3 },
+	{ 0x2f1c, 2333, 3 },
+	{ 0x2f1d, 2336, 3 },
+	{ 0x2f1e, 2339, 3 },
+	{ 0x2f1f, 2342, 3 },
+	{ 0x2f20, 2345, 3 },
+	{ 0x2f21, 2348, 3 },
+	{ 0x2f22, 2351, 3 },
+	{ 0x2f23, 2354, 3 },
+	{ 0x2f24, 2357, 3 },
+	{ 0x2f25, 2360, 3 },
+	{ 0x2f26, 2363, 3 },
+	{ 0x2f27, 2366, 3 },
+	{ 0x2f28, 2369, 3 },
+	{ 0x2f29, 2372, 3 },
+	{ 0x2f2a, 2375, 3 },
+	{ 0x2f2b, 2378, 3 },
+	{ 0x2f2c, 2381, 3 },
+	{ 0x2f2d, 2384, 3 },
+	{ 0x2f2e, 2387, 3 },
+	{ 0x2f2f, 2390, 3 },
+	{ 0x2f30, 2393, 3 },
+	{ 0x2f31, 2396, 3 },
+	{ 0x2f32, 2399, 3 },
+	{ 0x2f33, 2402, 3 },
+	{ 0x2f34, 2405, 3 },
+	{ 0x2f35, 2408, 3 },
+	{ 0x2f36, 2411, 3 },
+	{ 0x2f37, 2414, 3 },
+	{ 0x2f38, 2417, 3 },
+	{ 0x2f39, 2420, 3 },
+	{ 0x2f3a, 2423, 3 },
+	{ 0x2f3b, 2426, 3 },
+	{ 0x2f3c, 2429, 3 },
+	{ 0x2f3d, 2432, 3 },
+	{ 0x2f3e, 2435, 3 },
+	{ 0x2f3f, 2438, 3 },
+	{ 0x2f40, 2441, 3 },
+	{ 0x2f41, 2444, 3 },
+	{ 0x2f42, 2447, 3 },
+	{ 0x2f43, 2450, 3 },
+	{ 0x2f44, 2453, 3 },
+	{ 0x2f45, 2456, 3 },
+	{ 0x2f46, 2459, 3 },
+	{ 0x2f47, 2462, 3 },
+	{ 0x2f48, 2465, 3 },
+	{ 0x2f49, 2468, 3 },
+	{ 0x2f4a, 2471, 3 },
+	{ 0x2f4b, 2474, 3 },
+	{ 0x2f4c, 2477, 3 },
+	{ 0x2f4d, 2480, 3 },
+	{ 0x2f4e, 2483, 3 },
+	{ 0x2f4f, 2486, 3 },
+	{ 0x2f50, 2489, 3 },
+	{ 0x2f51, 2492, 3 },
+	{ 0x2f52, 2495, 3 },
+	{ 0x2f53, 2498, 3 },
+	{ 0x2f54, 2501, 3 },
+	{ 0x2f55, 2504, 3 },
+	{ 0x2f56, 2507, 3 },
+	{ 0x2f57, 2510, 3 },
+	{ 0x2f58, 2513, 3 },
+	{ 0x2f59, 2516, 3 },
+	{ 0x2f5a, 2519, 3 },
+	{ 0x2f5b, 2522, 3 },
+	{ 0x2f5c, 2525, 3 },
+	{ 0x2f5d, 2528, 3 },
+	{ 0x2f5e, 2531, 3 },
+	{ 0x2f5f, 2534, 3 },
+	{ 0x2f60, 2537, 3 },
+	{ 0x2f61, 2540, 3 },
+	{ 0x2f62, 2543, 3 },
+	{ 0x2f63, 2546, 3 },
+	{ 0x2f64, 2549, 3 },
+	{ 0x2f65, 2552, 3 },
+	{ 0x2f66, 2555, 3 },
+	{ 0x2f67, 2558, 3 },
+	{ 0x2f68, 2561, 3 },
+	{ 0x2f69, 2564, 3 },
+	{ 0x2f6a, 2567, 3 },
+	{ 0x2f6b, 2570, 3 },
+	{ 0x2f6c, 2573, 3 },
+	{ 0x2f6d, 2576, 3 },
+	{ 0x2f6e, 2579, 3 },
+	{ 0x2f6f, 2582, 3 },
+	{ 0x2f70, 2585, 3 },
+	{ 0x2f71, 2588, 3 },
+	{ 0x2f72, 2591, 3 },
+	{ 0x2f73, 2594, 3 },
+	{ 0x2f74, 2597, 3 },
+	{ 0x2f75, 2600, 3 },
+	{ 0x2f76, 2603, 3 },
+	{ 0x2f77, 2606, 3 },
+	{ 0x2f78, 2609, 3 },
+	{ 0x2f79, 2612, 3 },
+	{ 0x2f7a, 2615, 3 },
+	{ 0x2f7b, 2618, 3 },
+	{ 0x2f7c, 2621, 3 },
+	{ 0x2f7d, 2624, 3 },
+	{ 0x2f7e, 2627, 3 },
+	{ 0x2f7f, 2630, 3 },
+	{ 0x2f80, 2633, 3 },
+	{ 0x2f81, 2636, 3 },
+	{ 0x2f82, 2639, 3 },
+	{ 0x2f83, 2642, 3 },
+	{ 0x2f84, 2645, 3 },
+	{ 0x2f85, 2648, 3 },
+	{ 0x2f86, 2651, 3 },
+	{ 0x2f87, 2654, 3 },
+	{ 0x2f88, 2657, 3 },
+	{ 0x2f89, 2660, 3 },
+	{ 0x2f8a, 2663, 3 },
+	{ 0x2f8b, 2666, 3 },
+	{ 0x2f8c, 2669, 3 },
+	{ 0x2f8d, 2672, 3 },
+	{ 0x2f8e, 2675, 3 },
+	{ 0x2f8f, 2678, 3 },
+	{ 0x2f90, 2681, 3 },
+	{ 0x2f91, 2684, 3 },
+	{ 0x2f92, 2687, 3 },
+	{ 0x2f93, 2690, 3 },
+	{ 0x2f94, 2693, 3 },
+	{ 0x2f95, 2696, 3 },
+	{ 0x2f96, 2699, 3 },
+	{ 0x2f97, 2702, 3 },
+	{ 0x2f98, 2705, 3 },
+	{ 0x2f99, 2708, 3 },
+	{ 0x2f9a, 2711, 3 },
+	{ 0x2f9b, 2714, 3 },
+	{ 0x2f9c, 2717, 3 },
+	{ 0x2f9d, 2720, 3 },
+	{ 0x2f9e, 2723, 3 },
+	{ 0x2f9f, 2726, 3 },
+	{ 0x2fa0, 2729, 3 },
+	{ 0x2fa1, 2732, 3 },
+	{ 0x2fa2, 2735, 3 },
+	{ 0x2fa3, 2738, 3 },
+	{ 0x2fa4, 2741, 3 },
+	{ 0x2fa5, 2744, 3 },
+	{ 0x2fa6, 2747, 3 },
+	{ 0x2fa7, 2750, 3 },
+	{ 0x2fa8, 2753, 3 },
+	{ 0x2fa9, 2756, 3 },
+	{ 0x2faa, 2759, 3 },
+	{ 0x2fab, 2762, 3 },
+	{ 0x2fac, 2765, 3 },
+	{ 0x2fad, 2768, 3 },
+	{ 0x2fae, 2771, 3 },
+	{ 0x2faf, 2774, 3 },
+	{ 0x2fb0, 2777, 3 },
+	{ 0x2fb1, 2780, 3 },
+	{ 0x2fb2, 2783, 3 },
+	{ 0x2fb3, 2786, 3 },
+	{ 0x2fb4, 2789, 3 },
+	{ 0x2fb5, 2792, 3 },
+	{ 0x2fb6, 2795, 3 },
+	{ 0x2fb7, 2798, 3 },
+	{ 0x2fb8, 2801, 3 },
+	{ 0x2fb9, 2804, 3 },
+	{ 0x2fba, 2807, 3 },
+	{ 0x2fbb, 2810, 3 },
+	{ 0x2fbc, 2813, 3 },
+	{ 0x2fbd, 2816, 3 },
+	{ 0x2fbe, 2819, 3 },
+	{ 0x2fbf, 2822, 3 },
+	{ 0x2fc0, 2825, 3 },
+	{ 0x2fc1, 2828, 3 },
+	{ 0x2fc2, 2831, 3 },
+	{ 0x2fc3, 2834, 3 },
+	{ 0x2fc4, 2837, 3 },
+	{ 0x2fc5, 2840, 3 },
+	{ 0x2fc6, 2843, 3 },
+	{ 0x2fc7, 2846, 3 },
+	{ 0x2fc8, 2849, 3 },
+	{ 0x2fc9, 2852, 3 },
+	{ 0x2fca, 2855, 3 },
+	{ 0x2fcb, 2858, 3 },
+	{ 0x2fcc, 2861, 3 },
+	{ 0x2fcd, 2864, 3 },
+	{ 0x2fce, 2867, 3 },
+	{ 0x2fcf, 2870, 3 },
+	{ 0x2fd0, 2873, 3 },
+	{ 0x2fd1, 2876, 3 },
+	{ 0x2fd2, 2879, 3 },
+	{ 0x2fd3, 2882, 3 },
+	{ 0x2fd4, 2885, 3 },
+	{ 0x2fd5, 2888, 3 },
+	{ 0x3000, 0, 1 },
+	{ 0x3036, 2891, 3 },
+	{ 0x3038, 2318, 3 },
+	{ 0x3039, 2894, 3 },
+	{ 0x303a, 2897, 3 },
+	{ 0x309b, 2900, 4 },
+	{ 0x309c, 2904, 4 },
+	{ 0x309f, 2908, 6 },
+	{ 0x30ff, 2914, 6 },
+	{ 0x3131, 2920, 3 },
+	{ 0x3132, 2923, 3 },
+	{ 0x3133, 2926, 3 },
+	{ 0x3134, 2929, 3 },
+	{ 0x3135, 2932, 3 },
+	{ 0x3136, 2935, 3 },
+	{ 0x3137, 2938, 3 },
+	{ 0x3138, 2941, 3 },
+	{ 0x3139, 2944, 3 },
+	{ 0x313a, 2947, 3 },
+	{ 0x313b, 2950, 3 },
+	{ 0x313c, 2953, 3 },
+	{ 0x313d, 2956, 3 },
+	{ 0x313e, 2959, 3 },
+	{ 0x313f, 2962, 3 },
+	{ 0x3140, 2965, 3 },
+	{ 0x3141, 2968, 3 },
+	{ 0x3142, 2971, 3 },
+	{ 0x3143, 2974, 3 },
+	{ 0x3144, 2977, 3 },
+	{ 0x3145, 2980, 3 },
+	{ 0x3146, 2983, 3 },
+	{ 0x3147, 2986, 3 },
+	{ 0x3148, 2989, 3 },
+	{ 0x3149, 2992, 3 },
+	{ 0x314a, 2995, 3 },
+	{ 0x314b, 2998, 3 },
+	{ 0x314c, 3001, 3 },
+	{ 0x314d, 3004, 3 },
+	{ 0x314e, 3007, 3 },
+	{ 0x314f, 3010, 3 },
+	{ 0x3150, 3013, 3 },
+	{ 0x3151, 3016, 3 },
+	{ 0x3152, 3019, 3 },
+	{ 0x3153, 3022, 3 },
+	{ 0x3154, 3025, 3 },
+	{ 0x3155, 3028, 3 },
+	{ 0x3156, 3031, 3 },
+	{ 0x3157, 3034, 3 },
+	{ 0x3158, 3037, 3 },
+	{ 0x3159, 3040, 3 },
+	{ 0x315a, 3043, 3 },
+	{ 0x315b, 3046, 3 },
+	{ 0x315c, 3049, 3 },
+	{ 0x315d, 3052, 3 },
+	{ 0x315e, 3055, 3 },
+	{ 0x315f, 3058, 3 },
+	{ 0x3160, 3061, 3 },
+	{ 0x3161, 3064, 3 },
+	{ 0x3162, 3067, 3 },
+	{ 0x3163, 3070, 3 },
+	{ 0x3164, 3073, 3 },
+	{ 0x3165, 3076, 3 },
+	{ 0x3166, 3079, 3 },
+	{ 0x3167, 3082, 3 },
+	{ 0x3168, 3085, 3 },
+	{ 0x3169, 3088, 3 },
+	{ 0x316a, 3091, 3 },
+	{ 0x316b, 3094, 3 },
+	{ 0x316c, 3097, 3 },
+	{ 0x316d, 3100, 3 },
+	{ 0x316e, 3103, 3 },
+	{ 0x316f, 3106, 3 },
+	{ 0x3170, 3109, 3 },
+	{ 0x3171, 3112, 3 },
+	{ 0x3172, 3115, 3 },
+	{ 0x3173, 3118, 3 },
+	{ 0x3174, 3121, 3 },
+	{ 0x3175, 3124, 3 },
+	{ 0x3176, 3127, 3 },
+	{ 0x3177, 3130, 3 },
+	{ 0x3178, 3133, 3 },
+	{ 0x3179, 3136, 3 },
+	{ 0x317a, 3139, 3 },
+	{ 0x317b, 3142, 3 },
+	{ 0x317c, 3145, 3 },
+	{ 0x317d, 3148, 3 },
+	{ 0x317e, 3151, 3 },
+	{ 0x317f, 3154, 3 },
+	{ 0x3180, 3157, 3 },
+	{ 0x3181, 3160, 3 },
+	{ 0x3182, 3163, 3 },
+	{ 0x3183, 3166, 3 },
+	{ 0x3184, 3169, 3 },
+	{ 0x3185, 3172, 3 },
+	{ 0x3186, 3175, 3 },
+	{ 0x3187, 3178, 3 },
+	{ 0x3188, 3181, 3 },
+	{ 0x3189, 3184, 3 },
+	{ 0x318a, 3187, 3 },
+	{ 0x318b, 3190, 3 },
+	{ 0x318c, 3193, 3 },
+	{ 0x318d, 3196, 3 },
+	{ 0x318e, 3199, 3 },
+	{ 0x3192, 2249, 3 },
+	{ 0x3193, 2267, 3 },
+	{ 0x3194, 3202, 3 },
+	{ 0x3195, 3205, 3 },
+	{ 0x3196, 3208, 3 },
+	{ 0x3197, 3211, 3 },
+	{ 0x3198, 3214, 3 },
+	{ 0x3199, 3217, 3 },
+	{ 0x319a, 2261, 3 },
+	{ 0x319b, 3220, 3 },
+	{ 0x319c, 3223, 3 },
+	{ 0x319d, 3226, 3 },
+	{ 0x319e, 3229, 3 },
+	{ 0x319f, 2273, 3 },
+	{ 0x3200, 3232, 5 },
+	{ 0x3201, 3237, 5 },
+	{ 0x3202, 3242, 5 },
+	{ 0x3203, 3247, 5 },
+	{ 0x3204, 3252, 5 },
+	{ 0x3205, 3257, 5 },
+	{ 0x3206, 3262, 5 },
+	{ 0x3207, 3267, 5 },
+	{ 0x3208, 3272, 5 },
+	{ 0x3209, 3277, 5 },
+	{ 0x320a, 3282, 5 },
+	{ 0x320b, 3287, 5 },
+	{ 0x320c, 3292, 5 },
+	{ 0x320d, 3297, 5 },
+	{ 0x320e, 3302, 5 },
+	{ 0x320f, 3307, 5 },
+	{ 0x3210, 3312, 5 },
+	{ 0x3211, 3317, 5 },
+	{ 0x3212, 3322, 5 },
+	{ 0x3213, 3327, 5 },
+	{ 0x3214, 3332, 5 },
+	{ 0x3215, 3337, 5 },
+	{ 0x3216, 3342, 5 },
+	{ 0x3217, 3347, 5 },
+	{ 0x3218, 3352, 5 },
+	{ 0x3219, 3357, 5 },
+	{ 0x321a, 3362, 5 },
+	{ 0x321b, 3367, 5 },
+	{ 0x321c, 3372, 5 },
+	{ 0x321d, 3377, 8 },
+	{ 0x321e, 3385, 8 },
+	{ 0x3220, 3393, 5 },
+	{ 0x3221, 3398, 5 },
+	{ 0x3222, 3403, 5 },
+	{ 0x3223, 3408, 5 },
+	{ 0x3224, 3413, 5 },
+	{ 0x3225, 3418, 5 },
+	{ 0x3226, 3423, 5 },
+	{ 0x3227, 3428, 5 },
+	{ 0x3228, 3433, 5 },
+	{ 0x3229, 3438, 5 },
+	{ 0x322a, 3443, 5 },
+	{ 0x322b, 3448, 5 },
+	{ 0x322c, 3453, 5 },
+	{ 0x322d, 3458, 5 },
+	{ 0x322e, 3463, 5 },
+	{ 0x322f, 3468, 5 },
+	{ 0x3230, 3473, 5 },
+	{ 0x3231, 3478, 5 },
+	{ 0x3232, 3483, 5 },
+	{ 0x3233, 3488, 5 },
+	{ 0x3234, 3493, 5 },
+	{ 0x3235, 3498, 5 },
+	{ 0x3236, 3503, 5 },
+	{ 0x3237, 3508, 5 },
+	{ 0x3238, 3513, 5 },
+	{ 0x3239, 3518, 5 },
+	{ 0x323a, 3523, 5 },
+	{ 0x323b, 3528, 5 },
+	{ 0x323c, 3533, 5 },
+	{ 0x323d, 3538, 5 },
+	{ 0x323e, 3543, 5 },
+	{ 0x323f, 3548, 5 },
+	{ 0x3240, 3553, 5 },
+	{ 0x3241, 3558, 5 },
+	{ 0x3242, 3563, 5 },
+	{ 0x3243, 3568, 5 },
+	{ 0x3244, 3573, 3 },
+	{ 0x3245, 3576, 3 },
+	{ 0x3246, 2447, 3 },
+	{ 0x3247, 3579, 3 },
+	{ 0x3250, 3582, 3 },
+	{ 0x3251, 3585, 2 },
+	{ 0x3252, 3587, 2 },
+	{ 0x3253, 3589, 2 },
+	{ 0x3254, 3591, 2 },
+	{ 0x3255, 3593, 2 },
+	{ 0x3256, 3595, 2 },
+	{ 0x3257, 3597, 2 },
+	{ 0x3258, 3599, 2 },
+	{ 0x3259, 3601, 2 },
+	{ 0x325a, 3603, 2 },
+	{ 0x325b, 3605, 2 },
+	{ 0x325c, 3607, 2 },
+	{ 0x325d, 3609, 2 },
+	{ 0x325e, 3611, 2 },
+	{ 0x325f, 3613, 2 },
+	{ 0x3260, 2920, 3 },
+	{ 0x3261, 2929, 3 },
+	{ 0x3262, 2938, 3 },
+	{ 0x3263, 2944, 3 },
+	{ 0x3264, 2968, 3 },
+	{ 0x3265, 2971, 3 },
+	{ 0x3266, 2980, 3 },
+	{ 0x3267, 2986, 3 },
+	{ 0x3268, 2989, 3 },
+	{ 0x3269, 2995, 3 },
+	{ 0x326a, 2998, 3 },
+	{ 0x326b, 3001, 3 },
+	{ 0x326c, 3004, 3 },
+	{ 0x326d, 3007, 3 },
+	{ 0x326e, 3615, 3 },
+	{ 0x326f, 3618, 3 },
+	{ 0x3270, 3621, 3 },
+	{ 0x3271, 3624, 3 },
+	{ 0x3272, 3627, 3 },
+	{ 0x3273, 3630, 3 },
+	{ 0x3274, 3633, 3 },
+	{ 0x3275, 3636, 3 },
+	{ 0x3276, 3639, 3 },
+	{ 0x3277, 3642, 3 },
+	{ 0x3278, 3645, 3 },
+	{ 0x3279, 3648, 3 },
+	{ 0x327a, 3651, 3 },
+	{ 0x327b, 3654, 3 },
+	{ 0x327c, 3657, 6 },
+	{ 0x327d, 3663, 6 },
+	{ 0x327e, 3669, 3 },
+	{ 0x3280, 2249, 3 },
+	{ 0x3281, 2267, 3 },
+	{ 0x3282, 3202, 3 },
+	{ 0x3283, 3205, 3 },
+	{ 0x3284, 3672, 3 },
+	{ 0x3285, 3675, 3 },
+	{ 0x3286, 3678, 3 },
+	{ 0x3287, 2282, 3 },
+	{ 0x3288, 3681, 3 },
+	{ 0x3289, 2318, 3 },
+	{ 0x328a, 2468, 3 },
+	{ 0x328b, 2504, 3 },
+	{ 0x328c, 2501, 3 },
+	{ 0x328d, 2471, 3 },
+	{ 0x328e, 2747, 3 },
+	{ 0x328f, 2342, 3 },
+	{ 0x3290, 2462, 3 },
+	{ 0x3291, 3684, 3 },
+	{ 0x3292, 3687, 3 },
+	{ 0x3293, 3690, 3 },
+	{ 0x3294, 3693, 3 },
+	{ 0x3295, 3696, 3 },
+	{ 0x3296, 3699, 3 },
+	{ 0x3297, 3702, 3 },
+	{ 0x3298, 3705, 3 },
+	{ 0x3299, 3708, 3 },
+	{ 0x329a, 3711, 3 },
+	{ 0x329b, 2360, 3 },
+	{ 0x329c, 3714, 3 },
+	{ 0x329d, 3717, 3 },
+	{ 0x329e, 3720, 3 },
+	{ 0x329f, 3723, 3 },
+	{ 0x32a0, 3726, 3 },
+	{ 0x32a1, 3729, 3 },
+	{ 0x32a2, 3732, 3 },
+	{ 0x32a3, 3735, 3 },
+	{ 0x32a4, 3208, 3 },
+	{ 0x32a5, 3211, 3 },
+	{ 0x32a6, 3214, 3 },
+	{ 0x32a7, 3738, 3 },
+	{ 0x32a8, 3741, 3 },
+	{ 0x32a9, 3744, 3 },
+	{ 0x32aa, 3747, 3 },
+	{ 0x32ab, 3750, 3 },
+	{ 0x32ac, 3753, 3 },
+	{ 0x32ad, 3756, 3 },
+	{ 0x32ae, 3759, 3 },
+	{ 0x32af, 3762, 3 },
+	{ 0x32b0, 3765, 3 },
+	{ 0x32b1, 3768, 2 },
+	{ 0x32b2, 3770, 2 },
+	{ 0x32b3, 3772, 2 },
+	{ 0x32b4, 3774, 2 },
+	{ 0x32b5, 3776, 2 },
+	{ 0x32b6, 3778, 2 },
+	{ 0x32b7, 3780, 2 },
+	{ 0x32b8, 3782, 2 },
+	{ 0x32b9, 3784, 2 },
+	{ 0x32ba, 3786, 2 },
+	{ 0x32bb, 3788, 2 },
+	{ 0x32bc, 3790, 2 },
+	{ 0x32bd, 3792, 2 },
+	{ 0x32be, 3794, 2 },
+	{ 0x32bf, 3796, 2 },
+	{ 0x32c0, 3798, 4 },
+	{ 0x32c1, 3802, 4 },
+	{ 0x32c2, 3806, 4 },
+	{ 0x32c3, 3810, 4 },
+	{ 0x32c4, 3814, 4 },
+	{ 0x32c5, 3818, 4 },
+	{ 0x32c6, 3822, 4 },
+	{ 0x32c7, 3826, 4 },
+	{ 0x32c8, 3830, 4 },
+	{ 0x32c9, 3834, 5 },
+	{ 0x32ca, 3839, 5 },
+	{ 0x32cb, 3844, 5 },
+	{ 0x32cc, 3849, 2 },
+	{ 0x32cd, 3851, 3 },
+	{ 0x32ce, 3854, 2 },
+	{ 0x32cf, 3856, 3 },
+	{ 0x32d0, 3859, 3 },
+	{ 0x32d1, 3862, 3 },
+	{ 0x32d2, 3865, 3 },
+	{ 0x32d3, 3868, 3 },
+	{ 0x32d4, 3871, 3 },
+	{ 0x32d5, 3874, 3 },
+	{ 0x32d6, 3877, 3 },
+	{ 0x32d7, 3880, 3 },
+	{ 0x32d8, 3883, 3 },
+	{ 0x32d9, 3886, 3 },
+	{ 0x32da, 3889, 3 },
+	{ 0x32db, 3892, 3 },
+	{ 0x32dc, 3895, 3 },
+	{ 0x32dd, 3898, 3 },
+	{ 0x32de, 3901, 3 },
+	{ 0x32df, 3904, 3 },
+	{ 0x32e0, 3907, 3 },
+	{ 0x32e1, 3910, 3 },
+	{ 0x32e2, 3913, 3 },
+	{ 0x32e3, 3916, 3 },
+	{ 0x32e4, 3919, 3 },
+	{ 0x32e5, 3922, 3 },
+	{ 0x32e6, 3925, 3 },
+	{ 0x32e7, 3928, 3 },
+	{ 0x32e8, 3931, 3 },
+	{ 0x32e9, 3934, 3 },
+	{ 0x32ea, 3937, 3 },
+	{ 0x32eb, 3940, 3 },
+	{ 0x32ec, 3943, 3 },
+	{ 0x32ed, 3946, 3 },
+	{ 0x32ee, 3949, 3 },
+	{ 0x32ef, 3952, 3 },
+	{ 0x32f0, 3955, 3 },
+	{ 0x32f1, 3958, 3 },
+	{ 0x32f2, 3961, 3 },
+	{ 0x32f3, 3964, 3 },
+	{ 0x32f4, 3967, 3 },
+	{ 0x32f5, 3970, 3 },
+	{ 0x32f6, 3973, 3 },
+	{ 0x32f7, 3976, 3 },
+	{ 0x32f8, 3979, 3 },
+	{ 0x32f9, 3982, 3 },
+	{ 0x32fa, 3985, 3 },
+	{ 0x32fb, 3988, 3 },
+	{ 0x32fc, 3991, 3 },
+	{ 0x32fd, 3994, 3 },
+	{ 0x32fe, 3997, 3 },
+	{ 0x32ff, 4000, 6 },
+	{ 0x3300, 4006, 12 },
+	{ 0x3301, 4018, 12 },
+	{ 0x3302, 4030, 12 },
+	{ 0x3303, 4042, 9 },
+	{ 0x3304, 4051, 12 },
+	{ 0x3305, 4063, 9 },
+	{ 0x3306, 4072, 9 },
+	{ 0x3307, 4081, 15 },
+	{ 0x3308, 4096, 12 },
+	{ 0x3309, 4108, 9 },
+	{ 0x330a, 4117, 9 },
+	{ 0x330b, 4126, 9 },
+	{ 0x330c, 4135, 12 },
+	{ 0x330d, 4147, 12 },
+	{ 0x330e, 4159, 9 },
+	{ 0x330f, 4168, 9 },
+	{ 0x3310, 4177, 6 },
+	{ 0x3311, 4183, 9 },
+	{ 0x3312, 4192, 12 },
+	{ 0x3313, 4204, 12 },
+	{ 0x3314, 4216, 6 },
+	{ 0x3315, 4222, 15 },
+	{ 0x3316, 4237, 18 },
+	{ 0x3317, 4255, 15 },
+	{ 0x3318, 4270, 9 },
+	{ 0x3319, 4279, 15 },
+	{ 0x331a, 4294, 15 },
+	{ 0x331b, 4309, 12 },
+	{ 0x331c, 4321, 9 },
+	{ 0x331d, 4330, 9 },
+	{ 0x331e, 4339, 9 },
+	{ 0x331f, 4348, 12 },
+	{ 0x3320, 4360, 15 },
+	{ 0x3321, 4375, 12 },
+	{ 0x3322, 4387, 9 },
+	{ 0x3323, 4396, 9 },
+	{ 0x3324, 4405, 9 },
+	{ 0x3325, 4414, 6 },
+	{ 0x3326, 4420, 6 },
+	{ 0x3327, 4426, 6 },
+	{ 0x3328, 4432, 6 },
+	{ 0x3329, 4438, 9 },
+	{ 0x332a, 4447, 9 },
+	{ 0x332b, 4456, 15 },
+	{ 0x332c, 4471, 9 },
+	{ 0x332d, 4480, 12 },
+	{ 0x332e, 4492, 15 },
+	{ 0x332f, 4507, 9 },
+	{ 0x3330, 4516, 6 },
+	{ 0x3331, 4522, 6 },
+	{ 0x3332, 4528, 15 },
+	{ 0x3333, 4543, 12 },
+	{ 0x3334, 4555, 15 },
+	{ 0x3335, 4570, 9 },
+	{ 0x3336, 4579, 15 },
+	{ 0x3337, 4594, 6 },
+	{ 0x3338, 4600, 9 },
+	{ 0x3339, 4609, 9 },
+	{ 0x333a, 4618, 9 },
+	{ 0x333b, 4627, 9 },
+	{ 0x333c, 4636, 9 },
+	{ 0x333d, 4645, 12 },
+	{ 0x333e, 4657, 9 },
+	{ 0x333f, 4666, 6 },
+	{ 0x3340, 4672, 9 },
+	{ 0x3341, 4681, 9 },
+	{ 0x3342, 4690, 9 },
+	{ 0x3343, 4699, 12 },
+	{ 0x3344, 4711, 9 },
+	{ 0x3345, 4720, 9 },
+	{ 0x3346, 4729, 9 },
+	{ 0x3347, 4738, 15 },
+	{ 0x3348, 4753, 12 },
+	{ 0x3349, 4765, 6 },
+	{ 0x334a, 4771, 15 },
+	{ 0x334b, 4786, 6 },
+	{ 0x334c, 4792, 12 },
+	{ 0x334d, 4804, 12 },
+	{ 0x334e, 4816, 9 },
+	{ 0x334f, 4825, 9 },
+	{ 0x3350, 4834, 9 },
+	{ 0x3351, 4843, 12 },
+	{ 0x3352, 4855, 6 },
+	{ 0x3353, 4861, 9 },
+	{ 0x3354, 4870, 12 },
+	{ 0x3355, 4882, 6 },
+	{ 0x3356, 4888, 15 },
+	{ 0x3357, 4903, 9 },
+	{ 0x3358, 4912, 4 },
+	{ 0x3359, 4916, 4 },
+	{ 0x335a, 4920, 4 },
+	{ 0x335b, 4924, 4 },
+	{ 0x335c, 4928, 4 },
+	{ 0x335d, 4932, 4 },
+	{ 0x335e, 4936, 4 },
+	{ 0x335f, 4940, 4 },
+	{ 0x3360, 4944, 4 },
+	{ 0x3361, 4948, 4 },
+	{ 0x3362, 4952, 5 },
+	{ 0x3363, 4957, 5 },
+	{ 0x3364, 4962, 5 },
+	{ 0x3365, 4967, 5 },
+	{ 0x3366, 4972, 5 },
+	{ 0x3367, 4977, 5 },
+	{ 0x3368, 4982, 5 },
+	{ 0x3369, 4987, 5 },
+	{ 0x336a, 4992, 5 },
+	{ 0x336b, 4997, 5 },
+	{ 0x336c, 5002, 5 },
+	{ 0x336d, 5007, 5 },
+	{ 0x336e, 5012, 5 },
+	{ 0x336f, 5017, 5 },
+	{ 0x3370, 5022, 5 },
+	{ 0x3371, 5027, 3 },
+	{ 0x3372, 5030, 2 },
+	{ 0x3373, 5032, 2 },
+	{ 0x3374, 5034, 3 },
+	{ 0x3375, 5037, 2 },
+	{ 0x3376, 5039, 2 },
+	{ 0x3377, 5041, 2 },
+	{ 0x3378, 5043, 3 },
+	{ 0x3379, 5046, 3 },
+	{ 0x337a, 5049, 2 },
+	{ 0x337b, 5051, 6 },
+	{ 0x337c, 5057, 6 },
+	{ 0x337d, 5063, 6 },
+	{ 0x337e, 5069, 6 },
+	{ 0x337f, 5075, 12 },
+	{ 0x3380, 5087, 2 },
+	{ 0x3381, 5089, 2 },
+	{ 0x3382, 5091, 3 },
+	{ 0x3383, 5094, 2 },
+	{ 0x3384, 5096, 2 },
+	{ 0x3385, 5098, 2 },
+	{ 0x3386, 5100, 2 },
+	{ 0x3387, 5102, 2 },
+	{ 0x3388, 5104, 3 },
+	{ 0x3389, 5107, 4 },
+	{ 0x338a, 5111, 2 },
+	{ 0x338b, 5113, 2 },
+	{ 0x338c, 5115, 3 },
+	{ 0x338d, 5118, 3 },
+	{ 0x338e, 5121, 2 },
+	{ 0x338f, 5123, 2 },
+	{ 0x3390, 5125, 2 },
+	{ 0x3391, 5127, 3 },
+	{ 0x3392, 5130, 3 },
+	{ 0x3393, 5133, 3 },
+	{ 0x3394, 5136, 3 },
+	{ 0x3395, 5139, 3 },
+	{ 0x3396, 5142, 2 },
+	{ 0x3397, 5144, 2 },
+	{ 0x3398, 5146, 2 },
+	{ 0x3399, 5148, 2 },
+	{ 0x339a, 5150, 2 },
+	{ 0x339b, 5152, 3 },
+	{ 0x339c, 5155, 2 },
+	{ 0x339d, 5157, 2 },
+	{ 0x339e, 5159, 2 },
+	{ 0x339f, 5161, 3 },
+	{ 0x33a0, 5164, 3 },
+	{ 0x33a1, 5167, 2 },
+	{ 0x33a2, 5169, 3 },
+	{ 0x33a3, 5172, 3 },
+	{ 0x33a4, 5175, 3 },
+	{ 0x33a5, 5178, 2 },
+	{ 0x33a6, 5180, 3 },
+	{ 0x33a7, 5183, 5 },
+	{ 0x33a8, 5188, 6 },
+	{ 0x33a9, 5087, 2 },
+	{ 0x33aa, 5194, 3 },
+	{ 0x33ab, 5197, 3 },
+	{ 0x33ac, 5200, 3 },
+	{ 0x33ad, 5203, 3 },
+	{ 0x33ae, 5206, 7 },
+	{ 0x33af, 5213, 8 },
+	{ 0x33b0, 5221, 2 },
+	{ 0x33b1, 5223, 2 },
+	{ 0x33b2, 5225, 3 },
+	{ 0x33b3, 5228, 2 },
+	{ 0x33b4, 5230, 2 },
+	{ 0x33b5, 5232, 2 },
+	{ 0x33b6, 5234, 3 },
+	{ 0x33b7, 5237, 2 },
+	{ 0x33b8, 5239, 2 },
+	{ 0x33b9, 5237, 2 },
+	{ 0x33ba, 5241, 2 },
+	{ 0x33bb, 5243, 2 },
+	{ 0x33bc, 5245, 3 },
+	{ 0x33bd, 5248, 2 },
+	{ 0x33be, 5250, 2 },
+	{ 0x33bf, 5248, 2 },
+	{ 0x33c0, 5252, 3 },
+	{ 0x33c1, 5255, 3 },
+	{ 0x33c2, 5258, 4 },
+	{ 0x33c3, 5262, 2 },
+	{ 0x33c4, 5264, 2 },
+	{ 0x33c5, 5266, 2 },
+	{ 0x33c6, 5268, 6 },
+	{ 0x33c7, 5274, 3 },
+	{ 0x33c8, 5277, 2 },
+	{ 0x33c9, 5279, 2 },
+	{ 0x33ca, 5281, 2 },
+	{ 0x33cb, 5283, 2 },
+	{ 0x33cc, 5285, 2 },
+	{ 0x33cd, 5287, 2 },
+	{ 0x33ce, 5159, 2 },
+	{ 0x33cf, 5289, 2 },
+	{ 0x33d0, 5291, 2 },
+	{ 0x33d1, 5293, 2 },
+	{ 0x33d2, 5295, 3 },
+	{ 0x33d3, 5298, 2 },
+	{ 0x33d4, 5100, 2 },
+	{ 0x33d5, 5300, 3 },
+	{ 0x33d6, 5303, 3 },
+	{ 0x33d7, 5306, 2 },
+	{ 0x33d8, 5308, 4 },
+	{ 0x33d9, 5312, 3 },
+	{ 0x33da, 5315, 2 },
+	{ 0x33db, 5317, 2 },
+	{ 0x33dc, 5319, 2 },
+	{ 0x33dd, 5321, 2 },
+	{ 0x33de, 5323, 5 },
+	{ 0x33df, 5328, 5 },
+	{ 0x33e0, 5333, 4 },
+	{ 0x33e1, 5337, 4 },
+	{ 0x33e2, 5341, 4 },
+	{ 0x33e3, 5345, 4 },
+	{ 0x33e4, 5349, 4 },
+	{ 0x33e5, 5353, 4 },
+	{ 0x33e6, 5357, 4 },
+	{ 0x33e7, 5361, 4 },
+	{ 0x33e8, 5365, 4 },
+	{ 0x33e9, 5369, 5 },
+	{ 0x33ea, 5374, 5 },
+	{ 0x33eb, 5379, 5 },
+	{ 0x33ec, 5384, 5 },
+	{ 0x33ed, 5389, 5 },
+	{ 0x33ee, 5394, 5 },
+	{ 0x33ef, 5399, 5 },
+	{ 0x33f0, 5404, 5 },
+	{ 0x33f1, 5409, 5 },
+	{ 0x33f2, 5414, 5 },
+	{ 0x33f3, 5419, 5 },
+	{ 0x33f4, 5424, 5 },
+	{ 0x33f5, 5429, 5 },
+	{ 0x33f6, 5434, 5 },
+	{ 0x33f7, 5439, 5 },
+	{ 0x33f8, 5444, 5 },
+	{ 0x33f9, 5449, 5 },
+	{ 0x33fa, 5454, 5 },
+	{ 0x33fb, 5459, 5 },
+	{ 0x33fc, 5464, 5 },
+	{ 0x33fd, 5469, 5 },
+	{ 0x33fe, 5474, 5 },
+	{ 0x33ff, 5479, 3 },
+	{ 0xa640, 5482, 3 },
+	{ 0xa642, 5485, 3 },
+	{ 0xa644, 5488, 3 },
+	{ 0xa646, 5491, 3 },
+	{ 0xa648, 5494, 3 },
+	{ 0xa64a, 1037, 3 },
+	{ 0xa64c, 5497, 3 },
+	{ 0xa64e, 5500, 3 },
+	{ 0xa650, 5503, 3 },
+	{ 0xa652, 5506, 3 },
+	{ 0xa654, 5509, 3 },
+	{ 0xa656, 5512, 3 },
+	{ 0xa658, 5515, 3 },
+	{ 0xa65a, 5518, 3 },
+	{ 0xa65c, 5521, 3 },
+	{ 0xa65e, 5524, 3 },
+	{ 0xa660, 5527, 3 },
+	{ 0xa662, 5530, 3 },
+	{ 0xa664, 5533, 3 },
+	{ 0xa666, 5536, 3 },
+	{ 0xa668, 5539, 3 },
+	{ 0xa66a, 5542, 3 },
+	{ 0xa66c, 5545, 3 },
+	{ 0xa680, 5548, 3 },
+	{ 0xa682, 5551, 3 },
+	{ 0xa684, 5554, 3 },
+	{ 0xa686, 5557, 3 },
+	{ 0xa688, 5560, 3 },
+	{ 0xa68a, 5563, 3 },
+	{ 0xa68c, 5566, 3 },
+	{ 0xa68e, 5569, 3 },
+	{ 0xa690, 5572, 3 },
+	{ 0xa692, 5575, 3 },
+	{ 0xa694, 5578, 3 },
+	{ 0xa696, 5581, 3 },
+	{ 0xa698, 5584, 3 },
+	{ 0xa69a, 5587, 3 },
+	{ 0xa69c, 363, 2 },
+	{ 0xa69d, 367, 2 },
+	{ 0xa722, 5590, 3 },
+	{ 0xa724, 5593, 3 },
+	{ 0xa726, 5596, 3 },
+	{ 0xa728, 5599, 3 },
+	{ 0xa72a, 5602, 3 },
+	{ 0xa72c, 5605, 3 },
+	{ 0xa72e, 5608, 3 },
+	{ 0xa732, 5611, 3 },
+	{ 0xa734, 5614, 3 },
+	{ 0xa736, 5617, 3 },
+	{ 0xa738, 5620, 3 },
+	{ 0xa73a, 5623, 3 },
+	{ 0xa73c, 5626, 3 },
+	{ 0xa73e, 5629, 3 },
+	{ 0xa740, 5632, 3 },
+	{ 0xa742, 5635, 3 },
+	{ 0xa744, 5638, 3 },
+	{ 0xa746, 5641, 3 },
+	{ 0xa748, 5644, 3 },
+	{ 0xa74a, 5647, 3 },
+	{ 0xa74c, 5650, 3 },
+	{ 0xa74e, 5653, 3 },
+	{ 0xa750, 5656, 3 },
+	{ 0xa752, 5659, 3 },
+	{ 0xa754, 5662, 3 },
+	{ 0xa756, 5665, 3 },
+	{ 0xa758, 5668, 3 },
+	{ 0xa75a, 5671, 3 },
+	{ 0xa75c, 5674, 3 },
+	{ 0xa75e, 5677, 3 },
+	{ 0xa760, 5680, 3 },
+	{ 0xa762, 5683, 3 },
+	{ 0xa764, 5686, 3 },
+	{ 0xa766, 5689, 3 },
+	{ 0xa768, 5692, 3 },
+	{ 0xa76a, 5695, 3 },
+	{ 0xa76c, 5698, 3 },
+	{ 0xa76e, 5701, 3 },
+	{ 0xa770, 5701, 3 },
+	{ 0xa779, 5704, 3 },
+	{ 0xa77b, 5707, 3 },
+	{ 0xa77d, 5710, 3 },
+	{ 0xa77e, 5713, 3 },
+	{ 0xa780, 5716, 3 },
+	{ 0xa782, 5719, 3 },
+	{ 0xa784, 5722, 3 },
+	{ 0xa786, 5725, 3 },
+	{ 0xa78b, 5728, 3 },
+	{ 0xa78d, 1209, 2 },
+	{ 0xa790, 5731, 3 },
+	{ 0xa792, 5734, 3 },
+	{ 0xa796, 5737, 3 },
+	{ 0xa798, 5740, 3 },
+	{ 0xa79a, 5743, 3 },
+	{ 0xa79c, 5746, 3 },
+	{ 0xa79e, 5749, 3 },
+	{ 0xa7a0, 5752, 3 },
+	{ 0xa7a2, 5755, 3 },
+	{ 0xa7a4, 5758, 3 },
+	{ 0xa7a6, 5761, 3 },
+	{ 0xa7a8, 5764, 3 },
+	{ 0xa7aa, 186, 2 },
+	{ 0xa7ab, 1185, 2 },
+	{ 0xa7ac, 1207, 2 },
+	{ 0xa7ad, 5767, 2 },
+	{ 0xa7ae, 1211, 2 },
+	{ 0xa7b0, 5769, 2 },
+	{ 0xa7b1, 5771, 2 },
+	{ 0xa7b2, 1216, 2 },
+	{ 0xa7b3, 5773, 3 },
+	{ 0xa7b4, 5776, 3 },
+	{ 0xa7b6, 5779, 3 },
+	{ 0xa7b8, 5782, 3 },
+	{ 0xa7ba, 5785, 3 },
+	{ 0xa7bc, 5788, 3 },
+	{ 0xa7be, 5791, 3 },
+	{ 0xa7c0, 5794, 3 },
+	{ 0xa7c2, 5797, 3 },
+	{ 0xa7c4, 5800, 3 },
+	{ 0xa7c5, 1235, 2 },
+	{ 0xa7c6, 5803, 3 },
+	{ 0xa7c7, 5806, 3 },
+	{ 0xa7c9, 5809, 3 },
+	{ 0xa7d0, 5812, 3 },
+	{ 0xa7d6, 5815, 3 },
+	{ 0xa7d8, 5818, 3 },
+	{ 0xa7f2, 25, 1 },
+	{ 0xa7f3, 1204, 1 },
+	{ 0xa7f4, 1366, 1 },
+	{ 0xa7f5, 5821, 3 },
+	{ 0xa7f8, 44, 2 },
+	{ 0xa7f9, 61, 2 },
+	{ 0xab5c, 5596, 3 },
+	{ 0xab5d, 5824, 3 },
+	{ 0xab5e, 2055, 2 },
+	{ 0xab5f, 5827, 3 },
+	{ 0xab69, 5830, 2 },
+	{ 0xab70, 5832, 3 },
+	{ 0xab71, 5835, 3 },
+	{ 0xab72, 5838, 3 },
+	{ 0xab73, 5841, 3 },
+	{ 0xab74, 5844, 3 },
+	{ 0xab75, 5847, 3 },
+	{ 0xab76, 5850, 3 },
+	{ 0xab77, 5853, 3 },
+	{ 0xab78, 5856, 3 },
+	{ 0xab79, 5859, 3 },
+	{ 0xab7a, 5862, 3 },
+	{ 0xab7b, 5865, 3 },
+	{ 0xab7c, 5868, 3 },
+	{ 0xab7d, 5871, 3 },
+	{ 0xab7e, 5874, 3 },
+	{ 0xab7f, 5877, 3 },
+	{ 0xab80, 5880, 3 },
+	{ 0xab81, 5883, 3 },
+	{ 0xab82, 5886, 3 },
+	{ 0xab83, 5889, 3 },
+	{ 0xab84, 5892, 3 },
+	{ 0xab85, 5895, 3 },
+	{ 0xab86, 5898, 3 },
+	{ 0xab87, 5901, 3 },
+	{ 0xab88, 5904, 3 },
+	{ 0xab89, 5907, 3 },
+	{ 0xab8a, 5910, 3 },
+	{ 0xab8b, 5913, 3 },
+	{ 0xab8c, 5916, 3 },
+	{ 0xab8d, 5919, 3 },
+	{ 0xab8e, 5922, 3 },
+	{ 0xab8f, 5925, 3 },
+	{ 0xab90, 5928, 3 },
+	{ 0xab91, 5931, 3 },
+	{ 0xab92, 5934, 3 },
+	{ 0xab93, 5937, 3 },
+	{ 0xab94, 5940, 3 },
+	{ 0xab95, 5943, 3 },
+	{ 0xab96, 5946, 3 },
+	{ 0xab97, 5949, 3 },
+	{ 0xab98, 5952, 3 },
+	{ 0xab99, 5955, 3 },
+	{ 0xab9a, 5958, 3 },
+	{ 0xab9b, 5961, 3 },
+	{ 0xab9c, 5964, 3 },
+	{ 0xab9d, 5967, 3 },
+	{ 0xab9e, 5970, 3 },
+	{ 0xab9f, 5973, 3 },
+	{ 0xaba0, 5976, 3 },
+	{ 0xaba1, 5979, 3 },
+	{ 0xaba2, 5982, 3 },
+	{ 0xaba3, 5985, 3 },
+	{ 0xaba4, 5988, 3 },
+	{ 0xaba5, 5991, 3 },
+	{ 0xaba6, 5994, 3 },
+	{ 0xaba7, 5997, 3 },
+	{ 0xaba8, 6000, 3 },
+	{ 0xaba9, 6003, 3 },
+	{ 0xabaa, 6006, 3 },
+	{ 0xabab, 6009, 3 },
+	{ 0xabac, 6012, 3 },
+	{ 0xabad, 6015, 3 },
+	{ 0xabae, 6018, 3 },
+	{ 0xabaf, 6021, 3 },
+	{ 0xabb0, 6024, 3 },
+	{ 0xabb1, 6027, 3 },
+	{ 0xabb2, 6030, 3 },
+	{ 0xabb3, 6033, 3 },
+	{ 0xabb4, 6036, 3 },
+	{ 0xabb5, 6039, 3 },
+	{ 0xabb6, 6042, 3 },
+	{ 0xabb7, 6045, 3 },
+	{ 0xabb8, 6048, 3 },
+	{ 0xabb9, 6051, 3 },
+	{ 0xabba, 6054, 3 },
+	{ 0xabbb, 6057, 3 },
+	{ 0xabbc, 6060, 3 },
+	{ 0xabbd, 6063, 3 },
+	{ 0xabbe, 6066, 3 },
+	{ 0xabbf, 6069, 3 },
+	{ 0xf900, 6072, 3 },
+	{ 0xf901, 6075, 3 },
+	{ 0xf902, 2723, 3 },
+	{ 0xf903, 6078, 3 },
+	{ 0xf904, 6081, 3 },
+	{ 0xf905, 6084, 3 },
+	{ 0xf906, 6087, 3 },
+	{ 0xf907, 2885, 3 },
+	{ 0xf908, 2885, 3 },
+	{ 0xf909, 6090, 3 },
+	{ 0xf90a, 2747, 3 },
+	{ 0xf90b, 6093, 3 },
+	{ 0xf90c, 6096, 3 },
+	{ 0xf90d, 6099, 3 },
+	{ 0xf90e, 6102, 3 },
+	{ 0xf90f, 6105, 3 },
+	{ 0xf910, 6108, 3 },
+	{ 0xf911, 6111, 3 },
+	{ 0xf912, 6114, 3 },
+	{ 0xf913, 6117, 3 },
+	{ 0xf914, 6120, 3 },
+	{ 0xf915, 6123, 3 },
+	{ 0xf916, 6126, 3 },
+	{ 0xf917, 6129, 3 },
+	{ 0xf918, 6132, 3 },
+	{ 0xf919, 6135, 3 },
+	{ 0xf91a, 6138, 3 },
+	{ 0xf91b, 6141, 3 },
+	{ 0xf91c, 6144, 3 },
+	{ 0xf91d, 6147, 3 },
+	{ 0xf91e, 6150, 3 },
+	{ 0xf91f, 6153, 3 },
+	{ 0xf920, 6156, 3 },
+	{ 0xf921, 6159, 3 },
+	{ 0xf922, 6162, 3 },
+	{ 0xf923, 6165, 3 },
+	{ 0xf924, 6168, 3 },
+	{ 0xf925, 6171, 3 },
+	{ 0xf926, 6174, 3 },
+	{ 0xf927, 6177, 3 },
+	{ 0xf928, 6180, 3 },
+	{ 0xf929, 6183, 3 },
+	{ 0xf92a, 6186, 3 },
+	{ 0xf92b, 6189, 3 },
+	{ 0xf92c, 6192, 3 },
+	{ 0xf92d, 6195, 3 },
+	{ 0xf92e, 6198, 3 },
+	{ 0xf92f, 6201, 3 },
+	{ 0xf930, 6204, 3 },
+	{ 0xf931, 6207, 3 },
+	{ 0xf932, 6210, 3 },
+	{ 0xf933, 6213, 3 },
+	{ 0xf934, 2621, 3 },
+	{ 0xf935, 6216, 3 },
+	{ 0xf936, 6219, 3 },
+	{ 0xf937, 6222, 3 },
+	{ 0xf938, 6225, 3 },
+	{ 0xf939, 6228, 3 },
+	{ 0xf93a, 6231, 3 },
+	{ 0xf93b, 6234, 3 },
+	{ 0xf93c, 6237, 3 },
+	{ 0xf93d, 6240, 3 },
+	{ 0xf93e, 6243, 3 },
+	{ 0xf93f, 6246, 3 },
+	{ 0xf940, 2840, 3 },
+	{ 0xf941, 6249, 3 },
+	{ 0xf942, 6252, 3 },
+	{ 0xf943, 6255, 3 },
+	{ 0xf944, 6258, 3 },
+	{ 0xf945, 6261, 3 },
+	{ 0xf946, 6264, 3 },
+	{ 0xf947, 6267, 3 },
+	{ 0xf948, 6270, 3 },
+	{ 0xf949, 6273, 3 },
+	{ 0xf94a, 6276, 3 },
+	{ 0xf94b, 6279, 3 },
+	{ 0xf94c, 6282, 3 },
+	{ 0xf94d, 6285, 3 },
+	{ 0xf94e, 6288, 3 },
+	{ 0xf94f, 6291, 3 },
+	{ 0xf950, 6294, 3 },
+	{ 0xf951, 6297, 3 },
+	{ 0xf952, 6300, 3 },
+	{ 0xf953, 6303, 3 },
+	{ 0xf954, 6306, 3 },
+	{ 0xf955, 6309, 3 },
+	{ 0xf956, 6312, 3 },
+	{ 0xf957, 6315, 3 },
+	{ 0xf958, 6318, 3 },
+	{ 0xf959, 6321, 3 },
+	{ 0xf95a, 6324, 3 },
+	{ 0xf95b, 6327, 3 },
+	{ 0xf95c, 6120, 3 },
+	{ 0xf95d, 6330, 3 },
+	{ 0xf95e, 6333, 3 },
+	{ 0xf95f, 6336, 3 },
+	{ 0xf960, 6339, 3 },
+	{ 0xf961, 6342, 3 },
+	{ 0xf962, 6345, 3 },
+	{ 0xf963, 6348, 3 },
+	{ 0xf964, 6351, 3 },
+	{ 0xf965, 6354, 3 },
+	{ 0xf966, 6357, 3 },
+	{ 0xf967, 6360, 3 },
+	{ 0xf968, 6363, 3 },
+	{ 0xf969, 6366, 3 },
+	{ 0xf96a, 6369, 3 },
+	{ 0xf96b, 6372, 3 },
+	{ 0xf96c, 6375, 3 },
+	{ 0xf96d, 6378, 3 },
+	{ 0xf96e, 6381, 3 },
+	{ 0xf96f, 6384, 3 },
+	{ 0xf970, 6387, 3 },
+	{ 0xf971, 2729, 3 },
+	{ 0xf972, 6390, 3 },
+	{ 0xf973, 6393, 3 },
+	{ 0xf974, 6396, 3 },
+	{ 0xf975, 6399, 3 },
+	{ 0xf976, 6402, 3 },
+	{ 0xf977, 6405, 3 },
+	{ 0xf978, 6408, 3 },
+	{ 0xf979, 6411, 3 },
+	{ 0xf97a, 6414, 3 },
+	{ 0xf97b, 6417, 3 },
+	{ 0xf97c, 6420, 3 },
+	{ 0xf97d, 6423, 3 },
+	{ 0xf97e, 6426, 3 },
+	{ 0xf97f, 6429, 3 },
+	{ 0xf980, 6432, 3 },
+	{ 0xf981, 2360, 3 },
+	{ 0xf982, 6435, 3 },
+	{ 0xf983, 6438, 3 },
+	{ 0xf984, 6441, 3 },
+	{ 0xf985, 6444, 3 },
+	{ 0xf986, 6447, 3 },
+	{ 0xf987, 6450, 3 },
+	{ 0xf988, 6453, 3 },
+	{ 0xf989, 6456, 3 },
+	{ 0xf98a, 2303, 3 },
+	{ 0xf98b, 6459, 3 },
+	{ 0xf98c, 6462, 3 },
+	{ 0xf98d, 6465, 3 },
+	{ 0xf98e, 6468, 3 },
+	{ 0xf98f, 6471, 3 },
+	{ 0xf990, 6474, 3 },
+	{ 0xf991, 6477, 3 },
+	{ 0xf992, 6480, 3 },
+	{ 0xf993, 6483, 3 },
+	{ 0xf994, 6486, 3 },
+	{ 0xf995, 6489, 3 },
+	{ 0xf996, 6492, 3 },
+	{ 0xf997, 6495, 3 },
+	{ 0xf998, 6498, 3 },
+	{ 0xf999, 6501, 3 },
+	{ 0xf99a, 6504, 3 },
+	{ 0xf99b, 6507, 3 },
+	{ 0xf99c, 6510, 3 },
+	{ 0xf99d, 6513, 3 },
+	{ 0xf99e, 6516, 3 },
+	{ 0xf99f, 6519, 3 },
+	{ 0xf9a0, 6522, 3 },
+	{ 0xf9a1, 6384, 3 },
+	{ 0xf9a2, 6525, 3 },
+	{ 0xf9a3, 6528, 3 },
+	{ 0xf9a4, 6531, 3 },
+	{ 0xf9a5, 6534, 3 },
+	{ 0xf9a6, 6537, 3 },
+	{ 0xf9a7, 6540, 3 },
+	{ 0xf9a8, 6543, 3 },
+	{ 0xf9a9, 6546, 3 },
+	{ 0xf9aa, 6336, 3 },
+	{ 0xf9ab, 6549, 3 },
+	{ 0xf9ac, 6552, 3 },
+	{ 0xf9ad, 6555, 3 },
+	{ 0xf9ae, 6558, 3 },
+	{ 0xf9af, 6561, 3 },
+	{ 0xf9b0, 6564, 3 },
+	{ 0xf9b1, 6567, 3 },
+	{ 0xf9b2, 6570, 3 },
+	{ 0xf9b3, 6573, 3 },
+	{ 0xf9b4, 6576, 3 },
+	{ 0xf9b5, 6579, 3 },
+	{ 0xf9b6, 6582, 3 },
+	{ 0xf9b7, 6585, 3 },
+	{ 0xf9b8, 6588, 3 },
+	{ 0xf9b9, 6591, 3 },
+	{ 0xf9ba, 6594, 3 },
+	{ 0xf9bb, 6597, 3 },
+	{ 0xf9bc, 6600, 3 },
+	{ 0xf9bd, 6603, 3 },
+	{ 0xf9be, 6606, 3 },
+	{ 0xf9bf, 6120, 3 },
+	{ 0xf9c0, 6609, 3 },
+	{ 0xf9c1, 6612, 3 },
+	{ 0xf9c2, 6615, 3 },
+	{ 0xf9c3, 6618, 3 },
+	{ 0xf9c4, 2882, 3 },
+	{ 0xf9c5, 6621, 3 },
+	{ 0xf9c6, 6624, 3 },
+	{ 0xf9c7, 6627, 3 },
+	{ 0xf9c8, 6630, 3 },
+	{ 0xf9c9, 6633, 3 },
+	{ 0xf9ca, 6636, 3 },
+	{ 0xf9cb, 6639, 3 },
+	{ 0xf9cc, 6642, 3 },
+	{ 0xf9cd, 6645, 3 },
+	{ 0xf9ce, 6648, 3 },
+	{ 0xf9cf, 6651, 3 },
+	{ 0xf9d0, 6654, 3 },
+	{ 0xf9d1, 3675, 3 },
+	{ 0xf9d2, 6657, 3 },
+	{ 0xf9d3, 6660, 3 },
+	{ 0xf9d4, 6663, 3 },
+	{ 0xf9d5, 6666, 3 },
+	{ 0xf9d6, 6669, 3 },
+	{ 0xf9d7, 6672, 3 },
+	{ 0xf9d8, 6675, 3 },
+	{ 0xf9d9, 6678, 3 },
+	{ 0xf9da, 6681, 3 },
+	{ 0xf9db, 6342, 3 },
+	{ 0xf9dc, 6684, 3 },
+	{ 0xf9dd, 6687, 3 },
+	{ 0xf9de, 6690, 3 },
+	{ 0xf9df, 6693, 3 },
+	{ 0xf9e0, 6696, 3 },
+	{ 0xf9e1, 6699, 3 },
+	{ 0xf9e2, 6702, 3 },
+	{ 0xf9e3, 6705, 3 },
+	{ 0xf9e4, 6708, 3 },
+	{ 0xf9e5, 6711, 3 },
+	{ 0xf9e6, 6714, 3 },
+	{ 0xf9e7, 6717, 3 },
+	{ 0xf9e8, 6720, 3 },
+	{ 0xf9e9, 2744, 3 },
+	{ 0xf9ea, 6723, 3 },
+	{ 0xf9eb, 6726, 3 },
+	{ 0xf9ec, 6729, 3 },
+	{ 0xf9ed, 6732, 3 },
+	{ 0xf9ee, 6735, 3 },
+	{ 0xf9ef, 6738, 3 },
+	{ 0xf9f0, 6741, 3 },
+	{ 0xf9f1, 6744, 3 },
+	{ 0xf9f2, 6747, 3 },
+	{ 0xf9f3, 6750, 3 },
+	{ 0xf9f4, 6753, 3 },
+	{ 0xf9f5, 6756, 3 },
+	{ 0xf9f6, 6759, 3 },
+	{ 0xf9f7, 2597, 3 },
+	{ 0xf9f8, 6762, 3 },
+	{ 0xf9f9, 6765, 3 },
+	{ 0xf9fa, 6768, 3 },
+	{ 0xf9fb, 6771, 3 },
+	{ 0xf9fc, 6774, 3 },
+	{ 0xf9fd, 6777, 3 },
+	{ 0xf9fe, 6780, 3 },
+	{ 0xf9ff, 6783, 3 },
+	{ 0xfa00, 6786, 3 },
+	{ 0xfa01, 6789, 3 },
+	{ 0xfa02, 6792, 3 },
+	{ 0xfa03, 6795, 3 },
+	{ 0xfa04, 6798, 3 },
+	{ 0xfa05, 6801, 3 },
+	{ 0xfa06, 6804, 3 },
+	{ 0xfa07, 6807, 3 },
+	{ 0xfa08, 2678, 3 },
+	{ 0xfa09, 6810, 3 },
+	{ 0xfa0a, 2687, 3 },
+	{ 0xfa0b, 6813, 3 },
+	{ 0xfa0c, 6816, 3 },
+	{ 0xfa0d, 6819, 3 },
+	{ 0xfa10, 6822, 3 },
+	{ 0xfa12, 6825, 3 },
+	{ 0xfa15, 6828, 3 },
+	{ 0xfa16, 6831, 3 },
+	{ 0xfa17, 6834, 3 },
+	{ 0xfa18, 6837, 3 },
+	{ 0xfa19, 6840, 3 },
+	{ 0xfa1a, 6843, 3 },
+	{ 0xfa1b, 6846, 3 },
+	{ 0xfa1c, 6849, 3 },
+	{ 0xfa1d, 6852, 3 },
+	{ 0xfa1e, 2618, 3 },
+	{ 0xfa20, 6855, 3 },
+	{ 0xfa22, 6858, 3 },
+	{ 0xfa25, 6861, 3 },
+	{ 0xfa26, 6864, 3 },
+	{ 0xfa2a, 6867, 3 },
+	{ 0xfa2b, 6870, 3 },
+	{ 0xfa2c, 6873, 3 },
+	{ 0xfa2d, 6876, 3 },
+	{ 0xfa2e, 6879, 3 },
+	{ 0xfa2f, 6882, 3 },
+	{ 0xfa30, 6885, 3 },
+	{ 0xfa31, 6888, 3 },
+	{ 0xfa32, 6891, 3 },
+	{ 0xfa33, 6894, 3 },
+	{ 0xfa34, 6897, 3 },
+	{ 0xfa35, 6900, 3 },
+	{ 0xfa36, 6903, 3 },
+	{ 0xfa37, 6906, 3 },
+	{ 0xfa38, 6909, 3 },
+	{ 0xfa39, 6912, 3 },
+	{ 0xfa3a, 6915, 3 },
+	{ 0xfa3b, 6918, 3 },
+	{ 0xfa3c, 2381, 3 },
+	{ 0xfa3d, 6921, 3 },
+	{ 0xfa3e, 6924, 3 },
+	{ 0xfa3f, 6927, 3 },
+	{ 0xfa40, 6930, 3 },
+	{ 0xfa41, 6933, 3 },
+	{ 0xfa42, 6936, 3 },
+	{ 0xfa43, 6939, 3 },
+	{ 0xfa44, 6942, 3 },
+	{ 0xfa45, 6945, 3 },
+	{ 0xfa46, 6948, 3 },
+	{ 0xfa47, 6951, 3 },
+	{ 0xfa48, 6954, 3 },
+	{ 0xfa49, 6957, 3 },
+	{ 0xfa4a, 6960, 3 },
+	{ 0xfa4b, 6963, 3 },
+	{ 0xfa4c, 3690, 3 },
+	{ 0xfa4d, 6966, 3 },
+	{ 0xfa4e, 6969, 3 },
+	{ 0xfa4f, 6972, 3 },
+	{ 0xfa50, 6975, 3 },
+	{ 0xfa51, 3702, 3 },
+	{ 0xfa52, 6978, 3 },
+	{ 0xfa53, 6981, 3 },
+	{ 0xfa54, 6984, 3 },
+	{ 0xfa55, 6987, 3 },
+	{ 0xfa56, 6990, 3 },
+	{ 0xfa57, 6492, 3 },
+	{ 0xfa58, 6993, 3 },
+	{ 0xfa59, 6996, 3 },
+	{ 0xfa5a, 6999, 3 },
+	{ 0xfa5b, 7002, 3 },
+	{ 0xfa5c, 7005, 3 },
+	{ 0xfa5d, 7008, 3 },
+	{ 0xfa5e, 7008, 3 },
+	{ 0xfa5f, 7011, 3 },
+	{ 0xfa60, 7014, 3 },
+	{ 0xfa61, 7017, 3 },
+	{ 0xfa62, 7020, 3 },
+	{ 0xfa63, 7023, 3 },
+	{ 0xfa64, 7026, 3 },
+	{ 0xfa65, 7029, 3 },
+	{ 0xfa66, 7032, 3 },
+	{ 0xfa67, 6861, 3 },
+	{ 0xfa68, 7035, 3 },
+	{ 0xfa69, 7038, 3 },
+	{ 0xfa6a, 7041, 3 },
+	{ 0xfa6b, 7044, 3 },
+	{ 0xfa6c, 7047, 4 },
+	{ 0xfa6d, 7051, 3 },
+	{ 0xfa70, 7054, 3 },
+	{ 0xfa71, 7057, 3 },
+	{ 0xfa72, 7060, 3 },
+	{ 0xfa73, 7063, 3 },
+	{ 0xfa74, 7066, 3 },
+	{ 0xfa75, 7069, 3 },
+	{ 0xfa76, 7072, 3 },
+	{ 0xfa77, 7075, 3 },
+	{ 0xfa78, 6903, 3 },
+	{ 0xfa79, 7078, 3 },
+	{ 0xfa7a, 7081, 3 },
+	{ 0xfa7b, 7084, 3 },
+	{ 0xfa7c, 6822, 3 },
+	{ 0xfa7d, 7087, 3 },
+	{ 0xfa7e, 7090, 3 },
+	{ 0xfa7f, 7093, 3 },
+	{ 0xfa80, 7096, 3 },
+	{ 0xfa81, 7099, 3 },
+	{ 0xfa82, 7102, 3 },
+	{ 0xfa83, 7105, 3 },
+	{ 0xfa84, 7108, 3 },
+	{ 0xfa85, 7111, 3 },
+	{ 0xfa86, 7114, 3 },
+	{ 0xfa87, 7117, 3 },
+	{ 0xfa88, 7120, 3 },
+	{ 0xfa89, 6927, 3 },
+	{ 0xfa8a, 7123, 3 },
+	{ 0xfa8b, 6930, 3 },
+	{ 0xfa8c, 7126, 3 },
+	{ 0xfa8d, 7129, 3 },
+	{ 0xfa8e, 7132, 3 },
+	{ 0xfa8f, 7135, 3 },
+	{ 0xfa90, 7138, 3 },
+	{ 0xfa91, 6825, 3 },
+	{ 0xfa92, 6183, 3 },
+	{ 0xfa93, 7141, 3 },
+	{ 0xfa94, 7144, 3 },
+	{ 0xfa95, 2480, 3 },
+	{ 0xfa96, 6387, 3 },
+	{ 0xfa97, 6636, 3 },
+	{ 0xfa98, 7147, 3 },
+	{ 0xfa99, 7150, 3 },
+	{ 0xfa9a, 6951, 3 },
+	{ 0xfa9b, 7153, 3 },
+	{ 0xfa9c, 6954, 3 },
+	{ 0xfa9d, 7156, 3 },
+	{ 0xfa9e, 7159, 3 },
+	{ 0xfa9f, 7162, 3 },
+	{ 0xfaa0, 6831, 3 },
+	{ 0xfaa1, 7165, 3 },
+	{ 0xfaa2, 7168, 3 },
+	{ 0xfaa3, 7171, 3 },
+	{ 0xfaa4, 7174, 3 },
+	{ 0xfaa5, 7177, 3 },
+	{ 0xfaa6, 6834, 3 },
+	{ 0xfaa7, 7180, 3 },
+	{ 0xfaa8, 7183, 3 },
+	{ 0xfaa9, 7186, 3 },
+	{ 0xfaaa, 7189, 3 },
+	{ 0xfaab, 7192, 3 },
+	{ 0xfaac, 7195, 3 },
+	{ 0xfaad, 6990, 3 },
+	{ 0xfaae, 7198, 3 },
+	{ 0xfaaf, 7201, 3 },
+	{ 0xfab0, 6492, 3 },
+	{ 0xfab1, 7204, 3 },
+	{ 0xfab2, 7002, 3 },
+	{ 0xfab3, 7207, 3 },
+	{ 0xfab4, 7210, 3 },
+	{ 0xfab5, 7213, 3 },
+	{ 0xfab6, 7216, 3 },
+	{ 0xfab7, 7219, 3 },
+	{ 0xfab8, 7017, 3 },
+	{ 0xfab9, 7222, 3 },
+	{ 0xfaba, 6858, 3 },
+	{ 0xfabb, 7225, 3 },
+	{ 0xfabc, 7020, 3 },
+	{ 0xfabd, 6330, 3 },
+	{ 0xfabe, 7228, 3 },
+	{ 0xfabf, 7023, 3 },
+	{ 0xfac0, 7231, 3 },
+	{ 0xfac1, 7029, 3 },
+	{ 0xfac2, 7234, 3 },
+	{ 0xfac3, 7237, 3 },
+	{ 0xfac4, 7240, 3 },
+	{ 0xfac5, 7243, 3 },
+	{ 0xfac6, 7246, 3 },
+	{ 0xfac7, 7035, 3 },
+	{ 0xfac8, 6849, 3 },
+	{ 0xfac9, 7249, 3 },
+	{ 0xfaca, 7038, 3 },
+	{ 0xfacb, 7252, 3 },
+	{ 0xfacc, 7041, 3 },
+	{ 0xfacd, 7255, 3 },
+	{ 0xface, 2885, 3 },
+	{ 0xfacf, 7258, 4 },
+	{ 0xfad0, 7262, 4 },
+	{ 0xfad1, 7266, 4 },
+	{ 0xfad2, 7270, 3 },
+	{ 0xfad3, 7273, 3 },
+	{ 0xfad4, 7276, 3 },
+	{ 0xfad5, 7279, 4 },
+	{ 0xfad6, 7283, 4 },
+	{ 0xfad7, 7287, 4 },
+	{ 0xfad8, 7291, 3 },
+	{ 0xfad9, 7294, 3 },
+	{ 0xfb00, 7297, 2 },
+	{ 0xfb01, 7299, 2 },
+	{ 0xfb02, 7301, 2 },
+	{ 0xfb03, 7303, 3 },
+	{ 0xfb04, 7306, 3 },
+	{ 0xfb05, 7309, 2 },
+	{ 0xfb06, 7309, 2 },
+	{ 0xfb13, 7311, 4 },
+	{ 0xfb14, 7315, 4 },
+	{ 0xfb15, 7319, 4 },
+	{ 0xfb16, 7323, 4 },
+	{ 0xfb17, 7327, 4 },
+	{ 0xfb1d, 7331, 4 },
+	{ 0xfb1f, 7335, 4 },
+	{ 0xfb20, 7339, 2 },
+	{ 0xfb21, 1377, 2 },
+	{ 0xfb22, 1383, 2 },
+	{ 0xfb23, 7341, 2 },
+	{ 0xfb24, 7343, 2 },
+	{ 0xfb25, 7345, 2 },
+	{ 0xfb26, 7347, 2 },
+	{ 0xfb27, 7349, 2 },
+	{ 0xfb28, 7351, 2 },
+	{ 0xfb29, 1337, 1 },
+	{ 0xfb2a, 7353, 4 },
+	{ 0xfb2b, 7357, 4 },
+	{ 0xfb2c, 7361, 6 },
+	{ 0xfb2d, 7367, 6 },
+	{ 0xfb2e, 7373, 4 },
+	{ 0xfb2f, 7377, 4 },
+	{ 0xfb30, 7381, 4 },
+	{ 0xfb31, 7385, 4 },
+	{ 0xfb32, 7389, 4 },
+	{ 0xfb33, 7393, 4 },
+	{ 0xfb34, 7397, 4 },
+	{ 0xfb35, 7401, 4 },
+	{ 0xfb36, 7405, 4 },
+	{ 0xfb38, 7409, 4 },
+	{ 0xfb39, 7413, 4 },
+	{ 0xfb3a, 7417, 4 },
+	{ 0xfb3b, 7421, 4 },
+	{ 0xfb3c, 7425, 4 },
+	{ 0xfb3e, 7429, 4 },
+	{ 0xfb40, 7433, 4 },
+	{ 0xfb41, 7437, 4 },
+	{ 0xfb43, 7441, 4 },
+	{ 0xfb44, 7445, 4 },
+	{ 0xfb46, 7449, 4 },
+	{ 0xfb47, 7453, 4 },
+	{ 0xfb48, 7457, 4 },
+	{ 0xfb49, 7461, 4 },
+	{ 0xfb4a, 7465, 4 },
+	{ 0xfb4b, 7469, 4 },
+	{ 0xfb4c, 7473, 4 },
+	{ 0xfb4d, 7477, 4 },
+	{ 0xfb4e, 7481, 4 },
+	{ 0xfb4f, 7485, 4 },
+	{ 0xfb50, 7489, 2 },
+	{ 0xfb51, 7489, 2 },
+	{ 0xfb52, 7491, 2 },
+	{ 0xfb53, 7491, 2 },
+	{ 0xfb54, 7491, 2 },
+	{ 0xfb55, 7491, 2 },
+	{ 0xfb56, 7493, 2 },
+	{ 0xfb57, 7493, 2 },
+	{ 0xfb58, 7493, 2 },
+	{ 0xfb59, 7493, 2 },
+	{ 0xfb5a, 7495, 2 },
+	{ 0xfb5b, 7495, 2 },
+	{ 0xfb5c, 7495, 2 },
+	{ 0xfb5d, 7495, 2 },
+	{ 0xfb5e, 7497, 2 },
+	{ 0xfb5f, 7497, 2 },
+	{ 0xfb60, 7497, 2 },
+	{ 0xfb61, 7497, 2 },
+	{ 0xfb62, 7499, 2 },
+	{ 0xfb63, 7499, 2 },
+	{ 0xfb64, 7499, 2 },
+	{ 0xfb65, 7499, 2 },
+	{ 0xfb66, 7501, 2 },
+	{ 0xfb67, 7501, 2 },
+	{ 0xfb68, 7501, 2 },
+	{ 0xfb69, 7501, 2 },
+	{ 0xfb6a, 7503, 2 },
+	{ 0xfb6b, 7503, 2 },
+	{ 0xfb6c, 7503, 2 },
+	{ 0xfb6d, 7503, 2 },
+	{ 0xfb6e, 7505, 2 },
+	{ 0xfb6f, 7505, 2 },
+	{ 0xfb70, 7505, 2 },
+	{ 0xfb71, 7505, 2 },
+	{ 0xfb72, 7507, 2 },
+	{ 0xfb73, 7507, 2 },
+	{ 0xfb74, 7507, 2 },
+	{ 0xfb75, 7507, 2 },
+	{ 0xfb76, 7509, 2 },
+	{ 0xfb77, 7509, 2 },
+	{ 0xfb78, 7509, 2 },
+	{ 0xfb79, 7509, 2 },
+	{ 0xfb7a, 7511, 2 },
+	{ 0xfb7b, 7511, 2 },
+	{ 0xfb7c, 7511, 2 },
+	{ 0xfb7d, 7511, 2 },
+	{ 0xfb7e, 7513, 2 },
+	{ 0xfb7f, 7513, 2 },
+	{ 0xfb80, 7513, 2 },
+	{ 0xfb81, 7513, 2 },
+	{ 0xfb82, 7515, 2 },
+	{ 0xfb83, 7515, 2 },
+	{ 0xfb84, 7517, 2 },
+	{ 0xfb85, 7517, 2 },
+	{ 0xfb86, 7519, 2 },
+	{ 0xfb87, 7519, 2 },
+	{ 0xfb88, 7521, 2 },
+	{ 0xfb89, 7521, 2 },
+	{ 0xfb8a, 7523, 2 },
+	{ 0xfb8b, 7523, 2 },
+	{ 0xfb8c, 7525, 2 },
+	{ 0xfb8d, 7525, 2 },
+	{ 0xfb8e, 7527, 2 },
+	{ 0xfb8f, 7527, 2 },
+	{ 0xfb90, 7527, 2 },
+	{ 0xfb91, 7527, 2 },
+	{ 0xfb92, 7529, 2 },
+	{ 0xfb93, 7529, 2 },
+	{ 0xfb94, 7529, 2 },
+	{ 0xfb95, 7529, 2 },
+	{ 0xfb96, 7531, 2 },
+	{ 0xfb97, 7531, 2 },
+	{ 0xfb98, 7531, 2 },
+	{ 0xfb99, 7531, 2 },
+	{ 0xfb9a, 7533, 2 },
+	{ 0xfb9b, 7533, 2 },
+	{ 0xfb9c, 7533, 2 },
+	{ 0xfb9d, 7533, 2 },
+	{ 0xfb9e, 7535, 2 },
+	{ 0xfb9f, 7535, 2 },
+	{ 0xfba0, 7537, 2 },
+	{ 0xfba1, 7537, 2 },
+	{ 0xfba2, 7537, 2 },
+	{ 0xfba3, 7537, 2 },
+	{ 0xfba4, 7539, 2 },
+	{ 0xfba5, 7539, 2 },
+	{ 0xfba6, 7541, 2 },
+	{ 0xfba7, 7541, 2 },
+	{ 0xfba8, 7541, 2 },
+	{ 0xfba9, 7541, 2 },
+	{ 0xfbaa, 7543, 2 },
+	{ 0xfbab, 7543, 2 },
+	{ 0xfbac, 7543, 2 },
+	{ 0xfbad, 7543, 2 },
+	{ 0xfbae, 7545, 2 },
+	{ 0xfbaf, 7545, 2 },
+	{ 0xfbb0, 7547, 2 },
+	{ 0xfbb1, 7547, 2 },
+	{ 0xfbd3, 7549, 2 },
+	{ 0xfbd4, 7549, 2 },
+	{ 0xfbd5, 7549, 2 },
+	{ 0xfbd6, 7549, 2 },
+	{ 0xfbd7, 7551, 2 },
+	{ 0xfbd8, 7551, 2 },
+	{ 0xfbd9, 7553, 2 },
+	{ 0xfbda, 7553, 2 },
+	{ 0xfbdb, 7555, 2 },
+	{ 0xfbdc, 7555, 2 },
+	{ 0xfbdd, 627, 4 },
+	{ 0xfbde, 7557, 2 },
+	{ 0xfbdf, 7557, 2 },
+	{ 0xfbe0, 7559, 2 },
+	{ 0xfbe1, 7559, 2 },
+	{ 0xfbe2, 7561, 2 },
+	{ 0xfbe3, 7561, 2 },
+	{ 0xfbe4, 7563, 2 },
+	{ 0xfbe5, 7563, 2 },
+	{ 0xfbe6, 7563, 2 },
+	{ 0xfbe7, 7563, 2 },
+	{ 0xfbe8, 7565, 2 },
+	{ 0xfbe9, 7565, 2 },
+	{ 0xfbea, 7567, 4 },
+	{ 0xfbeb, 7567, 4 },
+	{ 0xfbec, 7571, 4 },
+	{ 0xfbed, 7571, 4 },
+	{ 0xfbee, 7575, 4 },
+	{ 0xfbef, 7575, 4 },
+	{ 0xfbf0, 7579, 4 },
+	{ 0xfbf1, 7579, 4 },
+	{ 0xfbf2, 7583, 4 },
+	{ 0xfbf3, 7583, 4 },
+	{ 0xfbf4, 7587, 4 },
+	{ 0xfbf5, 7587, 4 },
+	{ 0xfbf6, 7591, 4 },
+	{ 0xfbf7, 7591, 4 },
+	{ 0xfbf8, 7591, 4 },
+	{ 0xfbf9, 7595, 4 },
+	{ 0xfbfa, 7595, 4 },
+	{ 0xfbfb, 7595, 4 },
+	{ 0xfbfc, 7599, 2 },
+	{ 0xfbfd, 7599, 2 },
+	{ 0xfbfe, 7599, 2 },
+	{ 0xfbff, 7599, 2 },
+	{ 0xfc00, 7601, 4 },
+	{ 0xfc01, 7605, 4 },
+	{ 0xfc02, 7609, 4 },
+	{ 0xfc03, 7595, 4 },
+	{ 0xfc04, 7613, 4 },
+	{ 0xfc05, 7617, 4 },
+	{ 0xfc06, 7621, 4 },
+	{ 0xfc07, 7625, 4 },
+	{ 0xfc08, 7629, 4 },
+	{ 0xfc09, 7633, 4 },
+	{ 0xfc0a, 7637, 4 },
+	{ 0xfc0b, 7641, 4 },
+	{ 0xfc0c, 7645, 4 },
+	{ 0xfc0d, 7649, 4 },
+	{ 0xfc0e, 7653, 4 },
+	{ 0xfc0f, 7657, 4 },
+	{ 0xfc10, 7661, 4 },
+	{ 0xfc11, 7665, 4 },
+	{ 0xfc12, 7669, 4 },
+	{ 0xfc13, 7673, 4 },
+	{ 0xfc14, 7677, 4 },
+	{ 0xfc15, 7681, 4 },
+	{ 0xfc16, 7685, 4 },
+	{ 0xfc17, 7689, 4 },
+	{ 0xfc18, 7693, 4 },
+	{ 0xfc19, 7697, 4 },
+	{ 0xfc1a, 7701, 4 },
+	{ 0xfc1b, 7705, 4 },
+	{ 0xfc1c, 7709, 4 },
+	{ 0xfc1d, 7713, 4 },
+	{ 0xfc1e, 7717, 4 },
+	{ 0xfc1f, 7721, 4 },
+	{ 0xfc20, 7725, 4 },
+	{ 0xfc21, 7729, 4 },
+	{ 0xfc22, 7733, 4 },
+	{ 0xfc23, 7737, 4 },
+	{ 0xfc24, 7741, 4 },
+	{ 0xfc25, 7745, 4 },
+	{ 0xfc26, 7749, 4 },
+	{ 0xfc27, 7753, 4 },
+	{ 0xfc28, 7757, 4 },
+	{ 0xfc29, 7761, 4 },
+	{ 0xfc2a, 7765, 4 },
+	{ 0xfc2b, 7769, 4 },
+	{ 0xfc2c, 7773, 4 },
+	{ 0xfc2d, 7777, 4 },
+	{ 0xfc2e, 7781, 4 },
+	{ 0xfc2f, 7785, 4 },
+	{ 0xfc30, 7789, 4 },
+	{ 0xfc31, 7793, 4 },
+	{ 0xfc32, 7797, 4 },
+	{ 0xfc33, 7801, 4 },
+	{ 0xfc34, 7805, 4 },
+	{ 0xfc35, 7809, 4 },
+	{ 0xfc36, 7813, 4 },
+	{ 0xfc37, 7817, 4 },
+	{ 0xfc38, 7821, 4 },
+	{ 0xfc39, 7825, 4 },
+	{ 0xfc3a, 7829, 4 },
+	{ 0xfc3b, 7833, 4 },
+	{ 0xfc3c, 7837, 4 },
+	{ 0xfc3d, 7841, 4 },
+	{ 0xfc3e, 7845, 4 },
+	{ 0xfc3f, 7849, 4 },
+	{ 0xfc40, 7853, 4 },
+	{ 0xfc41, 7857, 4 },
+	{ 0xfc42, 7861, 4 },
+	{ 0xfc43, 7865, 4 },
+	{ 0xfc44, 7869, 4 },
+	{ 0xfc45, 7873, 4 },
+	{ 0xfc46, 7877, 4 },
+	{ 0xfc47, 7881, 4 },
+	{ 0xfc48, 7885, 4 },
+	{ 0xfc49, 7889, 4 },
+	{ 0xfc4a, 7893, 4 },
+	{ 0xfc4b, 7897, 4 },
+	{ 0xfc4c, 7901, 4 },
+	{ 0xfc4d, 7905, 4 },
+	{ 0xfc4e, 7909, 4 },
+	{ 0xfc4f, 7913, 4 },
+	{ 0xfc50, 7917, 4 },
+	{ 0xfc51, 7921, 4 },
+	{ 0xfc52, 7925, 4 },
+	{ 0xfc53, 7929, 4 },
+	{ 0xfc54, 7933, 4 },
+	{ 0xfc55, 7937, 4 },
+	{ 0xfc56, 7941, 4 },
+	{ 0xfc57, 7945, 4 },
+	{ 0xfc58, 7949, 4 },
+	{ 0xfc59, 7953, 4 },
+	{ 0xfc5a, 7957, 4 },
+	{ 0xfc5b, 7961, 4 },
+	{ 0xfc5c, 7965, 4 },
+	{ 0xfc5d, 7969, 4 },
+	{ 0xfc5e, 7973, 5 },
+	{ 0xfc5f, 7978, 5 },
+	{ 0xfc60, 7983, 5 },
+	{ 0xfc61, 7988, 5 },
+	{ 0xfc62, 7993, 5 },
+	{ 0xfc63, 7998, 5 },
+	{ 0xfc64, 8003, 4 },
+	{ 0xfc65, 8007, 4 },
+	{ 0xfc66, 7609, 4 },
+	{ 0xfc67, 8011, 4 },
+	{ 0xfc68, 7595, 4 },
+	{ 0xfc69, 7613, 4 },
+	{ 0xfc6a, 8015, 4 },
+	{ 0xfc6b, 8019, 4 },
+	{ 0xfc6c, 7629, 4 },
+	{ 0xfc6d, 8023, 4 },
+	{ 0xfc6e, 7633, 4 },
+	{ 0xfc6f, 7637, 4 },
+	{ 0xfc70, 8027, 4 },
+	{ 0xfc71, 8031, 4 },
+	{ 0xfc72, 7653, 4 },
+	{ 0xfc73, 8035, 4 },
+	{ 0xfc74, 7657, 4 },
+	{ 0xfc75, 7661, 4 },
+	{ 0xfc76, 8039, 4 },
+	{ 0xfc77, 8043, 4 },
+	{ 0xfc78, 7669, 4 },
+	{ 0xfc79, 8047, 4 },
+	{ 0xfc7a, 7673, 4 },
+	{ 0xfc7b, 7677, 4 },
+	{ 0xfc7c, 7793, 4 },
+	{ 0xfc7d, 7797, 4 },
+	{ 0xfc7e, 7809, 4 },
+	{ 0xfc7f, 7813, 4 },
+	{ 0xfc80, 7817, 4 },
+	{ 0xfc81, 7833, 4 },
+	{ 0xfc82, 7837, 4 },
+	{ 0xfc83, 7841, 4 },
+	{ 0xfc84, 7845, 4 },
+	{ 0xfc85, 7861, 4 },
+	{ 0xfc86, 7865, 4 },
+	{ 0xfc87, 7869, 4 },
+	{ 0xfc88, 8051, 4 },
+	{ 0xfc89, 7885, 4 },
+	{ 0xfc8a, 8055, 4 },
+	{ 0xfc8b, 8059, 4 },
+	{ 0xfc8c, 7909, 4 },
+	{ 0xfc8d, 8063, 4 },
+	{ 0xfc8e, 7913, 4 },
+	{ 0xfc8f, 7917, 4 },
+	{ 0xfc90, 7969, 4 },
+	{ 0xfc91, 8067, 4 },
+	{ 0xfc92, 8071, 4 },
+	{ 0xfc93, 7949, 4 },
+	{ 0xfc94, 8075, 4 },
+	{ 0xfc95, 7953, 4 },
+	{ 0xfc96, 7957, 4 },
+	{ 0xfc97, 7601, 4 },
+	{ 0xfc98, 7605, 4 },
+	{ 0xfc99, 8079, 4 },
+	{ 0xfc9a, 7609, 4 },
+	{ 0xfc9b, 8083, 4 },
+	{ 0xfc9c, 7617, 4 },
+	{ 0xfc9d, 7621, 4 },
+	{ 0xfc9e, 7625, 4 },
+	{ 0xfc9f, 7629, 4 },
+	{ 0xfca0, 8087, 4 },
+	{ 0xfca1, 7641, 4 },
+	{ 0xfca2, 7645, 4 },
+	{ 0xfca3, 7649, 4 },
+	{ 0xfca4, 7653, 4 },
+	{ 0xfca5, 8091, 4 },
+	{ 0xfca6, 7669, 4 },
+	{ 0xfca7, 7681, 4 },
+	{ 0xfca8, 7685, 4 },
+	{ 0xfca9, 7689, 4 },
+	{ 0xfcaa, 7693, 4 },
+	{ 0xfcab, 7697, 4 },
+	{ 0xfcac, 7705, 4 },
+	{ 0xfcad, 7709, 4 },
+	{ 0xfcae, 7713, 4 },
+	{ 0xfcaf, 7717, 4 },
+	{ 0xfcb0, 7721, 4 },
+	{ 0xfcb1, 7725, 4 },
+	{ 0xfcb2, 8095, 4 },
+	{ 0xfcb3, 7729, 4 },
+	{ 0xfcb4, 7733, 4 },
+	{ 0xfcb5, 7737, 4 },
+	{ 0xfcb6, 7741, 4 },
+	{ 0xfcb7, 7745, 4 },
+	{ 0xfcb8, 7749, 4 },
+	{ 0xfcb9, 7757, 4 },
+	{ 0xfcba, 7761, 4 },
+	{ 0xfcbb, 7765, 4 },
+	{ 0xfcbc, 7769, 4 },
+	{ 0xfcbd, 7773, 4 },
+	{ 0xfcbe, 7777, 4 },
+	{ 0xfcbf, 7781, 4 },
+	{ 0xfcc0, 7785, 4 },
+	{ 0xfcc1, 7789, 4 },
+	{ 0xfcc2, 7801, 4 },
+	{ 0xfcc3, 7805, 4 },
+	{ 0xfcc4, 7821, 4 },
+	{ 0xfcc5, 7825, 4 },
+	{ 0xfcc6, 7829, 4 },
+	{ 0xfcc7, 7833, 4 },
+	{ 0xfcc8, 7837, 4 },
+	{ 0xfcc9, 7849, 4 },
+	{ 0xfcca, 7853, 4 },
+	{ 0xfccb, 7857, 4 },
+	{ 0xfccc, 7861, 4 },
+	{ 0xfccd, 8099, 4 },
+	{ 0xfcce, 7873, 4 },
+	{ 0xfccf, 7877, 4 },
+	{ 0xfcd0, 7881, 4 },
+	{ 0xfcd1, 7885, 4 },
+	{ 0xfcd2, 7897, 4 },
+	{ 0xfcd3, 7901, 4 },
+	{ 0xfcd4, 7905, 4 },
+	{ 0xfcd5, 7909, 4 },
+	{ 0xfcd6, 8103, 4 },
+	{ 0xfcd7, 7921, 4 },
+	{ 0xfcd8, 7925, 4 },
+	{ 0xfcd9, 8107, 4 },
+	{ 0xfcda, 7937, 4 },
+	{ 0xfcdb, 7941, 4 },
+	{ 0xfcdc, 7945, 4 },
+	{ 0xfcdd, 7949, 4 },
+	{ 0xfcde, 8111, 4 },
+	{ 0xfcdf, 7609, 4 },
+	{ 0xfce0, 8083, 4 },
+	{ 0xfce1, 7629, 4 },
+	{ 0xfce2, 8087, 4 },
+	{ 0xfce3, 7653, 4 },
+	{ 0xfce4, 8091, 4 },
+	{ 0xfce5, 7669, 4 },
+	{ 0xfce6, 8115, 4 },
+	{ 0xfce7, 7721, 4 },
+	{ 0xfce8, 8119, 4 },
+	{ 0xfce9, 8123, 4 },
+	{ 0xfcea, 8127, 4 },
+	{ 0xfceb, 7833, 4 },
+	{ 0xfcec, 7837, 4 },
+	{ 0xfced, 7861, 4 },
+	{ 0xfcee, 7909, 4 },
+	{ 0xfcef, 8103, 4 },
+	{ 0xfcf0, 7949, 4 },
+	{ 0xfcf1, 8111, 4 },
+	{ 0xfcf2, 8131, 6 },
+	{ 0xfcf3, 8137, 6 },
+	{ 0xfcf4, 8143, 6 },
+	{ 0xfcf5, 8149, 4 },
+	{ 0xfcf6, 8153, 4 },
+	{ 0xfcf7, 8157, 4 },
+	{ 0xfcf8, 8161, 4 },
+	{ 0xfcf9, 8165, 4 },
+	{ 0xfcfa, 8169, 4 },
+	{ 0xfcfb, 8173, 4 },
+	{ 0xfcfc, 8177, 4 },
+	{ 0xfcfd, 8181, 4 },
+	{ 0xfcfe, 8185, 4 },
+	{ 0xfcff, 8189, 4 },
+	{ 0xfd00, 8193, 4 },
+	{ 0xfd01, 8197, 4 },
+	{ 0xfd02, 8201, 4 },
+	{ 0xfd03, 8205, 4 },
+	{ 0xfd04, 8209, 4 },
+	{ 0xfd05, 8213, 4 },
+	{ 0xfd06, 8217, 4 },
+	{ 0xfd07, 8221, 4 },
+	{ 0xfd08, 8225, 4 },
+	{ 0xfd09, 8229, 4 },
+	{ 0xfd0a, 8233, 4 },
+	{ 0xfd0b, 8237, 4 },
+	{ 0xfd0c, 8123, 4 },
+	{ 0xfd0d, 8241, 4 },
+	{ 0xfd0e, 8245, 4 },
+	{ 0xfd0f, 8249, 4 },
+	{ 0xfd10, 8253, 4 },
+	{ 0xfd11, 8149, 4 },
+	{ 0xfd12, 8153, 4 },
+	{ 0xfd13, 8157, 4 },
+	{ 0xfd14, 8161, 4 },
+	{ 0xfd15, 8165, 4 },
+	{ 0xfd16, 8169, 4 },
+	{ 0xfd17, 8173, 4 },
+	{ 0xfd18, 8177, 4 },
+	{ 0xfd19, 8181, 4 },
+	{ 0xfd1a, 8185, 4 },
+	{ 0xfd1b, 8189, 4 },
+	{ 0xfd1c, 8193, 4 },
+	{ 0xfd1d, 8197, 4 },
+	{ 0xfd1e, 8201, 4 },
+	{ 0xfd1f, 8205, 4 },
+	{ 0xfd20, 8209, 4 },
+	{ 0xfd21, 8213, 4 },
+	{ 0xfd22, 8217, 4 },
+	{ 0xfd23, 8221, 4 },
+	{ 0xfd24, 8225, 4 },
+	{ 0xfd25, 8229, 4 },
+	{ 0xfd26, 8233, 4 },
+	{ 0xfd27, 8237, 4 },
+	{ 0xfd28, 8123, 4 },
+	{ 0xfd29, 8241, 4 },
+	{ 0xfd2a, 8245, 4 },
+	{ 0xfd2b, 8249, 4 },
+	{ 0xfd2c, 8253, 4 },
+	{ 0xfd2d, 8229, 4 },
+	{ 0xfd2e, 8233, 4 },
+	{ 0xfd2f, 8237, 4 },
+	{ 0xfd30, 8123, 4 },
+	{ 0xfd31, 8119, 4 },
+	{ 0xfd32, 8127, 4 },
+	{ 0xfd33, 7753, 4 },
+	{ 0xfd34, 7709, 4 },
+	{ 0xfd35, 7713, 4 },
+	{ 0xfd36, 7717, 4 },
+	{ 0xfd37, 8229, 4 },
+	{ 0xfd38, 8233, 4 },
+	{ 0xfd39, 8237, 4 },
+	{ 0xfd3a, 7753, 4 },
+	{ 0xfd3b, 7757, 4 },
+	{ 0xfd3c, 8257, 4 },
+	{ 0xfd3d, 8257, 4 },
+	{ 0xfd50, 8261, 6 },
+	{ 0xfd51, 8267, 6 },
+	{ 0xfd52, 8267, 6 },
+	{ 0xfd53, 8273, 6 },
+	{ 0xfd54, 8279, 6 },
+	{ 0xfd55, 8285, 6 },
+	{ 0xfd56, 8291, 6 },
+	{ 0xfd57, 8297, 6 },
+	{ 0xfd58, 8303, 6 },
+	{ 0xfd59, 8303, 6 },
+	{ 0xfd5a, 8309, 6 },
+	{ 0xfd5b, 8315, 6 },
+	{ 0xfd5c, 8321, 6 },
+	{ 0xfd5d, 8327, 6 },
+	{ 0xfd5e, 8333, 6 },
+	{ 0xfd5f, 8339, 6 },
+	{ 0xfd60, 8339, 6 },
+	{ 0xfd61, 8345, 6 },
+	{ 0xfd62, 8351, 6 },
+	{ 0xfd63, 8351, 6 },
+	{ 0xfd64, 8357, 6 },
+	{ 0xfd65, 8357, 6 },
+	{ 0xfd66, 8363, 6 },
+	{ 0xfd67, 8369, 6 },
+	{ 0xfd68, 8369, 6 },
+	{ 0xfd69, 8375, 6 },
+	{ 0xfd6a, 8381, 6 },
+	{ 0xfd6b, 8381, 6 },
+	{ 0xfd6c, 8387, 6 },
+	{ 0xfd6d, 8387, 6 },
+	{ 0xfd6e, 8393, 6 },
+	{ 0xfd6f, 8399, 6 },
+	{ 0xfd70, 8399, 6 },
+	{ 0xfd71, 8405, 6 },
+	{ 0xfd72, 8405, 6 },
+	{ 0xfd73, 8411, 6 },
+	{ 0xfd74, 8417, 6 },
+	{ 0xfd75, 8423, 6 },
+	{ 0xfd76, 8429, 6 },
+	{ 0xfd77, 8429, 6 },
+	{ 0xfd78, 8435, 6 },
+	{ 0xfd79, 8441, 6 },
+	{ 0xfd7a, 8447, 6 },
+	{ 0xfd7b, 8453, 6 },
+	{ 0xfd7c, 8459, 6 },
+	{ 0xfd7d, 8459, 6 },
+	{ 0xfd7e, 8465, 6 },
+	{ 0xfd7f, 8471, 6 },
+	{ 0xfd80, 8477, 6 },
+	{ 0xfd81, 8483, 6 },
+	{ 0xfd82, 8489, 6 },
+	{ 0xfd83, 8495, 6 },
+	{ 0xfd84, 8495, 6 },
+	{ 0xfd85, 8501, 6 },
+	{ 0xfd86, 8501, 6 },
+	{ 0xfd87, 8507, 6 },
+	{ 0xfd88, 8507, 6 },
+	{ 0xfd89, 8513, 6 },
+	{ 0xfd8a, 8519, 6 },
+	{ 0xfd8b, 8525, 6 },
+	{ 0xfd8c, 8531, 6 },
+	{ 0xfd8d, 8537, 6 },
+	{ 0xfd8e, 8543, 6 },
+	{ 0xfd8f, 8549, 6 },
+	{ 0xfd92, 8555, 6 },
+	{ 0xfd93, 8561, 6 },
+	{ 0xfd94, 8567, 6 },
+	{ 0xfd95, 8573, 6 },
+	{ 0xfd96, 8579, 6 },
+	{ 0xfd97, 8585, 6 },
+	{ 0xfd98, 8585, 6 },
+	{ 0xfd99, 8591, 6 },
+	{ 0xfd9a, 8597, 6 },
+	{ 0xfd9b, 8603, 6 },
+	{ 0xfd9c, 8609, 6 },
+	{ 0xfd9d, 8609, 6 },
+	{ 0xfd9e, 8615, 6 },
+	{ 0xfd9f, 8621, 6 },
+	{ 0xfda0, 8627, 6 },
+	{ 0xfda1, 8633, 6 },
+	{ 0xfda2, 8639, 6 },
+	{ 0xfda3, 8645, 6 },
+	{ 0xfda4, 8651, 6 },
+	{ 0xfda5, 8657, 6 },
+	{ 0xfda6, 8663, 6 },
+	{ 0xfda7, 8669, 6 },
+	{ 0xfda8, 8675, 6 },
+	{ 0xfda9, 8681, 6 },
+	{ 0xfdaa, 8687, 6 },
+	{ 0xfdab, 8693, 6 },
+	{ 0xfdac, 8699, 6 },
+	{ 0xfdad, 8705, 6 },
+	{ 0xfdae, 8711, 6 },
+	{ 0xfdaf, 8717, 6 },
+	{ 0xfdb0, 8723, 6 },
+	{ 0xfdb1, 8729, 6 },
+	{ 0xfdb2, 8735, 6 },
+	{ 0xfdb3, 8741, 6 },
+	{ 0xfdb4, 8465, 6 },
+	{ 0xfdb5, 8477, 6 },
+	{ 0xfdb6, 8747, 6 },
+	{ 0xfdb7, 8753, 6 },
+	{ 0xfdb8, 8759, 6 },
+	{ 0xfdb9, 8765, 6 },
+	{ 0xfdba, 8771, 6 },
+	{ 0xfdbb, 8777, 6 },
+	{ 0xfdbc, 8771, 6 },
+	{ 0xfdbd, 8759, 6 },
+	{ 0xfdbe, 8783, 6 },
+	{ 0xfdbf, 8789, 6 },
+	{ 0xfdc0, 8795, 6 },
+	{ 0xfdc1, 8801, 6 },
+	{ 0xfdc2, 8807, 6 },
+	{ 0xfdc3, 8777, 6 },
+	{ 0xfdc4, 8423, 6 },
+	{ 0xfdc5, 8363, 6 },
+	{ 0xfdc6, 8813, 6 },
+	{ 0xfdc7, 8819, 6 },
+	{ 0xfdf0, 8825, 6 },
+	{ 0xfdf1, 8831, 6 },
+	{ 0xfdf2, 8837, 8 },
+	{ 0xfdf3, 8845, 8 },
+	{ 0xfdf4, 8853, 8 },
+	{ 0xfdf5, 8861, 8 },
+	{ 0xfdf6, 8869, 8 },
+	{ 0xfdf7, 8877, 8 },
+	{ 0xfdf8, 8885, 8 },
+	{ 0xfdf9, 8893, 6 },
+	{ 0xfdfa, 8899, 33 },
+	{ 0xfdfb, 8932, 15 },
+	{ 0xfdfc, 8947, 8 },
+	{ 0xfe10, 8955, 1 },
+	{ 0xfe11, 8956, 3 },
+	{ 0xfe12, 8959, 3 },
+	{ 0xfe13, 8962, 1 },
+	{ 0xfe14, 210, 1 },
+	{ 0xfe15, 8963, 1 },
+	{ 0xfe16, 8964, 1 },
+	{ 0xfe17, 8965, 3 },
+	{ 0xfe18, 8968, 3 },
+	{ 0xfe19, 1277, 3 },
+	{ 0xfe30, 1275, 2 },
+	{ 0xfe31, 8971, 3 },
+	{ 0xfe32, 8974, 3 },
+	{ 0xfe33, 8977, 1 },
+	{ 0xfe34, 8977, 1 },
+	{ 0xfe35, 1342, 1 },
+	{ 0xfe36, 1343, 1 },
+	{ 0xfe37, 8978, 1 },
+	{ 0xfe38, 8979, 1 },
+	{ 0xfe39, 8980, 3 },
+	{ 0xfe3a, 8983, 3 },
+	{ 0xfe3b, 8986, 3 },
+	{ 0xfe3c, 8989, 3 },
+	{ 0xfe3d, 8992, 3 },
+	{ 0xfe3e, 8995, 3 },
+	{ 0xfe3f, 1657, 3 },
+	{ 0xfe40, 1660, 3 },
+	{ 0xfe41, 8998, 3 },
+	{ 0xfe42, 9001, 3 },
+	{ 0xfe43, 9004, 3 },
+	{ 0xfe44, 9007, 3 },
+	{ 0xfe47, 9010, 1 },
+	{ 0xfe48, 9011, 1 },
+	{ 0xfe49, 0, 1 },
+	{ 0xfe4a, 0, 1 },
+	{ 0xfe4b, 0, 1 },
+	{ 0xfe4c, 0, 1 },
+	{ 0xfe4d, 8977, 1 },
+	{ 0xfe4e, 8977, 1 },
+	{ 0xfe4f, 8977, 1 },
+	{ 0xfe50, 8955, 1 },
+	{ 0xfe51, 8956, 3 },
+	{ 0xfe52, 1274, 1 },
+	{ 0xfe54, 210, 1 },
+	{ 0xfe55, 8962, 1 },
+	{ 0xfe56, 8964, 1 },
+	{ 0xfe57, 8963, 1 },
+	{ 0xfe58, 8971, 3 },
+	{ 0xfe59, 1342, 1 },
+	{ 0xfe5a, 1343, 1 },
+	{ 0xfe5b, 8978, 1 },
+	{ 0xfe5c, 8979, 1 },
+	{ 0xfe5d, 8980, 3 },
+	{ 0xfe5e, 8983, 3 },
+	{ 0xfe5f, 9012, 1 },
+	{ 0xfe60, 9013, 1 },
+	{ 0xfe61, 9014, 1 },
+	{ 0xfe62, 1337, 1 },
+	{ 0xfe63, 9015, 1 },
+	{ 0xfe64, 1583, 1 },
+	{ 0xfe65, 1584, 1 },
+	{ 0xfe66, 1341, 1 },
+	{ 0xfe68, 9016, 1 },
+	{ 0xfe69, 9017, 1 },
+	{ 0xfe6a, 9018, 1 },
+	{ 0xfe6b, 9019, 1 },
+	{ 0xfe70, 9020, 3 },
+	{ 0xfe71, 9023, 4 },
+	{ 0xfe72, 9027, 3 },
+	{ 0xfe74, 9030, 3 },
+	{ 0xfe76, 9033, 3 },
+	{ 0xfe77, 9036, 4 },
+	{ 0xfe78, 9040, 3 },
+	{ 0xfe79, 9043, 4 },
+	{ 0xfe7a, 9047, 3 },
+	{ 0xfe7b, 9050, 4 },
+	{ 0xfe7c, 9054, 3 },
+	{ 0xfe7d, 9057, 4 },
+	{ 0xfe7e, 9061, 3 },
+	{ 0xfe7f, 9064, 4 },
+	{ 0xfe80, 9068, 2 },
+	{ 0xfe81, 9070, 2 },
+	{ 0xfe82, 9070, 2 },
+	{ 0xfe83, 9072, 2 },
+	{ 0xfe84, 9072, 2 },
+	{ 0xfe85, 9074, 2 },
+	{ 0xfe86, 9074, 2 },
+	{ 0xfe87, 9076, 2 },
+	{ 0xfe88, 9076, 2 },
+	{ 0xfe89, 9078, 2 },
+	{ 0xfe8a, 9078, 2 },
+	{ 0xfe8b, 9078, 2 },
+	{ 0xfe8c, 9078, 2 },
+	{ 0xfe8d, 9080, 2 },
+	{ 0xfe8e, 9080, 2 },
+	{ 0xfe8f, 9082, 2 },
+	{ 0xfe90, 9082, 2 },
+	{ 0xfe91, 9082, 2 },
+	{ 0xfe92, 9082, 2 },
+	{ 0xfe93, 9084, 2 },
+	{ 0xfe94, 9084, 2 },
+	{ 0xfe95, 9086, 2 },
+	{ 0xfe96, 9086, 2 },
+	{ 0xfe97, 9086, 2 },
+	{ 0xfe98, 9086, 2 },
+	{ 0xfe99, 9088, 2 },
+	{ 0xfe9a, 9088, 2 },
+	{ 0xfe9b, 9088, 2 },
+	{ 0xfe9c, 9088, 2 },
+	{ 0xfe9d, 9090, 2 },
+	{ 0xfe9e, 9090, 2 },
+	{ 0xfe9f, 9090, 2 },
+	{ 0xfea0, 9090, 2 },
+	{ 0xfea1, 9092, 2 },
+	{ 0xfea2, 9092, 2 },
+	{ 0xfea3, 9092, 2 },
+	{ 0xfea4, 9092, 2 },
+	{ 0xfea5, 9094, 2 },
+	{ 0xfea6, 9094, 2 },
+	{ 0xfea7, 9094, 2 },
+	{ 0xfea8, 9094, 2 },
+	{ 0xfea9, 9096, 2 },
+	{ 0xfeaa, 9096, 2 },
+	{ 0xfeab, 9098, 2 },
+	{ 0xfeac, 9098, 2 },
+	{ 0xfead, 9100, 2 },
+	{ 0xfeae, 9100, 2 },
+	{ 0xfeaf, 9102, 2 },
+	{ 0xfeb0, 9102, 2 },
+	{ 0xfeb1, 9104, 2 },
+	{ 0xfeb2, 9104, 2 },
+	{ 0xfeb3, 9104, 2 },
+	{ 0xfeb4, 9104, 2 },
+	{ 0xfeb5, 9106, 2 },
+	{ 0xfeb6, 9106, 2 },
+	{ 0xfeb7, 9106, 2 },
+	{ 0xfeb8, 9106, 2 },
+	{ 0xfeb9, 9108, 2 },
+	{ 0xfeba, 9108, 2 },
+	{ 0xfebb, 9108, 2 },
+	{ 0xfebc, 9108, 2 },
+	{ 0xfebd, 9110, 2 },
+	{ 0xfebe, 9110, 2 },
+	{ 0xfebf, 9110, 2 },
+	{ 0xfec0, 9110, 2 },
+	{ 0xfec1, 9112, 2 },
+	{ 0xfec2, 9112, 2 },
+	{ 0xfec3, 9112, 2 },
+	{ 0xfec4, 9112, 2 },
+	{ 0xfec5, 9114, 2 },
+	{ 0xfec6, 9114, 2 },
+	{ 0xfec7, 9114, 2 },
+	{ 0xfec8, 9114, 2 },
+	{ 0xfec9, 9116, 2 },
+	{ 0xfeca, 9116, 2 },
+	{ 0xfecb, 9116, 2 },
+	{ 0xfecc, 9116, 2 },
+	{ 0xfecd, 9118, 2 },
+	{ 0xfece, 9118, 2 },
+	{ 0xfecf, 9118, 2 },
+	{ 0xfed0, 9118, 2 },
+	{ 0xfed1, 9120, 2 },
+	{ 0xfed2, 9120, 2 },
+	{ 0xfed3, 9120, 2 },
+	{ 0xfed4, 9120, 2 },
+	{ 0xfed5, 9122, 2 },
+	{ 0xfed6, 9122, 2 },
+	{ 0xfed7, 9122, 2 },
+	{ 0xfed8, 9122, 2 },
+	{ 0xfed9, 9124, 2 },
+	{ 0xfeda, 9124, 2 },
+	{ 0xfedb, 9124, 2 },
+	{ 0xfedc, 9124, 2 },
+	{ 0xfedd, 9126, 2 },
+	{ 0xfede, 9126, 2 },
+	{ 0xfedf, 9126, 2 },
+	{ 0xfee0, 9126, 2 },
+	{ 0xfee1, 9128, 2 },
+	{ 0xfee2, 9128, 2 },
+	{ 0xfee3, 9128, 2 },
+	{ 0xfee4, 9128, 2 },
+	{ 0xfee5, 9130, 2 },
+	{ 0xfee6, 9130, 2 },
+	{ 0xfee7, 9130, 2 },
+	{ 0xfee8, 9130, 2 },
+	{ 0xfee9, 9132, 2 },
+	{ 0xfeea, 9132, 2 },
+	{ 0xfeeb, 9132, 2 },
+	{ 0xfeec, 9132, 2 },
+	{ 0xfeed, 9134, 2 },
+	{ 0xfeee, 9134, 2 },
+	{ 0xfeef, 7565, 2 },
+	{ 0xfef0, 7565, 2 },
+	{ 0xfef1, 9136, 2 },
+	{ 0xfef2, 9136, 2 },
+	{ 0xfef3, 9136, 2 },
+	{ 0xfef4, 9136, 2 },
+	{ 0xfef5, 9138, 4 },
+	{ 0xfef6, 9138, 4 },
+	{ 0xfef7, 9142, 4 },
+	{ 0xfef8, 9142, 4 },
+	{ 0xfef9, 9146, 4 },
+	{ 0xfefa, 9146, 4 },
+	{ 0xfefb, 9150, 4 },
+	{ 0xfefc, 9150, 4 },
+	{ 0xff01, 8963, 1 },
+	{ 0xff02, 9154, 1 },
+	{ 0xff03, 9012, 1 },
+	{ 0xff04, 9017, 1 },
+	{ 0xff05, 9018, 1 },
+	{ 0xff06, 9013, 1 },
+	{ 0xff07, 9155, 1 },
+	{ 0xff08, 1342, 1 },
+	{ 0xff09, 1343, 1 },
+	{ 0xff0a, 9014, 1 },
+	{ 0xff0b, 1337, 1 },
+	{ 0xff0c, 8955, 1 },
+	{ 0xff0d, 9015, 1 },
+	{ 0xff0e, 1274, 1 },
+	{ 0xff0f, 9156, 1 },
+	{ 0xff10, 1330, 1 },
+	{ 0xff11, 6, 1 },
+	{ 0xff12, 2, 1 },
+	{ 0xff13, 3, 1 },
+	{ 0xff14, 1331, 1 },
+	{ 0xff15, 1332, 1 },
+	{ 0xff16, 1333, 1 },
+	{ 0xff17, 1334, 1 },
+	{ 0xff18, 1335, 1 },
+	{ 0xff19, 1336, 1 },
+	{ 0xff1a, 8962, 1 },
+	{ 0xff1b, 210, 1 },
+	{ 0xff1c, 1583, 1 },
+	{ 0xff1d, 1341, 1 },
+	{ 0xff1e, 1584, 1 },
+	{ 0xff1f, 8964, 1 },
+	{ 0xff20, 9019, 1 },
+	{ 0xff21, 1, 1 },
+	{ 0xff22, 1175, 1 },
+	{ 0xff23, 25, 1 },
+	{ 0xff24, 39, 1 },
+	{ 0xff25, 26, 1 },
+	{ 0xff26, 1204, 1 },
+	{ 0xff27, 42, 1 },
+	{ 0xff28, 43, 1 },
+	{ 0xff29, 27, 1 },
+	{ 0xff2a, 48, 1 },
+	{ 0xff2b, 49, 1 },
+	{ 0xff2c, 50, 1 },
+	{ 0xff2d, 1176, 1 },
+	{ 0xff2e, 30, 1 },
+	{ 0xff2f, 7, 1 },
+	{ 0xff30, 1177, 1 },
+	{ 0xff31, 1366, 1 },
+	{ 0xff32, 63, 1 },
+	{ 0xff33, 64, 1 },
+	{ 0xff34, 65, 1 },
+	{ 0xff35, 33, 1 },
+	{ 0xff36, 1196, 1 },
+	{ 0xff37, 68, 1 },
+	{ 0xff38, 194, 1 },
+	{ 0xff39, 34, 1 },
+	{ 0xff3a, 69, 1 },
+	{ 0xff3b, 9010, 1 },
+	{ 0xff3c, 9016, 1 },
+	{ 0xff3d, 9011, 1 },
+	{ 0xff3e, 9157, 1 },
+	{ 0xff3f, 8977, 1 },
+	{ 0xff40, 1270, 1 },
+	{ 0xff41, 1, 1 },
+	{ 0xff42, 1175, 1 },
+	{ 0xff43, 25, 1 },
+	{ 0xff44, 39, 1 },
+	{ 0xff45, 26, 1 },
+	{ 0xff46, 1204, 1 },
+	{ 0xff47, 42, 1 },
+	{ 0xff48, 43, 1 },
+	{ 0xff49, 27, 1 },
+	{ 0xff4a, 48, 1 },
+	{ 0xff4b, 49, 1 },
+	{ 0xff4c, 50, 1 },
+	{ 0xff4d, 1176, 1 },
+	{ 0xff4e, 30, 1 },
+	{ 0xff4f, 7, 1 },
+	{ 0xff50, 1177, 1 },
+	{ 0xff51, 1366, 1 },
+	{ 0xff52, 63, 1 },
+	{ 0xff53, 64, 1 },
+	{ 0xff54, 65, 1 },
+	{ 0xff55, 33, 1 },
+	{ 0xff56, 1196, 1 },
+	{ 0xff57, 68, 1 },
+	{ 0xff58, 194, 1 },
+	{ 0xff59, 34, 1 },
+	{ 0xff5a, 69, 1 },
+	{ 0xff5b, 8978, 1 },
+	{ 0xff5c, 9158, 1 },
+	{ 0xff5d, 8979, 1 },
+	{ 0xff5e, 9159, 1 },
+	{ 0xff5f, 9160, 3 },
+	{ 0xff60, 9163, 3 },
+	{ 0xff61, 8959, 3 },
+	{ 0xff62, 8998, 3 },
+	{ 0xff63, 9001, 3 },
+	{ 0xff64, 8956, 3 },
+	{ 0xff65, 9166, 3 },
+	{ 0xff66, 3997, 3 },
+	{ 0xff67, 9169, 3 },
+	{ 0xff68, 9172, 3 },
+	{ 0xff69, 9175, 3 },
+	{ 0xff6a, 9178, 3 },
+	{ 0xff6b, 9181, 3 },
+	{ 0xff6c, 9184, 3 },
+	{ 0xff6d, 9187, 3 },
+	{ 0xff6e, 9190, 3 },
+	{ 0xff6f, 9193, 3 },
+	{ 0xff70, 9196, 3 },
+	{ 0xff71, 3859, 3 },
+	{ 0xff72, 3862, 3 },
+	{ 0xff73, 3865, 3 },
+	{ 0xff74, 3868, 3 },
+	{ 0xff75, 3871, 3 },
+	{ 0xff76, 3874, 3 },
+	{ 0xff77, 3877, 3 },
+	{ 0xff78, 3880, 3 },
+	{ 0xff79, 3883, 3 },
+	{ 0xff7a, 3886, 3 },
+	{ 0xff7b, 3889, 3 },
+	{ 0xff7c, 3892, 3 },
+	{ 0xff7d, 3895, 3 },
+	{ 0xff7e, 3898, 3 },
+	{ 0xff7f, 3901, 3 },
+	{ 0xff80, 3904, 3 },
+	{ 0xff81, 3907, 3 },
+	{ 0xff82, 3910, 3 },
+	{ 0xff83, 3913, 3 },
+	{ 0xff84, 3916, 3 },
+	{ 0xff85, 3919, 3 },
+	{ 0xff86, 3922, 3 },
+	{ 0xff87, 3925, 3 },
+	{ 0xff88, 3928, 3 },
+	{ 0xff89, 3931, 3 },
+	{ 0xff8a, 3934, 3 },
+	{ 0xff8b, 3937, 3 },
+	{ 0xff8c, 3940, 3 },
+	{ 0xff8d, 3943, 3 },
+	{ 0xff8e, 3946, 3 },
+	{ 0xff8f, 3949, 3 },
+	{ 0xff90, 3952, 3 },
+	{ 0xff91, 3955, 3 },
+	{ 0xff92, 3958, 3 },
+	{ 0xff93, 3961, 3 },
+	{ 0xff94, 3964, 3 },
+	{ 0xff95, 3967, 3 },
+	{ 0xff96, 3970, 3 },
+	{ 0xff97, 3973, 3 },
+	{ 0xff98, 3976, 3 },
+	{ 0xff99, 3979, 3 },
+	{ 0xff9a, 3982, 3 },
+	{ 0xff9b, 3985, 3 },
+	{ 0xff9c, 3988, 3 },
+	{ 0xff9d, 9199, 3 },
+	{ 0xff9e, 9202, 3 },
+	{ 0xff9f, 9205, 3 },
+	{ 0xffa0, 3073, 3 },
+	{ 0xffa1, 2920, 3 },
+	{ 0xffa2, 2923, 3 },
+	{ 0xffa3, 2926, 3 },
+	{ 0xffa4, 2929, 3 },
+	{ 0xffa5, 2932, 3 },
+	{ 0xffa6, 2935, 3 },
+	{ 0xffa7, 2938, 3 },
+	{ 0xffa8, 2941, 3 },
+	{ 0xffa9, 2944, 3 },
+	{ 0xffaa, 2947, 3 },
+	{ 0xffab, 2950, 3 },
+	{ 0xffac, 2953, 3 },
+	{ 0xffad, 2956, 3 },
+	{ 0xffae, 2959, 3 },
+	{ 0xffaf, 2962, 3 },
+	{ 0xffb0, 2965, 3 },
+	{ 0xffb1, 2968, 3 },
+	{ 0xffb2, 2971, 3 },
+	{ 0xffb3, 2974, 3 },
+	{ 0xffb4, 2977, 3 },
+	{ 0xffb5, 2980, 3 },
+	{ 0xffb6, 2983, 3 },
+	{ 0xffb7, 2986, 3 },
+	{ 0xffb8, 2989, 3 },
+	{ 0xffb9, 2992, 3 },
+	{ 0xffba, 2995, 3 },
+	{ 0xffbb, 2998, 3 },
+	{ 0xffbc, 3001, 3 },
+	{ 0xffbd, 3004, 3 },
+	{ 0xffbe, 3007, 3 },
+	{ 0xffc2, 3010, 3 },
+	{ 0xffc3, 3013, 3 },
+	{ 0xffc4, 3016, 3 },
+	{ 0xffc5, 3019, 3 },
+	{ 0xffc6, 3022, 3 },
+	{ 0xffc7, 3025, 3 },
+	{ 0xffca, 3028, 3 },
+	{ 0xffcb, 3031, 3 },
+	{ 0xffcc, 3034, 3 },
+	{ 0xffcd, 3037, 3 },
+	{ 0xffce, 3040, 3 },
+	{ 0xffcf, 3043, 3 },
+	{ 0xffd2, 3046, 3 },
+	{ 0xffd3, 3049, 3 },
+	{ 0xffd4, 3052, 3 },
+	{ 0xffd5, 3055, 3 },
+	{ 0xffd6, 3058, 3 },
+	{ 0xffd7, 3061, 3 },
+	{ 0xffda, 3064, 3 },
+	{ 0xffdb, 3067, 3 },
+	{ 0xffdc, 3070, 3 },
+	{ 0xffe0, 9208, 2 },
+	{ 0xffe1, 9210, 2 },
+	{ 0xffe2, 9212, 2 },
+	{ 0xffe3, 0, 1 },
+	{ 0xffe4, 9214, 2 },
+	{ 0xffe5, 9216, 2 },
+	{ 0xffe6, 9218, 3 },
+	{ 0xffe8, 9221, 3 },
+	{ 0xffe9, 1502, 3 },
+	{ 0xffea, 9224, 3 },
+	{ 0xffeb, 1505, 3 },
+	{ 0xffec, 9227, 3 },
+	{ 0xffed, 9230, 3 },
+	{ 0xffee, 9233, 3 },
+	{ 0x10400, 9236, 4 },
+	{ 0x10401, 9240, 4 },
+	{ 0x10402, 9244, 4 },
+	{ 0x10403, 9248, 4 },
+	{ 0x10404, 9252, 4 },
+	{ 0x10405, 9256, 4 },
+	{ 0x10406, 9260, 4 },
+	{ 0x10407, 9264, 4 },
+	{ 0x10408, 9268, 4 },
+	{ 0x10409, 9272, 4 },
+	{ 0x1040a, 9276, 4 },
+	{ 0x1040b, 9280, 4 },
+	{ 0x1040c, 9284, 4 },
+	{ 0x1040d, 9288, 4 },
+	{ 0x1040e, 9292, 4 },
+	{ 0x1040f, 9296, 4 },
+	{ 0x10410, 9300, 4 },
+	{ 0x10411, 9304, 4 },
+	{ 0x10412, 9308, 4 },
+	{ 0x10413, 9312, 4 },
+	{ 0x10414, 9316, 4 },
+	{ 0x10415, 9320, 4 },
+	{ 0x10416, 9324, 4 },
+	{ 0x10417, 9328, 4 },
+	{ 0x10418, 9332, 4 },
+	{ 0x10419, 9336, 4 },
+	{ 0x1041a, 9340, 4 },
+	{ 0x1041b, 9344, 4 },
+	{ 0x1041c, 9348, 4 },
+	{ 0x1041d, 9352, 4 },
+	{ 0x1041e, 9356, 4 },
+	{ 0x1041f, 9360, 4 },
+	{ 0x10420, 9364, 4 },
+	{ 0x10421, 9368, 4 },
+	{ 0x10422, 9372, 4 },
+	{ 0x10423, 9376, 4 },
+	{ 0x10424, 9380, 4 },
+	{ 0x10425, 9384, 4 },
+	{ 0x10426, 9388, 4 },
+	{ 0x10427, 9392, 4 },
+	{ 0x104b0, 9396, 4 },
+	{ 0x104b1, 9400, 4 },
+	{ 0x104b2, 9404, 4 },
+	{ 0x104b3, 9408, 4 },
+	{ 0x104b4, 9412, 4 },
+	{ 0x104b5, 9416, 4 },
+	{ 0x104b6, 9420, 4 },
+	{ 0x104b7, 9424, 4 },
+	{ 0x104b8, 9428, 4 },
+	{ 0x104b9, 9432, 4 },
+	{ 0x104ba, 9436, 4 },
+	{ 0x104bb, 9440, 4 },
+	{ 0x104bc, 9444, 4 },
+	{ 0x104bd, 9448, 4 },
+	{ 0x104be, 9452, 4 },
+	{ 0x104bf, 9456, 4 },
+	{ 0x104c0, 9460, 4 },
+	{ 0x104c1, 9464, 4 },
+	{ 0x104c2, 9468, 4 },
+	{ 0x104c3, 9472, 4 },
+	{ 0x104c4, 9476, 4 },
+	{ 0x104c5, 9480, 4 },
+	{ 0x104c6, 9484, 4 },
+	{ 0x104c7, 9488, 4 },
+	{ 0x104c8, 9492, 4 },
+	{ 0x104c9, 9496, 4 },
+	{ 0x104ca, 9500, 4 },
+	{ 0x104cb, 9504, 4 },
+	{ 0x104cc, 9508, 4 },
+	{ 0x104cd, 9512, 4 },
+	{ 0x104ce, 9516, 4 },
+	{ 0x104cf, 9520, 4 },
+	{ 0x104d0, 9524, 4 },
+	{ 0x104d1, 9528, 4 },
+	{ 0x104d2, 9532, 4 },
+	{ 0x104d3, 9536, 4 },
+	{ 0x10570, 9540, 4 },
+	{ 0x10571, 9544, 4 },
+	{ 0x10572, 9548, 4 },
+	{ 0x10573, 9552, 4 },
+	{ 0x10574, 9556, 4 },
+	{ 0x10575, 9560, 4 },
+	{ 0x10576, 9564, 4 },
+	{ 0x10577, 9568, 4 },
+	{ 0x10578, 9572, 4 },
+	{ 0x10579, 9576, 4 },
+	{ 0x1057a, 9580, 4 },
+	{ 0x1057c, 9584, 4 },
+	{ 0x1057d, 9588, 4 },
+	{ 0x1057e, 9592, 4 },
+	{ 0x1057f, 9596, 4 },
+	{ 0x10580, 9600, 4 },
+	{ 0x10581, 9604, 4 },
+	{ 0x10582, 9608, 4 },
+	{ 0x10583, 9612, 4 },
+	{ 0x10584, 9616, 4 },
+	{ 0x10585, 9620, 4 },
+	{ 0x10586, 9624, 4 },
+	{ 0x10587, 9628, 4 },
+	{ 0x10588, 9632, 4 },
+	{ 0x10589, 9636, 4 },
+	{ 0x1058a, 9640, 4 },
+	{ 0x1058c, 9644, 4 },
+	{ 0x1058d, 9648, 4 },
+	{ 0x1058e, 9652, 4 },
+	{ 0x1058f, 9656, 4 },
+	{ 0x10590, 9660, 4 },
+	{ 0x10591, 9664, 4 },
+	{ 0x10592, 9668, 4 },
+	{ 0x10594, 9672, 4 },
+	{ 0x10595, 9676, 4 },
+	{ 0x10781, 9680, 2 },
+	{ 0x10782, 9682, 2 },
+	{ 0x10783, 23, 2 },
+	{ 0x10784, 9684, 2 },
+	{ 0x10785, 70, 2 },
+	{ 0x10787, 9686, 2 },
+	{ 0x10788, 9688, 3 },
+	{ 0x10789, 9691, 2 },
+	{ 0x1078a, 9693, 2 },
+	{ 0x1078b, 80, 2 },
+	{ 0x1078c, 82, 2 },
+	{ 0x1078d, 9695, 3 },
+	{ 0x1078e, 9698, 2 },
+	{ 0x1078f, 9700, 2 },
+	{ 0x10790, 9702, 2 },
+	{ 0x10791, 9704, 2 },
+	{ 0x10792, 9706, 2 },
+	{ 0x10793, 94, 2 },
+	{ 0x10794, 9708, 2 },
+	{ 0x10795, 44, 2 },
+	{ 0x10796, 9710, 2 },
+	{ 0x10797, 9712, 2 },
+	{ 0x10798, 9714, 2 },
+	{ 0x10799, 9716, 2 },
+	{ 0x1079a, 9718, 2 },
+	{ 0x1079b, 5767, 2 },
+	{ 0x1079c, 9720, 4 },
+	{ 0x1079d, 9724, 3 },
+	{ 0x1079e, 9727, 2 },
+	{ 0x1079f, 9729, 4 },
+	{ 0x107a0, 9733, 2 },
+	{ 0x107a1, 9735, 4 },
+	{ 0x107a2, 31, 2 },
+	{ 0x107a3, 9739, 2 },
+	{ 0x107a4, 9741, 2 },
+	{ 0x107a5, 1366, 1 },
+	{ 0x107a6, 9743, 2 },
+	{ 0x107a7, 9745, 4 },
+	{ 0x107a8, 2060, 2 },
+	{ 0x107a9, 9749, 2 },
+	{ 0x107aa, 114, 2 },
+	{ 0x107ab, 9751, 2 },
+	{ 0x107ac, 9753, 2 },
+	{ 0x107ad, 9755, 3 },
+	{ 0x107ae, 9758, 2 },
+	{ 0x107af, 122, 2 },
+	{ 0x107b0, 9760, 3 },
+	{ 0x107b2, 9763, 2 },
+	{ 0x107b3, 9765, 2 },
+	{ 0x107b4, 9767, 2 },
+	{ 0x107b5, 9769, 2 },
+	{ 0x107b6, 9771, 2 },
+	{ 0x107b7, 9773, 2 },
+	{ 0x107b8, 9775, 2 },
+	{ 0x107b9, 9777, 4 },
+	{ 0x107ba, 9781, 4 },
+	{ 0x10c80, 9785, 4 },
+	{ 0x10c81, 9789, 4 },
+	{ 0x10c82, 9793, 4 },
+	{ 0x10c83, 9797, 4 },
+	{ 0x10c84, 9801, 4 },
+	{ 0x10c85, 9805, 4 },
+	{ 0x10c86, 9809, 4 },
+	{ 0x10c87, 9813, 4 },
+	{ 0x10c88, 9817, 4 },
+	{ 0x10c89, 9821, 4 },
+	{ 0x10c8a, 9825, 4 },
+	{ 0x10c8b, 9829, 4 },
+	{ 0x10c8c, 9833, 4 },
+	{ 0x10c8d, 9837, 4 },
+	{ 0x10c8e, 9841, 4 },
+	{ 0x10c8f, 9845, 4 },
+	{ 0x10c90, 9849, 4 },
+	{ 0x10c91, 9853, 4 },
+	{ 0x10c92, 9857, 4 },
+	{ 0x10c93, 9861, 4 },
+	{ 0x10c94, 9865, 4 },
+	{ 0x10c95, 9869, 4 },
+	{ 0x10c96, 9873, 4 },
+	{ 0x10c97, 9877, 4 },
+	{ 0x10c98, 9881, 4 },
+	{ 0x10c99, 9885, 4 },
+	{ 0x10c9a, 9889, 4 },
+	{ 0x10c9b, 9893, 4 },
+	{ 0x10c9c, 9897, 4 },
+	{ 0x10c9d, 9901, 4 },
+	{ 0x10c9e, 9905, 4 },
+	{ 0x10c9f, 9909, 4 },
+	{ 0x10ca0, 9913, 4 },
+	{ 0x10ca1, 9917, 4 },
+	{ 0x10ca2, 9921, 4 },
+	{ 0x10ca3, 9925, 4 },
+	{ 0x10ca4, 9929, 4 },
+	{ 0x10ca5, 9933, 4 },
+	{ 0x10ca6, 9937, 4 },
+	{ 0x10ca7, 9941, 4 },
+	{ 0x10ca8, 9945, 4 },
+	{ 0x10ca9, 9949, 4 },
+	{ 0x10caa, 9953, 4 },
+	{ 0x10cab, 9957, 4 },
+	{ 0x10cac, 9961, 4 },
+	{ 0x10cad, 9965, 4 },
+	{ 0x10cae, 9969, 4 },
+	{ 0x10caf, 9973, 4 },
+	{ 0x10cb0, 9977, 4 },
+	{ 0x10cb1, 9981, 4 },
+	{ 0x10cb2, 9985, 4 },
+	{ 0x118a0, 9989, 4 },
+	{ 0x118a1, 9993, 4 },
+	{ 0x118a2, 9997, 4 },
+	{ 0x118a3, 10001, 4 },
+	{ 0x118a4, 10005, 4 },
+	{ 0x118a5, 10009, 4 },
+	{ 0x118a6, 10013, 4 },
+	{ 0x118a7, 10017, 4 },
+	{ 0x118a8, 10021, 4 },
+	{ 0x118a9, 10025, 4 },
+	{ 0x118aa, 10029, 4 },
+	{ 0x118ab, 10033, 4 },
+	{ 0x118ac, 10037, 4 },
+	{ 0x118ad, 10041, 4 },
+	{ 0x118ae, 10045, 4 },
+	{ 0x118af, 10049, 4 },
+	{ 0x118b0, 10053, 4 },
+	{ 0x118b1, 10057, 4 },
+	{ 0x118b2, 10061, 4 },
+	{ 0x118b3, 10065, 4 },
+	{ 0x118b4, 10069, 4 },
+	{ 0x118b5, 10073, 4 },
+	{ 0x118b6, 10077, 4 },
+	{ 0x118b7, 10081, 4 },
+	{ 0x118b8, 10085, 4 },
+	{ 0x118b9, 10089, 4 },
+	{ 0x118ba, 10093, 4 },
+	{ 0x118bb, 10097, 4 },
+	{ 0x118bc, 10101, 4 },
+	{ 0x118bd, 10105, 4 },
+	{ 0x118be, 10109, 4 },
+	{ 0x118bf, 10113, 4 },
+	{ 0x16e40, 10117, 4 },
+	{ 0x16e41, 10121, 4 },
+	{ 0x16e42, 10125, 4 },
+	{ 0x16e43, 10129, 4 },
+	{ 0x16e44, 10133, 4 },
+	{ 0x16e45, 10137, 4 },
+	{ 0x16e46, 10141, 4 },
+	{ 0x16e47, 10145, 4 },
+	{ 0x16e48, 10149, 4 },
+	{ 0x16e49, 10153, 4 },
+	{ 0x16e4a, 10157, 4 },
+	{ 0x16e4b, 10161, 4 },
+	{ 0x16e4c, 10165, 4 },
+	{ 0x16e4d, 10169, 4 },
+	{ 0x16e4e, 10173, 4 },
+	{ 0x16e4f, 10177, 4 },
+	{ 0x16e50, 10181, 4 },
+	{ 0x16e51, 10185, 4 },
+	{ 0x16e52, 10189, 4 },
+	{ 0x16e53, 10193, 4 },
+	{ 0x16e54, 10197, 4 },
+	{ 0x16e55, 10201, 4 },
+	{ 0x16e56, 10205, 4 },
+	{ 0x16e57, 10209, 4 },
+	{ 0x16e58, 10213, 4 },
+	{ 0x16e59, 10217, 4 },
+	{ 0x16e5a, 10221, 4 },
+	{ 0x16e5b, 10225, 4 },
+	{ 0x16e5c, 10229, 4 },
+	{ 0x16e5d, 10233, 4 },
+	{ 0x16e5e, 10237, 4 },
+	{ 0x16e5f, 10241, 4 },
+	{ 0x1d15e, 10245, 8 },
+	{ 0x1d15f, 10253, 8 },
+	{ 0x1d160, 10261, 12 },
+	{ 0x1d161, 10273, 12 },
+	{ 0x1d162, 10285, 12 },
+	{ 0x1d163, 10297, 12 },
+	{ 0x1d164, 10309, 12 },
+	{ 0x1d1bb, 10321, 8 },
+	{ 0x1d1bc, 10329, 8 },
+	{ 0x1d1bd, 10337, 12 },
+	{ 0x1d1be, 10349, 12 },
+	{ 0x1d1bf, 10361, 12 },
+	{ 0x1d1c0, 10373, 12 },
+	{ 0x1d400, 1, 1 },
+	{ 0x1d401, 1175, 1 },
+	{ 0x1d402, 25, 1 },
+	{ 0x1d403, 39, 1 },
+	{ 0x1d404, 26, 1 },
+	{ 0x1d405, 1204, 1 },
+	{ 0x1d406, 42, 1 },
+	{ 0x1d407, 43, 1 },
+	{ 0x1d408, 27, 1 },
+	{ 0x1d409, 48, 1 },
+	{ 0x1d40a, 49, 1 },
+	{ 0x1d40b, 50, 1 },
+	{ 0x1d40c, 1176, 1 },
+	{ 0x1d40d, 30, 1 },
+	{ 0x1d40e, 7, 1 },
+	{ 0x1d40f, 1177, 1 },
+	{ 0x1d410, 1366, 1 },
+	{ 0x1d411, 63, 1 },
+	{ 0x1d412, 64, 1 },
+	{ 0x1d413, 65, 1 },
+	{ 0x1d414, 33, 1 },
+	{ 0x1d415, 1196, 1 },
+	{ 0x1d416, 68, 1 },
+	{ 0x1d417, 194, 1 },
+	{ 0x1d418, 34, 1 },
+	{ 0x1d419, 69, 1 },
+	{ 0x1d41a, 1, 1 },
+	{ 0x1d41b, 1175, 1 },
+	{ 0x1d41c, 25, 1 },
+	{ 0x1d41d, 39, 1 },
+	{ 0x1d41e, 26, 1 },
+	{ 0x1d41f, 1204, 1 },
+	{ 0x1d420, 42, 1 },
+	{ 0x1d421, 43, 1 },
+	{ 0x1d422, 27, 1 },
+	{ 0x1d423, 48, 1 },
+	{ 0x1d424, 49, 1 },
+	{ 0x1d425, 50, 1 },
+	{ 0x1d426, 1176, 1 },
+	{ 0x1d427, 30, 1 },
+	{ 0x1d428, 7, 1 },
+	{ 0x1d429, 1177, 1 },
+	{ 0x1d42a, 1366, 1 },
+	{ 0x1d42b, 63, 1 },
+	{ 0x1d42c, 64, 1 },
+	{ 0x1d42d, 65, 1 },
+	{ 0x1d42e, 33, 1 },
+	{ 0x1d42f, 1196, 1 },
+	{ 0x1d430, 68, 1 },
+	{ 0x1d431, 194, 1 },
+	{ 0x1d432, 34, 1 },
+	{ 0x1d433, 69, 1 },
+	{ 0x1d434, 1, 1 },
+	{ 0x1d435, 1175, 1 },
+	{ 0x1d436, 25, 1 },
+	{ 0x1d437, 39, 1 },
+	{ 0x1d438, 26, 1 },
+	{ 0x1d439, 1204, 1 },
+	{ 0x1d43a, 42, 1 },
+	{ 0x1d43b, 43, 1 },
+	{ 0x1d43c, 27, 1 },
+	{ 0x1d43d, 48, 1 },
+	{ 0x1d43e, 49, 1 },
+	{ 0x1d43f, 50, 1 },
+	{ 0x1d440, 1176, 1 },
+	{ 0x1d441, 30, 1 },
+	{ 0x1d442, 7, 1 },
+	{ 0x1d443, 1177, 1 },
+	{ 0x1d444, 1366, 1 },
+	{ 0x1d445, 63, 1 },
+	{ 0x1d446, 64, 1 },
+	{ 0x1d447, 65, 1 },
+	{ 0x1d448, 33, 1 },
+	{ 0x1d449, 1196, 1 },
+	{ 0x1d44a, 68, 1 },
+	{ 0x1d44b, 194, 1 },
+	{ 0x1d44c, 34, 1 },
+	{ 0x1d44d, 69, 1 },
+	{ 0x1d44e, 1, 1 },
+	{ 0x1d44f, 1175, 1 },
+	{ 0x1d450, 25, 1 },
+	{ 0x1d451, 39, 1 },
+	{ 0x1d452, 26, 1 },
+	{ 0x1d453, 1204, 1 },
+	{ 0x1d454, 42, 1 },
+	{ 0x1d456, 27, 1 },
+	{ 0x1d457, 48, 1 },
+	{ 0x1d458, 49, 1 },
+	{ 0x1d459, 50, 1 },
+	{ 0x1d45a, 1176, 1 },
+	{ 0x1d45b, 30, 1 },
+	{ 0x1d45c, 7, 1 },
+	{ 0x1d45d, 1177, 1 },
+	{ 0x1d45e, 1366, 1 },
+	{ 0x1d45f, 63, 1 },
+	{ 0x1d460, 64, 1 },
+	{ 0x1d461, 65, 1 },
+	{ 0x1d462, 33, 1 },
+	{ 0x1d463, 1196, 1 },
+	{ 0x1d464, 68, 1 },
+	{ 0x1d465, 194, 1 },
+	{ 0x1d466, 34, 1 },
+	{ 0x1d467, 69, 1 },
+	{ 0x1d468, 1, 1 },
+	{ 0x1d469, 1175, 1 },
+	{ 0x1d46a, 25, 1 },
+	{ 0x1d46b, 39, 1 },
+	{ 0x1d46c, 26, 1 },
+	{ 0x1d46d, 1204, 1 },
+	{ 0x1d46e, 42, 1 },
+	{ 0x1d46f, 43, 1 },
+	{ 0x1d470, 27, 1 },
+	{ 0x1d471, 48, 1 },
+	{ 0x1d472, 49, 1 },
+	{ 0x1d473, 50, 1 },
+	{ 0x1d474, 1176, 1 },
+	{ 0x1d475, 30, 1 },
+	{ 0x1d476, 7, 1 },
+	{ 0x1d477, 1177, 1 },
+	{ 0x1d478, 1366, 1 },
+	{ 0x1d479, 63, 1 },
+	{ 0x1d47a, 64, 1 },
+	{ 0x1d47b, 65, 1 },
+	{ 0x1d47c, 33, 1 },
+	{ 0x1d47d, 1196, 1 },
+	{ 0x1d47e, 68, 1 },
+	{ 0x1d47f, 194, 1 },
+	{ 0x1d480, 34, 1 },
+	{ 0x1d481, 69, 1 },
+	{ 0x1d482, 1, 1 },
+	{ 0x1d483, 1175, 1 },
+	{ 0x1d484, 25, 1 },
+	{ 0x1d485, 39, 1 },
+	{ 0x1d486, 26, 1 },
+	{ 0x1d487, 1204, 1 },
+	{ 0x1d488, 42, 1 },
+	{ 0x1d489, 43, 1 },
+	{ 0x1d48a, 27, 1 },
+	{ 0x1d48b, 48, 1 },
+	{ 0x1d48c, 49, 1 },
+	{ 0x1d48d, 50, 1 },
+	{ 0x1d48e, 1176, 1 },
+	{ 0x1d48f, 30, 1 },
+	{ 0x1d490, 7, 1 },
+	{ 0x1d491, 1177, 1 },
+	{ 0x1d492, 1366, 1 },
+	{ 0x1d493, 63, 1 },
+	{ 0x1d494, 64, 1 },
+	{ 0x1d495, 65, 1 },
+	{ 0x1d496, 33, 1 },
+	{ 0x1d497, 1196, 1 },
+	{ 0x1d498, 68, 1 },
+	{ 0x1d499, 194, 1 },
+	{ 0x1d49a, 34, 1 },
+	{ 0x1d49b, 69, 1 },
+	{ 0x1d49c, 1, 1 },
+	{ 0x1d49e, 25, 1 },
+	{ 0x1d49f, 39, 1 },
+	{ 0x1d4a2, 42, 1 },
+	{ 0x1d4a5, 48, 1 },
+	{ 0x1d4a6, 49, 1 },
+	{ 0x1d4a9, 30, 1 },
+	{ 0x1d4aa, 7, 1 },
+	{ 0x1d4ab, 1177, 1 },
+	{ 0x1d4ac, 1366, 1 },
+	{ 0x1d4ae, 64, 1 },
+	{ 0x1d4af, 65, 1 },
+	{ 0x1d4b0, 33, 1 },
+	{ 0x1d4b1, 1196, 1 },
+	{ 0x1d4b2, 68, 1 },
+	{ 0x1d4b3, 194, 1 },
+	{ 0x1d4b4, 34, 1 },
+	{ 0x1d4b5, 69, 1 },
+	{ 0x1d4b6, 1, 1 },
+	{ 0x1d4b7, 1175, 1 },
+	{ 0x1d4b8, 25, 1 },
+	{ 0x1d4b9, 39, 1 },
+	{ 0x1d4bb, 1204, 1 },
+	{ 0x1d4bd, 43, 1 },
+	{ 0x1d4be, 27, 1 },
+	{ 0x1d4bf, 48, 1 },
+	{ 0x1d4c0, 49, 1 },
+	{ 0x1d4c1, 50, 1 },
+	{ 0x1d4c2, 1176, 1 },
+	{ 0x1d4c3, 30, 1 },
+	{ 0x1d4c5, 1177, 1 },
+	{ 0x1d4c6, 1366, 1 },
+	{ 0x1d4c7, 63, 1 },
+	{ 0x1d4c8, 64, 1 },
+	{ 0x1d4c9, 65, 1 },
+	{ 0x1d4ca, 33, 1 },
+	{ 0x1d4cb, 1196, 1 },
+	{ 0x1d4cc, 68, 1 },
+	{ 0x1d4cd, 194, 1 },
+	{ 0x1d4ce, 34, 1 },
+	{ 0x1d4cf, 69, 1 },
+	{ 0x1d4d0, 1, 1 },
+	{ 0x1d4d1, 1175, 1 },
+	{ 0x1d4d2, 25, 1 },
+	{ 0x1d4d3, 39, 1 },
+	{ 0x1d4d4, 26, 1 },
+	{ 0x1d4d5, 1204, 1 },
+	{ 0x1d4d6, 42, 1 },
+	{ 0x1d4d7, 43, 1 },
+	{ 0x1d4d8, 27, 1 },
+	{ 0x1d4d9, 48, 1 },
+	{ 0x1d4da, 49, 1 },
+	{ 0x1d4db, 50, 1 },
+	{ 0x1d4dc, 1176, 1 },
+	{ 0x1d4dd, 30, 1 },
+	{ 0x1d4de, 7, 1 },
+	{ 0x1d4df, 1177, 1 },
+	{ 0x1d4e0, 1366, 1 },
+	{ 0x1d4e1, 63, 1 },
+	{ 0x1d4e2, 64, 1 },
+	{ 0x1d4e3, 65, 1 },
+	{ 0x1d4e4, 33, 1 },
+	{ 0x1d4e5, 1196, 1 },
+	{ 0x1d4e6, 68, 1 },
+	{ 0x1d4e7, 194, 1 },
+	{ 0x1d4e8, 34, 1 },
+	{ 0x1d4e9, 69, 1 },
+	{ 0x1d4ea, 1, 1 },
+	{ 0x1d4eb, 1175, 1 },
+	{ 0x1d4ec, 25, 1 },
+	{ 0x1d4ed, 39, 1 },
+	{ 0x1d4ee, 26, 1 },
+	{ 0x1d4ef, 1204, 1 },
+	{ 0x1d4f0, 42, 1 },
+	{ 0x1d4f1, 43, 1 },
+	{ 0x1d4f2, 27, 1 },
+	{ 0x1d4f3, 48, 1 },
+	{ 0x1d4f4, 49, 1 },
+	{ 0x1d4f5, 50, 1 },
+	{ 0x1d4f6, 1176, 1 },
+	{ 0x1d4f7, 30, 1 },
+	{ 0x1d4f8, 7, 1 },
+	{ 0x1d4f9, 1177, 1 },
+	{ 0x1d4fa, 1366, 1 },
+	{ 0x1d4fb, 63, 1 },
+	{ 0x1d4fc, 64, 1 },
+	{ 0x1d4fd, 65, 1 },
+	{ 0x1d4fe, 33, 1 },
+	{ 0x1d4ff, 1196, 1 },
+	{ 0x1d500, 68, 1 },
+	{ 0x1d501, 194, 1 },
+	{ 0x1d502, 34, 1 },
+	{ 0x1d503, 69, 1 },
+	{ 0x1d504, 1, 1 },
+	{ 0x1d505, 1175, 1 },
+	{ 0x1d507, 39, 1 },
+	{ 0x1d508, 26, 1 },
+	{ 0x1d509, 1204, 1 },
+	{ 0x1d50a, 42, 1 },
+	{ 0x1d50d, 48, 1 },
+	{ 0x1d50e, 49, 1 },
+	{ 0x1d50f, 50, 1 },
+	{ 0x1d510, 1176, 1 },
+	{ 0x1d511, 30, 1 },
+	{ 0x1d512, 7, 1 },
+	{ 0x1d513, 1177, 1 },
+	{ 0x1d514, 1366, 1 },
+	{ 0x1d516, 64, 1 },
+	{ 0x1d517, 65, 1 },
+	{ 0x1d518, 33, 1 },
+	{ 0x1d519, 1196, 1 },
+	{ 0x1d51a, 68, 1 },
+	{ 0x1d51b, 194, 1 },
+	{ 0x1d51c, 34, 1 },
+	{ 0x1d51e, 1, 1 },
+	{ 0x1d51f, 1175, 1 },
+	{ 0x1d520, 25, 1 },
+	{ 0x1d521, 39, 1 },
+	{ 0x1d522, 26, 1 },
+	{ 0x1d523, 1204, 1 },
+	{ 0x1d524, 42, 1 },
+	{ 0x1d525, 43, 1 },
+	{ 0x1d526, 27, 1 },
+	{ 0x1d527, 48, 1 },
+	{ 0x1d528, 49, 1 },
+	{ 0x1d529, 50, 1 },
+	{ 0x1d52a, 1176, 1 },
+	{ 0x1d52b, 30, 1 },
+	{ 0x1d52c, 7, 1 },
+	{ 0x1d52d, 1177, 1 },
+	{ 0x1d52e, 1366, 1 },
+	{ 0x1d52f, 63, 1 },
+	{ 0x1d530, 64, 1 },
+	{ 0x1d531, 65, 1 },
+	{ 0x1d532, 33, 1 },
+	{ 0x1d533, 1196, 1 },
+	{ 0x1d534, 68, 1 },
+	{ 0x1d535, 194, 1 },
+	{ 0x1d536, 34, 1 },
+	{ 0x1d537, 69, 1 },
+	{ 0x1d538, 1, 1 },
+	{ 0x1d539, 1175, 1 },
+	{ 0x1d53b, 39, 1 },
+	{ 0x1d53c, 26, 1 },
+	{ 0x1d53d, 1204, 1 },
+	{ 0x1d53e, 42, 1 },
+	{ 0x1d540, 27, 1 },
+	{ 0x1d541, 48, 1 },
+	{ 0x1d542, 49, 1 },
+	{ 0x1d543, 50, 1 },
+	{ 0x1d544, 1176, 1 },
+	{ 0x1d546, 7, 1 },
+	{ 0x1d54a, 64, 1 },
+	{ 0x1d54b, 65, 1 },
+	{ 0x1d54c, 33, 1 },
+	{ 0x1d54d, 1196, 1 },
+	{ 0x1d54e, 68, 1 },
+	{ 0x1d54f, 194, 1 },
+	{ 0x1d550, 34, 1 },
+	{ 0x1d552, 1, 1 },
+	{ 0x1d553, 1175, 1 },
+	{ 0x1d554, 25, 1 },
+	{ 0x1d555, 39, 1 },
+	{ 0x1d556, 26, 1 },
+	{ 0x1d557, 1204, 1 },
+	{ 0x1d558, 42, 1 },
+	{ 0x1d559, 43, 1 },
+	{ 0x1d55a, 27, 1 },
+	{ 0x1d55b, 48, 1 },
+	{ 0x1d55c, 49, 1 },
+	{ 0x1d55d, 50, 1 },
+	{ 0x1d55e, 1176, 1 },
+	{ 0x1d55f, 30, 1 },
+	{ 0x1d560, 7, 1 },
+	{ 0x1d561, 1177, 1 },
+	{ 0x1d562, 1366, 1 },
+	{ 0x1d563, 63, 1 },
+	{ 0x1d564, 64, 1 },
+	{ 0x1d565, 65, 1 },
+	{ 0x1d566, 33, 1 },
+	{ 0x1d567, 1196, 1 },
+	{ 0x1d568, 68, 1 },
+	{ 0x1d569, 194, 1 },
+	{ 0x1d56a, 34, 1 },
+	{ 0x1d56b, 69, 1 },
+	{ 0x1d56c, 1, 1 },
+	{ 0x1d56d, 1175, 1 },
+	{ 0x1d56e, 25, 1 },
+	{ 0x1d56f, 39, 1 },
+	{ 0x1d570, 26, 1 },
+	{ 0x1d571, 1204, 1 },
+	{ 0x1d572, 42, 1 },
+	{ 0x1d573, 43, 1 },
+	{ 0x1d574, 27, 1 },
+	{ 0x1d575, 48, 1 },
+	{ 0x1d576, 49, 1 },
+	{ 0x1d577, 50, 1 },
+	{ 0x1d578, 1176, 1 },
+	{ 0x1d579, 30, 1 },
+	{ 0x1d57a, 7, 1 },
+	{ 0x1d57b, 1177, 1 },
+	{ 0x1d57c, 1366, 1 },
+	{ 0x1d57d, 63, 1 },
+	{ 0x1d57e, 64, 1 },
+	{ 0x1d57f, 65, 1 },
+	{ 0x1d580, 33, 1 },
+	{ 0x1d581, 1196, 1 },
+	{ 0x1d582, 68, 1 },
+	{ 0x1d583, 194, 1 },
+	{ 0x1d584, 34, 1 },
+	{ 0x1d585, 69, 1 },
+	{ 0x1d586, 1, 1 },
+	{ 0x1d587, 1175, 1 },
+	{ 0x1d588, 25, 1 },
+	{ 0x1d589, 39, 1 },
+	{ 0x1d58a, 26, 1 },
+	{ 0x1d58b, 1204, 1 },
+	{ 0x1d58c, 42, 1 },
+	{ 0x1d58d, 43, 1 },
+	{ 0x1d58e, 27, 1 },
+	{ 0x1d58f, 48, 1 },
+	{ 0x1d590, 49, 1 },
+	{ 0x1d591, 50, 1 },
+	{ 0x1d592, 1176, 1 },
+	{ 0x1d593, 30, 1 },
+	{ 0x1d594, 7, 1 },
+	{ 0x1d595, 1177, 1 },
+	{ 0x1d596, 1366, 1 },
+	{ 0x1d597, 63, 1 },
+	{ 0x1d598, 64, 1 },
+	{ 0x1d599, 65, 1 },
+	{ 0x1d59a, 33, 1 },
+	{ 0x1d59b, 1196, 1 },
+	{ 0x1d59c, 68, 1 },
+	{ 0x1d59d, 194, 1 },
+	{ 0x1d59e, 34, 1 },
+	{ 0x1d59f, 69, 1 },
+	{ 0x1d5a0, 1, 1 },
+	{ 0x1d5a1, 1175, 1 },
+	{ 0x1d5a2, 25, 1 },
+	{ 0x1d5a3, 39, 1 },
+	{ 0x1d5a4, 26, 1 },
+	{ 0x1d5a5, 1204, 1 },
+	{ 0x1d5a6, 42, 1 },
+	{ 0x1d5a7, 43, 1 },
+	{ 0x1d5a8, 27, 1 },
+	{ 0x1d5a9, 48, 1 },
+	{ 0x1d5aa, 49, 1 },
+	{ 0x1d5ab, 50, 1 },
+	{ 0x1d5ac, 1176, 1 },
+	{ 0x1d5ad, 30, 1 },
+	{ 0x1d5ae, 7, 1 },
+	{ 0x1d5af, 1177, 1 },
+	{ 0x1d5b0, 1366, 1 },
+	{ 0x1d5b1, 63, 1 },
+	{ 0x1d5b2, 64, 1 },
+	{ 0x1d5b3, 65, 1 },
+	{ 0x1d5b4, 33, 1 },
+	{ 0x1d5b5, 1196, 1 },
+	{ 0x1d5b6, 68, 1 },
+	{ 0x1d5b7, 194, 1 },
+	{ 0x1d5b8, 34, 1 },
+	{ 0x1d5b9, 69, 1 },
+	{ 0x1d5ba, 1, 1 },
+	{ 0x1d5bb, 1175, 1 },
+	{ 0x1d5bc, 25, 1 },
+	{ 0x1d5bd, 39, 1 },
+	{ 0x1d5be, 26, 1 },
+	{ 0x1d5bf, 1204, 1 },
+	{ 0x1d5c0, 42, 1 },
+	{ 0x1d5c1, 43, 1 },
+	{ 0x1d5c2, 27, 1 },
+	{ 0x1d5c3, 48, 1 },
+	{ 0x1d5c4, 49, 1 },
+	{ 0x1d5c5, 50, 1 },
+	{ 0x1d5c6, 1176, 1 },
+	{ 0x1d5c7, 30, 1 },
+	{ 0x1d5c8, 7, 1 },
+	{ 0x1d5c9, 1177, 1 },
+	{ 0x1d5ca, 1366, 1 },
+	{ 0x1d5cb, 63, 1 },
+	{ 0x1d5cc, 64, 1 },
+	{ 0x1d5cd, 65, 1 },
+	{ 0x1d5ce, 33, 1 },
+	{ 0x1d5cf, 1196, 1 },
+	{ 0x1d5d0, 68, 1 },
+	{ 0x1d5d1, 194, 1 },
+	{ 0x1d5d2, 34, 1 },
+	{ 0x1d5d3, 69, 1 },
+	{ 0x1d5d4, 1, 1 },
+	{ 0x1d5d5, 1175, 1 },
+	{ 0x1d5d6, 25, 1 },
+	{ 0x1d5d7, 39, 1 },
+	{ 0x1d5d8, 26, 1 },
+	{ 0x1d5d9, 1204, 1 },
+	{ 0x1d5da, 42, 1 },
+	{ 0x1d5db, 43, 1 },
+	{ 0x1d5dc, 27, 1 },
+	{ 0x1d5dd, 48, 1 },
+	{ 0x1d5de, 49, 1 },
+	{ 0x1d5df, 50, 1 },
+	{ 0x1d5e0, 1176, 1 },
+	{ 0x1d5e1, 30, 1 },
+	{ 0x1d5e2, 7, 1 },
+	{ 0x1d5e3, 1177, 1 },
+	{ 0x1d5e4, 1366, 1 },
+	{ 0x1d5e5, 63, 1 },
+	{ 0x1d5e6, 64, 1 },
+	{ 0x1d5e7, 65, 1 },
+	{ 0x1d5e8, 33, 1 },
+	{ 0x1d5e9, 1196, 1 },
+	{ 0x1d5ea, 68, 1 },
+	{ 0x1d5eb, 194, 1 },
+	{ 0x1d5ec, 34, 1 },
+	{ 0x1d5ed, 69, 1 },
+	{ 0x1d5ee, 1, 1 },
+	{ 0x1d5ef, 1175, 1 },
+	{ 0x1d5f0, 25, 1 },
+	{ 0x1d5f1, 39, 1 },
+	{ 0x1d5f2, 26, 1 },
+	{ 0x1d5f3, 1204, 1 },
+	{ 0x1d5f4, 42, 1 },
+	{ 0x1d5f5, 43, 1 },
+	{ 0x1d5f6, 27, 1 },
+	{ 0x1d5f7, 48, 1 },
+	{ 0x1d5f8, 49, 1 },
+	{ 0x1d5f9, 50, 1 },
+	{ 0x1d5fa, 1176, 1 },
+	{ 0x1d5fb, 30, 1 },
+	{ 0x1d5fc, 7, 1 },
+	{ 0x1d5fd, 1177, 1 },
+	{ 0x1d5fe, 1366, 1 },
+	{ 0x1d5ff, 63, 1 },
+	{ 0x1d600, 64, 1 },
+	{ 0x1d601, 65, 1 },
+	{ 0x1d602, 33, 1 },
+	{ 0x1d603, 1196, 1 },
+	{ 0x1d604, 68, 1 },
+	{ 0x1d605, 194, 1 },
+	{ 0x1d606, 34, 1 },
+	{ 0x1d607, 69, 1 },
+	{ 0x1d608, 1, 1 },
+	{ 0x1d609, 1175, 1 },
+	{ 0x1d60a, 25, 1 },
+	{ 0x1d60b, 39, 1 },
+	{ 0x1d60c, 26, 1 },
+	{ 0x1d60d, 1204, 1 },
+	{ 0x1d60e, 42, 1 },
+	{ 0x1d60f, 43, 1 },
+	{ 0x1d610, 27, 1 },
+	{ 0x1d611, 48, 1 },
+	{ 0x1d612, 49, 1 },
+	{ 0x1d613, 50, 1 },
+	{ 0x1d614, 1176, 1 },
+	{ 0x1d615, 30, 1 },
+	{ 0x1d616, 7, 1 },
+	{ 0x1d617, 1177, 1 },
+	{ 0x1d618, 1366, 1 },
+	{ 0x1d619, 63, 1 },
+	{ 0x1d61a, 64, 1 },
+	{ 0x1d61b, 65, 1 },
+	{ 0x1d61c, 33, 1 },
+	{ 0x1d61d, 1196, 1 },
+	{ 0x1d61e, 68, 1 },
+	{ 0x1d61f, 194, 1 },
+	{ 0x1d620, 34, 1 },
+	{ 0x1d621, 69, 1 },
+	{ 0x1d622, 1, 1 },
+	{ 0x1d623, 1175, 1 },
+	{ 0x1d624, 25, 1 },
+	{ 0x1d625, 39, 1 },
+	{ 0x1d626, 26, 1 },
+	{ 0x1d627, 1204, 1 },
+	{ 0x1d628, 42, 1 },
+	{ 0x1d629, 43, 1 },
+	{ 0x1d62a, 27, 1 },
+	{ 0x1d62b, 48, 1 },
+	{ 0x1d62c, 49, 1 },
+	{ 0x1d62d, 50, 1 },
+	{ 0x1d62e, 1176, 1 },
+	{ 0x1d62f, 30, 1 },
+	{ 0x1d630, 7, 1 },
+	{ 0x1d631, 1177, 1 },
+	{ 0x1d632, 1366, 1 },
+	{ 0x1d633, 63, 1 },
+	{ 0x1d634, 64, 1 },
+	{ 0x1d635, 65, 1 },
+	{ 0x1d636, 33, 1 },
+	{ 0x1d637, 1196, 1 },
+	{ 0x1d638, 68, 1 },
+	{ 0x1d639, 194, 1 },
+	{ 0x1d63a, 34, 1 },
+	{ 0x1d63b, 69, 1 },
+	{ 0x1d63c, 1, 1 },
+	{ 0x1d63d, 1175, 1 },
+	{ 0x1d63e, 25, 1 },
+	{ 0x1d63f, 39, 1 },
+	{ 0x1d640, 26, 1 },
+	{ 0x1d641, 1204, 1 },
+	{ 0x1d642, 42, 1 },
+	{ 0x1d643, 43, 1 },
+	{ 0x1d644, 27, 1 },
+	{ 0x1d645, 48, 1 },
+	{ 0x1d646, 49, 1 },
+	{ 0x1d647, 50, 1 },
+	{ 0x1d648, 1176, 1 },
+	{ 0x1d649, 30, 1 },
+	{ 0x1d64a, 7, 1 },
+	{ 0x1d64b, 1177, 1 },
+	{ 0x1d64c, 1366, 1 },
+	{ 0x1d64d, 63, 1 },
+	{ 0x1d64e, 64, 1 },
+	{ 0x1d64f, 65, 1 },
+	{ 0x1d650, 33, 1 },
+	{ 0x1d651, 1196, 1 },
+	{ 0x1d652, 68, 1 },
+	{ 0x1d653, 194, 1 },
+	{ 0x1d654, 34, 1 },
+	{ 0x1d655, 69, 1 },
+	{ 0x1d656, 1, 1 },
+	{ 0x1d657, 1175, 1 },
+	{ 0x1d658, 25, 1 },
+	{ 0x1d659, 39, 1 },
+	{ 0x1d65a, 26, 1 },
+	{ 0x1d65b, 1204, 1 },
+	{ 0x1d65c, 42, 1 },
+	{ 0x1d65d, 43, 1 },
+	{ 0x1d65e, 27, 1 },
+	{ 0x1d65f, 48, 1 },
+	{ 0x1d660, 49, 1 },
+	{ 0x1d661, 50, 1 },
+	{ 0x1d662, 1176, 1 },
+	{ 0x1d663, 30, 1 },
+	{ 0x1d664, 7, 1 },
+	{ 0x1d665, 1177, 1 },
+	{ 0x1d666, 1366, 1 },
+	{ 0x1d667, 63, 1 },
+	{ 0x1d668, 64, 1 },
+	{ 0x1d669, 65, 1 },
+	{ 0x1d66a, 33, 1 },
+	{ 0x1d66b, 1196, 1 },
+	{ 0x1d66c, 68, 1 },
+	{ 0x1d66d, 194, 1 },
+	{ 0x1d66e, 34, 1 },
+	{ 0x1d66f, 69, 1 },
+	{ 0x1d670, 1, 1 },
+	{ 0x1d671, 1175, 1 },
+	{ 0x1d672, 25, 1 },
+	{ 0x1d673, 39, 1 },
+	{ 0x1d674, 26, 1 },
+	{ 0x1d675, 1204, 1 },
+	{ 0x1d676, 42, 1 },
+	{ 0x1d677, 43, 1 },
+	{ 0x1d678, 27, 1 },
+	{ 0x1d679, 48, 1 },
+	{ 0x1d67a, 49, 1 },
+	{ 0x1d67b, 50, 1 },
+	{ 0x1d67c, 1176, 1 },
+	{ 0x1d67d, 30, 1 },
+	{ 0x1d67e, 7, 1 },
+	{ 0x1d67f, 1177, 1 },
+	{ 0x1d680, 1366, 1 },
+	{ 0x1d681, 63, 1 },
+	{ 0x1d682, 64, 1 },
+	{ 0x1d683, 65, 1 },
+	{ 0x1d684, 33, 1 },
+	{ 0x1d685, 1196, 1 },
+	{ 0x1d686, 68, 1 },
+	{ 0x1d687, 194, 1 },
+	{ 0x1d688, 34, 1 },
+	{ 0x1d689, 69, 1 },
+	{ 0x1d68a, 1, 1 },
+	{ 0x1d68b, 1175, 1 },
+	{ 0x1d68c, 25, 1 },
+	{ 0x1d68d, 39, 1 },
+	{ 0x1d68e, 26, 1 },
+	{ 0x1d68f, 1204, 1 },
+	{ 0x1d690, 42, 1 },
+	{ 0x1d691, 43, 1 },
+	{ 0x1d692, 27, 1 },
+	{ 0x1d693, 48, 1 },
+	{ 0x1d694, 49, 1 },
+	{ 0x1d695, 50, 1 },
+	{ 0x1d696, 1176, 1 },
+	{ 0x1d697, 30, 1 },
+	{ 0x1d698, 7, 1 },
+	{ 0x1d699, 1177, 1 },
+	{ 0x1d69a, 1366, 1 },
+	{ 0x1d69b, 63, 1 },
+	{ 0x1d69c, 64, 1 },
+	{ 0x1d69d, 65, 1 },
+	{ 0x1d69e, 33, 1 },
+	{ 0x1d69f, 1196, 1 },
+	{ 0x1d6a0, 68, 1 },
+	{ 0x1d6a1, 194, 1 },
+	{ 0x1d6a2, 34, 1 },
+	{ 0x1d6a3, 69, 1 },
+	{ 0x1d6a4, 10385, 2 },
+	{ 0x1d6a5, 10387, 2 },
+	{ 0x1d6a8, 213, 2 },
+	{ 0x1d6a9, 227, 2 },
+	{ 0x1d6aa, 229, 2 },
+	{ 0x1d6ab, 231, 2 },
+	{ 0x1d6ac, 217, 2 },
+	{ 0x1d6ad, 233, 2 },
+	{ 0x1d6ae, 219, 2 },
+	{ 0x1d6af, 235, 2 },
+	{ 0x1d6b0, 197, 2 },
+	{ 0x1d6b1, 237, 2 },
+	{ 0x1d6b2, 239, 2 },
+	{ 0x1d6b3, 4, 2 },
+	{ 0x1d6b4, 241, 2 },
+	{ 0x1d6b5, 243, 2 },
+	{ 0x1d6b6, 221, 2 },
+	{ 0x1d6b7, 245, 2 },
+	{ 0x1d6b8, 247, 2 },
+	{ 0x1d6b9, 235, 2 },
+	{ 0x1d6ba, 249, 2 },
+	{ 0x1d6bb, 251, 2 },
+	{ 0x1d6bc, 223, 2 },
+	{ 0x1d6bd, 253, 2 },
+	{ 0x1d6be, 255, 2 },
+	{ 0x1d6bf, 257, 2 },
+	{ 0x1d6c0, 225, 2 },
+	{ 0x1d6c1, 10389, 3 },
+	{ 0x1d6c2, 213, 2 },
+	{ 0x1d6c3, 227, 2 },
+	{ 0x1d6c4, 229, 2 },
+	{ 0x1d6c5, 231, 2 },
+	{ 0x1d6c6, 217, 2 },
+	{ 0x1d6c7, 233, 2 },
+	{ 0x1d6c8, 219, 2 },
+	{ 0x1d6c9, 235, 2 },
+	{ 0x1d6ca, 197, 2 },
+	{ 0x1d6cb, 237, 2 },
+	{ 0x1d6cc, 239, 2 },
+	{ 0x1d6cd, 4, 2 },
+	{ 0x1d6ce, 241, 2 },
+	{ 0x1d6cf, 243, 2 },
+	{ 0x1d6d0, 221, 2 },
+	{ 0x1d6d1, 245, 2 },
+	{ 0x1d6d2, 247, 2 },
+	{ 0x1d6d3, 249, 2 },
+	{ 0x1d6d4, 249, 2 },
+	{ 0x1d6d5, 251, 2 },
+	{ 0x1d6d6, 223, 2 },
+	{ 0x1d6d7, 253, 2 },
+	{ 0x1d6d8, 255, 2 },
+	{ 0x1d6d9, 257, 2 },
+	{ 0x1d6da, 225, 2 },
+	{ 0x1d6db, 10392, 3 },
+	{ 0x1d6dc, 217, 2 },
+	{ 0x1d6dd, 235, 2 },
+	{ 0x1d6de, 237, 2 },
+	{ 0x1d6df, 253, 2 },
+	{ 0x1d6e0, 247, 2 },
+	{ 0x1d6e1, 245, 2 },
+	{ 0x1d6e2, 213, 2 },
+	{ 0x1d6e3, 227, 2 },
+	{ 0x1d6e4, 229, 2 },
+	{ 0x1d6e5, 231, 2 },
+	{ 0x1d6e6, 217, 2 },
+	{ 0x1d6e7, 233, 2 },
+	{ 0x1d6e8, 219, 2 },
+	{ 0x1d6e9, 235, 2 },
+	{ 0x1d6ea, 197, 2 },
+	{ 0x1d6eb, 237, 2 },
+	{ 0x1d6ec, 239, 2 },
+	{ 0x1d6ed, 4, 2 },
+	{ 0x1d6ee, 241, 2 },
+	{ 0x1d6ef, 243, 2 },
+	{ 0x1d6f0, 221, 2 },
+	{ 0x1d6f1, 245, 2 },
+	{ 0x1d6f2, 247, 2 },
+	{ 0x1d6f3, 235, 2 },
+	{ 0x1d6f4, 249, 2 },
+	{ 0x1d6f5, 251, 2 },
+	{ 0x1d6f6, 223, 2 },
+	{ 0x1d6f7, 253, 2 },
+	{ 0x1d6f8, 255, 2 },
+	{ 0x1d6f9, 257, 2 },
+	{ 0x1d6fa, 225, 2 },
+	{ 0x1d6fb, 10389, 3 },
+	{ 0x1d6fc, 213, 2 },
+	{ 0x1d6fd, 227, 2 },
+	{ 0x1d6fe, 229, 2 },
+	{ 0x1d6ff, 231, 2 },
+	{ 0x1d700, 217, 2 },
+	{ 0x1d701, 233, 2 },
+	{ 0x1d702, 219, 2 },
+	{ 0x1d703, 235, 2 },
+	{ 0x1d704, 197, 2 },
+	{ 0x1d705, 237, 2 },
+	{ 0x1d706, 239, 2 },
+	{ 0x1d707, 4, 2 },
+	{ 0x1d708, 241, 2 },
+	{ 0x1d709, 243, 2 },
+	{ 0x1d70a, 221, 2 },
+	{ 0x1d70b, 245, 2 },
+	{ 0x1d70c, 247, 2 },
+	{ 0x1d70d, 249, 2 },
+	{ 0x1d70e, 249, 2 },
+	{ 0x1d70f, 251, 2 },
+	{ 0x1d710, 223, 2 },
+	{ 0x1d711, 253, 2 },
+	{ 0x1d712, 255, 2 },
+	{ 0x1d713, 257, 2 },
+	{ 0x1d714, 225, 2 },
+	{ 0x1d715, 10392, 3 },
+	{ 0x1d716, 217, 2 },
+	{ 0x1d717, 235, 2 },
+	{ 0x1d718, 237, 2 },
+	{ 0x1d719, 253, 2 },
+	{ 0x1d71a, 247, 2 },
+	{ 0x1d71b, 245, 2 },
+	{ 0x1d71c, 213, 2 },
+	{ 0x1d71d, 227, 2 },
+	{ 0x1d71e, 229, 2 },
+	{ 0x1d71f, 231, 2 },
+	{ 0x1d720, 217, 2 },
+	{ 0x1d721, 233, 2 },
+	{ 0x1d722, 219, 2 },
+	{ 0x1d723, 235, 2 },
+	{ 0x1d724, 197, 2 },
+	{ 0x1d725, 237, 2 },
+	{ 0x1d726, 239, 2 },
+	{ 0x1d727, 4, 2 },
+	{ 0x1d728, 241, 2 },
+	{ 0x1d729, 243, 2 },
+	{ 0x1d72a, 221, 2 },
+	{ 0x1d72b, 245, 2 },
+	{ 0x1d72c, 247, 2 },
+	{ 0x1d72d, 235, 2 },
+	{ 0x1d72e, 249, 2 },
+	{ 0x1d72f, 251, 2 },
+	{ 0x1d730, 223, 2 },
+	{ 0x1d731, 253, 2 },
+	{ 0x1d732, 255, 2 },
+	{ 0x1d733, 257, 2 },
+	{ 0x1d734, 225, 2 },
+	{ 0x1d735, 10389, 3 },
+	{ 0x1d736, 213, 2 },
+	{ 0x1d737, 227, 2 },
+	{ 0x1d738, 229, 2 },
+	{ 0x1d739, 231, 2 },
+	{ 0x1d73a, 217, 2 },
+	{ 0x1d73b, 233, 2 },
+	{ 0x1d73c, 219, 2 },
+	{ 0x1d73d, 235, 2 },
+	{ 0x1d73e, 197, 2 },
+	{ 0x1d73f, 237, 2 },
+	{ 0x1d740, 239, 2 },
+	{ 0x1d741, 4, 2 },
+	{ 0x1d742, 241, 2 },
+	{ 0x1d743, 243, 2 },
+	{ 0x1d744, 221, 2 },
+	{ 0x1d745, 245, 2 },
+	{ 0x1d746, 247, 2 },
+	{ 0x1d747, 249, 2 },
+	{ 0x1d748, 249, 2 },
+	{ 0x1d749, 251, 2 },
+	{ 0x1d74a, 223, 2 },
+	{ 0x1d74b, 253, 2 },
+	{ 0x1d74c, 255, 2 },
+	{ 0x1d74d, 257, 2 },
+	{ 0x1d74e, 225, 2 },
+	{ 0x1d74f, 10392, 3 },
+	{ 0x1d750, 217, 2 },
+	{ 0x1d751, 235, 2 },
+	{ 0x1d752, 237, 2 },
+	{ 0x1d753, 253, 2 },
+	{ 0x1d754, 247, 2 },
+	{ 0x1d755, 245, 2 },
+	{ 0x1d756, 213, 2 },
+	{ 0x1d757, 227, 2 },
+	{ 0x1d758, 229, 2 },
+	{ 0x1d759, 231, 2 },
+	{ 0x1d75a, 217, 2 },
+	{ 0x1d75b, 233, 2 },
+	{ 0x1d75c, 219, 2 },
+	{ 0x1d75d, 235, 2 },
+	{ 0x1d75e, 197, 2 },
+	{ 0x1d75f, 237, 2 },
+	{ 0x1d760, 239, 2 },
+	{ 0x1d761, 4, 2 },
+	{ 0x1d762, 241, 2 },
+	{ 0x1d763, 243, 2 },
+	{ 0x1d764, 221, 2 },
+	{ 0x1d765, 245, 2 },
+	{ 0x1d766, 247, 2 },
+	{ 0x1d767, 235, 2 },
+	{ 0x1d768, 249, 2 },
+	{ 0x1d769, 251, 2 },
+	{ 0x1d76a, 223, 2 },
+	{ 0x1d76b, 253, 2 },
+	{ 0x1d76c, 255, 2 },
+	{ 0x1d76d, 257, 2 },
+	{ 0x1d76e, 225, 2 },
+	{ 0x1d76f, 10389, 3 },
+	{ 0x1d770, 213, 2 },
+	{ 0x1d771, 227, 2 },
+	{ 0x1d772, 229, 2 },
+	{ 0x1d773, 231, 2 },
+	{ 0x1d774, 217, 2 },
+	{ 0x1d775, 233, 2 },
+	{ 0x1d776, 219, 2 },
+	{ 0x1d777, 235, 2 },
+	{ 0x1d778, 197, 2 },
+	{ 0x1d779, 237, 2 },
+	{ 0x1d77a, 239, 2 },
+	{ 0x1d77b, 4, 2 },
+	{ 0x1d77c, 241, 2 },
+	{ 0x1d77d, 243, 2 },
+	{ 0x1d77e, 221, 2 },
+	{ 0x1d77f, 245, 2 },
+	{ 0x1d780, 247, 2 },
+	{ 0x1d781, 249, 2 },
+	{ 0x1d782, 249, 2 },
+	{ 0x1d783, 251, 2 },
+	{ 0x1d784, 223, 2 },
+	{ 0x1d785, 253, 2 },
+	{ 0x1d786, 255, 2 },
+	{ 0x1d787, 257, 2 },
+	{ 0x1d788, 225, 2 },
+	{ 0x1d789, 10392, 3 },
+	{ 0x1d78a, 217, 2 },
+	{ 0x1d78b, 235, 2 },
+	{ 0x1d78c, 237, 2 },
+	{ 0x1d78d, 253, 2 },
+	{ 0x1d78e, 247, 2 },
+	{ 0x1d78f, 245, 2 },
+	{ 0x1d790, 213, 2 },
+	{ 0x1d791, 227, 2 },
+	{ 0x1d792, 229, 2 },
+	{ 0x1d793, 231, 2 },
+	{ 0x1d794, 217, 2 },
+	{ 0x1d795, 233, 2 },
+	{ 0x1d796, 219, 2 },
+	{ 0x1d797, 235, 2 },
+	{ 0x1d798, 197, 2 },
+	{ 0x1d799, 237, 2 },
+	{ 0x1d79a, 239, 2 },
+	{ 0x1d79b, 4, 2 },
+	{ 0x1d79c, 241, 2 },
+	{ 0x1d79d, 243, 2 },
+	{ 0x1d79e, 221, 2 },
+	{ 0x1d79f, 245, 2 },
+	{ 0x1d7a0, 247, 2 },
+	{ 0x1d7a1, 235, 2 },
+	{ 0x1d7a2, 249, 2 },
+	{ 0x1d7a3, 251, 2 },
+	{ 0x1d7a4, 223, 2 },
+	{ 0x1d7a5, 253, 2 },
+	{ 0x1d7a6, 255, 2 },
+	{ 0x1d7a7, 257, 2 },
+	{ 0x1d7a8, 225, 2 },
+	{ 0x1d7a9, 10389, 3 },
+	{ 0x1d7aa, 213, 2 },
+	{ 0x1d7ab, 227, 2 },
+	{ 0x1d7ac, 229, 2 },
+	{ 0x1d7ad, 231, 2 },
+	{ 0x1d7ae, 217, 2 },
+	{ 0x1d7af, 233, 2 },
+	{ 0x1d7b0, 219, 2 },
+	{ 0x1d7b1, 235, 2 },
+	{ 0x1d7b2, 197, 2 },
+	{ 0x1d7b3, 237, 2 },
+	{ 0x1d7b4, 239, 2 },
+	{ 0x1d7b5, 4, 2 },
+	{ 0x1d7b6, 241, 2 },
+	{ 0x1d7b7, 243, 2 },
+	{ 0x1d7b8, 221, 2 },
+	{ 0x1d7b9, 245, 2 },
+	{ 0x1d7ba, 247, 2 },
+	{ 0x1d7bb, 249, 2 },
+	{ 0x1d7bc, 249, 2 },
+	{ 0x1d7bd, 251, 2 },
+	{ 0x1d7be, 223, 2 },
+	{ 0x1d7bf, 253, 2 },
+	{ 0x1d7c0, 255, 2 },
+	{ 0x1d7c1, 257, 2 },
+	{ 0x1d7c2, 225, 2 },
+	{ 0x1d7c3, 10392, 3 },
+	{ 0x1d7c4, 217, 2 },
+	{ 0x1d7c5, 235, 2 },
+	{ 0x1d7c6, 237, 2 },
+	{ 0x1d7c7, 253, 2 },
+	{ 0x1d7c8, 247, 2 },
+	{ 0x1d7c9, 245, 2 },
+	{ 0x1d7ca, 265, 2 },
+	{ 0x1d7cb, 265, 2 },
+	{ 0x1d7ce, 1330, 1 },
+	{ 0x1d7cf, 6, 1 },
+	{ 0x1d7d0, 2, 1 },
+	{ 0x1d7d1, 3, 1 },
+	{ 0x1d7d2, 1331, 1 },
+	{ 0x1d7d3, 1332, 1 },
+	{ 0x1d7d4, 1333, 1 },
+	{ 0x1d7d5, 1334, 1 },
+	{ 0x1d7d6, 1335, 1 },
+	{ 0x1d7d7, 1336, 1 },
+	{ 0x1d7d8, 1330, 1 },
+	{ 0x1d7d9, 6, 1 },
+	{ 0x1d7da, 2, 1 },
+	{ 0x1d7db, 3, 1 },
+	{ 0x1d7dc, 1331, 1 },
+	{ 0x1d7dd, 1332, 1 },
+	{ 0x1d7de, 1333, 1 },
+	{ 0x1d7df, 1334, 1 },
+	{ 0x1d7e0, 1335, 1 },
+	{ 0x1d7e1, 1336, 1 },
+	{ 0x1d7e2, 1330, 1 },
+	{ 0x1d7e3, 6, 1 },
+	{ 0x1d7e4, 2, 1 },
+	{ 0x1d7e5, 3, 1 },
+	{ 0x1d7e6, 1331, 1 },
+	{ 0x1d7e7, 1332, 1 },
+	{ 0x1d7e8, 1333, 1 },
+	{ 0x1d7e9, 1334, 1 },
+	{ 0x1d7ea, 1335, 1 },
+	{ 0x1d7eb, 1336, 1 },
+	{ 0x1d7ec, 1330, 1 },
+	{ 0x1d7ed, 6, 1 },
+	{ 0x1d7ee, 2, 1 },
+	{ 0x1d7ef, 3, 1 },
+	{ 0x1d7f0, 1331, 1 },
+	{ 0x1d7f1, 1332, 1 },
+	{ 0x1d7f2, 1333, 1 },
+	{ 0x1d7f3, 1334, 1 },
+	{ 0x1d7f4, 1335, 1 },
+	{ 0x1d7f5, 1336, 1 },
+	{ 0x1d7f6, 1330, 1 },
+	{ 0x1d7f7, 6, 1 },
+	{ 0x1d7f8, 2, 1 },
+	{ 0x1d7f9, 3, 1 },
+	{ 0x1d7fa, 1331, 1 },
+	{ 0x1d7fb, 1332, 1 },
+	{ 0x1d7fc, 1333, 1 },
+	{ 0x1d7fd, 1334, 1 },
+	{ 0x1d7fe, 1335, 1 },
+	{ 0x1d7ff, 1336, 1 },
+	{ 0x1e900, 10395, 4 },
+	{ 0x1e901, 10399, 4 },
+	{ 0x1e902, 10403, 4 },
+	{ 0x1e903, 10407, 4 },
+	{ 0x1e904, 10411, 4 },
+	{ 0x1e905, 10415, 4 },
+	{ 0x1e906, 10419, 4 },
+	{ 0x1e907, 10423, 4 },
+	{ 0x1e908, 10427, 4 },
+	{ 0x1e909, 10431, 4 },
+	{ 0x1e90a, 10435, 4 },
+	{ 0x1e90b, 10439, 4 },
+	{ 0x1e90c, 10443, 4 },
+	{ 0x1e90d, 10447, 4 },
+	{ 0x1e90e, 10451, 4 },
+	{ 0x1e90f, 10455, 4 },
+	{ 0x1e910, 10459, 4 },
+	{ 0x1e911, 10463, 4 },
+	{ 0x1e912, 10467, 4 },
+	{ 0x1e913, 10471, 4 },
+	{ 0x1e914, 10475, 4 },
+	{ 0x1e915, 10479, 4 },
+	{ 0x1e916, 10483, 4 },
+	{ 0x1e917, 10487, 4 },
+	{ 0x1e918, 10491, 4 },
+	{ 0x1e919, 10495, 4 },
+	{ 0x1e91a, 10499, 4 },
+	{ 0x1e91b, 10503, 4 },
+	{ 0x1e91c, 10507, 4 },
+	{ 0x1e91d, 10511, 4 },
+	{ 0x1e91e, 10515, 4 },
+	{ 0x1e91f, 10519, 4 },
+	{ 0x1e920, 10523, 4 },
+	{ 0x1e921, 10527, 4 },
+	{ 0x1ee00, 9080, 2 },
+	{ 0x1ee01, 9082, 2 },
+	{ 0x1ee02, 9090, 2 },
+	{ 0x1ee03, 9096, 2 },
+	{ 0x1ee05, 9134, 2 },
+	{ 0x1ee06, 9102, 2 },
+	{ 0x1ee07, 9092, 2 },
+	{ 0x1ee08, 9112, 2 },
+	{ 0x1ee09, 9136, 2 },
+	{ 0x1ee0a, 9124, 2 },
+	{ 0x1ee0b, 9126, 2 },
+	{ 0x1ee0c, 9128, 2 },
+	{ 0x1ee0d, 9130, 2 },
+	{ 0x1ee0e, 9104, 2 },
+	{ 0x1ee0f, 9116, 2 },
+	{ 0x1ee10, 9120, 2 },
+	{ 0x1ee11, 9108, 2 },
+	{ 0x1ee12, 9122, 2 },
+	{ 0x1ee13, 9100, 2 },
+	{ 0x1ee14, 9106, 2 },
+	{ 0x1ee15, 9086, 2 },
+	{ 0x1ee16, 9088, 2 },
+	{ 0x1ee17, 9094, 2 },
+	{ 0x1ee18, 9098, 2 },
+	{ 0x1ee19, 9110, 2 },
+	{ 0x1ee1a, 9114, 2 },
+	{ 0x1ee1b, 9118, 2 },
+	{ 0x1ee1c, 10531, 2 },
+	{ 0x1ee1d, 7535, 2 },
+	{ 0x1ee1e, 10533, 2 },
+	{ 0x1ee1f, 10535, 2 },
+	{ 0x1ee21, 9082, 2 },
+	{ 0x1ee22, 9090, 2 },
+	{ 0x1ee24, 9132, 2 },
+	{ 0x1ee27, 9092, 2 },
+	{ 0x1ee29, 9136, 2 },
+	{ 0x1ee2a, 9124, 2 },
+	{ 0x1ee2b, 9126, 2 },
+	{ 0x1ee2c, 9128, 2 },
+	{ 0x1ee2d, 9130, 2 },
+	{ 0x1ee2e, 9104, 2 },
+	{ 0x1ee2f, 9116, 2 },
+	{ 0x1ee30, 9120, 2 },
+	{ 0x1ee31, 9108, 2 },
+	{ 0x1ee32, 9122, 2 },
+	{ 0x1ee34, 9106, 2 },
+	{ 0x1ee35, 9086, 2 },
+	{ 0x1ee36, 9088, 2 },
+	{ 0x1ee37, 9094, 2 },
+	{ 0x1ee39, 9110, 2 },
+	{ 0x1ee3b, 9118, 2 },
+	{ 0x1ee42, 9090, 2 },
+	{ 0x1ee47, 9092, 2 },
+	{ 0x1ee49, 9136, 2 },
+	{ 0x1ee4b, 9126, 2 },
+	{ 0x1ee4d, 9130, 2 },
+	{ 0x1ee4e, 9104, 2 },
+	{ 0x1ee4f, 9116, 2 },
+	{ 0x1ee51, 9108, 2 },
+	{ 0x1ee52, 9122, 2 },
+	{ 0x1ee54, 9106, 2 },
+	{ 0x1ee57, 9094, 2 },
+	{ 0x1ee59, 9110, 2 },
+	{ 0x1ee5b, 9118, 2 },
+	{ 0x1ee5d, 7535, 2 },
+	{ 0x1ee5f, 10535, 2 },
+	{ 0x1ee61, 9082, 2 },
+	{ 0x1ee62, 9090, 2 },
+	{ 0x1ee64, 9132, 2 },
+	{ 0x1ee67, 9092, 2 },
+	{ 0x1ee68, 9112, 2 },
+	{ 0x1ee69, 9136, 2 },
+	{ 0x1ee6a, 9124, 2 },
+	{ 0x1ee6c, 9128, 2 },
+	{ 0x1ee6d, 9130, 2 },
+	{ 0x1ee6e, 9104, 2 },
+	{ 0x1ee6f, 9116, 2 },
+	{ 0x1ee70, 9120, 2 },
+	{ 0x1ee71, 9108, 2 },
+	{ 0x1ee72, 9122, 2 },
+	{ 0x1ee74, 9106, 2 },
+	{ 0x1ee75, 9086, 2 },
+	{ 0x1ee76, 9088, 2 },
+	{ 0x1ee77, 9094, 2 },
+	{ 0x1ee79, 9110, 2 },
+	{ 0x1ee7a, 9114, 2 },
+	{ 0x1ee7b, 9118, 2 },
+	{ 0x1ee7c, 10531, 2 },
+	{ 0x1ee7e, 10533, 2 },
+	{ 0x1ee80, 9080, 2 },
+	{ 0x1ee81, 9082, 2 },
+	{ 0x1ee82, 9090, 2 },
+	{ 0x1ee83, 9096, 2 },
+	{ 0x1ee84, 9132, 2 },
+	{ 0x1ee85, 9134, 2 },
+	{ 0x1ee86, 9102, 2 },
+	{ 0x1ee87, 9092, 2 },
+	{ 0x1ee88, 9112, 2 },
+	{ 0x1ee89, 9136, 2 },
+	{ 0x1ee8b, 9126, 2 },
+	{ 0x1ee8c, 9128, 2 },
+	{ 0x1ee8d, 9130, 2 },
+	{ 0x1ee8e, 9104, 2 },
+	{ 0x1ee8f, 9116, 2 },
+	{ 0x1ee90, 9120, 2 },
+	{ 0x1ee91, 9108, 2 },
+	{ 0x1ee92, 9122, 2 },
+	{ 0x1ee93, 9100, 2 },
+	{ 0x1ee94, 9106, 2 },
+	{ 0x1ee95, 9086, 2 },
+	{ 0x1ee96, 9088, 2 },
+	{ 0x1ee97, 9094, 2 },
+	{ 0x1ee98, 9098, 2 },
+	{ 0x1ee99, 9110, 2 },
+	{ 0x1ee9a, 9114, 2 },
+	{ 0x1ee9b, 9118, 2 },
+	{ 0x1eea1, 9082, 2 },
+	{ 0x1eea2, 9090, 2 },
+	{ 0x1eea3, 9096, 2 },
+	{ 0x1eea5, 9134, 2 },
+	{ 0x1eea6, 9102, 2 },
+	{ 0x1eea7, 9092, 2 },
+	{ 0x1eea8, 9112, 2 },
+	{ 0x1eea9, 9136, 2 },
+	{ 0x1eeab, 9126, 2 },
+	{ 0x1eeac, 9128, 2 },
+	{ 0x1eead, 9130, 2 },
+	{ 0x1eeae, 9104, 2 },
+	{ 0x1eeaf, 9116, 2 },
+	{ 0x1eeb0, 9120, 2 },
+	{ 0x1eeb1, 9108, 2 },
+	{ 0x1eeb2, 9122, 2 },
+	{ 0x1eeb3, 9100, 2 },
+	{ 0x1eeb4, 9106, 2 },
+	{ 0x1eeb5, 9086, 2 },
+	{ 0x1eeb6, 9088, 2 },
+	{ 0x1eeb7, 9094, 2 },
+	{ 0x1eeb8, 9098, 2 },
+	{ 0x1eeb9, 9110, 2 },
+	{ 0x1eeba, 9114, 2 },
+	{ 0x1eebb, 9118, 2 },
+	{ 0x1f100, 10537, 2 },
+	{ 0x1f101, 10539, 2 },
+	{ 0x1f102, 10541, 2 },
+	{ 0x1f103, 10543, 2 },
+	{ 0x1f104, 10545, 2 },
+	{ 0x1f105, 10547, 2 },
+	{ 0x1f106, 10549, 2 },
+	{ 0x1f107, 10551, 2 },
+	{ 0x1f108, 10553, 2 },
+	{ 0x1f109, 10555, 2 },
+	{ 0x1f10a, 10557, 2 },
+	{ 0x1f110, 1807, 3 },
+	{ 0x1f111, 1810, 3 },
+	{ 0x1f112, 1813, 3 },
+	{ 0x1f113, 1816, 3 },
+	{ 0x1f114, 1819, 3 },
+	{ 0x1f115, 1822, 3 },
+	{ 0x1f116, 1825, 3 },
+	{ 0x1f117, 1828, 3 },
+	{ 0x1f118, 1831, 3 },
+	{ 0x1f119, 1834, 3 },
+	{ 0x1f11a, 1837, 3 },
+	{ 0x1f11b, 1840, 3 },
+	{ 0x1f11c, 1843, 3 },
+	{ 0x1f11d, 1846, 3 },
+	{ 0x1f11e, 1849, 3 },
+	{ 0x1f11f, 1852, 3 },
+	{ 0x1f120, 1855, 3 },
+	{ 0x1f121, 1858, 3 },
+	{ 0x1f122, 1861, 3 },
+	{ 0x1f123, 1864, 3 },
+	{ 0x1f124, 1867, 3 },
+	{ 0x1f125, 1870, 3 },
+	{ 0x1f126, 1873, 3 },
+	{ 0x1f127, 1876, 3 },
+	{ 0x1f128, 1879, 3 },
+	{ 0x1f129, 1882, 3 },
+	{ 0x1f12a, 10559, 7 },
+	{ 0x1f12b, 25, 1 },
+	{ 0x1f12c, 63, 1 },
+	{ 0x1f12d, 5266, 2 },
+	{ 0x1f12e, 10566, 2 },
+	{ 0x1f130, 1, 1 },
+	{ 0x1f131, 1175, 1 },
+	{ 0x1f132, 25, 1 },
+	{ 0x1f133, 39, 1 },
+	{ 0x1f134, 26, 1 },
+	{ 0x1f135, 1204, 1 },
+	{ 0x1f136, 42, 1 },
+	{ 0x1f137, 43, 1 },
+	{ 0x1f138, 27, 1 },
+	{ 0x1f139, 48, 1 },
+	{ 0x1f13a, 49, 1 },
+	{ 0x1f13b, 50, 1 },
+	{ 0x1f13c, 1176, 1 },
+	{ 0x1f13d, 30, 1 },
+	{ 0x1f13e, 7, 1 },
+	{ 0x1f13f, 1177, 1 },
+	{ 0x1f140, 1366, 1 },
+	{ 0x1f141, 63, 1 },
+	{ 0x1f142, 64, 1 },
+	{ 0x1f143, 65, 1 },
+	{ 0x1f144, 33, 1 },
+	{ 0x1f145, 1196, 1 },
+	{ 0x1f146, 68, 1 },
+	{ 0x1f147, 194, 1 },
+	{ 0x1f148, 34, 1 },
+	{ 0x1f149, 69, 1 },
+	{ 0x1f14a, 10568, 2 },
+	{ 0x1f14b, 5237, 2 },
+	{ 0x1f14c, 10570, 2 },
+	{ 0x1f14d, 37, 2 },
+	{ 0x1f14e, 10572, 3 },
+	{ 0x1f14f, 10575, 2 },
+	{ 0x1f16a, 10577, 2 },
+	{ 0x1f16b, 10579, 2 },
+	{ 0x1f16c, 10581, 2 },
+	{ 0x1f190, 10583, 2 },
+	{ 0x1f200, 10585, 6 },
+	{ 0x1f201, 10591, 6 },
+	{ 0x1f202, 3889, 3 },
+	{ 0x1f210, 2438, 3 },
+	{ 0x1f211, 10597, 3 },
+	{ 0x1f212, 10600, 3 },
+	{ 0x1f213, 10603, 3 },
+	{ 0x1f214, 2267, 3 },
+	{ 0x1f215, 10606, 3 },
+	{ 0x1f216, 10609, 3 },
+	{ 0x1f217, 3226, 3 },
+	{ 0x1f218, 10612, 3 },
+	{ 0x1f219, 10615, 3 },
+	{ 0x1f21a, 10618, 3 },
+	{ 0x1f21b, 6606, 3 },
+	{ 0x1f21c, 10621, 3 },
+	{ 0x1f21d, 10624, 3 },
+	{ 0x1f21e, 10627, 3 },
+	{ 0x1f21f, 10630, 3 },
+	{ 0x1f220, 10633, 3 },
+	{ 0x1f221, 10636, 3 },
+	{ 0x1f222, 2546, 3 },
+	{ 0x1f223, 10639, 3 },
+	{ 0x1f224, 10642, 3 },
+	{ 0x1f225, 10645, 3 },
+	{ 0x1f226, 10648, 3 },
+	{ 0x1f227, 10651, 3 },
+	{ 0x1f228, 10654, 3 },
+	{ 0x1f229, 2249, 3 },
+	{ 0x1f22a, 3202, 3 },
+	{ 0x1f22b, 10657, 3 },
+	{ 0x1f22c, 3738, 3 },
+	{ 0x1f22d, 3211, 3 },
+	{ 0x1f22e, 3741, 3 },
+	{ 0x1f22f, 10660, 3 },
+	{ 0x1f230, 2714, 3 },
+	{ 0x1f231, 10663, 3 },
+	{ 0x1f232, 10666, 3 },
+	{ 0x1f233, 10669, 3 },
+	{ 0x1f234, 10672, 3 },
+	{ 0x1f235, 10675, 3 },
+	{ 0x1f236, 3687, 3 },
+	{ 0x1f237, 2468, 3 },
+	{ 0x1f238, 10678, 3 },
+	{ 0x1f239, 10681, 3 },
+	{ 0x1f23a, 10684, 3 },
+	{ 0x1f23b, 10687, 3 },
+	{ 0x1f240, 10690, 9 },
+	{ 0x1f241, 10699, 9 },
+	{ 0x1f242, 10708, 9 },
+	{ 0x1f243, 10717, 9 },
+	{ 0x1f244, 10726, 9 },
+	{ 0x1f245, 10735, 9 },
+	{ 0x1f246, 10744, 9 },
+	{ 0x1f247, 10753, 9 },
+	{ 0x1f248, 10762, 9 },
+	{ 0x1f250, 10771, 3 },
+	{ 0x1f251, 10774, 3 },
+	{ 0x1fbf0, 1330, 1 },
+	{ 0x1fbf1, 6, 1 },
+	{ 0x1fbf2, 2, 1 },
+	{ 0x1fbf3, 3, 1 },
+	{ 0x1fbf4, 1331, 1 },
+	{ 0x1fbf5, 1332, 1 },
+	{ 0x1fbf6, 1333, 1 },
+	{ 0x1fbf7, 1334, 1 },
+	{ 0x1fbf8, 1335, 1 },
+	{ 0x1fbf9, 1336, 1 },
+	{ 0x2f800, 10777, 3 },
+	{ 0x2f801, 10780, 3 },
+	{ 0x2f802, 10783, 3 },
+	{ 0x2f803, 10786, 4 },
+	{ 0x2f804, 10790, 3 },
+	{ 0x2f805, 6885, 3 },
+	{ 0x2f806, 10793, 3 },
+	{ 0x2f807, 10796, 3 },
+	{ 0x2f808, 10799, 3 },
+	{ 0x2f809, 10802, 3 },
+	{ 0x2f80a, 6888, 3 },
+	{ 0x2f80b, 10805, 3 },
+	{ 0x2f80c, 10808, 3 },
+	{ 0x2f80d, 10811, 4 },
+	{ 0x2f80e, 6891, 3 },
+	{ 0x2f80f, 10815, 3 },
+	{ 0x2f810, 10818, 3 },
+	{ 0x2f811, 10821, 3 },
+	{ 0x2f812, 10824, 4 },
+	{ 0x2f813, 10828, 3 },
+	{ 0x2f814, 10831, 3 },
+	{ 0x2f815, 10627, 3 },
+	{ 0x2f816, 10834, 4 },
+	{ 0x2f817, 10838, 3 },
+	{ 0x2f818, 10841, 3 },
+	{ 0x2f819, 10844, 3 },
+	{ 0x2f81a, 10847, 3 },
+	{ 0x2f81b, 7057, 3 },
+	{ 0x2f81c, 10850, 4 },
+	{ 0x2f81d, 2297, 3 },
+	{ 0x2f81e, 10854, 3 },
+	{ 0x2f81f, 10857, 3 },
+	{ 0x2f820, 10860, 3 },
+	{ 0x2f821, 10863, 3 },
+	{ 0x2f822, 10681, 3 },
+	{ 0x2f823, 10866, 3 },
+	{ 0x2f824, 10869, 3 },
+	{ 0x2f825, 7072, 3 },
+	{ 0x2f826, 6894, 3 },
+	{ 0x2f827, 6897, 3 },
+	{ 0x2f828, 7075, 3 },
+	{ 0x2f829, 10872, 3 },
+	{ 0x2f82a, 10875, 3 },
+	{ 0x2f82b, 6348, 3 },
+	{ 0x2f82c, 10878, 3 },
+	{ 0x2f82d, 6900, 3 },
+	{ 0x2f82e, 10881, 3 },
+	{ 0x2f82f, 10884, 3 },
+	{ 0x2f830, 10887, 3 },
+	{ 0x2f831, 10890, 3 },
+	{ 0x2f832, 10890, 3 },
+	{ 0x2f833, 10890, 3 },
+	{ 0x2f834, 10893, 4 },
+	{ 0x2f835, 10897, 3 },
+	{ 0x2f836, 10900, 3 },
+	{ 0x2f837, 10903, 3 },
+	{ 0x2f838, 10906, 4 },
+	{ 0x2f839, 10910, 3 },
+	{ 0x2f83a, 10913, 3 },
+	{ 0x2f83b, 10916, 3 },
+	{ 0x2f83c, 10919, 3 },
+	{ 0x2f83d, 10922, 3 },
+	{ 0x2f83e, 10925, 3 },
+	{ 0x2f83f, 10928, 3 },
+	{ 0x2f840, 10931, 3 },
+	{ 0x2f841, 10934, 3 },
+	{ 0x2f842, 10937, 3 },
+	{ 0x2f843, 10940, 3 },
+	{ 0x2f844, 10943, 3 },
+	{ 0x2f845, 10946, 3 },
+	{ 0x2f846, 10946, 3 },
+	{ 0x2f847, 7081, 3 },
+	{ 0x2f848, 10949, 3 },
+	{ 0x2f849, 10952, 3 },
+	{ 0x2f84a, 10955, 3 },
+	{ 0x2f84b, 10958, 3 },
+	{ 0x2f84c, 6906, 3 },
+	{ 0x2f84d, 10961, 3 },
+	{ 0x2f84e, 10964, 3 },
+	{ 0x2f84f, 10967, 3 },
+	{ 0x2f850, 6786, 3 },
+	{ 0x2f851, 10970, 3 },
+	{ 0x2f852, 10973, 3 },
+	{ 0x2f853, 10976, 3 },
+	{ 0x2f854, 10979, 3 },
+	{ 0x2f855, 10982, 3 },
+	{ 0x2f856, 10985, 3 },
+	{ 0x2f857, 10988, 3 },
+	{ 0x2f858, 10991, 3 },
+	{ 0x2f859, 10994, 4 },
+	{ 0x2f85a, 10998, 3 },
+	{ 0x2f85b, 11001, 3 },
+	{ 0x2f85c, 11004, 3 },
+	{ 0x2f85d, 10606, 3 },
+	{ 0x2f85e, 11007, 3 },
+	{ 0x2f85f, 11010, 3 },
+	{ 0x2f860, 11013, 4 },
+	{ 0x2f861, 11017, 4 },
+	{ 0x2f862, 11021, 3 },
+	{ 0x2f863, 11024, 3 },
+	{ 0x2f864, 11027, 3 },
+	{ 0x2f865, 11030, 3 },
+	{ 0x2f866, 11033, 3 },
+	{ 0x2f867, 11036, 3 },
+	{ 0x2f868, 11039, 3 },
+	{ 0x2f869, 11042, 3 },
+	{ 0x2f86a, 11045, 3 },
+	{ 0x2f86b, 11045, 3 },
+	{ 0x2f86c, 11048, 4 },
+	{ 0x2f86d, 11052, 3 },
+	{ 0x2f86e, 11055, 3 },
+	{ 0x2f86f, 6336, 3 },
+	{ 0x2f870, 11058, 3 },
+	{ 0x2f871, 11061, 4 },
+	{ 0x2f872, 11065, 3 },
+	{ 0x2f873, 11068, 3 },
+	{ 0x2f874, 11071, 3 },
+	{ 0x2f875, 2375, 3 },
+	{ 0x2f876, 11074, 3 },
+	{ 0x2f877, 11077, 3 },
+	{ 0x2f878, 2381, 3 },
+	{ 0x2f879, 11080, 3 },
+	{ 0x2f87a, 11083, 3 },
+	{ 0x2f87b, 11086, 4 },
+	{ 0x2f87c, 11090, 3 },
+	{ 0x2f87d, 11093, 4 },
+	{ 0x2f87e, 11097, 3 },
+	{ 0x2f87f, 11100, 3 },
+	{ 0x2f880, 11103, 3 },
+	{ 0x2f881, 11106, 3 },
+	{ 0x2f882, 11109, 3 },
+	{ 0x2f883, 11112, 3 },
+	{ 0x2f884, 11115, 3 },
+	{ 0x2f885, 11118, 3 },
+	{ 0x2f886, 11121, 3 },
+	{ 0x2f887, 11124, 3 },
+	{ 0x2f888, 11127, 3 },
+	{ 0x2f889, 11130, 4 },
+	{ 0x2f88a, 11134, 3 },
+	{ 0x2f88b, 11137, 3 },
+	{ 0x2f88c, 11140, 3 },
+	{ 0x2f88d, 11143, 3 },
+	{ 0x2f88e, 6180, 3 },
+	{ 0x2f88f, 11146, 4 },
+	{ 0x2f890, 2411, 3 },
+	{ 0x2f891, 11150, 4 },
+	{ 0x2f892, 11150, 4 },
+	{ 0x2f893, 11154, 3 },
+	{ 0x2f894, 11157, 3 },
+	{ 0x2f895, 11157, 3 },
+	{ 0x2f896, 11160, 3 },
+	{ 0x2f897, 11163, 4 },
+	{ 0x2f898, 11167, 4 },
+	{ 0x2f899, 11171, 3 },
+	{ 0x2f89a, 11174, 3 },
+	{ 0x2f89b, 11177, 3 },
+	{ 0x2f89c, 11180, 3 },
+	{ 0x2f89d, 11183, 3 },
+	{ 0x2f89e, 11186, 3 },
+	{ 0x2f89f, 11189, 3 },
+	{ 0x2f8a0, 11192, 3 },
+	{ 0x2f8a1, 11195, 3 },
+	{ 0x2f8a2, 11198, 3 },
+	{ 0x2f8a3, 6921, 3 },
+	{ 0x2f8a4, 11201, 4 },
+	{ 0x2f8a5, 11205, 3 },
+	{ 0x2f8a6, 11208, 3 },
+	{ 0x2f8a7, 11211, 3 },
+	{ 0x2f8a8, 7117, 3 },
+	{ 0x2f8a9, 11211, 3 },
+	{ 0x2f8aa, 11214, 3 },
+	{ 0x2f8ab, 6927, 3 },
+	{ 0x2f8ac, 11217, 3 },
+	{ 0x2f8ad, 11220, 3 },
+	{ 0x2f8ae, 11223, 3 },
+	{ 0x2f8af, 11226, 3 },
+	{ 0x2f8b0, 6930, 3 },
+	{ 0x2f8b1, 6099, 3 },
+	{ 0x2f8b2, 11229, 3 },
+	{ 0x2f8b3, 11232, 3 },
+	{ 0x2f8b4, 11235, 3 },
+	{ 0x2f8b5, 11238, 3 },
+	{ 0x2f8b6, 11241, 3 },
+	{ 0x2f8b7, 11244, 3 },
+	{ 0x2f8b8, 11247, 4 },
+	{ 0x2f8b9, 11251, 3 },
+	{ 0x2f8ba, 11254, 3 },
+	{ 0x2f8bb, 11257, 3 },
+	{ 0x2f8bc, 11260, 3 },
+	{ 0x2f8bd, 11263, 3 },
+	{ 0x2f8be, 11266, 4 },
+	{ 0x2f8bf, 11270, 3 },
+	{ 0x2f8c0, 11273, 3 },
+	{ 0x2f8c1, 11276, 3 },
+	{ 0x2f8c2, 11279, 3 },
+	{ 0x2f8c3, 11282, 3 },
+	{ 0x2f8c4, 11285, 3 },
+	{ 0x2f8c5, 11288, 3 },
+	{ 0x2f8c6, 11291, 3 },
+	{ 0x2f8c7, 11294, 3 },
+	{ 0x2f8c8, 6933, 3 },
+	{ 0x2f8c9, 11297, 3 },
+	{ 0x2f8ca, 11300, 4 },
+	{ 0x2f8cb, 11304, 3 },
+	{ 0x2f8cc, 11307, 3 },
+	{ 0x2f8cd, 11310, 3 },
+	{ 0x2f8ce, 11313, 3 },
+	{ 0x2f8cf, 6939, 3 },
+	{ 0x2f8d0, 11316, 3 },
+	{ 0x2f8d1, 11319, 3 },
+	{ 0x2f8d2, 11322, 3 },
+	{ 0x2f8d3, 11325, 3 },
+	{ 0x2f8d4, 11328, 3 },
+	{ 0x2f8d5, 11331, 3 },
+	{ 0x2f8d6, 11334, 3 },
+	{ 0x2f8d7, 11337, 3 },
+	{ 0x2f8d8, 6183, 3 },
+	{ 0x2f8d9, 7141, 3 },
+	{ 0x2f8da, 11340, 3 },
+	{ 0x2f8db, 11343, 3 },
+	{ 0x2f8dc, 11346, 3 },
+	{ 0x2f8dd, 11349, 4 },
+	{ 0x2f8de, 11353, 3 },
+	{ 0x2f8df, 11356, 3 },
+	{ 0x2f8e0, 11359, 3 },
+	{ 0x2f8e1, 11362, 3 },
+	{ 0x2f8e2, 6942, 3 },
+	{ 0x2f8e3, 11365, 4 },
+	{ 0x2f8e4, 11369, 3 },
+	{ 0x2f8e5, 11372, 3 },
+	{ 0x2f8e6, 11375, 3 },
+	{ 0x2f8e7, 7270, 3 },
+	{ 0x2f8e8, 11378, 3 },
+	{ 0x2f8e9, 11381, 3 },
+	{ 0x2f8ea, 11384, 3 },
+	{ 0x2f8eb, 11387, 3 },
+	{ 0x2f8ec, 11390, 4 },
+	{ 0x2f8ed, 11394, 3 },
+	{ 0x2f8ee, 11397, 3 },
+	{ 0x2f8ef, 11400, 3 },
+	{ 0x2f8f0, 11403, 4 },
+	{ 0x2f8f1, 11407, 3 },
+	{ 0x2f8f2, 11410, 3 },
+	{ 0x2f8f3, 11413, 3 },
+	{ 0x2f8f4, 11416, 3 },
+	{ 0x2f8f5, 6387, 3 },
+	{ 0x2f8f6, 11419, 3 },
+	{ 0x2f8f7, 11422, 4 },
+	{ 0x2f8f8, 11426, 4 },
+	{ 0x2f8f9, 11430, 4 },
+	{ 0x2f8fa, 11434, 3 },
+	{ 0x2f8fb, 11437, 4 },
+	{ 0x2f8fc, 11441, 3 },
+	{ 0x2f8fd, 11444, 3 },
+	{ 0x2f8fe, 11447, 3 },
+	{ 0x2f8ff, 11450, 3 },
+	{ 0x2f900, 11453, 3 },
+	{ 0x2f901, 6945, 3 },
+	{ 0x2f902, 6636, 3 },
+	{ 0x2f903, 11456, 3 },
+	{ 0x2f904, 11459, 3 },
+	{ 0x2f905, 11462, 3 },
+	{ 0x2f906, 11465, 4 },
+	{ 0x2f907, 11469, 3 },
+	{ 0x2f908, 11472, 3 },
+	{ 0x2f909, 11475, 3 },
+	{ 0x2f90a, 11478, 3 },
+	{ 0x2f90b, 7150, 3 },
+	{ 0x2f90c, 11481, 3 },
+	{ 0x2f90d, 11484, 4 },
+	{ 0x2f90e, 11488, 3 },
+	{ 0x2f90f, 11491, 3 },
+	{ 0x2f910, 11494, 4 },
+	{ 0x2f911, 11498, 4 },
+	{ 0x2f912, 11502, 3 },
+	{ 0x2f913, 11505, 3 },
+	{ 0x2f914, 7153, 3 },
+	{ 0x2f915, 11508, 3 },
+	{ 0x2f916, 11511, 3 },
+	{ 0x2f917, 11514, 3 },
+	{ 0x2f918, 11517, 3 },
+	{ 0x2f919, 11520, 3 },
+	{ 0x2f91a, 11523, 3 },
+	{ 0x2f91b, 11526, 4 },
+	{ 0x2f91c, 11530, 3 },
+	{ 0x2f91d, 11533, 4 },
+	{ 0x2f91e, 11537, 3 },
+	{ 0x2f91f, 11540, 4 },
+	{ 0x2f920, 11544, 3 },
+	{ 0x2f921, 7159, 3 },
+	{ 0x2f922, 11547, 3 },
+	{ 0x2f923, 11550, 4 },
+	{ 0x2f924, 11554, 3 },
+	{ 0x2f925, 11557, 3 },
+	{ 0x2f926, 11560, 4 },
+	{ 0x2f927, 11564, 4 },
+	{ 0x2f928, 11568, 3 },
+	{ 0x2f929, 11571, 3 },
+	{ 0x2f92a, 11574, 3 },
+	{ 0x2f92b, 11577, 3 },
+	{ 0x2f92c, 11580, 3 },
+	{ 0x2f92d, 11580, 3 },
+	{ 0x2f92e, 11583, 3 },
+	{ 0x2f92f, 11586, 3 },
+	{ 0x2f930, 7165, 3 },
+	{ 0x2f931, 11589, 3 },
+	{ 0x2f932, 11592, 3 },
+	{ 0x2f933, 11595, 3 },
+	{ 0x2f934, 11598, 3 },
+	{ 0x2f935, 11601, 4 },
+	{ 0x2f936, 11605, 3 },
+	{ 0x2f937, 11608, 4 },
+	{ 0x2f938, 6345, 3 },
+	{ 0x2f939, 11612, 4 },
+	{ 0x2f93a, 11616, 3 },
+	{ 0x2f93b, 11619, 4 },
+	{ 0x2f93c, 11623, 4 },
+	{ 0x2f93d, 11627, 4 },
+	{ 0x2f93e, 11631, 3 },
+	{ 0x2f93f, 11634, 3 },
+	{ 0x2f940, 7183, 3 },
+	{ 0x2f941, 11637, 4 },
+	{ 0x2f942, 11641, 4 },
+	{ 0x2f943, 11645, 4 },
+	{ 0x2f944, 11649, 4 },
+	{ 0x2f945, 11653, 3 },
+	{ 0x2f946, 11656, 3 },
+	{ 0x2f947, 11656, 3 },
+	{ 0x2f948, 7186, 3 },
+	{ 0x2f949, 7276, 3 },
+	{ 0x2f94a, 11659, 3 },
+	{ 0x2f94b, 11662, 3 },
+	{ 0x2f94c, 11665, 3 },
+	{ 0x2f94d, 11668, 4 },
+	{ 0x2f94e, 11672, 3 },
+	{ 0x2f94f, 6234, 3 },
+	{ 0x2f950, 7192, 3 },
+	{ 0x2f951, 11675, 3 },
+	{ 0x2f952, 11678, 4 },
+	{ 0x2f953, 6975, 3 },
+	{ 0x2f954, 11682, 4 },
+	{ 0x2f955, 11686, 4 },
+	{ 0x2f956, 6846, 3 },
+	{ 0x2f957, 11690, 3 },
+	{ 0x2f958, 11693, 3 },
+	{ 0x2f959, 6984, 3 },
+	{ 0x2f95a, 11696, 3 },
+	{ 0x2f95b, 11699, 3 },
+	{ 0x2f95c, 11702, 4 },
+	{ 0x2f95d, 11706, 4 },
+	{ 0x2f95e, 11706, 4 },
+	{ 0x2f95f, 11710, 3 },
+	{ 0x2f960, 11713, 3 },
+	{ 0x2f961, 11716, 4 },
+	{ 0x2f962, 11720, 3 },
+	{ 0x2f963, 11723, 3 },
+	{ 0x2f964, 11726, 3 },
+	{ 0x2f965, 11729, 4 },
+	{ 0x2f966, 11733, 3 },
+	{ 0x2f967, 11736, 3 },
+	{ 0x2f968, 11739, 3 },
+	{ 0x2f969, 11742, 3 },
+	{ 0x2f96a, 11745, 3 },
+	{ 0x2f96b, 11748, 4 },
+	{ 0x2f96c, 11752, 3 },
+	{ 0x2f96d, 11755, 3 },
+	{ 0x2f96e, 11758, 3 },
+	{ 0x2f96f, 11761, 3 },
+	{ 0x2f970, 11764, 3 },
+	{ 0x2f971, 11767, 3 },
+	{ 0x2f972, 11770, 4 },
+	{ 0x2f973, 11774, 4 },
+	{ 0x2f974, 11778, 3 },
+	{ 0x2f975, 11781, 4 },
+	{ 0x2f976, 11785, 3 },
+	{ 0x2f977, 11788, 4 },
+	{ 0x2f978, 11792, 3 },
+	{ 0x2f979, 11795, 3 },
+	{ 0x2f97a, 7002, 3 },
+	{ 0x2f97b, 11798, 4 },
+	{ 0x2f97c, 11802, 4 },
+	{ 0x2f97d, 11806, 3 },
+	{ 0x2f97e, 11809, 4 },
+	{ 0x2f97f, 11813, 3 },
+	{ 0x2f980, 11816, 4 },
+	{ 0x2f981, 11820, 3 },
+	{ 0x2f982, 11823, 3 },
+	{ 0x2f983, 11826, 3 },
+	{ 0x2f984, 11829, 3 },
+	{ 0x2f985, 11832, 3 },
+	{ 0x2f986, 11835, 3 },
+	{ 0x2f987, 11838, 4 },
+	{ 0x2f988, 11842, 4 },
+	{ 0x2f989, 11846, 4 },
+	{ 0x2f98a, 11850, 4 },
+	{ 0x2f98b, 11154, 3 },
+	{ 0x2f98c, 11854, 3 },
+	{ 0x2f98d, 11857, 3 },
+	{ 0x2f98e, 11860, 3 },
+	{ 0x2f98f, 11863, 3 },
+	{ 0x2f990, 11866, 3 },
+	{ 0x2f991, 11869, 3 },
+	{ 0x2f992, 11872, 3 },
+	{ 0x2f993, 11875, 3 },
+	{ 0x2f994, 11878, 3 },
+	{ 0x2f995, 11881, 3 },
+	{ 0x2f996, 11884, 3 },
+	{ 0x2f997, 11887, 4 },
+	{ 0x2f998, 6396, 3 },
+	{ 0x2f999, 11891, 3 },
+	{ 0x2f99a, 11894, 3 },
+	{ 0x2f99b, 11897, 3 },
+	{ 0x2f99c, 11900, 3 },
+	{ 0x2f99d, 11903, 3 },
+	{ 0x2f99e, 11906, 3 },
+	{ 0x2f99f, 7011, 3 },
+	{ 0x2f9a0, 11909, 3 },
+	{ 0x2f9a1, 11912, 3 },
+	{ 0x2f9a2, 11915, 3 },
+	{ 0x2f9a3, 11918, 3 },
+	{ 0x2f9a4, 11921, 4 },
+	{ 0x2f9a5, 11925, 4 },
+	{ 0x2f9a6, 11929, 4 },
+	{ 0x2f9a7, 11933, 3 },
+	{ 0x2f9a8, 11936, 3 },
+	{ 0x2f9a9, 11939, 3 },
+	{ 0x2f9aa, 11942, 3 },
+	{ 0x2f9ab, 11945, 4 },
+	{ 0x2f9ac, 11949, 3 },
+	{ 0x2f9ad, 11952, 4 },
+	{ 0x2f9ae, 11956, 3 },
+	{ 0x2f9af, 11959, 3 },
+	{ 0x2f9b0, 11962, 4 },
+	{ 0x2f9b1, 11966, 4 },
+	{ 0x2f9b2, 11970, 3 },
+	{ 0x2f9b3, 11973, 3 },
+	{ 0x2f9b4, 6219, 3 },
+	{ 0x2f9b5, 11976, 3 },
+	{ 0x2f9b6, 11979, 3 },
+	{ 0x2f9b7, 11982, 3 },
+	{ 0x2f9b8, 11985, 3 },
+	{ 0x2f9b9, 11988, 3 },
+	{ 0x2f9ba, 11991, 3 },
+	{ 0x2f9bb, 7213, 3 },
+	{ 0x2f9bc, 11994, 3 },
+	{ 0x2f9bd, 11997, 3 },
+	{ 0x2f9be, 12000, 3 },
+	{ 0x2f9bf, 12003, 3 },
+	{ 0x2f9c0, 12006, 3 },
+	{ 0x2f9c1, 12009, 3 },
+	{ 0x2f9c2, 12012, 3 },
+	{ 0x2f9c3, 12015, 3 },
+	{ 0x2f9c4, 2681, 3 },
+	{ 0x2f9c5, 12018, 4 },
+	{ 0x2f9c6, 12022, 3 },
+	{ 0x2f9c7, 12025, 3 },
+	{ 0x2f9c8, 12028, 3 },
+	{ 0x2f9c9, 12031, 3 },
+	{ 0x2f9ca, 12034, 3 },
+	{ 0x2f9cb, 12037, 4 },
+	{ 0x2f9cc, 12041, 4 },
+	{ 0x2f9cd, 12045, 3 },
+	{ 0x2f9ce, 12048, 3 },
+	{ 0x2f9cf, 12051, 3 },
+	{ 0x2f9d0, 7228, 3 },
+	{ 0x2f9d1, 7231, 3 },
+	{ 0x2f9d2, 2702, 3 },
+	{ 0x2f9d3, 12054, 4 },
+	{ 0x2f9d4, 12058, 3 },
+	{ 0x2f9d5, 12061, 3 },
+	{ 0x2f9d6, 12064, 3 },
+	{ 0x2f9d7, 12067, 3 },
+	{ 0x2f9d8, 12070, 4 },
+	{ 0x2f9d9, 12074, 4 },
+	{ 0x2f9da, 12078, 3 },
+	{ 0x2f9db, 12081, 3 },
+	{ 0x2f9dc, 12084, 3 },
+	{ 0x2f9dd, 12087, 4 },
+	{ 0x2f9de, 12091, 3 },
+	{ 0x2f9df, 7234, 3 },
+	{ 0x2f9e0, 12094, 4 },
+	{ 0x2f9e1, 12098, 4 },
+	{ 0x2f9e2, 12102, 3 },
+	{ 0x2f9e3, 12105, 3 },
+	{ 0x2f9e4, 12108, 3 },
+	{ 0x2f9e5, 12111, 4 },
+	{ 0x2f9e6, 12115, 3 },
+	{ 0x2f9e7, 12118, 3 },
+	{ 0x2f9e8, 12121, 3 },
+	{ 0x2f9e9, 12124, 3 },
+	{ 0x2f9ea, 12127, 3 },
+	{ 0x2f9eb, 12130, 3 },
+	{ 0x2f9ec, 12133, 3 },
+	{ 0x2f9ed, 12136, 4 },
+	{ 0x2f9ee, 12140, 3 },
+	{ 0x2f9ef, 12143, 3 },
+	{ 0x2f9f0, 12146, 3 },
+	{ 0x2f9f1, 12149, 4 },
+	{ 0x2f9f2, 12153, 3 },
+	{ 0x2f9f3, 12156, 3 },
+	{ 0x2f9f4, 12159, 3 },
+	{ 0x2f9f5, 12162, 3 },
+	{ 0x2f9f6, 12165, 4 },
+	{ 0x2f9f7, 12169, 4 },
+	{ 0x2f9f8, 12173, 3 },
+	{ 0x2f9f9, 12176, 3 },
+	{ 0x2f9fa, 12179, 3 },
+	{ 0x2f9fb, 12182, 4 },
+	{ 0x2f9fc, 12186, 3 },
+	{ 0x2f9fd, 12189, 4 },
+	{ 0x2f9fe, 7252, 3 },
+	{ 0x2f9ff, 7252, 3 },
+	{ 0x2fa00, 12193, 3 },
+	{ 0x2fa01, 12196, 4 },
+	{ 0x2fa02, 12200, 3 },
+	{ 0x2fa03, 12203, 3 },
+	{ 0x2fa04, 12206, 3 },
+	{ 0x2fa05, 12209, 3 },
+	{ 0x2fa06, 12212, 3 },
+	{ 0x2fa07, 12215, 3 },
+	{ 0x2fa08, 12218, 3 },
+	{ 0x2fa09, 12221, 4 },
+	{ 0x2fa0a, 7255, 3 },
+	{ 0x2fa0b, 12225, 3 },
+	{ 0x2fa0c, 12228, 3 },
+	{ 0x2fa0d, 12231, 3 },
+	{ 0x2fa0e, 12234, 3 },
+	{ 0x2fa0f, 12237, 3 },
+	{ 0x2fa10, 12240, 4 },
+	{ 0x2fa11, 12244, 3 },
+	{ 0x2fa12, 12247, 4 },
+	{ 0x2fa13, 12251, 4 },
+	{ 0x2fa14, 12255, 4 },
+	{ 0x2fa15, 2846, 3 },
+	{ 0x2fa16, 12259, 3 },
+	{ 0x2fa17, 2858, 3 },
+	{ 0x2fa18, 12262, 3 },
+	{ 0x2fa19, 12265, 3 },
+	{ 0x2fa1a, 12268, 3 },
+	{ 0x2fa1b, 12271, 3 },
+	{ 0x2fa1c, 2873, 3 },
+	{ 0x2fa1d, 12274, 4 },
+};
@@ -20,9 +20,20 @@
 
 #include "nnclientsocket.h"
 #include "nnlog.h"
+#include "nnreactor.h"
 #include "platform.h"
+#include "util.h"
+#include <algorithm>
 #include <iostream>
 
+NewNet::ClientSocket::~ClientSocket()
+{
+#ifndef WIN32
+  if(m_PassDescriptor != -1)
+    close(m_PassDescriptor);
+#endif // WIN32
+}
+
 void
 NewNet::ClientSocket::disconnect(bool invoke)
 {
@@ -121,28 +132,353 @@ NewNet::ClientSocket::process()
 
   if((readyState() & StateSend) && dataWaiting())
   {
-    size_t n = std::min((size_t)1024, m_SendBuffer.count());
-    ssize_t sent = ::send(descriptor(), (const char *)m_SendBuffer.data(), n, 0);
+    ssize_t sent = write();
     if(sent < 0)
     {
-      if(errno == EAGAIN)
-        setReadyState(readyState() & ~StateSend);
-      else
+      NNLOG("newnet.net.warn", "Socket %u encountered error %i. Closing it.", descriptor(), errno);
+      closesocket(descriptor());
+      setSocketError(ErrorUnknown);
+      disconnectedEvent(this);
+      return;
+    }
+    else if(sent == 0)
+      setReadyState(readyState() & ~StateSend);
+    else
+      dataSentEvent(this);
+  }
+}
+
+void
+NewNet::ClientSocket::send(const unsigned char * data, size_t n)
+{
+  m_SendBuffer.append(data, n);
+  queued(n);
+}
+
+void
+NewNet::ClientSocket::send(const unsigned char * header, size_t headerSize, const unsigned char * data, size_t n)
+{
+  m_SendBuffer.append(header, headerSize);
+  m_SendBuffer.append(data, n);
+  queued(headerSize + n);
+}
+
+void
+NewNet::ClientSocket::queued(size_t n)
+{
+  m_SendStats.queued += n;
+  setDataWaiting(m_SendBuffer.count() > 0);
+
+  if(! m_Corked)
+  {
+    /* First data of this iteration, ask the reactor to flush us when
+       it's done with the other sockets. */
+    if(! reactor())
+      return;
+    m_Corked = true;
+    m_CorkSent = 0;
+    m_CorkStart = NewNet::clock.now();
+    reactor()->scheduleFlush(this);
+    return;
+  }
+
+  /* Don't let data wait on a long reactor iteration forever. The cached
+     time doesn't move during the iteration, read the clock. */
+  if((m_CorkLatency >= 0) && reactor() && (socketState() == SocketConnected))
+  {
+    const struct timeval & now = NewNet::clock.precise();
+    if(difftime(now, m_CorkStart) >= m_CorkLatency)
+    {
+      ++m_SendStats.capped;
+      ssize_t sent = write();
+      if(sent > 0)
+        m_CorkSent += sent;
+      m_CorkStart = now;
+    }
+  }
+}
+
+void
+NewNet::ClientSocket::flush()
+{
+  if(! m_Corked)
+    return;
+  m_Corked = false;
+
+  /* Sockets that were removed from the reactor may have handed their
+     descriptor over to another socket, leave them alone. */
+  if((! reactor()) || (socketState() != SocketConnected) || (descriptor() < 0))
+    return;
+
+  ++m_SendStats.flushes;
+
+  /* Write until the socket or the rate limiter tells us to stop. What's
+     left will be sent when the reactor reports the socket writable. */
+  while(dataWaiting() && ((! upRateLimiter()) || (upRateLimiter()->nextWindow() == 0)))
+  {
+    ssize_t sent = write();
+    if(sent < 0)
+    {
+      NNLOG("newnet.net.warn", "Socket %u encountered error %i. Closing it.", descriptor(), errno);
+      closesocket(descriptor());
+      setSocketError(ErrorUnknown);
+      disconnectedEvent(this);
+      return;
+    }
+    if(sent == 0)
+      break;
+    m_CorkSent += sent;
+  }
+
+  if(m_CorkSent > 0)
+  {
+    m_CorkSent = 0;
+    dataSentEvent(this);
+  }
+}
+
+ssize_t
+NewNet::ClientSocket::write()
+{
+  /* Write as much as possible, but stay close to the rate limit so the
+     limiter can keep the transfer smooth. */
+  size_t n = 65536;
+  if(upRateLimiter() && (upRateLimiter()->limit() > 0))
+    n = std::max((size_t)1024, std::min(n, (size_t)upRateLimiter()->limit() / 10));
+  n = std::min(n, m_SendBuffer.count());
+
+  ssize_t sent;
+#ifndef WIN32
+  if(m_PassDescriptor != -1)
+  {
+    /* The descriptor goes with the byte it was queued before: stop right
+       before it, then attach it to the next write. */
+    if(m_PassOffset > 0)
+    {
+      n = std::min(n, m_PassOffset);
+      sent = ::send(descriptor(), (const char *)m_SendBuffer.data(), n, 0);
+    }
+    else
+      sent = writeDescriptor(n);
+    if(sent > 0)
+    {
+      if(m_PassOffset == 0)
       {
-        NNLOG("newnet.net.warn", "Socket %u encountered error %i. Closing it.", descriptor(), errno);
-        closesocket(descriptor());
-        setSocketError(ErrorUnknown);
-        disconnectedEvent(this);
-        return;
+        close(m_PassDescriptor);
+        m_PassDescriptor = -1;
       }
+      else
+        m_PassOffset -= sent;
     }
-    else {
-        if(upRateLimiter())
-          upRateLimiter()->transferred(sent);
-        m_SendBuffer.seek(sent);
-        NNLOG("newnet.net.debug", "Sent %i bytes to socket %u, %d bytes remaining.", sent, descriptor(), m_SendBuffer.count());
-        setDataWaiting(m_SendBuffer.count() != 0);
-        dataSentEvent(this);
+  }
+  else
+#endif // WIN32
+    sent = ::send(descriptor(), (const char *)m_SendBuffer.data(), n, 0);
+  ++m_SendStats.writes;
+  if(sent < 0)
+  {
+    if((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))
+      return 0;
+    return -1;
+  }
+
+  if(upRateLimiter())
+    upRateLimiter()->transferred(sent);
+  m_SendBuffer.seek(sent);
+  m_SendStats.sent += sent;
+  NNLOG("newnet.net.debug", "Sent %i bytes to socket %u, %d bytes remaining.", sent, descriptor(), m_SendBuffer.count());
+  setDataWaiting(m_SendBuffer.count() != 0);
+  return sent;
+}
+
+#ifndef WIN32
+bool
+NewNet::ClientSocket::sendDescriptor(int fd)
+{
+  if(m_PassDescriptor != -1)
+    return false;
+  m_PassDescriptor = dup(fd);
+  if(m_PassDescriptor == -1)
+    return false;
+  m_PassOffset = m_SendBuffer.count();
+  return true;
+}
+
+ssize_t
+NewNet::ClientSocket::writeDescriptor(size_t n)
+{
+  struct iovec iov;
+  iov.iov_base = (void *)m_SendBuffer.data();
+  iov.iov_len = n;
+
+  union
+  {
+    struct cmsghdr header;
+    char data[CMSG_SPACE(sizeof(int))];
+  } control;
+  memset(&control, 0, sizeof(control));
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.data;
+  msg.msg_controllen = sizeof(control.data);
+
+  struct cmsghdr * cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(cmsg), &m_PassDescriptor, sizeof(int));
+
+  NNLOG("newnet.net.debug", "Passing descriptor %i through socket %u.", m_PassDescriptor, descriptor());
+  return sendmsg(descriptor(), &msg, 0);
+}
+
+bool
+NewNet::ClientSocket::peerUid(uid_t & uid) const
+{
+  if(descriptor() < 0)
+    return false;
+#if defined(SO_PEERCRED)
+  struct ucred credentials;
+  socklen_t length = sizeof(credentials);
+  if(getsockopt(descriptor(), SOL_SOCKET, SO_PEERCRED, &credentials, &length) != 0)
+    return false;
+  uid = credentials.uid;
+  return true;
+#elif defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || defined(__APPLE__)
+  gid_t gid;
+  return getpeereid(descriptor(), &uid, &gid) == 0;
+#else
+  return false;
+#endif
+}
+#endif // WIN32
+
+/* TCP options only make sense on internet sockets. */
+static bool
+isInternetSocket(int fd)
+{
+  struct sockaddr_storage address;
+  socklen_t length = sizeof(address);
+  if(getsockname(fd, (struct sockaddr *)&address, &length) != 0)
+    return false;
+  return (address.ss_family == AF_INET) || (address.ss_family == AF_INET6);
+}
+
+static void
+setOption(int fd, int level, int option, int value, const char * name)
+{
+  if(setsockopt(fd, level, option, (const char *)&value, sizeof(value)) != 0)
+    NNLOG("newnet.net.warn", "Couldn't set %s to %i on socket %i (errno: %i).", name, value, fd, errno);
+}
+
+static int
+getOption(int fd, int level, int option)
+{
+  int value = 0;
+  socklen_t length = sizeof(value);
+  if(getsockopt(fd, level, option, (char *)&value, &length) != 0)
+    return 0;
+  return value;
+}
+
+void
+NewNet::ClientSocket::setSocketOptions(const SocketOptions & options)
+{
+  m_SocketOptions = options;
+  m_HasSocketOptions = true;
+  if(descriptor() != -1)
+    descriptorChanged();
+}
+
+void
+NewNet::ClientSocket::descriptorChanged()
+{
+  m_HasEffectiveOptions = false;
+  if(! m_HasSocketOptions)
+    return;
+
+  int fd = descriptor();
+  const SocketOptions & options = m_SocketOptions;
+
+  if(options.sendBuffer > 0)
+    setOption(fd, SOL_SOCKET, SO_SNDBUF, options.sendBuffer, "SO_SNDBUF");
+  if(options.receiveBuffer > 0)
+    setOption(fd, SOL_SOCKET, SO_RCVBUF, options.receiveBuffer, "SO_RCVBUF");
+
+  if(isInternetSocket(fd))
+  {
+    /* Set both ways: the descriptor may have been configured for another
+       kind of socket before it was handed over to us. */
+    setOption(fd, IPPROTO_TCP, TCP_NODELAY, options.noDelay ? 1 : 0, "TCP_NODELAY");
+    setOption(fd, SOL_SOCKET, SO_KEEPALIVE, (options.keepAlive > 0) ? 1 : 0, "SO_KEEPALIVE");
+    if(options.keepAlive > 0)
+    {
+#ifdef TCP_KEEPIDLE
+      setOption(fd, IPPROTO_TCP, TCP_KEEPIDLE, options.keepAlive, "TCP_KEEPIDLE");
+#endif // TCP_KEEPIDLE
+#ifdef TCP_KEEPINTVL
+      if(options.keepAliveInterval > 0)
+        setOption(fd, IPPROTO_TCP, TCP_KEEPINTVL, options.keepAliveInterval, "TCP_KEEPINTVL");
+#endif // TCP_KEEPINTVL
+#ifdef TCP_KEEPCNT
+      if(options.keepAliveCount > 0)
+        setOption(fd, IPPROTO_TCP, TCP_KEEPCNT, options.keepAliveCount, "TCP_KEEPCNT");
+#endif // TCP_KEEPCNT
     }
+#ifdef TCP_NOTSENT_LOWAT
+    if(options.notSentLowat > 0)
+      setOption(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, options.notSentLowat, "TCP_NOTSENT_LOWAT");
+#endif // TCP_NOTSENT_LOWAT
+  }
+
+  /* Reading the options back takes a system call each, only do it when
+     someone is going to read them */
+  static const NewNet::Log::Domain debugDomain("newnet.net.debug");
+  if(! NewNet::log.enabled(debugDomain))
+    return;
+  const SocketOptions & effective = effectiveSocketOptions();
+  NNLOG("newnet.net.debug", "Socket %i options: send buffer %i, receive buffer %i, nodelay %i, keepalive %i/%i/%i, not sent low water mark %i.",
+        fd, effective.sendBuffer, effective.receiveBuffer, effective.noDelay ? 1 : 0, effective.keepAlive,
+        effective.keepAliveInterval, effective.keepAliveCount, effective.notSentLowat);
+}
+
+const NewNet::ClientSocket::SocketOptions &
+NewNet::ClientSocket::effectiveSocketOptions() const
+{
+  SocketOptions & effective = m_EffectiveOptions;
+  if(m_HasEffectiveOptions)
+    return effective;
+  effective = SocketOptions();
+  int fd = descriptor();
+  if(fd == -1)
+    return effective;
+  m_HasEffectiveOptions = true;
+
+  effective.sendBuffer = getOption(fd, SOL_SOCKET, SO_SNDBUF);
+  effective.receiveBuffer = getOption(fd, SOL_SOCKET, SO_RCVBUF);
+  if(! isInternetSocket(fd))
+    return effective;
+
+  effective.noDelay = getOption(fd, IPPROTO_TCP, TCP_NODELAY) != 0;
+  if(getOption(fd, SOL_SOCKET, SO_KEEPALIVE))
+  {
+#ifdef TCP_KEEPIDLE
+    effective.keepAlive = getOption(fd, IPPROTO_TCP, TCP_KEEPIDLE);
+#else
+    effective.keepAlive = 1;
+#endif // TCP_KEEPIDLE
+#ifdef TCP_KEEPINTVL
+    effective.keepAliveInterval = getOption(fd, IPPROTO_TCP, TCP_KEEPINTVL);
+#endif // TCP_KEEPINTVL
+#ifdef TCP_KEEPCNT
+    effective.keepAliveCount = getOption(fd, IPPROTO_TCP, TCP_KEEPCNT);
+#endif // TCP_KEEPCNT
   }
+#ifdef TCP_NOTSENT_LOWAT
+  effective.notSentLowat = getOption(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT);
+#endif // TCP_NOTSENT_LOWAT
+  return effective;
 }
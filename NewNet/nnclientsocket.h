@@ -24,6 +24,8 @@
 #include "nnsocket.h"
 #include "nnbuffer.h"
 #include "nnevent.h"
+#include "platform.h"
+#include <stdint.h>
 
 namespace NewNet
 {
@@ -38,10 +40,47 @@ namespace NewNet
     //! Create an empty client socket.
     /*! This will create an empty client socket. The client socket starts in
         an uninitialized state without a descriptor. */
-    ClientSocket() : Socket()
+    ClientSocket() : Socket(), m_Corked(false), m_CorkSent(0), m_CorkLatency(50),
+                     m_HasSocketOptions(false), m_HasEffectiveOptions(false), m_PassDescriptor(-1),
+                     m_PassOffset(0)
     {
+      memset(&m_SendStats, 0, sizeof(m_SendStats));
     }
 
+#ifndef DOXYGEN_UNDOCUMENTED
+    ~ClientSocket();
+#endif // DOXYGEN_UNDOCUMENTED
+
+    //! Socket options applied to the descriptor.
+    /*! Zero keeps the system's value. Options a descriptor doesn't support,
+        such as the TCP ones on unix sockets, are skipped. */
+    struct SocketOptions
+    {
+      SocketOptions() : sendBuffer(0), receiveBuffer(0), noDelay(false), keepAlive(0),
+                        keepAliveInterval(0), keepAliveCount(0), notSentLowat(0)
+      {
+      }
+
+      int sendBuffer;        //!< SO_SNDBUF, in bytes.
+      int receiveBuffer;     //!< SO_RCVBUF, in bytes.
+      bool noDelay;          //!< TCP_NODELAY: send small messages right away.
+      int keepAlive;         //!< Idle seconds before keepalive probes are sent, 0 disables them.
+      int keepAliveInterval; //!< Seconds between keepalive probes.
+      int keepAliveCount;    //!< Unanswered probes before the connection is dropped.
+      int notSentLowat;      //!< TCP_NOTSENT_LOWAT, in bytes.
+    };
+
+    //! Statistics about outgoing data.
+    /*! Collected for every client socket, see sendStats(). */
+    struct SendStats
+    {
+      uint64_t queued;         //!< Bytes appended to the send buffer.
+      uint64_t sent;           //!< Bytes actually written to the socket.
+      unsigned long writes;    //!< Number of send system calls.
+      unsigned long flushes;   //!< Number of end of iteration flushes.
+      unsigned long capped;    //!< Writes forced by the latency cap.
+    };
+
     //! Disconnect the client socket.
     /*! This immediately disconnects the client socket and invokes the
         disconnected event (except if invoke is false). */
@@ -56,11 +95,75 @@ namespace NewNet
     //! Append data to the send buffer.
     /*! This is a convenience function that will append data to the send
         buffer and will mark the flag that specifies that the socket wants
-        to send data. */
-    void send(const unsigned char * data, size_t n)
+        to send data. The socket is corked: everything queued during the
+        current reactor iteration is written at once when the iteration ends,
+        or earlier if the data has waited longer than corkLatency(). */
+    void send(const unsigned char * data, size_t n);
+
+    //! Append a header and data to the send buffer.
+    /*! Same as send(data, n), but queues a message header and its body as
+        a single unit. */
+    void send(const unsigned char * header, size_t headerSize, const unsigned char * data, size_t n);
+
+#ifndef WIN32
+    //! Pass a descriptor to the peer.
+    /*! Only works on unix sockets. The descriptor is duplicated and sent
+        along with the first byte queued after this call, so the peer
+        receives it with that byte's recvmsg(). The copy is closed once it
+        has been sent. Only one descriptor can be waiting at a time, returns
+        false if another one is. */
+    bool sendDescriptor(int fd);
+
+    //! Return the user id of the peer.
+    /*! Only works on unix sockets, the system vouches for the value.
+        Returns false if it can't be determined. */
+    bool peerUid(uid_t & uid) const;
+#endif // WIN32
+
+    //! Write the corked data.
+    /*! Called by the reactor at the end of the loop iteration. Writes as
+        much of the send buffer as the socket and rate limiter allow and
+        emits dataSentEvent if anything was sent. */
+    virtual void flush();
+
+    //! Return the cork latency cap.
+    /*! Maximum number of miliseconds data may stay corked before it is
+        written, even if the reactor iteration hasn't ended yet. */
+    long corkLatency() const
+    {
+      return m_CorkLatency;
+    }
+
+    //! Set the cork latency cap.
+    /*! See corkLatency(). A negative value disables the cap. */
+    void setCorkLatency(long ms)
     {
-      m_SendBuffer.append(data, n);
-      setDataWaiting(m_SendBuffer.count() > 0);
+      m_CorkLatency = ms;
+    }
+
+    //! Set the socket options.
+    /*! The options are applied right away if the socket has a descriptor,
+        and to every descriptor it gets afterwards. Sockets without options
+        keep the system's defaults. */
+    void setSocketOptions(const SocketOptions & options);
+
+    //! Return the requested socket options.
+    const SocketOptions & socketOptions() const
+    {
+      return m_SocketOptions;
+    }
+
+    //! Return the options actually in effect.
+    /*! Read back from the descriptor the first time they're asked for
+        once it changed, and kept: the system may round or double the
+        buffer sizes. Unsupported options read as 0. */
+    const SocketOptions & effectiveSocketOptions() const;
+
+    //! Return the send statistics.
+    /*! Returns the statistics about the data sent through this socket. */
+    const SendStats & sendStats() const
+    {
+      return m_SendStats;
     }
 
     //! Return a reference to the send buffer.
@@ -101,8 +204,40 @@ namespace NewNet
         host. */
     Event<ClientSocket *> dataSentEvent;
 
+  protected:
+    /* Apply the socket options to the new descriptor. */
+    void descriptorChanged();
+
+    //! Write the send buffer without emitting events.
+    /*! Performs at most one send system call. Returns the number of bytes
+        written, 0 if the socket would block and -1 on error. */
+    ssize_t write();
+
+    //! Bookkeeping after data was appended to the send buffer.
+    /*! send() calls it once the data is in the buffer. Subclasses that need
+        to change the data once queued (to obfuscate it for instance) can
+        append it to sendBuffer() themselves and call this afterwards: it may
+        write the buffer right away. */
+    void queued(size_t n);
+
   private:
+#ifndef WIN32
+    /* Write n bytes with the waiting descriptor attached. */
+    ssize_t writeDescriptor(size_t n);
+#endif // WIN32
+
     Buffer m_SendBuffer, m_ReceiveBuffer;
+    SendStats m_SendStats;
+    bool m_Corked;
+    size_t m_CorkSent;
+    struct timeval m_CorkStart;
+    long m_CorkLatency;
+    bool m_HasSocketOptions;
+    SocketOptions m_SocketOptions;
+    mutable bool m_HasEffectiveOptions;
+    mutable SocketOptions m_EffectiveOptions;
+    int m_PassDescriptor;
+    size_t m_PassOffset;
   };
 }
 
@@ -0,0 +1,91 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#include "nnclock.h"
+#include "util.h"
+#include <time.h>
+
+NewNet::Clock NewNet::clock;
+
+/* Read the system's monotonic clock. The coarse clock is served from the
+   vDSO without touching the hardware, at the price of a tick of
+   resolution. */
+static void
+systemTime(struct timeval & tv, bool precise)
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clockid_t id = CLOCK_MONOTONIC;
+# ifdef CLOCK_MONOTONIC_COARSE
+  if(! precise)
+    id = CLOCK_MONOTONIC_COARSE;
+# endif // CLOCK_MONOTONIC_COARSE
+  if(clock_gettime(id, &ts) == 0)
+  {
+    tv.tv_sec = ts.tv_sec;
+    tv.tv_usec = ts.tv_nsec / 1000;
+    return;
+  }
+#endif // CLOCK_MONOTONIC
+  gettimeofday(&tv, 0);
+}
+
+NewNet::Clock::Clock() : m_Source(0)
+{
+  systemTime(m_Now, true);
+}
+
+const struct timeval &
+NewNet::Clock::update()
+{
+  read(false);
+  return m_Now;
+}
+
+const struct timeval &
+NewNet::Clock::precise()
+{
+  read(true);
+  return m_Now;
+}
+
+void
+NewNet::Clock::setSource(Source * source)
+{
+  m_Source = source;
+  if(m_Source)
+    m_Source->read(m_Now, true);
+  else
+    systemTime(m_Now, true);
+}
+
+void
+NewNet::Clock::read(bool precise)
+{
+  struct timeval tv;
+  if(m_Source)
+    m_Source->read(tv, precise);
+  else
+    systemTime(tv, precise);
+
+  /* A coarse reading can be behind the precise one taken just before */
+  if(timercmp(&tv, &m_Now, >))
+    m_Now = tv;
+}
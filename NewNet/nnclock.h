@@ -0,0 +1,123 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef NEWNET_CLOCK_H
+#define NEWNET_CLOCK_H
+
+#include "platform.h"
+
+namespace NewNet
+{
+  //! Monotonic time for timers and transfer rates.
+  /*! The clock keeps the time of the current reactor iteration, which the
+      reactor refreshes once per iteration. Everything measuring durations
+      should use it rather than gettimeofday(): it's cheaper and it doesn't
+      jump when the wall clock is set. The values only make sense relative
+      to each other, compare them with difftime(). */
+  class Clock
+  {
+  public:
+    //! Where the clock gets its time.
+    /*! Replace it with a MockClock to control time in tests. */
+    class Source
+    {
+    public:
+#ifndef DOXYGEN_UNDOCUMENTED
+      virtual ~Source() { }
+#endif // DOXYGEN_UNDOCUMENTED
+
+      //! Read the current time.
+      /*! A coarse reading may be a few milliseconds late but is much
+          cheaper than a precise one. */
+      virtual void read(struct timeval & tv, bool precise) = 0;
+    };
+
+    //! Constructor.
+    /*! Reads the system's monotonic clock. */
+    Clock();
+
+    //! Time of the current reactor iteration.
+    const struct timeval & now() const
+    {
+      return m_Now;
+    }
+
+    //! Refresh the cached time with a coarse reading.
+    /*! Called by the reactor at the start of every iteration. */
+    const struct timeval & update();
+
+    //! Refresh the cached time with a precise reading.
+    /*! Use this when a few milliseconds matter. */
+    const struct timeval & precise();
+
+    //! Replace the time source.
+    /*! Pass 0 to go back to the system clock. The source isn't owned by
+        the clock. Past readings mean nothing to the new source: the cached
+        time is reset to its current time. Otherwise the cached time never
+        goes backwards. */
+    void setSource(Source * source);
+
+  private:
+    void read(bool precise);
+
+    Source * m_Source;
+    struct timeval m_Now;
+  };
+
+  //! Time source for tests.
+  /*! Time only moves when you tell it to. It starts at one second, so a
+      zero timeval can still mean 'never'. */
+  class MockClock : public Clock::Source
+  {
+  public:
+    MockClock()
+    {
+      m_Now.tv_sec = 1;
+      m_Now.tv_usec = 0;
+    }
+
+    //! Move the time forward.
+    void advance(long ms)
+    {
+      m_Now.tv_sec += ms / 1000;
+      m_Now.tv_usec += (ms % 1000) * 1000;
+      if(m_Now.tv_usec >= 1000000)
+      {
+        m_Now.tv_sec += 1;
+        m_Now.tv_usec -= 1000000;
+      }
+    }
+
+#ifndef DOXYGEN_UNDOCUMENTED
+    void read(struct timeval & tv, bool)
+    {
+      tv = m_Now;
+    }
+#endif // DOXYGEN_UNDOCUMENTED
+
+  private:
+    struct timeval m_Now;
+  };
+
+  //! Global clock instance.
+  extern Clock clock;
+}
+
+#endif // NEWNET_CLOCK_H
@@ -23,6 +23,7 @@
 
 #include "nnobject.h"
 #include "nnrefptr.h"
+#include "nnsmallvector.h"
 #include <vector>
 #include <functional>
 #include <algorithm>
@@ -32,7 +33,9 @@ namespace NewNet
   //! Simple event dispatcher class.
   /*! The NewNet::Event class provides a simple and easy to use event
       aggregation solution. Callbacks can be registered to an event that
-      will be invoked upon emitting the event. */
+      will be invoked upon emitting the event. Emitting doesn't copy the
+      callback list: callbacks may connect or disconnect callbacks, or even
+      delete the event, while it is being emitted. */
   template<typename T> class Event : public Object
   {
   public:
@@ -62,16 +65,15 @@ namespace NewNet
       /* Callback was disconnected from an Event */
       void onDisconnected(Event * event)
       {
-        typename std::vector<Event *>::iterator it;
-        it = std::find(m_Events.begin(), m_Events.end(), event);
-        if (it != m_Events.end())
-            m_Events.erase(it);
+        size_t i = m_Events.find(event);
+        if (i != m_Events.size())
+            m_Events.erase(i);
       }
 #endif // DOXYGEN_UNDOCUMENTED
 
       //! Disconnect this callback from all events.
       /*! Calling this will result in the disconnection of the callback from
-          all the events it is registered to. Note: Events store a RefPtr to
+          all the events it is registered to. Note: Events hold a reference to
           the callbacks. The callback class might be deleted when
           disconnecting from all registered events. */
       void disconnect()
@@ -82,7 +84,7 @@ namespace NewNet
 
         /* Disconnect from all the events we're registered to */
         while(! m_Events.empty())
-          m_Events.front()->disconnect(this);
+          m_Events[0]->disconnect(this);
 
         /* Decrease the refrence count again and delete if necessary */
         if(--(this->refCounter()))
@@ -92,16 +94,83 @@ namespace NewNet
     private:
       /* Private copy constructor, you don't want this happening */
       Callback(const Callback &) { }
-      std::vector<Event *> m_Events;
+
+      /* Callbacks are nearly always connected to a single event */
+      SmallVector<Event *, 1> m_Events;
     };
 
   private:
 #ifndef DOXYGEN_UNDOCUMENTED
+    /* Blocks of Size bytes kept once freed, so connecting and disconnecting
+       methods over and over doesn't go through the heap every time. Every
+       thread has its own list: a block freed by another thread than the one
+       that allocated it just moves over. */
+    template<size_t Size> class Pool
+    {
+    public:
+      static void * allocate()
+      {
+        List & list = freeList();
+        Block * block = list.head;
+        if(! block)
+          return ::operator new(Size);
+        list.head = block->next;
+        --list.count;
+        return block;
+      }
+
+      static void release(void * p)
+      {
+        List & list = freeList();
+        if(list.count >= MaxBlocks)
+        {
+          ::operator delete(p);
+          return;
+        }
+        Block * block = static_cast<Block *>(p);
+        block->next = list.head;
+        list.head = block;
+        ++list.count;
+      }
+
+    private:
+      /* Past this many, freed blocks go back to the heap */
+      enum { MaxBlocks = 256 };
+
+      struct Block
+      {
+        Block * next;
+      };
+
+      struct List
+      {
+        List() : head(0), count(0) { }
+        ~List()
+        {
+          while(head)
+          {
+            Block * next = head->next;
+            ::operator delete(head);
+            head = next;
+          }
+        }
+        Block * head;
+        size_t count;
+      };
+
+      static List & freeList()
+      {
+        static thread_local List list;
+        return list;
+      }
+    };
+
     /* Callback to a method of a NewNet::Object */
     template<class ObjectType, typename MethodType> class BoundCallback : public Callback
     {
     private:
-      /* We use this to track deletion of our Object */
+      /* We use this to track deletion of our Object. It's a member so
+         binding a method costs a single allocation. */
       class GuardObjectCallback : public GuardObject::Callback
       {
       public:
@@ -117,15 +186,14 @@ namespace NewNet
       private:
         BoundCallback * m_Callback;
       };
-      GuardObjectCallback * m_GuardObjectCallback;
+      GuardObjectCallback m_GuardObjectCallback;
 
     public:
       BoundCallback(ObjectType * object, MethodType method)
-                   : m_Object(object), m_Method(method)
+                   : m_GuardObjectCallback(this), m_Object(object), m_Method(method)
       {
         /* Register to the Object's delete guard */
-        m_GuardObjectCallback = new GuardObjectCallback(this);
-        m_Object->guardObject() += m_GuardObjectCallback;
+        m_Object->guardObject() += &m_GuardObjectCallback;
       }
 
       ~BoundCallback()
@@ -133,18 +201,13 @@ namespace NewNet
         /* If the object is still valid, remove our delete callback from
            its delete guard */
         if(m_Object)
-          m_Object->guardObject() -= m_GuardObjectCallback;
-
-        delete m_GuardObjectCallback;
+          m_Object->guardObject() -= &m_GuardObjectCallback;
       }
 
       void operator()(T t)
       {
-        /* Since C++ methods are internally called as
-           Class::Method(object, ...), this results in a valid C++ bound
-           method call. */
         if(m_Object)
-          std::bind1st(std::mem_fun(m_Method), m_Object)(t);
+          (m_Object->*m_Method)(t);
       }
 
     protected:
@@ -156,9 +219,22 @@ namespace NewNet
         Callback::disconnect();
       }
 
+    public:
+      /* Bound callbacks come and go with connections, take them from the
+         pool of blocks of their size. */
+      static void * operator new(size_t)
+      {
+        return Pool<sizeof(BoundCallback)>::allocate();
+      }
+
+      static void operator delete(void * p)
+      {
+        Pool<sizeof(BoundCallback)>::release(p);
+      }
+
     private:
       /* Private copy constructor, you don't want this happening */
-      BoundCallback(const BoundCallback &) { }
+      BoundCallback(const BoundCallback &);
 
       ObjectType * m_Object;
       MethodType m_Method;
@@ -168,17 +244,18 @@ namespace NewNet
   public:
     //! Constructor.
     /*! Create a new event to which you can register callbacks. */
-    Event() { }
+    Event() : m_Connected(0), m_Emitting(0), m_Holes(false) { }
 
     //! Copy constructor.
     /*! When an event is copied, all the callbacks registered to the original
         event will also be connected to this event. */
-    Event(const Event & that)
+    Event(const Event & that) : Object(that), m_Connected(0), m_Emitting(0), m_Holes(false)
     {
-      typename std::vector<RefPtr<Callback> >::const_iterator it, end;
-      end = that.m_Callbacks.end();
-      for(it = that.m_Callbacks.begin(); it != end; ++it)
-        connect(*it);
+      for(size_t i = 0; i < that.m_Callbacks.size(); ++i)
+      {
+        if(that.m_Callbacks[i])
+          connect(that.m_Callbacks[i]);
+      }
     }
 
     //! Destructor.
@@ -187,26 +264,48 @@ namespace NewNet
     {
       /* Disconnect all Callbacks */
       clear();
+
+      /* Tell operator() to stop touching us */
+      if(m_Emitting)
+        *m_Emitting = true;
     }
 
     //! Empty the event callback list.
     /*! Call this to remove all the callbacks from this event. Note: the
-        event stores a RefPtr to all the callbacks registered. Clearing the
-        event may delete the callback if there are no other references to
-        it. */
+        event stores a reference to all the callbacks registered. Clearing
+        the event may delete the callback if there are no other references
+        to it. */
     void clear()
     {
-      while(! m_Callbacks.empty())
-        disconnect(m_Callbacks.front());
+      for(size_t i = 0; i < m_Callbacks.size(); )
+      {
+        /* Disconnecting might remove the entry or leave a hole */
+        if(m_Callbacks[i])
+          disconnect(m_Callbacks[i]);
+        else
+          ++i;
+      }
+    }
+
+    //! Determine if the event has callbacks.
+    /*! Returns true if no callback is connected to this event. Emitters can
+        use this to skip building expensive arguments nobody will see. */
+    bool empty() const
+    {
+      return m_Connected == 0;
     }
 
     //! Connect a callback to the event.
     /*! Add a callback to this event so that it will get invoked when the
-        event is emitted. Note: stores a RefPtr to the callback. */
+        event is emitted. Callbacks connected while the event is emitted
+        are invoked from the next emission on. Note: holds a reference to
+        the callback. */
     Callback * connect(Callback * callback)
     {
-      /* Push a RefPtr to the Callback to our list */
+      /* Hold a reference to the Callback in our list */
+      ++(callback->refCounter());
       m_Callbacks.push_back(callback);
+      ++m_Connected;
 
       /* Notify the Callback that it's connected to us */
       callback->onConnected(this);
@@ -216,7 +315,8 @@ namespace NewNet
 
     //! Create a callback to a bound method.
     /*! This will construct a callback object that will invoke a method
-        of an object. */
+        of an object. Its memory comes from a per thread pool, once a
+        callback of the same size was deleted binding doesn't allocate. */
     template<class ObjectType, typename MethodType>
     static Callback * bind(ObjectType * object, MethodType method)
     {
@@ -225,7 +325,7 @@ namespace NewNet
 
     //! Connect callback to a method of an object to the event.
     /*! Add a callback to a method of an object so that it will get
-        invoked when the event is emitted. Note: stores a RefPtr to the newly
+        invoked when the event is emitted. Note: holds a reference to the newly
         created callback. */
     template<class ObjectType, typename MethodType>
     Callback * connect(ObjectType * object, MethodType method)
@@ -234,20 +334,32 @@ namespace NewNet
     }
 
     //! Disconnect a callback from the event.
-    /*! Remove a callback from the invocation list. Note: the event stores
-        a RefPtr to the callback. If the event holds the last RefPtr, the
-        callback will be deleted. */
+    /*! Remove a callback from the invocation list. A callback disconnected
+        while the event is emitted isn't invoked anymore, even if its turn
+        didn't come yet. Note: the event holds a reference to the callback.
+        If the event holds the last reference, the callback will be
+        deleted. */
     void disconnect(Callback * callback)
     {
       /* Artificially increase the reference count so it doesn't get deleted
          prematurely */
       ++(callback->refCounter());
 
-      /* Delete the Callback from our list */
-      typename std::vector<RefPtr<Callback> >::iterator it;
-      it = std::find(m_Callbacks.begin(), m_Callbacks.end(), callback);
-      if (it != m_Callbacks.end())
-        m_Callbacks.erase(it);
+      /* Delete the Callback from our list. While emitting, operator() is
+         walking the list: leave a hole, it is compacted afterwards. */
+      size_t i = m_Callbacks.find(callback);
+      if (i != m_Callbacks.size())
+      {
+        if(m_Emitting)
+        {
+          m_Callbacks[i] = 0;
+          m_Holes = true;
+        }
+        else
+          m_Callbacks.erase(i);
+        --m_Connected;
+        --(callback->refCounter());
+      }
 
       /* Notify the Callback it was disconnected */
       callback->onDisconnected(this);
@@ -263,16 +375,49 @@ namespace NewNet
         registered callbacks. */
     void operator()(T t)
     {
-      std::vector<RefPtr<Callback> > callbacks(m_Callbacks);
-      typename std::vector<RefPtr<Callback> >::iterator it, end = callbacks.end();
-      for(it = callbacks.begin(); it != end; ++it)
+      /* Emissions can nest. Each one gets a flag the destructor raises so
+         none of them touches the event once it's gone. */
+      bool deleted = false;
+      bool * outer = m_Emitting;
+      m_Emitting = &deleted;
+
+      /* Only invoke the callbacks that were there when we started */
+      size_t count = m_Callbacks.size();
+      for(size_t i = 0; i < count; ++i)
+      {
+        Callback * callback = m_Callbacks[i];
+        if(! callback)
+          continue;
+
+        /* Keep the callback alive while it runs, it may disconnect */
+        RefPtr<Callback> guard(callback);
+        (*callback)(t);
+
+        if(deleted)
+        {
+          if(outer)
+            *outer = true;
+          return;
+        }
+      }
+
+      m_Emitting = outer;
+      if(! m_Emitting && m_Holes)
       {
-        (*(*it))(t);
+        m_Callbacks.removeAll(0);
+        m_Holes = false;
       }
     }
 
   private:
-    std::vector<RefPtr<Callback> > m_Callbacks;
+    /* Events can't be assigned, copy construct them instead */
+    Event & operator=(const Event &);
+
+    /* Most events have one or two listeners */
+    SmallVector<Callback *, 2> m_Callbacks;
+    size_t m_Connected;
+    bool * m_Emitting;
+    bool m_Holes;
   };
 }
 
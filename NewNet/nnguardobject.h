@@ -21,6 +21,7 @@
 #ifndef NEWNET_GUARDOBJECT_H
 #define NEWNET_GUARDOBJECT_H
 
+#include "nnsmallvector.h"
 #include <vector>
 #include <algorithm>
 
@@ -58,11 +59,20 @@ namespace NewNet
     }
 
 #ifndef DOXYGEN_UNDOCUMENTED
+    /* Callbacks belong to the guarded object, copies start out empty */
+    GuardObject(const GuardObject &)
+    {
+    }
+
+    GuardObject & operator=(const GuardObject &)
+    {
+      return *this;
+    }
+
     void emit(Object * p)
     {
-      std::vector<Callback *>::iterator it, end = m_Callbacks.end();
-      for(it = m_Callbacks.begin(); it != end; ++it)
-        (*it)->operator()(p);
+      for(size_t i = 0; i < m_Callbacks.size(); ++i)
+        m_Callbacks[i]->operator()(p);
     }
 #endif // DOXYGEN_UNDOCUMENTED
 
@@ -83,16 +93,16 @@ namespace NewNet
         automatically. */
     GuardObject & operator-=(Callback * p)
     {
-      std::vector<Callback *>::iterator it;
-      it = std::find(m_Callbacks.begin(), m_Callbacks.end(), p);
-      if (it != m_Callbacks.end())
-        m_Callbacks.erase(it);
+      size_t i = m_Callbacks.find(p);
+      if (i != m_Callbacks.size())
+        m_Callbacks.erase(i);
 
       return *this;
     }
 
   private:
-    std::vector<Callback *> m_Callbacks;
+    /* Most objects are only watched by the callbacks bound to them */
+    SmallVector<Callback *, 1> m_Callbacks;
   };
 }
 
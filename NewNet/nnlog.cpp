@@ -19,58 +19,112 @@
  */
 
 #include "nnlog.h"
+#include "nnlogsink.h"
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <algorithm>
 
 NewNet::Log NewNet::log;
 
+NewNet::Log::Domain::Domain(const char * name) : m_Id(NewNet::log.registerDomain(name))
+{
+}
+
 void NewNet::Log::operator()(const std::string & domain, const char * fmt, ...)
 {
-  bool enabled = std::find(m_EnabledDomains.begin(), m_EnabledDomains.end(), domain) != m_EnabledDomains.end();
-  if(! (enabled || m_AllEnabled))
+  if(! enabled(Domain(domain.c_str())))
     return;
 
-  int size = 100;
-  char * p, * np;
-  if((p = (char *)malloc(size)) == 0)
+  va_list ap;
+  va_start(ap, fmt);
+  print(domain, fmt, ap);
+  va_end(ap);
+}
+
+void NewNet::Log::operator()(const Domain & domain, const char * fmt, ...)
+{
+  if(! enabled(domain))
     return;
 
-  while(1)
+  va_list ap;
+  va_start(ap, fmt);
+  print(m_DomainNames[domain.id()], fmt, ap);
+  va_end(ap);
+}
+
+void NewNet::Log::print(const std::string & domain, const char * fmt, va_list ap)
+{
+  // Nearly every message fits here, only longer ones need the heap.
+  char buf[512];
+  char * p = buf;
+  va_list aq;
+  va_copy(aq, ap);
+  int n = vsnprintf(buf, sizeof(buf), fmt, aq);
+  va_end(aq);
+  if(n < 0)
+    return;
+  if(n >= (int)sizeof(buf))
   {
-    va_list ap;
-    va_start(ap, fmt);
-    int n = vsnprintf(p, size, fmt, ap);
-    va_end(ap);
-    if(n > -1 && n < size)
-    {
-      LogNotify notice;
-      notice.domain = domain;
-      notice.message = p;
-      logEvent(&notice);
-      free(p);
+    if((p = (char *)malloc(n + 1)) == 0)
       return;
-    }
-    if(n > -1)
-      size = n + 1;
-    else
-      size *= 2;
-    if((np = (char *)realloc(p, size)) == 0)
-    {
-      free(p);
-      return;
-    }
-    else
-      p = np;
+    va_copy(aq, ap);
+    vsnprintf(p, n + 1, fmt, aq);
+    va_end(aq);
+  }
+
+  if(m_Sink)
+    m_Sink->push(domain, p, n);
+
+  if(! logEvent.empty())
+  {
+    LogNotify notice;
+    notice.domain = domain;
+    notice.message.assign(p, n);
+    logEvent(&notice);
   }
+
+  if(p != buf)
+    free(p);
+}
+
+unsigned int NewNet::Log::registerDomain(const std::string & domain)
+{
+  std::map<std::string, unsigned int>::const_iterator it = m_DomainIds.find(domain);
+  if(it != m_DomainIds.end())
+    return it->second;
+
+  unsigned int id = m_DomainNames.size();
+  m_DomainIds[domain] = id;
+  m_DomainNames.push_back(domain);
+  if((id >> 5) >= m_Mask.size())
+    m_Mask.push_back(0);
+  update(id);
+  return id;
+}
+
+/* Recompute the enabled bit of a domain. */
+void NewNet::Log::update(unsigned int id)
+{
+  bool enabled = m_AllEnabled || std::find(m_EnabledDomains.begin(), m_EnabledDomains.end(), m_DomainNames[id]) != m_EnabledDomains.end();
+  if(enabled)
+    m_Mask[id >> 5] |= (1u << (id & 31));
+  else
+    m_Mask[id >> 5] &= ~(1u << (id & 31));
 }
 
 void NewNet::Log::enable(const std::string & domain)
 {
   if(domain == "ALL")
+  {
     m_AllEnabled = true;
-  else if(std::find(m_EnabledDomains.begin(), m_EnabledDomains.end(), domain) == m_EnabledDomains.end())
+    for(unsigned int id = 0; id < m_DomainNames.size(); ++id)
+      update(id);
+    return;
+  }
+  if(std::find(m_EnabledDomains.begin(), m_EnabledDomains.end(), domain) == m_EnabledDomains.end())
     m_EnabledDomains.push_back(domain);
+  update(registerDomain(domain));
 }
 
 void NewNet::Log::disable(const std::string & domain)
@@ -78,10 +132,13 @@ void NewNet::Log::disable(const std::string & domain)
   if(domain == "ALL")
   {
     m_AllEnabled = false;
+    for(unsigned int id = 0; id < m_DomainNames.size(); ++id)
+      update(id);
     return;
   }
   std::vector<std::string>::iterator it;
   it = std::find(m_EnabledDomains.begin(), m_EnabledDomains.end(), domain);
   if(it != m_EnabledDomains.end())
     m_EnabledDomains.erase(it);
+  update(registerDomain(domain));
 }
@@ -23,11 +23,16 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <iostream>
+#include <stdarg.h>
+#include <stdint.h>
 #include "nnevent.h"
 
 namespace NewNet
 {
+  class AsyncLogSink;
+
   //! Controllable logging class
   /*! This class will let you output messages to the console in a controlled
       fashion. It works by enabling and disabling domains where events
@@ -40,10 +45,34 @@ namespace NewNet
       std::string message;
     } LogNotify;
 
+    //! A registered message domain.
+    /*! Domains are registered once and get a small integer identifier.
+        Checking if one is enabled is then a single bit test. The NNLOG
+        macro keeps one of these per call site. */
+    class Domain
+    {
+    public:
+      //! Register a domain with the global logger.
+      explicit Domain(const char * name);
+
+      //! The identifier of the domain.
+      unsigned int id() const
+      {
+        return m_Id;
+      }
+
+    private:
+      unsigned int m_Id;
+    };
+
     //! Print a message.
     /*! Print a message if the specified domain is enabled. */
     void operator() (const std::string & domain, const char*, ...);
 
+    //! Print a message.
+    /*! Print a message if the specified domain is enabled. */
+    void operator() (const Domain & domain, const char*, ...);
+
     //! Enable a message domain.
     /*! This will enable printing messages of that domain. A special
         case is 'ALL' in which case all messages will be printed. */
@@ -53,14 +82,43 @@ namespace NewNet
     /*! This will disable printing messages of that domain. */
     void disable(const std::string & domain);
 
+    //! Determine if a domain is enabled.
+    /*! Returns true if messages of that domain will be printed. */
+    bool enabled(const Domain & domain) const
+    {
+      return (m_Mask[domain.id() >> 5] >> (domain.id() & 31)) & 1;
+    }
+
+    //! Register a message domain.
+    /*! Returns the identifier of the domain, registering it first if
+        needed. */
+    unsigned int registerDomain(const std::string & domain);
+
+    //! Set the asynchronous output.
+    /*! Messages in enabled domains are queued to the sink before logEvent
+        is emitted. Pass 0 to detach it. The sink isn't owned by the
+        logger. */
+    void setSink(AsyncLogSink * sink)
+    {
+      m_Sink = sink;
+    }
+
     //! Invoked when a message is logged.
     /*! This will be invoked when a message is logged in a domain that's
-        enabled. */
+        enabled. Callbacks run synchronously in the thread that logs, keep
+        them cheap or prefer an AsyncLogSink. */
     NewNet::Event<const LogNotify *> logEvent;
 
   private:
+    void print(const std::string & domain, const char * fmt, va_list ap);
+    void update(unsigned int id);
+
     bool m_AllEnabled;
+    AsyncLogSink * m_Sink;
     std::vector<std::string> m_EnabledDomains;
+    std::map<std::string, unsigned int> m_DomainIds;
+    std::vector<std::string> m_DomainNames;
+    std::vector<uint32_t> m_Mask;
   };
 
   //! Console output class.
@@ -78,11 +136,20 @@ namespace NewNet
   };
 
   //! Global logger instance.
-  /*! Global logger instance, you can also reference this using the convenient
-      NNLOG preprocessor definition. */
+  /*! Global logger instance. Use the NNLOG macro to print messages. */
   extern Log log;
 }
 
-#define NNLOG NewNet::log
+//! Print a message to the global logger.
+/*! The domain has to be a string literal, it's registered the first time
+    the call site is reached. When the domain is disabled the arguments
+    aren't evaluated at all. */
+#define NNLOG(domain, ...) \
+  do \
+  { \
+    static const NewNet::Log::Domain nnlogDomain(domain); \
+    if(NewNet::log.enabled(nnlogDomain)) \
+      NewNet::log(nnlogDomain, __VA_ARGS__); \
+  } while(0)
 
 #endif // NEWNET_LOG_H
@@ -0,0 +1,196 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#include "nnlogsink.h"
+#include "platform.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Longest domain stored in a slot, the rest is for the message. */
+#define MAX_DOMAIN 64
+/* Most messages written out in one go. */
+#define MAX_BATCH 256
+
+NewNet::AsyncLogSink::AsyncLogSink(int fd, size_t slots) : m_Fd(fd), m_Tail(0), m_Head(0),
+  m_Dropped(0), m_ReportedDropped(0), m_Idle(false), m_Stop(false), m_Written(0)
+{
+  size_t n = 1;
+  while(n < slots)
+    n <<= 1;
+  m_Slots = new Slot[n];
+  m_Mask = n - 1;
+  // Vyukov's bounded queue: a slot is free for position p when its
+  // sequence is p, and holds a message once its sequence is p + 1.
+  for(size_t i = 0; i < n; ++i)
+    m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+
+  m_Thread = std::thread(&AsyncLogSink::run, this);
+}
+
+NewNet::AsyncLogSink::~AsyncLogSink()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stop.store(true, std::memory_order_release);
+  }
+  m_Wakeup.notify_one();
+  m_Thread.join();
+  delete [] m_Slots;
+}
+
+bool
+NewNet::AsyncLogSink::push(const std::string & domain, const char * message, size_t length)
+{
+  size_t pos = m_Tail.load(std::memory_order_relaxed);
+  Slot * slot;
+  while(true)
+  {
+    slot = &m_Slots[pos & m_Mask];
+    size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+    if(diff == 0)
+    {
+      if(m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if(diff < 0)
+    {
+      // The writer hasn't caught up, don't wait for it.
+      m_Dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+      pos = m_Tail.load(std::memory_order_relaxed);
+  }
+
+  size_t domainLength = domain.size() < MAX_DOMAIN ? domain.size() : MAX_DOMAIN;
+  size_t textLength = length < SlotText - domainLength ? length : SlotText - domainLength;
+  memcpy(slot->text, domain.data(), domainLength);
+  memcpy(slot->text + domainLength, message, textLength);
+  slot->domainLength = domainLength;
+  slot->textLength = textLength;
+  slot->sequence.store(pos + 1, std::memory_order_release);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if(m_Idle.load(std::memory_order_relaxed))
+    m_Wakeup.notify_one();
+  return true;
+}
+
+void
+NewNet::AsyncLogSink::flush()
+{
+  size_t target = m_Tail.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_Wakeup.notify_one();
+  while(m_Written.load(std::memory_order_acquire) < target)
+    m_Drained.wait(lock);
+}
+
+bool
+NewNet::AsyncLogSink::ready() const
+{
+  const Slot & slot = m_Slots[m_Head & m_Mask];
+  return slot.sequence.load(std::memory_order_acquire) == m_Head + 1;
+}
+
+/* Format up to MAX_BATCH queued messages and release their slots. */
+bool
+NewNet::AsyncLogSink::drain(std::string & out)
+{
+  unsigned long dropped = m_Dropped.load(std::memory_order_relaxed);
+  if(dropped != m_ReportedDropped)
+  {
+    char notice[64];
+    snprintf(notice, sizeof(notice), "[newnet.log] %lu messages dropped\n", dropped - m_ReportedDropped);
+    out += notice;
+    m_ReportedDropped = dropped;
+  }
+
+  for(int i = 0; i < MAX_BATCH && ready(); ++i)
+  {
+    Slot & slot = m_Slots[m_Head & m_Mask];
+    out += '[';
+    out.append(slot.text, slot.domainLength);
+    out += "] ";
+    out.append(slot.text + slot.domainLength, slot.textLength);
+    out += '\n';
+    slot.sequence.store(m_Head + m_Mask + 1, std::memory_order_release);
+    ++m_Head;
+  }
+
+  return ! out.empty();
+}
+
+void
+NewNet::AsyncLogSink::write(const std::string & out)
+{
+  size_t done = 0;
+  while(done < out.size())
+  {
+    ssize_t n = ::write(m_Fd, out.data() + done, out.size() - done);
+    if(n < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      return;
+    }
+    done += n;
+  }
+}
+
+void
+NewNet::AsyncLogSink::run()
+{
+  std::string out;
+  out.reserve(MAX_BATCH * 128);
+
+  while(true)
+  {
+    bool stop = m_Stop.load(std::memory_order_acquire);
+
+    if(drain(out))
+    {
+      write(out);
+      out.clear();
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Written.store(m_Head, std::memory_order_release);
+    }
+    m_Drained.notify_all();
+
+    if(stop)
+      break;
+
+    // Producers only signal when we say we're idle. Check the ring once more
+    // after saying so, and don't sleep for long in case a signal was missed.
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Idle.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(! ready() && ! m_Stop.load(std::memory_order_acquire))
+      m_Wakeup.wait_for(lock, std::chrono::milliseconds(100));
+    m_Idle.store(false, std::memory_order_relaxed);
+  }
+}
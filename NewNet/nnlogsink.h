@@ -0,0 +1,102 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef NEWNET_LOGSINK_H
+#define NEWNET_LOGSINK_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <stddef.h>
+
+namespace NewNet
+{
+  //! Asynchronous log output.
+  /*! Messages are copied into a preallocated ring buffer and written to a
+      file descriptor by a background thread, so the thread logging never
+      blocks on the output. Any thread may push messages. When the ring is
+      full messages are dropped and the number of lost messages is written
+      out once there's room again. Attach it with Log::setSink(). */
+  class AsyncLogSink
+  {
+  public:
+    //! Size of the text stored in a ring slot.
+    /*! Longer messages are truncated. */
+    static const size_t SlotText = 496;
+
+    //! Constructor.
+    /*! Start a writer thread for the file descriptor. The number of slots
+        is rounded up to a power of two. The descriptor isn't closed by the
+        sink. */
+    AsyncLogSink(int fd, size_t slots = 1024);
+
+    //! Destructor.
+    /*! Writes out all pending messages and stops the writer thread. Detach
+        the sink from the logger first. */
+    ~AsyncLogSink();
+
+    //! Queue a message.
+    /*! Copy a message into the ring buffer. This never allocates and never
+        blocks. Returns false if the message was dropped. */
+    bool push(const std::string & domain, const char * message, size_t length);
+
+    //! Wait until every queued message is written.
+    void flush();
+
+    //! Number of messages dropped so far because the ring was full.
+    unsigned long dropped() const
+    {
+      return m_Dropped.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Slot
+    {
+      std::atomic<size_t> sequence;
+      unsigned short domainLength;
+      unsigned short textLength;
+      char text[SlotText];
+    };
+
+    void run();
+    bool ready() const;
+    bool drain(std::string & out);
+    void write(const std::string & out);
+
+    int m_Fd;
+    Slot * m_Slots;
+    size_t m_Mask;
+    std::atomic<size_t> m_Tail;
+    size_t m_Head;
+    std::atomic<unsigned long> m_Dropped;
+    unsigned long m_ReportedDropped;
+    std::atomic<bool> m_Idle;
+    std::atomic<bool> m_Stop;
+    std::atomic<size_t> m_Written;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wakeup;
+    std::condition_variable m_Drained;
+    std::thread m_Thread;
+  };
+}
+
+#endif // NEWNET_LOGSINK_H
@@ -0,0 +1,83 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+
+#include "nnnotifier.h"
+#include "nnlog.h"
+#include "platform.h"
+#include "util.h"
+#include <errno.h>
+
+NewNet::Notifier::Notifier() : m_WriteFD(-1)
+{
+#ifndef WIN32
+  int fds[2];
+  if(::pipe(fds) == -1)
+  {
+    NNLOG("newnet.net.warn", "Couldn't create a notifier pipe (errno: %i).", errno);
+    return;
+  }
+  if(! setnonblocking(fds[0]) || ! setnonblocking(fds[1]))
+    NNLOG("newnet.net.warn", "Couldn't set notifier pipe to non blocking (errno: %i)", errno);
+
+  m_WriteFD = fds[1];
+  setDescriptor(fds[0]);
+  /* The reactor watches listening sockets for reading. */
+  setSocketState(SocketListening);
+#endif // WIN32
+}
+
+NewNet::Notifier::~Notifier()
+{
+#ifndef WIN32
+  if(descriptor() != -1)
+    ::close(descriptor());
+  if(m_WriteFD != -1)
+    ::close(m_WriteFD);
+#endif // WIN32
+}
+
+void
+NewNet::Notifier::notify()
+{
+#ifndef WIN32
+  /* When the pipe is full the reactor will wake up anyway. */
+  char c = 0;
+  if(m_WriteFD != -1)
+    while(::write(m_WriteFD, &c, 1) == -1 && errno == EINTR)
+      ;
+#endif // WIN32
+}
+
+void
+NewNet::Notifier::process()
+{
+#ifndef WIN32
+  if(! (readyState() & StateReceive))
+    return;
+
+  char buf[256];
+  while(::read(descriptor(), buf, sizeof(buf)) > 0)
+    ;
+  setReadyState(readyState() & ~StateReceive);
+#endif // WIN32
+
+  notifiedEvent(this);
+}
@@ -0,0 +1,70 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+
+#ifndef NEWNET_NOTIFIER_H
+#define NEWNET_NOTIFIER_H
+
+#include "nnsocket.h"
+#include "nnevent.h"
+
+namespace NewNet
+{
+  //! Wakes the reactor up from another thread.
+  /*! A notifier is a socket watching the reading end of a pipe. Other
+      threads (or signal handlers) call notify(), which writes a byte to the
+      pipe, and the reactor emits notifiedEvent from its own thread at the
+      next iteration. Several notifications may be folded in one event.
+      Add it to the reactor like any other socket. Not available on win32,
+      check valid(). */
+  class Notifier : public Socket
+  {
+  public:
+    //! Constructor.
+    /*! Creates the pipe. */
+    Notifier();
+
+#ifndef DOXYGEN_UNDOCUMENTED
+    ~Notifier();
+#endif // DOXYGEN_UNDOCUMENTED
+
+    //! Returns true if the pipe could be created.
+    bool valid() const
+    {
+      return descriptor() != -1;
+    }
+
+    //! Wake the reactor up.
+    /*! Safe to call from any thread and from signal handlers. */
+    void notify();
+
+    //! Processor function.
+    /*! Empties the pipe and emits notifiedEvent. */
+    virtual void process();
+
+    //! Emitted in the reactor thread after notify() was called.
+    Event<Notifier *> notifiedEvent;
+
+  private:
+    int m_WriteFD;
+  };
+}
+
+#endif // NEWNET_NOTIFIER_H
@@ -19,6 +19,7 @@
  */
 
 #include "nnratelimiter.h"
+#include "nnclock.h"
 #include "platform.h"
 #include "util.h"
 
@@ -54,9 +55,7 @@ NewNet::RateLimiter::~RateLimiter()
 void
 NewNet::RateLimiter::transferred(ssize_t n)
 {
-  struct timeval now;
-  gettimeofday(&now, 0);
-  m_Data->rateData.push_back(RateData(now, n));
+  m_Data->rateData.push_back(RateData(NewNet::clock.now(), n));
 }
 
 #ifndef timercmp
@@ -70,8 +69,7 @@ void
 NewNet::RateLimiter::flush()
 {
   /* Flush all entries that are older than MAX_HISTORY second(s) */
-  struct timeval tv;
-  gettimeofday(&tv, 0);
+  struct timeval tv = NewNet::clock.now();
   tv.tv_sec -= MAX_HISTORY;
   while((! m_Data->rateData.empty()) && timercmp(&tv, &m_Data->rateData.front().first, >))
     m_Data->rateData.erase(m_Data->rateData.begin());
@@ -96,13 +94,10 @@ NewNet::RateLimiter::nextWindow()
     {
       /* Rate limit will be 'unbreached' one second after this frame. */
 
-      struct timeval now;
-      gettimeofday(&now, 0);
-
       struct timeval tv((*it).first);
       tv.tv_sec += 1;
 
-      long d = difftime(tv, now);
+      long d = difftime(tv, NewNet::clock.now());
       if(d <= 0)
         return 0;
       else
@@ -59,6 +59,8 @@ NewNet::Reactor::Reactor()
     NNLOG("newnet.net.debug", "%i file descriptors available for museekd.", m_maxSocketNo);
 
     event_init();
+    // prepareReactorData() deletes the previous timer before arming it again.
+    evtimer_set(&mEvTimeout, ::eventCallback, this);
 }
 
 #ifndef DOXYGEN_UNDOCUMENTED
@@ -80,8 +82,7 @@ NewNet::Reactor::checkTimeouts(struct timeval & timeout, bool & timeout_set)
 {
   bool retVal = false;
 
-  struct timeval now;
-  gettimeofday(&now, 0);
+  const struct timeval & now = NewNet::clock.now();
 
   std::vector<TimeoutItem>::iterator it;
 
@@ -94,7 +95,6 @@ NewNet::Reactor::checkTimeouts(struct timeval & timeout, bool & timeout_set)
     if(timercmp(&now, &(*it).first, >=))
     {
       // Calculate how long the timeout is overdue
-      gettimeofday(&now, 0);
       unsigned long diff = difftime(now, (*it).first);
 
       // Store the timeout callback and delete it from to-be-emitted list
@@ -178,6 +178,9 @@ void NewNet::Reactor::run()
 
     bool loop = true;
     while (loop) {
+        // Read the clock once for the whole iteration
+        NewNet::clock.update();
+        flushSockets();
         loop = prepareReactorData();
     }
 
@@ -203,8 +206,7 @@ NewNet::Reactor::prepareReactorData() {
     {
       /* We know when we need to wake up, but how many sec/usec from
          now is that? */
-      struct timeval now;
-      gettimeofday(&now, 0);
+      const struct timeval & now = NewNet::clock.now();
       timeout.tv_sec -= now.tv_sec;
       timeout.tv_usec -= now.tv_usec;
       if(timeout.tv_usec < 0)
@@ -237,6 +239,8 @@ NewNet::Reactor::eventCallback(int fd, short event, void *arg) {
 
     bool loop = true;
     while (loop) {
+        NewNet::clock.update();
+
         /* Make a copy of our socket list, as they might disappear because of
            events that occur and then our iterators go berserk */
         std::vector<RefPtr<Socket> > sockets(m_Sockets);
@@ -266,6 +270,7 @@ NewNet::Reactor::eventCallback(int fd, short event, void *arg) {
             }
         }
 
+        flushSockets();
         loop = prepareReactorData();
     }
 }
@@ -355,6 +360,28 @@ NewNet::Reactor::checkSockets(struct timeval & timeout, bool & timeout_set) {
     }
 }
 
+void
+NewNet::Reactor::scheduleFlush(Socket * socket)
+{
+  m_FlushQueue.push_back(socket);
+}
+
+void
+NewNet::Reactor::flushSockets()
+{
+  /* Flushing may emit events that queue more data, those sockets will be
+     flushed by the next pass. */
+  while(! m_FlushQueue.empty())
+  {
+    std::vector<RefPtr<Socket> > sockets;
+    sockets.swap(m_FlushQueue);
+
+    std::vector<RefPtr<Socket> >::iterator it, end = sockets.end();
+    for(it = sockets.begin(); it != end; ++it)
+      (*it)->flush();
+  }
+}
+
 void
 NewNet::Reactor::stop()
 {
@@ -365,8 +392,7 @@ NewNet::Reactor::Timeout::Callback *
 NewNet::Reactor::addTimeout(long msec, Timeout::Callback * callback)
 {
   // Calculate when the event has to occur
-  struct timeval tv;
-  gettimeofday(&tv, 0);
+  struct timeval tv = NewNet::clock.now();
   tv.tv_sec += (msec / 1000);
   tv.tv_usec += (msec % 1000) * 1000;
   if(tv.tv_usec >= 1000000)
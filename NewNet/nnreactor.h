@@ -25,6 +25,7 @@
 #include "nnsocket.h"
 #include "nnrefptr.h"
 #include "nnevent.h"
+#include "nnclock.h"
 #include "util.h"
 #include <vector>
 #include <event.h>
@@ -33,8 +34,7 @@
    sooner than the current timeout, or if no timeout has been set yet. */
 inline void fixtime(struct timeval & timeout, long ms, bool & timeout_set)
 {
-  struct timeval now;
-  gettimeofday(&now, 0);
+  const struct timeval & now = NewNet::clock.now();
   if((! timeout_set) || (difftime(timeout, now) > ms))
   {
     timeout.tv_sec = now.tv_sec + (ms / 1000);
@@ -115,6 +115,13 @@ namespace NewNet
         and frees the RefPtr on the callback object. */
     void removeTimeout(Timeout::Callback * callback);
 
+    //! Flush a socket at the end of the current loop iteration.
+    /*! Sockets call this when data is queued for sending. All the data
+        queued during an iteration is then written together by calling
+        Socket::flush() once the reactor is done processing events. Note:
+        stores a RefPtr to the socket until it is flushed. */
+    void scheduleFlush(Socket * socket);
+
     //! Returns the maximum number of sockets that can be opened
     /*! On linux this is usually 1024 */
     int maxSocketNo();
@@ -125,6 +132,12 @@ namespace NewNet
     //! Returns the highest file descriptor currently used
     int maxFileDescriptor();
 
+    //! Returns the sockets watched by the reactor
+    const std::vector<RefPtr<Socket> > & sockets() const
+    {
+      return m_Sockets;
+    }
+
     //! Invoked by libevent when a socket wakes up
     /*! Invoked by libevent when a socket wakes up */
     void eventCallback(int, short, void *);
@@ -141,6 +154,10 @@ namespace NewNet
     /*! Check for timeouts and emit needed actions. Set up next reactor wake up. */
     bool checkTimeouts(struct timeval & timeout, bool & timeout_set);
 
+    //! Flush the sockets that queued data during this iteration.
+    /*! Flush the sockets that queued data during this iteration. */
+    void flushSockets();
+
     //! Set up every data needed for the next reactor cycle.
     /*! Set up every data needed for the next reactor cycle. */
     bool prepareReactorData();
@@ -148,6 +165,7 @@ namespace NewNet
     int m_maxSocketNo;
     int m_maxFD;
     std::vector<RefPtr<Socket> > m_Sockets;
+    std::vector<RefPtr<Socket> > m_FlushQueue;
 
 #ifndef DOXYGEN_UNDOCUMENTED
     struct Timeouts;
@@ -0,0 +1,143 @@
+/*  NewNet - A networking framework in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef NEWNET_SMALLVECTOR_H
+#define NEWNET_SMALLVECTOR_H
+
+#include <stddef.h>
+
+namespace NewNet
+{
+  //! Array of pointers with inline storage.
+  /*! Stores up to N elements inside the object itself and only goes to the
+      heap when it grows past that. Meant for the callback lists of events
+      and guard objects, which nearly always hold one or two pointers. Only
+      use it with plain types such as pointers: elements are copied with
+      assignment and never destroyed. */
+  template<typename T, size_t N> class SmallVector
+  {
+  public:
+    //! Create an empty array.
+    SmallVector() : m_Data(m_Inline), m_Size(0), m_Capacity(N)
+    {
+    }
+
+#ifndef DOXYGEN_UNDOCUMENTED
+    ~SmallVector()
+    {
+      if(m_Data != m_Inline)
+        delete [] m_Data;
+    }
+#endif // DOXYGEN_UNDOCUMENTED
+
+    //! Number of elements.
+    size_t size() const
+    {
+      return m_Size;
+    }
+
+    //! Returns true if there are no elements.
+    bool empty() const
+    {
+      return m_Size == 0;
+    }
+
+    //! Access an element.
+    T & operator[](size_t i)
+    {
+      return m_Data[i];
+    }
+
+    //! Access an element.
+    const T & operator[](size_t i) const
+    {
+      return m_Data[i];
+    }
+
+    //! Append an element.
+    void push_back(const T & t)
+    {
+      if(m_Size == m_Capacity)
+        grow();
+      m_Data[m_Size++] = t;
+    }
+
+    //! Position of the first element equal to t.
+    /*! Returns size() if there is none. */
+    size_t find(const T & t) const
+    {
+      size_t i = 0;
+      while(i < m_Size && ! (m_Data[i] == t))
+        ++i;
+      return i;
+    }
+
+    //! Remove the element at position i.
+    /*! Following elements are moved down one position. */
+    void erase(size_t i)
+    {
+      for(--m_Size; i < m_Size; ++i)
+        m_Data[i] = m_Data[i + 1];
+    }
+
+    //! Remove every element equal to t.
+    void removeAll(const T & t)
+    {
+      size_t j = 0;
+      for(size_t i = 0; i < m_Size; ++i)
+      {
+        if(! (m_Data[i] == t))
+          m_Data[j++] = m_Data[i];
+      }
+      m_Size = j;
+    }
+
+    //! Remove all the elements.
+    /*! Keeps the storage allocated. */
+    void clear()
+    {
+      m_Size = 0;
+    }
+
+  private:
+    /* Private copy constructor and assignment, you don't want this
+       happening */
+    SmallVector(const SmallVector &);
+    SmallVector & operator=(const SmallVector &);
+
+    void grow()
+    {
+      T * data = new T[m_Capacity * 2];
+      for(size_t i = 0; i < m_Size; ++i)
+        data[i] = m_Data[i];
+      if(m_Data != m_Inline)
+        delete [] m_Data;
+      m_Data = data;
+      m_Capacity *= 2;
+    }
+
+    T * m_Data;
+    size_t m_Size;
+    size_t m_Capacity;
+    T m_Inline[N];
+  };
+}
+
+#endif // NEWNET_SMALLVECTOR_H
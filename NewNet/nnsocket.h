@@ -119,6 +119,8 @@ namespace NewNet
     void setDescriptor(int fd)
     {
       m_FD = fd;
+      if(fd != -1)
+        descriptorChanged();
     }
 
     //! Return the current socket state.
@@ -217,6 +219,13 @@ namespace NewNet
     {
     }
 
+    //! Flush function.
+    /*! This is called by the reactor at the end of the loop iteration in
+        which the socket asked to be flushed (see Reactor::scheduleFlush()). */
+    virtual void flush()
+    {
+    }
+
     //! Associate some libevent data to the socket.
     /*! Associate some libevent data to the socket. */
     void setEventData(struct event & evData) {
@@ -229,6 +238,13 @@ namespace NewNet
         return m_EventData;
     }
 
+  protected:
+    //! Invoked when the socket gets a new descriptor.
+    /*! Subclasses override this to configure the descriptor. */
+    virtual void descriptorChanged()
+    {
+    }
+
   private:
     Reactor * m_Reactor;
     int m_FD;
@@ -80,3 +80,19 @@ NewNet::TcpServerSocket::listen(const std::string & host, unsigned int port)
 
   NNLOG("newnet.net.debug", "Listening on socket '%s:%u'.", host.c_str(), port);
 }
+
+void
+NewNet::TcpServerSocket::adopt(int fd)
+{
+  struct sockaddr_in address;
+  socklen_t length = sizeof(address);
+  if(getsockname(fd, (struct sockaddr *)&address, &length) == 0)
+    m_ListenPort = ntohs(address.sin_port);
+  setnonblocking(fd);
+
+  setDescriptor(fd);
+  setSocketState(SocketListening);
+  listeningEvent(this);
+
+  NNLOG("newnet.net.debug", "Adopted socket %i listening on port %u.", fd, m_ListenPort);
+}
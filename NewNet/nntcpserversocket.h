@@ -50,6 +50,12 @@ namespace NewNet
       listen(std::string(), port);
     }
 
+    //! Take over a listening descriptor.
+    /*! Use a socket that is already bound and listening, for example one
+        inherited from another process. The listen port is read from the
+        descriptor. */
+    void adopt(int fd);
+
     //! Return listen port
     /*! Return which port this server socket is listening on. */
     unsigned int listenPort()
@@ -73,6 +73,19 @@ NewNet::UnixServerSocket::listen(const std::string & path)
   NNLOG("newnet.net.debug", "Listening on unix socket '%s'.", path.c_str());
 }
 
+void
+NewNet::UnixServerSocket::adopt(int fd, const std::string & path)
+{
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+
+  m_Path = path;
+  setDescriptor(fd);
+  setSocketState(SocketListening);
+  listeningEvent(this);
+
+  NNLOG("newnet.net.debug", "Adopted socket %i listening on unix socket '%s'.", fd, path.c_str());
+}
+
 void
 NewNet::UnixServerSocket::disconnect()
 {
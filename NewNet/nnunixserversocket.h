@@ -42,6 +42,11 @@ namespace NewNet
     /*! Starts listening on the specified path. */
     void listen(const std::string & path);
 
+    //! Take over a listening descriptor.
+    /*! Use a socket that is already bound to path and listening, for
+        example one inherited from another process. */
+    void adopt(int fd, const std::string & path);
+
     //! Disconnect the server socket.
     /*! Closes the server socket and removes the unix socket file. */
     virtual void disconnect();
@@ -0,0 +1,197 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+/* Drives reactor timeouts and the rate limiter through a MockClock, so the
+   timer and rate logic can be checked without waiting for the real time to
+   pass. Reports every check that fails and exits with 1 if any did. */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include <NewNet/nnclock.h>
+#include <NewNet/nnreactor.h>
+#include <NewNet/nnratelimiter.h>
+#include <stdio.h>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (! (cond)) { \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            ++failures; \
+        } \
+    } while (0)
+
+static NewNet::MockClock mock;
+
+static void
+advance(long ms)
+{
+    mock.advance(ms);
+    NewNet::clock.update();
+}
+
+/* Exposes the reactor's timeout pass, which run() only calls from the
+   libevent loop. */
+class TestReactor : public NewNet::Reactor
+{
+public:
+    /* Invoke the expired timeouts. Returns the delay until the next one,
+       -1 if none is left. The second pass sees the timeouts added by the
+       callbacks of the first one, like the next reactor iteration would. */
+    long fire()
+    {
+        struct timeval timeout;
+        bool timeout_set = false;
+        checkTimeouts(timeout, timeout_set);
+        timeout_set = false;
+        checkTimeouts(timeout, timeout_set);
+        return timeout_set ? difftime(timeout, NewNet::clock.now()) : -1;
+    }
+};
+
+/* Records which timeouts fired and how late. */
+class Recorder : public NewNet::Object
+{
+public:
+    Recorder(TestReactor * reactor) : m_Reactor(reactor)
+    {
+    }
+
+    void onFirst(long overdue)
+    {
+        fired.push_back(1);
+        overdues.push_back(overdue);
+    }
+
+    void onSecond(long overdue)
+    {
+        fired.push_back(2);
+        overdues.push_back(overdue);
+    }
+
+    /* Adds itself again, the way periodic timers do. */
+    void onPeriodic(long overdue)
+    {
+        fired.push_back(3);
+        overdues.push_back(overdue);
+        m_Reactor->addTimeout(100, this, &Recorder::onPeriodic);
+    }
+
+    std::vector<int> fired;
+    std::vector<long> overdues;
+
+private:
+    TestReactor * m_Reactor;
+};
+
+static void
+checkTimeouts()
+{
+    NewNet::RefPtr<TestReactor> reactor(new TestReactor);
+    NewNet::RefPtr<Recorder> recorder(new Recorder(reactor));
+
+    reactor->addTimeout(100, recorder.ptr(), &Recorder::onFirst);
+    reactor->addTimeout(50, recorder.ptr(), &Recorder::onSecond);
+    CHECK(reactor->fire() == 50);
+
+    /* Nothing fires early */
+    advance(49);
+    CHECK(reactor->fire() == 1);
+    CHECK(recorder->fired.empty());
+
+    /* On time, then overdue */
+    advance(1);
+    CHECK(reactor->fire() == 50);
+    CHECK(recorder->fired.size() == 1 && recorder->fired[0] == 2 && recorder->overdues[0] == 0);
+    advance(70);
+    CHECK(reactor->fire() == -1);
+    CHECK(recorder->fired.size() == 2 && recorder->fired[1] == 1 && recorder->overdues[1] == 20);
+
+    /* Removed timeouts never fire */
+    recorder->fired.clear();
+    recorder->overdues.clear();
+    NewNet::Reactor::Timeout::Callback * second = reactor->addTimeout(10, recorder.ptr(), &Recorder::onSecond);
+    reactor->removeTimeout(second);
+    advance(20);
+    CHECK(reactor->fire() == -1);
+    CHECK(recorder->fired.empty());
+
+    /* A timeout added from its own callback waits for the next pass */
+    reactor->addTimeout(100, recorder.ptr(), &Recorder::onPeriodic);
+    advance(250);
+    CHECK(reactor->fire() == 100);
+    CHECK(recorder->fired.size() == 1 && recorder->overdues[0] == 150);
+    advance(100);
+    CHECK(reactor->fire() == 100);
+    CHECK(recorder->fired.size() == 2 && recorder->overdues[1] == 0);
+}
+
+static void
+checkRateLimiter()
+{
+    NewNet::RefPtr<NewNet::RateLimiter> limiter(new NewNet::RateLimiter);
+
+    /* No limit, and nothing allowed */
+    limiter->transferred(1000000);
+    CHECK(limiter->nextWindow() == 0);
+    limiter->setLimit(0);
+    CHECK(limiter->nextWindow() == 60000);
+
+    /* The window opens one second after the frame that broke the limit */
+    advance(10000);
+    limiter->setLimit(1000);
+    CHECK(limiter->nextWindow() == 0);
+    limiter->transferred(600);
+    CHECK(limiter->nextWindow() == 0);
+    advance(200);
+    limiter->transferred(600);
+    CHECK(limiter->nextWindow() == 800);
+    advance(300);
+    CHECK(limiter->nextWindow() == 500);
+    advance(500);
+    CHECK(limiter->nextWindow() == 0);
+
+    /* Frames older than the history don't count any more */
+    limiter->transferred(5000);
+    CHECK(limiter->nextWindow() == 1000);
+    advance(6000);
+    limiter->transferred(600);
+    CHECK(limiter->nextWindow() == 0);
+}
+
+int
+main(int, char **)
+{
+    NewNet::clock.setSource(&mock);
+
+    checkTimeouts();
+    checkRateLimiter();
+
+    NewNet::clock.setSource(0);
+
+    if (failures) {
+        fprintf(stderr, "%d checks failed.\n", failures);
+        return 1;
+    }
+    printf("All checks passed.\n");
+    return 0;
+}
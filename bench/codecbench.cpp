@@ -0,0 +1,338 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+/* Measures how fast museekd encodes and decodes its messages and how many
+   heap allocations that takes. Every message museekd parses is decoded, the
+   big ones with realistic payloads, and the messages museekd both builds and
+   parses are checked to survive a round trip.
+
+   Usage: codecbench [--scale X] [--write-corpus DIR]
+   --write-corpus writes the corpus in codecfuzz's input format and exits. */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "codeccorpus.h"
+#include <museekd/servermessages.h>
+#include <museekd/peermessages.h>
+#include <museekd/distributedmessages.h>
+#include <museekd/ifacemessages.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <sys/time.h>
+
+/* Count every heap allocation made by the process. NewNet::Buffer grows
+   with realloc(), so with glibc the C allocator is counted too. */
+static unsigned long allocations = 0;
+
+#ifdef __GLIBC__
+extern "C"
+{
+    void * __libc_malloc(size_t n);
+    void * __libc_calloc(size_t n, size_t size);
+    void * __libc_realloc(void * p, size_t n);
+
+    void *
+    malloc(size_t n)
+    {
+        ++allocations;
+        return __libc_malloc(n);
+    }
+
+    void *
+    calloc(size_t n, size_t size)
+    {
+        ++allocations;
+        return __libc_calloc(n, size);
+    }
+
+    void *
+    realloc(void * p, size_t n)
+    {
+        ++allocations;
+        return __libc_realloc(p, n);
+    }
+}
+#else
+void *
+operator new(size_t n)
+{
+    ++allocations;
+    void * p = malloc(n ? n : 1);
+    if (! p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void
+operator delete(void * p) noexcept
+{
+    free(p);
+}
+#endif // __GLIBC__
+
+/* Don't let one message take forever, nor tiny ones finish too quickly to
+   be measured. */
+static size_t budget = 64 * 1024 * 1024;
+static const size_t maxRounds = 20000;
+
+static size_t
+roundsFor(size_t bytes)
+{
+    size_t rounds = budget / (bytes ? bytes : 1);
+    if (rounds < 1)
+        rounds = 1;
+    if (rounds > maxRounds)
+        rounds = maxRounds;
+    return rounds;
+}
+
+static double
+elapsed(const struct timeval & start, const struct timeval & end)
+{
+    double us = (end.tv_sec - start.tv_sec) * 1000000.0 + (end.tv_usec - start.tv_usec);
+    return us > 0 ? us : 1;
+}
+
+static void
+report(const char * protocol, const char * name, size_t bytes, size_t rounds, double us, unsigned long allocs)
+{
+    printf("%-12s %-28s %10u %10.1f %12.0f %12.1f\n", protocol, name, (unsigned int)bytes,
+           bytes * rounds / us, rounds * 1000000.0 / us, (double)allocs / rounds);
+    fflush(stdout);
+}
+
+static void
+header(const char * what)
+{
+    printf("\n%-12s %-28s %10s %10s %12s %12s\n", "protocol", what, "bytes", "MB/s", "msgs/s", "allocs/msg");
+}
+
+/* Time make_network_packet() on a fresh copy of a message every round, as
+   museekd builds a new message for every send. */
+template<class T> static size_t
+encode(const char * protocol, const char * name, const T & msg)
+{
+    size_t bytes = 0;
+    {
+        T copy(msg);
+        bytes = copy.make_network_packet().count();
+    }
+
+    size_t rounds = roundsFor(bytes);
+    double total = 0;
+    unsigned long allocs = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        T copy(msg);
+        struct timeval start, end;
+        unsigned long before = allocations;
+        gettimeofday(&start, 0);
+        copy.make_network_packet();
+        gettimeofday(&end, 0);
+        allocs += allocations - before;
+        total += elapsed(start, end);
+    }
+    report(protocol, name, bytes, rounds, total, allocs);
+    return bytes;
+}
+
+static void
+decode(const Bench::CorpusEntry & entry)
+{
+    const unsigned char * data = entry.payload.empty() ? 0 : &entry.payload[0];
+    size_t rounds = roundsFor(entry.payload.size());
+    unsigned long before = allocations;
+    struct timeval start, end;
+    gettimeofday(&start, 0);
+    for (size_t r = 0; r < rounds; ++r)
+        Bench::decode(entry.protocol, entry.code, data, entry.payload.size());
+    gettimeofday(&end, 0);
+    report(Bench::protocolName(entry.protocol), entry.name.c_str(), entry.payload.size(),
+           rounds, elapsed(start, end), allocations - before);
+}
+
+/* Build a message, parse the result into a new instance. */
+template<class T> static void
+roundTrip(T & out, T & in, size_t codeSize = 4)
+{
+    const NewNet::Buffer & packet = out.make_network_packet();
+    in.parse_network_packet(packet.data() + codeSize, packet.count() - codeSize);
+}
+
+static bool
+sameFolder(const Folder & a, const Folder & b)
+{
+    if (a.size() != b.size())
+        return false;
+    Folder::const_iterator ia = a.begin(), ib = b.begin();
+    for (; ia != a.end(); ++ia, ++ib) {
+        if (ia->first != ib->first || ia->second.size != ib->second.size ||
+            ia->second.ext != ib->second.ext || ia->second.attrs != ib->second.attrs)
+            return false;
+    }
+    return true;
+}
+
+static bool
+check(bool ok, const char * name)
+{
+    if (! ok)
+        fprintf(stderr, "Round trip failed for %s.\n", name);
+    return ok;
+}
+
+static bool
+checkRoundTrips(double scale)
+{
+    bool ok = true;
+    size_t results = (size_t)(1000 * scale) + 1;
+
+    {
+        Folder folder = Bench::makeFolder(results, "@@music");
+        Folder locked = Bench::makeFolder(results / 10, "@@locked");
+        PSearchReply out(77, "searcher", folder, 1500, 12, true, locked), in;
+        roundTrip(out, in);
+        ok &= check(in.ticket == 77 && in.user == "searcher" && in.avgspeed == 1500 &&
+                    in.queuelen == 12 && in.slotfree && sameFolder(in.results, folder) &&
+                    sameFolder(in.lockedResults, locked), "PSearchReply");
+    }
+
+    {
+        Folders folders;
+        folders["@@music"] = Bench::makeShares(results, 12);
+        PFolderContentsReply out(folders), in;
+        roundTrip(out, in);
+        bool same = in.folders.size() == 1 && in.folders["@@music"].size() == folders["@@music"].size();
+        Shares::const_iterator it = folders["@@music"].begin();
+        for (; same && it != folders["@@music"].end(); ++it)
+            same = sameFolder(in.folders["@@music"][it->first], it->second);
+        ok &= check(same, "PFolderContentsReply");
+    }
+
+    {
+        PSearchRequest out(99, "artist album"), in;
+        roundTrip(out, in);
+        ok &= check(in.ticket == 99 && in.query == "artist album", "PSearchRequest");
+    }
+
+    {
+        DSearchRequest out(0x31, "searcher", 1234, "artist album flac"), in;
+        roundTrip(out, in, 1);
+        ok &= check(in.unknown == 0x31 && in.username == "searcher" && in.ticket == 1234 &&
+                    in.query == "artist album flac", "DSearchRequest");
+    }
+
+    return ok;
+}
+
+static int
+writeCorpus(const char * dir, const Bench::Corpus & corpus)
+{
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s-%u-%s-%u", dir, Bench::protocolName(corpus[i].protocol),
+                 (unsigned int)corpus[i].code, corpus[i].name.c_str(), (unsigned int)i);
+        std::vector<unsigned char> input = Bench::fuzzInput(corpus[i]);
+        FILE * f = fopen(path, "wb");
+        if (! f || fwrite(&input[0], 1, input.size(), f) != input.size()) {
+            fprintf(stderr, "Couldn't write %s.\n", path);
+            if (f)
+                fclose(f);
+            return 1;
+        }
+        fclose(f);
+    }
+    printf("Wrote %u corpus files to %s.\n", (unsigned int)corpus.size(), dir);
+    return 0;
+}
+
+int
+main(int argc, char ** argv)
+{
+    double scale = 1.0;
+    const char * corpusDir = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (! strcmp(argv[i], "--scale") && i + 1 < argc)
+            scale = atof(argv[++i]);
+        else if (! strcmp(argv[i], "--write-corpus") && i + 1 < argc)
+            corpusDir = argv[++i];
+        else {
+            fprintf(stderr, "Usage: %s [--scale X] [--write-corpus DIR]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Bench::Corpus corpus;
+    Bench::buildCorpus(corpus, scale);
+    if (corpusDir)
+        return writeCorpus(corpusDir, corpus);
+
+    if (! checkRoundTrips(scale))
+        return 1;
+
+    size_t results = (size_t)(10000 * scale) + 1;
+    size_t files = (size_t)(500000 * scale) + 1;
+    size_t users = (size_t)(5000 * scale) + 1;
+
+    header("encode");
+    {
+        PSearchReply msg(1234, "searcher", Bench::makeFolder(results, "@@music"), 150000, 3, true,
+                         Bench::makeFolder(results / 10, "@@locked"));
+        encode("peer", "PSearchReply", msg);
+    }
+    {
+        Folders folders;
+        folders["@@music"] = Bench::makeShares(results, 12);
+        PFolderContentsReply msg(folders);
+        encode("peer", "PFolderContentsReply", msg);
+    }
+    {
+        Shares shares = Bench::makeShares(files, 12);
+        encode("iface", "IUserShares", IUserShares("user", shares));
+    }
+    {
+        Folder folder = Bench::makeFolder(results, "@@music");
+        encode("iface", "ISearchReply", ISearchReply(1234, "searcher", true, 150000, 3, folder, Folder()));
+    }
+    {
+        RoomList roomlist;
+        std::map<std::string, RoomData> rooms;
+        std::map<std::string, Tickers> tickers;
+        roomlist["museek"] = users;
+        rooms["museek"] = Bench::makeRoom(users);
+        encode("iface", "IRoomStateCompat", IRoomStateCompat(roomlist, rooms, tickers));
+    }
+    {
+        std::map<std::string, RoomData> rooms;
+        rooms["museek"] = Bench::makeRoom(users);
+        encode("iface", "IRoomMembers", IRoomMembers(rooms, PrivRoomOperators(), PrivRoomOwners()));
+    }
+    {
+        encode("distributed", "DSearchRequest", DSearchRequest(0x31, "searcher", 1234, "artist album flac"));
+        encode("server", "SFileSearch", SFileSearch(1234, "artist album flac"));
+    }
+
+    header("decode");
+    for (size_t i = 0; i < corpus.size(); ++i)
+        decode(corpus[i]);
+
+    return 0;
+}
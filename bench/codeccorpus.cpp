@@ -0,0 +1,396 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "codeccorpus.h"
+#include <museekd/servermessages.h>
+#include <museekd/peermessages.h>
+#include <museekd/distributedmessages.h>
+#include <museekd/ifacemessages.h>
+#include <stdio.h>
+
+namespace
+{
+  struct TableEntry
+  {
+    Bench::Protocol protocol;
+    uint32 code;
+    const char * name;
+  };
+
+  /* Every message museekd parses, straight from the event tables. */
+  const TableEntry tableEntries[] = {
+    #define MAP_MESSAGE(ID, TYPE, EVENT) { Bench::ServerProtocol, ID, #TYPE },
+    #include <museekd/servereventtable.h>
+    #undef MAP_MESSAGE
+    #define MAP_MESSAGE(ID, TYPE, EVENT) { Bench::PeerProtocol, ID, #TYPE },
+    #include <museekd/peereventtable.h>
+    #undef MAP_MESSAGE
+    #define MAP_MESSAGE(ID, TYPE, EVENT) { Bench::DistributedProtocol, ID, #TYPE },
+    #include <museekd/distributedeventtable.h>
+    #undef MAP_MESSAGE
+    #define MAP_MESSAGE(ID, TYPE, EVENT) { Bench::IfaceProtocol, ID, #TYPE },
+    #define MAP_C_MESSAGE(ID, TYPE, EVENT) { Bench::IfaceProtocol, ID, #TYPE },
+    #include <museekd/ifaceeventtable.h>
+    #undef MAP_MESSAGE
+    #undef MAP_C_MESSAGE
+  };
+
+  const size_t tableSize = sizeof(tableEntries) / sizeof(tableEntries[0]);
+
+  /* Interface messages carrying secrets are deciphered with the session
+     key. The fuzzer and the benchmark share this one. */
+  CipherContext * cipherContext()
+  {
+    static CipherContext * context = 0;
+    if(! context)
+    {
+      context = new CipherContext();
+      cipherKeySHA256(context, (char *)"museek", 6);
+    }
+    return context;
+  }
+
+  template<class T> void parse(const unsigned char * data, size_t count)
+  {
+    T msg;
+    msg.parse_network_packet(data, count);
+  }
+
+  template<class T> void parseCiphered(const unsigned char * data, size_t count)
+  {
+    T msg(cipherContext());
+    msg.parse_network_packet(data, count);
+  }
+
+  /* Exposes the NetworkMessage packers so payloads that museekd never
+     builds itself can be written in the layout its parsers expect. */
+  class PayloadWriter : public NetworkMessage
+  {
+  public:
+    PayloadWriter()
+    {
+      // Placeholder for the message code, compress() expects one.
+      NetworkMessage::pack((uint32)0);
+    }
+
+    using NetworkMessage::pack;
+
+    std::vector<unsigned char> payload(bool compressed = false)
+    {
+      if(compressed)
+        compress();
+      return std::vector<unsigned char>(buffer.data() + 4, buffer.data() + buffer.count());
+    }
+  };
+
+  /* Strip the message code from a packet built by a MAKE block. Distributed
+     messages use a single byte code. */
+  std::vector<unsigned char> payloadOf(NetworkMessage & msg, size_t codeSize = 4)
+  {
+    const NewNet::Buffer & packet = msg.make_network_packet();
+    return std::vector<unsigned char>(packet.data() + codeSize, packet.data() + packet.count());
+  }
+
+  void addEntry(Bench::Corpus & corpus, Bench::Protocol protocol, uint32 code, const std::vector<unsigned char> & payload)
+  {
+    Bench::CorpusEntry entry;
+    entry.protocol = protocol;
+    entry.code = code;
+    entry.name = Bench::messageName(protocol, code);
+    entry.payload = payload;
+    corpus.push_back(entry);
+  }
+
+  /* Deterministic pseudo random numbers so runs are comparable. */
+  uint32 nextRandom()
+  {
+    static uint32 state = 42;
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+  }
+}
+
+const char *
+Bench::protocolName(Protocol protocol)
+{
+  switch(protocol)
+  {
+    case ServerProtocol: return "server";
+    case PeerProtocol: return "peer";
+    case DistributedProtocol: return "distributed";
+    case IfaceProtocol: return "iface";
+    default: return "unknown";
+  }
+}
+
+const char *
+Bench::messageName(Protocol protocol, uint32 code)
+{
+  for(size_t i = 0; i < tableSize; ++i)
+    if(tableEntries[i].protocol == protocol && tableEntries[i].code == code)
+      return tableEntries[i].name;
+  return 0;
+}
+
+bool
+Bench::decode(Protocol protocol, uint32 code, const unsigned char * data, size_t count)
+{
+  switch(protocol)
+  {
+    case ServerProtocol:
+      switch(code)
+      {
+        #define MAP_MESSAGE(ID, TYPE, EVENT) case ID: parse<TYPE>(data, count); return true;
+        #include <museekd/servereventtable.h>
+        #undef MAP_MESSAGE
+      }
+      break;
+    case PeerProtocol:
+      switch(code)
+      {
+        #define MAP_MESSAGE(ID, TYPE, EVENT) case ID: parse<TYPE>(data, count); return true;
+        #include <museekd/peereventtable.h>
+        #undef MAP_MESSAGE
+      }
+      break;
+    case DistributedProtocol:
+      switch(code)
+      {
+        #define MAP_MESSAGE(ID, TYPE, EVENT) case ID: parse<TYPE>(data, count); return true;
+        #include <museekd/distributedeventtable.h>
+        #undef MAP_MESSAGE
+      }
+      break;
+    case IfaceProtocol:
+      switch(code)
+      {
+        #define MAP_MESSAGE(ID, TYPE, EVENT) case ID: parse<TYPE>(data, count); return true;
+        #define MAP_C_MESSAGE(ID, TYPE, EVENT) case ID: parseCiphered<TYPE>(data, count); return true;
+        #include <museekd/ifaceeventtable.h>
+        #undef MAP_MESSAGE
+        #undef MAP_C_MESSAGE
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+Folder
+Bench::makeFolder(size_t files, const std::string & prefix)
+{
+  Folder folder;
+  char name[128];
+  for(size_t i = 0; i < files; ++i)
+  {
+    snprintf(name, sizeof(name), "%s\\Artist %03u\\Album %02u\\%02u - Track title %u.mp3",
+             prefix.c_str(), (unsigned int)(i / 200), (unsigned int)(i / 12 % 17),
+             (unsigned int)(i % 12 + 1), (unsigned int)i);
+    FileEntry & fe = folder[name];
+    fe.size = 3000000 + nextRandom() % 9000000;
+    fe.ext = "mp3";
+    fe.attrs.push_back(320);
+    fe.attrs.push_back(180 + nextRandom() % 240);
+    fe.attrs.push_back(0);
+  }
+  return folder;
+}
+
+Shares
+Bench::makeShares(size_t files, size_t filesPerDir)
+{
+  Shares shares;
+  char dir[128], name[64];
+  for(size_t i = 0; i < files; ++i)
+  {
+    snprintf(dir, sizeof(dir), "@@music\\Artist %04u\\Album %04u",
+             (unsigned int)(i / filesPerDir / 10), (unsigned int)(i / filesPerDir));
+    snprintf(name, sizeof(name), "%02u - Track title %u.mp3",
+             (unsigned int)(i % filesPerDir + 1), (unsigned int)i);
+    FileEntry & fe = shares[dir][name];
+    fe.size = 3000000 + nextRandom() % 9000000;
+    fe.ext = "mp3";
+    fe.attrs.push_back(320);
+    fe.attrs.push_back(180 + nextRandom() % 240);
+  }
+  return shares;
+}
+
+RoomData
+Bench::makeRoom(size_t users)
+{
+  RoomData room;
+  char name[32];
+  for(size_t i = 0; i < users; ++i)
+  {
+    snprintf(name, sizeof(name), "user%05u", (unsigned int)i);
+    UserData & data = room[name];
+    data.status = 1 + nextRandom() % 2;
+    data.avgspeed = nextRandom() % 500000;
+    data.downloadnum = nextRandom() % 10000;
+    data.files = nextRandom() % 50000;
+    data.dirs = data.files / 12;
+    data.slotsfull = (nextRandom() % 4) == 0;
+    data.country = (i % 3) ? "FR" : "US";
+  }
+  return room;
+}
+
+void
+Bench::buildCorpus(Corpus & corpus, double scale)
+{
+  size_t searchResults = (size_t)(10000 * scale) + 1;
+  size_t sharedFiles = (size_t)(500000 * scale) + 1;
+  size_t roomUsers = (size_t)(5000 * scale) + 1;
+
+  // A generic payload for every message museekd parses: a string, a count,
+  // another string, then an offset. Good enough to walk most parsers.
+  for(size_t i = 0; i < tableSize; ++i)
+  {
+    PayloadWriter w;
+    w.pack(std::string("museek"));
+    w.pack((uint32)3);
+    w.pack(std::string("user"));
+    w.pack((uint32)1);
+    w.pack((uint64)4096);
+    w.pack(std::string("mp3"));
+    addEntry(corpus, tableEntries[i].protocol, tableEntries[i].code, w.payload());
+  }
+
+  // Interface messages with ciphered strings.
+  {
+    INewPassword password(cipherContext(), "secret");
+    addEntry(corpus, IfaceProtocol, 0x0012, payloadOf(password));
+    IConfigSet set(cipherContext(), "museeq.text", "font", "monospace");
+    addEntry(corpus, IfaceProtocol, 0x0101, payloadOf(set));
+    IConfigRemove remove(cipherContext(), "museeq.text", "font");
+    addEntry(corpus, IfaceProtocol, 0x0102, payloadOf(remove));
+  }
+
+  // Search results as a peer sends them.
+  {
+    PSearchReply msg(1234, "searcher", makeFolder(searchResults, "@@music"), 150000, 3, true,
+                     makeFolder(searchResults / 10, "@@locked"));
+    addEntry(corpus, PeerProtocol, 9, payloadOf(msg));
+  }
+
+  // A folder listing.
+  {
+    Folders folders;
+    Folder folder = makeFolder(searchResults / 10 + 1, "@@music");
+    Folder::const_iterator it = folder.begin();
+    for(; it != folder.end(); ++it)
+    {
+      std::string path = it->first;
+      std::string::size_type sep = path.rfind('\\');
+      folders["@@music\\Artist 000"][path.substr(0, sep)][path.substr(sep + 1)] = it->second;
+    }
+    PFolderContentsReply msg(folders);
+    addEntry(corpus, PeerProtocol, 37, payloadOf(msg));
+  }
+
+  // A complete shares listing. museekd only forwards a precompressed blob,
+  // so write the layout PSharesReply parses.
+  {
+    Shares shares = makeShares(sharedFiles, 12);
+    PayloadWriter w;
+    w.pack((uint32)shares.size());
+    Shares::const_iterator dit = shares.begin();
+    for(; dit != shares.end(); ++dit)
+    {
+      w.pack(dit->first);
+      w.pack((uint32)dit->second.size());
+      Folder::const_iterator fit = dit->second.begin();
+      for(; fit != dit->second.end(); ++fit)
+      {
+        w.pack((uchar)1);
+        w.pack(fit->first);
+        w.pack(fit->second.size);
+        w.pack(fit->second.ext);
+        w.pack((uint32)fit->second.attrs.size());
+        for(uint32 j = 0; j < fit->second.attrs.size(); ++j)
+        {
+          w.pack(j);
+          w.pack(fit->second.attrs[j]);
+        }
+      }
+    }
+    addEntry(corpus, PeerProtocol, 5, w.payload(true));
+  }
+
+  // Joining a crowded room. The server sends every column separately.
+  {
+    RoomData room = makeRoom(roomUsers);
+    RoomData::const_iterator it;
+    PayloadWriter w;
+    w.pack(std::string("museek"));
+    w.pack((uint32)room.size());
+    for(it = room.begin(); it != room.end(); ++it)
+      w.pack(it->first);
+    w.pack((uint32)room.size());
+    for(it = room.begin(); it != room.end(); ++it)
+      w.pack(it->second.status);
+    w.pack((uint32)room.size());
+    for(it = room.begin(); it != room.end(); ++it)
+    {
+      w.pack(it->second.avgspeed);
+      w.pack(it->second.downloadnum);
+      w.pack(it->second.files);
+      w.pack(it->second.dirs);
+    }
+    w.pack((uint32)room.size());
+    for(it = room.begin(); it != room.end(); ++it)
+      w.pack((uint32)it->second.slotsfull);
+    w.pack((uint32)room.size());
+    for(it = room.begin(); it != room.end(); ++it)
+      w.pack(it->second.country);
+    addEntry(corpus, ServerProtocol, 14, w.payload());
+  }
+
+  // Search requests travelling down the distributed network.
+  {
+    DSearchRequest msg(0x31, "searcher", 1234, "artist album flac");
+    addEntry(corpus, DistributedProtocol, 3, payloadOf(msg, 1));
+  }
+}
+
+std::vector<unsigned char>
+Bench::fuzzInput(const CorpusEntry & entry)
+{
+  std::vector<unsigned char> input;
+  input.push_back((unsigned char)entry.protocol);
+  for(int i = 0; i < 4; ++i)
+    input.push_back((entry.code >> (8 * i)) & 0xff);
+  input.insert(input.end(), entry.payload.begin(), entry.payload.end());
+  return input;
+}
+
+bool
+Bench::decodeFuzzInput(const unsigned char * data, size_t count)
+{
+  if(count < 5)
+    return false;
+  Protocol protocol = (Protocol)(data[0] % ProtocolCount);
+  uint32 code = data[1] + (data[2] << 8) + (data[3] << 16) + ((uint32)data[4] << 24);
+  return decode(protocol, code, data + 5, count - 5);
+}
@@ -0,0 +1,80 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_BENCH_CODECCORPUS_H
+#define MUSEEK_BENCH_CODECCORPUS_H
+
+#include <museekd/mutypes.h>
+#include <string>
+#include <vector>
+
+/* Shared between the codec benchmark and the codec fuzzer: a decoder for
+   every message museekd parses, generated from the *eventtable.h files, and
+   a corpus of payloads for them. Payloads never include the message code,
+   just like MessageProcessor::MessageData. */
+namespace Bench
+{
+  enum Protocol
+  {
+    ServerProtocol = 0,
+    PeerProtocol,
+    DistributedProtocol,
+    IfaceProtocol,
+    ProtocolCount
+  };
+
+  struct CorpusEntry
+  {
+    Protocol protocol;
+    uint32 code;
+    std::string name;
+    std::vector<unsigned char> payload;
+  };
+
+  typedef std::vector<CorpusEntry> Corpus;
+
+  /* Returns a printable name for a protocol. */
+  const char * protocolName(Protocol protocol);
+
+  /* Returns the name of the message type mapped to a code, or 0 if museekd
+     doesn't parse that code. */
+  const char * messageName(Protocol protocol, uint32 code);
+
+  /* Parse a payload the way the matching socket would. Returns false if the
+     code is unknown. */
+  bool decode(Protocol protocol, uint32 code, const unsigned char * data, size_t count);
+
+  /* Generated inputs: the large messages are built with their real MAKE
+     code (10k-entry search replies, 500k-file shares, 5k-user rooms at
+     scale 1) and every other parsed message gets a small generic payload.
+     Use a smaller scale to get quick fuzzer seeds. */
+  void buildCorpus(Corpus & corpus, double scale = 1.0);
+
+  /* Fuzzer input format: one byte selecting the protocol, the message code
+     as a little endian uint32, then the payload. */
+  std::vector<unsigned char> fuzzInput(const CorpusEntry & entry);
+  bool decodeFuzzInput(const unsigned char * data, size_t count);
+
+  /* Fixtures for the big messages, also used by the encoders. */
+  Folder makeFolder(size_t files, const std::string & prefix);
+  Shares makeShares(size_t files, size_t filesPerDir);
+  RoomData makeRoom(size_t users);
+}
+
+#endif // MUSEEK_BENCH_CODECCORPUS_H
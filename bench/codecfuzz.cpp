@@ -0,0 +1,91 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+/* Feeds arbitrary input to the message parsers. The first byte selects the
+   protocol, the next four are the message code and the rest is the payload
+   (see Bench::decodeFuzzInput).
+
+   Built with -DLIBFUZZER=ON this is a libFuzzer target; seed it with the
+   files written by codecbench --write-corpus. Otherwise it's a plain
+   program replaying the files given on the command line, or the built-in
+   corpus and every truncation of it when given none. */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "codeccorpus.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+extern "C" int
+LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
+{
+    Bench::decodeFuzzInput(data, size);
+    return 0;
+}
+
+#ifndef MUSEEK_LIBFUZZER
+static bool
+replayFile(const char * path)
+{
+    FILE * f = fopen(path, "rb");
+    if (! f) {
+        fprintf(stderr, "Couldn't open %s.\n", path);
+        return false;
+    }
+    std::vector<unsigned char> input;
+    unsigned char buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        input.insert(input.end(), buf, buf + n);
+    fclose(f);
+    LLVMFuzzerTestOneInput(input.empty() ? 0 : &input[0], input.size());
+    return true;
+}
+
+int
+main(int argc, char ** argv)
+{
+    if (argc > 1) {
+        for (int i = 1; i < argc; ++i)
+            if (! replayFile(argv[i]))
+                return 1;
+        printf("Replayed %d inputs.\n", argc - 1);
+        return 0;
+    }
+
+    /* Truncated messages are the most common malformed input and every
+       parser has to survive them. Try every prefix of the small messages
+       and a few hundred of the large ones. */
+    Bench::Corpus corpus;
+    Bench::buildCorpus(corpus, 0.001);
+    size_t runs = 0;
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        std::vector<unsigned char> input = Bench::fuzzInput(corpus[i]);
+        size_t step = input.size() / 256 + 1;
+        for (size_t len = 0; len <= input.size(); len += step, ++runs)
+            LLVMFuzzerTestOneInput(&input[0], len);
+        LLVMFuzzerTestOneInput(&input[0], input.size());
+        ++runs;
+    }
+    printf("Ran %u inputs from %u corpus entries.\n", (unsigned int)runs, (unsigned int)corpus.size());
+    return 0;
+}
+#endif // MUSEEK_LIBFUZZER
@@ -0,0 +1,134 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+/* Compares the in-place obfuscation decoder used by MessageProcessor with
+   the byte-at-a-time implementation it replaced, and checks both produce
+   the same output. */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include <museekd/messageprocessor.h>
+#include <NewNet/util.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/* The previous implementation: one heap allocated key per message, rotated
+   and applied one byte at a time. */
+static void
+legacyRotrKey(unsigned char *buf, unsigned int c)
+{
+    const unsigned int mask = 31;
+
+    uint32_t key_orig = buf[0] + (buf[1] << 8) + (buf[2] << 16) + (buf[3] << 24);
+
+    c &= mask;
+    uint32_t key_rotated = (key_orig>>c) | (key_orig<<( (-c)&mask ));
+
+    buf[0] = key_rotated & 0xff;
+    buf[1] = (key_rotated >> 8) & 0xff;
+    buf[2] = (key_rotated >> 16) & 0xff;
+    buf[3] = (key_rotated >> 24) & 0xff;
+}
+
+static void
+legacyDecodeMessage(unsigned char *buf, uint32 len)
+{
+    uint keySize = 4;
+    uchar * key = new uchar[keySize];
+
+    for(uint j = 0; j < keySize; ++j) {
+        key[j] = buf[j];
+    }
+
+    uint32 key_pos = 0;
+    for (uint i = keySize; i < (len + keySize + 4); i++) {
+        key_pos = i % keySize;
+        if (key_pos == 0) {
+            legacyRotrKey(key, 31);
+        }
+        buf[i] = buf[i] ^ key[key_pos];
+    }
+
+    delete[] key;
+}
+
+static void
+newDecodeMessage(unsigned char *buf, uint32 len)
+{
+    Museek::ObfuscationDecoder decoder;
+    decoder.setKey(buf);
+    decoder.decode(buf, 4, len + 8);
+}
+
+static double
+run(void (*decode)(unsigned char *, uint32), const std::vector<unsigned char> & message, size_t rounds)
+{
+    std::vector<unsigned char> work(message);
+    struct timeval start, end;
+    gettimeofday(&start, 0);
+    for (size_t r = 0; r < rounds; ++r) {
+        /* Decoding twice restores the input, which keeps the data realistic. */
+        decode(&work[0], message.size() - 8);
+    }
+    gettimeofday(&end, 0);
+    long ms = difftime(end, start);
+    if (ms <= 0)
+        ms = 1;
+    return (double)message.size() * rounds / (ms * 1000.0);
+}
+
+int
+main(int argc, char ** argv)
+{
+    static const size_t sizes[] = { 16, 64, 256, 4096, 65536 };
+    size_t totalBytes = (argc > 1) ? strtoul(argv[1], 0, 10) : 256 * 1024 * 1024;
+
+    srand(42);
+    printf("%10s %14s %14s %8s\n", "size", "legacy MB/s", "new MB/s", "speedup");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        std::vector<unsigned char> message(sizes[s] + 8);
+        for (size_t i = 0; i < message.size(); ++i)
+            message[i] = rand() & 0xff;
+
+        /* Both implementations must agree, including on incremental decoding
+           split at an odd offset. */
+        std::vector<unsigned char> a(message), b(message), c(message);
+        legacyDecodeMessage(&a[0], sizes[s]);
+        newDecodeMessage(&b[0], sizes[s]);
+        Museek::ObfuscationDecoder decoder;
+        decoder.setKey(&c[0]);
+        decoder.decode(&c[0], 4, 11);
+        decoder.decode(&c[0], 11, c.size());
+        if (a != b || a != c) {
+            fprintf(stderr, "Decoders disagree for a %u byte message.\n", (unsigned int)sizes[s]);
+            return 1;
+        }
+
+        size_t rounds = totalBytes / message.size();
+        double legacy = run(legacyDecodeMessage, message, rounds);
+        double current = run(newDecodeMessage, message, rounds);
+        printf("%10u %14.1f %14.1f %7.1fx\n", (unsigned int)sizes[s], legacy, current, current / legacy);
+    }
+
+    return 0;
+}
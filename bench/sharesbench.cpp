@@ -0,0 +1,323 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+/* Compares the index of the shares database with the flat file map and the
+   per-word file maps it replaced, on a generated share: memory used, build
+   time, keyword and phrase search latency. Both must find the same files.
+   Give the number of files as first argument (default 200000). */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include <Muhelp/ShareIndex.hh>
+#include <NewNet/util.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+/* Count the bytes allocated on the heap. */
+static size_t allocated = 0;
+
+void *
+operator new(size_t size)
+{
+    size_t * p = (size_t *)malloc(size + sizeof(size_t) * 2);
+    if (! p)
+        throw std::bad_alloc();
+    *p = size;
+    allocated += size;
+    return p + 2;
+}
+
+void
+operator delete(void * ptr) noexcept
+{
+    if (! ptr)
+        return;
+    size_t * p = (size_t *)ptr - 2;
+    allocated -= *p;
+    free(p);
+}
+
+static double
+elapsed(const struct timeval & start)
+{
+    struct timeval end;
+    gettimeofday(&end, 0);
+    return (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_usec - start.tv_usec) / 1000.0;
+}
+
+/* Words follow a Zipf-like distribution, like in real file names. */
+static std::string
+randomWord(const std::vector<std::string> & vocabulary)
+{
+    double r = (double)rand() / RAND_MAX;
+    size_t i = (size_t)(vocabulary.size() * r * r * r);
+    return vocabulary[i < vocabulary.size() ? i : vocabulary.size() - 1];
+}
+
+static void
+generate(size_t count, Folder & flat, std::vector<std::string> & vocabulary)
+{
+    static const char * letters = "abcdefghijklmnopqrstuvwxyz";
+    for (size_t i = 0; i < 20000; ++i) {
+        std::string word;
+        size_t length = 3 + rand() % 7;
+        for (size_t j = 0; j < length; ++j)
+            word += letters[rand() % 26];
+        vocabulary.push_back(word);
+    }
+
+    char buf[32];
+    while (flat.size() < count) {
+        std::string artist = "\\music\\" + randomWord(vocabulary) + " " + randomWord(vocabulary);
+        for (int a = 0; a < 1 + rand() % 4 && flat.size() < count; ++a) {
+            snprintf(buf, sizeof(buf), " (%d)", 1970 + rand() % 50);
+            std::string album = artist + "\\" + randomWord(vocabulary) + " " + randomWord(vocabulary) + buf;
+            for (int t = 1; t <= 8 + rand() % 8 && flat.size() < count; ++t) {
+                snprintf(buf, sizeof(buf), "\\%02d - ", t);
+                FileEntry fe;
+                fe.size = 3000000 + rand() % 5000000;
+                fe.ext = "mp3";
+                fe.attrs.push_back(192);
+                fe.attrs.push_back(200 + rand() % 200);
+                flat[album + buf + randomWord(vocabulary) + " " + randomWord(vocabulary) + ".mp3"] = fe;
+            }
+        }
+    }
+}
+
+/* The previous index: for every word, a copy of every file containing it. */
+typedef std::map<char, Shares> LegacyIndex;
+
+static void
+legacyBuild(const Folder & flat, LegacyIndex & index)
+{
+    Folder::const_iterator fit = flat.begin();
+    for (; fit != flat.end(); ++fit) {
+        std::vector<std::string> words;
+        ShareIndex::split(fit->first, words);
+        for (size_t i = 0; i < words.size(); ++i)
+            index[words[i][0]][words[i]][fit->first] = fit->second;
+    }
+}
+
+static void
+legacySearch(LegacyIndex & index, const std::vector<std::string> & words, std::vector<std::string> & result)
+{
+    std::vector<Folder *> q_in;
+    for (size_t i = 0; i < words.size(); ++i) {
+        Folder * t = &index[words[i][0]][words[i]];
+        if (t->empty())
+            return;
+        q_in.push_back(t);
+    }
+    Folder::const_iterator it = q_in[0]->begin();
+    for (; it != q_in[0]->end() && result.size() < 500; ++it) {
+        size_t i = 1;
+        for (; i < q_in.size(); ++i)
+            if (q_in[i]->find(it->first) == q_in[i]->end())
+                break;
+        if (i == q_in.size())
+            result.push_back(it->first);
+    }
+}
+
+static void
+newBuild(const Folder & flat, ShareIndex & index)
+{
+    /* Files come grouped by folder, sorted by name. */
+    std::map<std::string, Folder, ShareIndex::PathLess> folders;
+    for (Folder::const_iterator fit = flat.begin(); fit != flat.end(); ++fit) {
+        std::string::size_type sep = fit->first.rfind('\\');
+        folders[fit->first.substr(0, sep)][fit->first.substr(sep + 1)] = fit->second;
+    }
+
+    std::map<std::string, Folder, ShareIndex::PathLess>::const_iterator dit = folders.begin();
+    for (; dit != folders.end(); ++dit) {
+        uint32 directory = index.addDirectory(dit->first);
+        for (Folder::const_iterator fit = dit->second.begin(); fit != dit->second.end(); ++fit) {
+            uint32 id = index.addFile(directory, fit->first, fit->second);
+            index.add(id, dit->first + "\\" + fit->first);
+            index.addFileText(id, fit->first);
+        }
+    }
+    for (uint32 d = 0; d < index.directories(); ++d)
+        index.addDirectoryText(d, index.component(d));
+    index.finish();
+}
+
+/* Phrases: the previous search looked at every path. */
+static void
+legacyPhrase(const Folder & flat, const std::string & phrase, std::vector<std::string> & result, size_t limit)
+{
+    for (Folder::const_iterator fit = flat.begin(); fit != flat.end() && result.size() < limit; ++fit)
+        if (fit->first.find(phrase) != std::string::npos)
+            result.push_back(fit->first);
+}
+
+static void
+newPhrase(const ShareIndex & index, const std::string & phrase, std::vector<std::string> & result, size_t limit)
+{
+    std::vector<uint32> directories, names;
+    bool exact = index.candidates(phrase, directories, names);
+    ShareIndex::Ranges files;
+    for (size_t i = 0; i < directories.size(); ++i)
+        if (exact || index.component(directories[i]).find(phrase) != std::string::npos)
+            files.push_back(index.subtree(directories[i]));
+    size_t folders = files.size();
+    for (size_t i = 0; i < names.size(); ++i)
+        if (exact || index.name(names[i]).find(phrase) != std::string::npos)
+            files.push_back(std::make_pair(names[i], names[i] + 1));
+    std::inplace_merge(files.begin(), files.begin() + folders, files.end());
+    ShareIndex::merge(files);
+    for (size_t i = 0; i < files.size(); ++i)
+        for (uint32 id = files[i].first; id < files[i].second && result.size() < limit; ++id)
+            result.push_back(index.path(id));
+}
+
+static void
+newSearch(const ShareIndex & index, const std::vector<std::string> & words, std::vector<std::string> & result)
+{
+    std::vector<ShareIndex::Cursor> q_in;
+    for (size_t i = 0; i < words.size(); ++i) {
+        ShareIndex::Cursor cursor;
+        if (! index.find(words[i], cursor))
+            return;
+        q_in.push_back(cursor);
+    }
+    ShareIndex::Intersection matches(q_in);
+    uint32 id;
+    while (result.size() < 500 && matches.next(id))
+        result.push_back(index.path(id));
+}
+
+int
+main(int argc, char ** argv)
+{
+    size_t count = (argc > 1) ? strtoul(argv[1], 0, 10) : 200000;
+
+    srand(42);
+    Folder flat;
+    std::vector<std::string> vocabulary;
+    size_t flatBytes = allocated;
+    generate(count, flat, vocabulary);
+    flatBytes = allocated - flatBytes;
+
+    /* Queries of one to three words, some common, some rare. */
+    std::vector<std::vector<std::string> > queries;
+    for (int q = 0; q < 2000; ++q) {
+        std::vector<std::string> words;
+        int n = 1 + rand() % 3;
+        for (int w = 0; w < n; ++w)
+            words.push_back(randomWord(vocabulary));
+        queries.push_back(words);
+    }
+
+    /* Phrases: pieces of words, some too short to have a trigram. */
+    std::vector<std::string> phrases;
+    for (int q = 0; q < 200; ++q) {
+        std::string word = randomWord(vocabulary);
+        size_t length = (q % 10 == 0) ? 2 : 3 + rand() % 4;
+        phrases.push_back(word.substr(rand() % word.size(), length));
+    }
+
+    struct timeval start;
+    size_t before = allocated;
+    gettimeofday(&start, 0);
+    LegacyIndex legacy;
+    legacyBuild(flat, legacy);
+    double legacyBuildMs = elapsed(start);
+    /* The legacy index needs the flat map of files too. */
+    size_t legacyBytes = allocated - before + flatBytes;
+
+    before = allocated;
+    gettimeofday(&start, 0);
+    ShareIndex index;
+    newBuild(flat, index);
+    double newBuildMs = elapsed(start);
+    size_t newBytes = allocated - before;
+
+    size_t found = 0;
+    for (size_t q = 0; q < queries.size(); ++q) {
+        std::vector<std::string> a, b;
+        legacySearch(legacy, queries[q], a);
+        newSearch(index, queries[q], b);
+        if (a != b) {
+            fprintf(stderr, "Indexes disagree for query %u.\n", (unsigned int)q);
+            return 1;
+        }
+        found += a.size();
+    }
+
+    gettimeofday(&start, 0);
+    for (size_t q = 0; q < queries.size(); ++q) {
+        std::vector<std::string> a;
+        legacySearch(legacy, queries[q], a);
+    }
+    double legacySearchMs = elapsed(start);
+
+    gettimeofday(&start, 0);
+    for (size_t q = 0; q < queries.size(); ++q) {
+        std::vector<std::string> b;
+        newSearch(index, queries[q], b);
+    }
+    double newSearchMs = elapsed(start);
+
+    size_t phraseFound = 0;
+    for (size_t q = 0; q < phrases.size(); ++q) {
+        std::vector<std::string> a, b;
+        legacyPhrase(flat, phrases[q], a, flat.size());
+        newPhrase(index, phrases[q], b, flat.size());
+        std::sort(b.begin(), b.end());
+        if (a != b) {
+            fprintf(stderr, "Indexes disagree for phrase '%s'.\n", phrases[q].c_str());
+            return 1;
+        }
+        phraseFound += a.size();
+    }
+
+    gettimeofday(&start, 0);
+    for (size_t q = 0; q < phrases.size(); ++q) {
+        std::vector<std::string> a;
+        legacyPhrase(flat, phrases[q], a, 500);
+    }
+    double legacyPhraseMs = elapsed(start);
+
+    gettimeofday(&start, 0);
+    for (size_t q = 0; q < phrases.size(); ++q) {
+        std::vector<std::string> b;
+        newPhrase(index, phrases[q], b, 500);
+    }
+    double newPhraseMs = elapsed(start);
+
+    printf("%u files, %u words, %u queries, %u results, %u phrases, %u results\n", (unsigned int)flat.size(),
+           index.words(), (unsigned int)queries.size(), (unsigned int)found, (unsigned int)phrases.size(),
+           (unsigned int)phraseFound);
+    printf("%-8s %12s %12s %14s %14s\n", "", "memory MB", "build ms", "us per query", "us per phrase");
+    printf("%-8s %12.1f %12.0f %14.1f %14.1f\n", "legacy", legacyBytes / 1048576.0, legacyBuildMs,
+           legacySearchMs * 1000 / queries.size(), legacyPhraseMs * 1000 / phrases.size());
+    printf("%-8s %12.1f %12.0f %14.1f %14.1f\n", "new", newBytes / 1048576.0, newBuildMs,
+           newSearchMs * 1000 / queries.size(), newPhraseMs * 1000 / phrases.size());
+    return 0;
+}
@@ -19,6 +19,8 @@
 #cmakedefine HAVE_NETINET_TCP_H 1
 #cmakedefine HAVE_WINDOWS_H 1
 #cmakedefine HAVE_WINSOCK_H 1
+#cmakedefine HAVE_STRUCT_STAT_ST_MTIM 1
+#cmakedefine HAVE_STRUCT_STAT_ST_MTIMESPEC 1
 
 #define _FILE_OFFSET_BITS 64
 #define _LARGEFILE_SOURCE 1
@@ -22,6 +22,7 @@
 
 #include <muscan/scanner.hh>
 #include <Muhelp/Muconf.hh>
+#include <Muhelp/ShareIndexer.hh>
 #include <NewNet/nnlog.h>
 
 #include <iostream>
@@ -79,8 +80,8 @@ int main(int argc, char **argv) {
 	}
 	
 	if (Scanner_Verbosity >= 2){
-	    NNLOG.logEvent.connect(new NewNet::ConsoleOutput);
-    	NNLOG.enable("ALL");
+	    NewNet::log.logEvent.connect(new NewNet::ConsoleOutput);
+    	NewNet::log.enable("ALL");
     }
 	
 	Muconf config(config_file);
@@ -147,11 +148,17 @@ int main(int argc, char **argv) {
 	DirScanner folded;
 	root.fold(&folded);
 		
+	string database;
 	if (doBuddy) { 
-		folded.save(config["buddy.shares"]["database"]);
+		database = config["buddy.shares"]["database"];
 	} else {
-		folded.save(config["shares"]["database"]);
+		database = config["shares"]["database"];
 	}
+	ShareDelta::save(database, folded);
+
+	ShareIndexer indexer(Scanner_Encoding(config, "filesystem"), Scanner_Encoding(config, "network"));
+	if(! indexer.save(database, folded))
+		cerr << "couldn't save the index of '" << database << "'" << endl;
 
 	return 0;
 }
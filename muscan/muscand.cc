@@ -3,6 +3,7 @@
 
 #include <muscan/scanner.hh>
 #include <Muhelp/Muconf.hh>
+#include <Muhelp/ShareIndexer.hh>
 #include <NewNet/nnlog.h>
 
 #include <iostream>
@@ -32,6 +33,7 @@ public:
 	
 private:
 	string shares, state;
+	string filesystem, network;
 	FAMConnection fc;
 	vector<FAMDirScanner *> nodes, pending;
 	time_t save_at;
@@ -64,8 +66,8 @@ FAMHandler::FAMHandler(const string& config_file, bool doBuddy, bool doReload)
 	FAMCONNECTION_GETFD(&fc) = -1;
 
 	if (Scanner_Verbosity >= 2){
-	    NNLOG.logEvent.connect(new NewNet::ConsoleOutput);
-    	NNLOG.enable("ALL");
+	    NewNet::log.logEvent.connect(new NewNet::ConsoleOutput);
+    	NewNet::log.enable("ALL");
     }
  
 	m_doReload = doReload;
@@ -90,6 +92,8 @@ FAMHandler::FAMHandler(const string& config_file, bool doBuddy, bool doReload)
 		shares = tmp;
 		state = shares + ".state";
 	}
+	filesystem = Scanner_Encoding(config, "filesystem");
+	network = Scanner_Encoding(config, "network");
 
 }
 
@@ -246,7 +250,10 @@ FAMHandler::save()
 	DirEntry folded;
 
 	root->fold(&folded);
-	folded.save(shares);
+	ShareDelta::save(shares, folded);
+	ShareIndexer indexer(filesystem, network);
+	if(! indexer.save(shares, folded))
+		cerr << "couldn't save the index of '" << shares << "'" << endl;
 #ifndef WIN32
 	if (m_doReload)
 		system("killall -HUP museekd");
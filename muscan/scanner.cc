@@ -35,6 +35,7 @@ extern "C" {
 #endif
 
 #include <Muhelp/DirEntry.hh>
+#include <Muhelp/Muconf.hh>
 #include <Muhelp/string_ext.hh>
 #include <NewNet/nnlog.h>
 
@@ -59,6 +60,17 @@ static int libvorbisfile_is_present = 1;
 
 int Scanner_Verbosity = 0;
 
+string Scanner_Encoding(Muconf& config, const string& key) {
+	string codeset;
+	if(config.hasDomain("encoding") && config["encoding"].hasKey(key))
+		codeset = (string)config["encoding"][key];
+	if(codeset.empty() && key != "network")
+		return Scanner_Encoding(config, "network");
+	if(codeset.empty())
+		codeset = "UTF-8";
+	return codeset;
+}
+
 void DirScanner::add(const string& path) {
 	if(folders.find(path) == folders.end())
 		folders[path] = new_folder(path);
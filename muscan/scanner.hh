@@ -45,4 +45,9 @@ public:
 
 extern int Scanner_Verbosity;
 
+class Muconf;
+/* The encoding museekd recodes names from (key "filesystem") or to (key
+ * "network"), as set in its configuration. */
+std::string Scanner_Encoding(Muconf& config, const std::string& key);
+
 #endif // __SCANNER_HH__
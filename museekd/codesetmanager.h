@@ -81,6 +81,16 @@ namespace Museek
     /* Convert 'str' from a peer's encoding to filesystem encoding, slashes = should we replace slashes? */
     std::string fromPeerToFS(const std::string & peer, const std::string & str, bool slashes = true);
 
+    /* Return the character set used on the network. */
+    std::string networkCodeset() const
+    {
+      return getNetworkCodeset("encoding", "network");
+    }
+    /* Return the character set of the file names. */
+    std::string filesystemCodeset() const
+    {
+      return getNetworkCodeset("encoding", "filesystem");
+    }
     /* Convert 'str' from network encoding to utf8 */
     std::string fromNet(const std::string & str);
     /* Convert 'str' from utf8 to network encoding*/
@@ -27,6 +27,7 @@
 #include "handshakemessages.h"
 #include "servermanager.h"
 #include "codesetmanager.h"
+#include "messagedispatcher.h"
 #include <NewNet/nnreactor.h>
 
 Museek::DistributedSocket::DistributedSocket(Museek::HandshakeSocket * that) : Museek::UserSocket(that, "D"), Museek::MessageProcessor(1, that->obfuscated())
@@ -39,6 +40,7 @@ Museek::DistributedSocket::DistributedSocket(Museek::HandshakeSocket * that) : M
     searchRequestedEvent.connect(this, &DistributedSocket::onSearchRequested);
     disconnectedEvent.connect(this, &DistributedSocket::onDisconnected);
     connectedEvent.connect(this, &DistributedSocket::onConnected);
+    setSocketOptions(museekd()->socketOptions("distributed"));
 }
 
 Museek::DistributedSocket::DistributedSocket(Museek::Museekd * museekd, bool obfuscated) : Museek::UserSocket(museekd, "D", obfuscated), Museek::MessageProcessor(1, obfuscated)
@@ -51,6 +53,7 @@ Museek::DistributedSocket::DistributedSocket(Museek::Museekd * museekd, bool obf
     searchRequestedEvent.connect(this, &DistributedSocket::onSearchRequested);
     disconnectedEvent.connect(this, &DistributedSocket::onDisconnected);
     connectedEvent.connect(this, &DistributedSocket::onConnected);
+    setSocketOptions(museekd->socketOptions("distributed"));
 }
 
 Museek::DistributedSocket::~DistributedSocket()
@@ -165,31 +168,44 @@ void Museek::DistributedSocket::onSearchRequested(const DSearchRequest * msg) {
     }
 }
 
+namespace
+{
+  #define MAP_MESSAGE(ID, TYPE, EVENT) \
+    DISPATCH_SUBSCRIBED(Museek::DistributedSocket, EVENT) \
+    static void dispatch_##EVENT(Museek::DistributedSocket * owner, const Museek::MessageProcessor::MessageData * data) \
+    { \
+      NNLOG("museekd.messages.distributed", "Received distributed message " #TYPE "."); \
+      TYPE msg; \
+      msg.setDistributedSocket(owner); \
+      msg.parse_network_packet(data->data, data->length); \
+      owner->EVENT(&msg); \
+    }
+  #include "distributedeventtable.h"
+  #undef MAP_MESSAGE
+
+  typedef Museek::MessageDispatcher<Museek::DistributedSocket> DistributedDispatcher;
+
+  const DistributedDispatcher::Entry distributedDispatchEntries[] = {
+    #define MAP_MESSAGE(ID, TYPE, EVENT) DISPATCH_ENTRY(ID, TYPE, EVENT)
+    #include "distributedeventtable.h"
+    #undef MAP_MESSAGE
+  };
+
+  const DistributedDispatcher distributedDispatcher(distributedDispatchEntries,
+      sizeof(distributedDispatchEntries) / sizeof(distributedDispatchEntries[0]));
+}
+
 void
 Museek::DistributedSocket::onMessageReceived(const MessageData * data)
 {
   if (m_DataTimeout.isValid())
     museekd()->reactor()->removeTimeout(m_DataTimeout);
 
-  switch(data->type)
+  if(! distributedDispatcher.dispatch(this, data))
   {
-    #define MAP_MESSAGE(ID, TYPE, EVENT) \
-      case ID: \
-      { \
-        NNLOG("museekd.messages.distributed", "Received distributed message " #TYPE "."); \
-        TYPE msg; \
-        msg.setDistributedSocket(this); \
-        msg.parse_network_packet(data->data, data->length); \
-        EVENT(&msg); \
-        break; \
-      }
-    #include "distributedeventtable.h"
-    #undef MAP_MESSAGE
-
-    default:
-        NNLOG("museekd.distrib.warn", "Received unknown distributed message, type: %u, length: %u", data->type, data->length);
-        NetworkMessage msg;
-        msg.parse_network_packet(data->data, data->length);
+    NNLOG("museekd.distrib.warn", "Received unknown distributed message, type: %u, length: %u", data->type, data->length);
+    NetworkMessage msg;
+    msg.parse_network_packet(data->data, data->length);
   }
 }
 
@@ -32,6 +32,7 @@
 #include <NewNet/nnreactor.h>
 #include <NewNet/nnpath.h>
 #include <NewNet/util.h>
+#include <NewNet/nnclock.h>
 #include "util.h"
 #include <sstream>
 #include <Mucipher/mucipher.h>
@@ -221,8 +222,7 @@ Museek::Download::setPositionFromIncompleteFile()
 void
 Museek::Download::received(uint bytes)
 {
-	struct timeval now;
-	gettimeofday(&now, NULL);
+	const struct timeval & now = NewNet::clock.now();
 
 	if(m_CollectStart.tv_sec == 0)
 		m_CollectStart = now;
@@ -424,6 +424,29 @@ Museek::DownloadManager::~DownloadManager()
     NNLOG("museekd.down.debug", "Download Manager destroyed");
 }
 
+/**
+  * Hot restart: continue a download the previous instance was doing. The download list was
+  * loaded from disk already.
+  */
+bool
+Museek::DownloadManager::resume(const std::string & user, const std::string & path, uint ticket, int fd)
+{
+    Download * download = findDownload(user, path);
+    if(! download) {
+        NNLOG("museekd.down.warn", "Can't resume the download of %s from %s, it isn't in the list.", path.c_str(), user.c_str());
+        closesocket(fd);
+        return false;
+    }
+
+    NNLOG("museekd.down.debug", "Resuming download of %s from %s.", path.c_str(), user.c_str());
+    download->setTicket(ticket);
+    DownloadSocket * downloadSocket = new DownloadSocket(museekd(), download);
+    downloadSocket->setUser(user);
+    download->setSocket(downloadSocket);
+    museekd()->reactor()->add(downloadSocket);
+    return downloadSocket->resume(fd);
+}
+
 /**
   * Download a folder: first get the folder contents, then download all the files it contains.
   * The path should be encoded with utf8 encoding. Separator should be the network one (backslash).
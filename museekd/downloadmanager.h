@@ -142,6 +142,9 @@ namespace Museek
 
     /* Add a new download or retry an existing one. */
     void add(const std::string & user, const std::string & path, const std::string & localPath = std::string(), const uint & ticket = 0);
+    /* Continue a download on a connection handed over by the previous
+       instance (see Handoff). Takes ownership of fd. */
+    bool resume(const std::string & user, const std::string & path, uint ticket, int fd);
     /* Download a folder: first get the folder contents, then download
        all the files it contains. */
     void addFolder(const std::string & user, const std::string & path, const std::string & localPath = std::string());
@@ -37,6 +37,7 @@ Museek::DownloadSocket::DownloadSocket(Museek::Museekd * museekd, Museek::Downlo
     // Connect disconnected event.
     disconnectedEvent.connect(this, &DownloadSocket::onDisconnected);
     cannotConnectEvent.connect(this, &DownloadSocket::onCannotConnect);
+    setSocketOptions(museekd->socketOptions("download"));
 }
 
 Museek::DownloadSocket::~DownloadSocket()
@@ -138,6 +139,33 @@ Museek::DownloadSocket::stop()
     disconnect();
 }
 
+void
+Museek::DownloadSocket::syncOutput()
+{
+    if(m_Output.is_open())
+        m_Output.flush();
+}
+
+/*
+    Hot restart: the previous instance handed us a connection in the middle of the transfer. The
+    uploader doesn't know anything happened, everything it sent so far is in the incomplete file
+    or still waiting in the connection.
+*/
+bool
+Museek::DownloadSocket::resume(int fd)
+{
+    setDescriptor(fd);
+    setSocketState(SocketConnected);
+    setNeedsObfuscated(false);
+
+    if(! openIncompleteFile())
+        return false;
+
+    m_DataTimeout = museekd()->reactor()->addTimeout(60000, this, &DownloadSocket::dataTimeout);
+    m_Download->setState(TS_Transferring);
+    return true;
+}
+
 /*
     We have received the ticket, we can start downloading
 */
@@ -40,6 +40,12 @@ namespace Museek
     void wait();
     void stop();
 
+    /* Write what was received so far to the incomplete file. */
+    void syncOutput();
+    /* Continue a transfer on a connection handed over by the previous
+       instance, from the end of the incomplete file. */
+    bool resume(int fd);
+
   private:
     bool openIncompleteFile();
     void onConnected(NewNet::ClientSocket * socket);
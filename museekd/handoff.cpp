@@ -0,0 +1,627 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "handoff.h"
+#include "museekd.h"
+#include "servermanager.h"
+#include "peermanager.h"
+#include "ifacemanager.h"
+#include "downloadmanager.h"
+#include "downloadsocket.h"
+#include "uploadmanager.h"
+#include "uploadsocket.h"
+#include <NewNet/nnlog.h>
+#include <NewNet/nntcpserversocket.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <algorithm>
+#ifndef WIN32
+# include <sys/types.h>
+# include <sys/socket.h>
+# include <sys/wait.h>
+# include <poll.h>
+# include <unistd.h>
+#endif // WIN32
+
+#ifndef WIN32 // No descriptor passing on win32
+
+/* The state is a blob of little endian integers and length prefixed
+   strings, followed by the descriptors it refers to by index. */
+#define HANDOFF_MAGIC 0x4f48554d
+#define HANDOFF_VERSION 1
+/* Descriptors passed per sendmsg(), stay well below SCM_MAX_FD. */
+#define HANDOFF_FD_CHUNK 64
+
+namespace
+{
+  void putInt(std::string & out, uint32 value)
+  {
+    for(int i = 0; i < 4; ++i)
+      out += (char)((value >> (i * 8)) & 0xff);
+  }
+
+  void putInt64(std::string & out, uint64 value)
+  {
+    putInt(out, value & 0xffffffff);
+    putInt(out, value >> 32);
+  }
+
+  void putString(std::string & out, const std::string & value)
+  {
+    putInt(out, value.size());
+    out += value;
+  }
+
+  /* Reads the blob, remembers if it ran past the end. */
+  class Reader
+  {
+  public:
+    Reader(const std::string & data) : m_Data(data), m_Pos(0), m_Failed(false)
+    {
+    }
+
+    bool failed() const
+    {
+      return m_Failed;
+    }
+
+    uint32 getInt()
+    {
+      if(m_Pos + 4 > m_Data.size())
+      {
+        m_Failed = true;
+        return 0;
+      }
+      uint32 value = 0;
+      for(int i = 0; i < 4; ++i)
+        value |= (uint32)(unsigned char)m_Data[m_Pos++] << (i * 8);
+      return value;
+    }
+
+    uint64 getInt64()
+    {
+      uint64 low = getInt();
+      return low | ((uint64)getInt() << 32);
+    }
+
+    std::string getString()
+    {
+      uint32 length = getInt();
+      if(m_Failed || (length > m_Data.size() - m_Pos))
+      {
+        m_Failed = true;
+        return std::string();
+      }
+      std::string value(m_Data, m_Pos, length);
+      m_Pos += length;
+      return value;
+    }
+
+  private:
+    const std::string & m_Data;
+    size_t m_Pos;
+    bool m_Failed;
+  };
+
+  bool writeAll(int fd, const char * data, size_t n)
+  {
+    while(n > 0)
+    {
+      ssize_t written = write(fd, data, n);
+      if(written < 0 && errno == EINTR)
+        continue;
+      if(written <= 0)
+        return false;
+      data += written;
+      n -= written;
+    }
+    return true;
+  }
+
+  /* Read exactly n bytes, collecting any descriptor that comes along. */
+  bool readAll(int fd, char * data, size_t n, std::vector<int> & fds)
+  {
+    while(n > 0)
+    {
+      struct iovec iov;
+      iov.iov_base = data;
+      iov.iov_len = n;
+
+      union
+      {
+        struct cmsghdr header;
+        char data[CMSG_SPACE(HANDOFF_FD_CHUNK * sizeof(int))];
+      } control;
+
+      struct msghdr msg;
+      memset(&msg, 0, sizeof(msg));
+      msg.msg_iov = &iov;
+      msg.msg_iovlen = 1;
+      msg.msg_control = control.data;
+      msg.msg_controllen = sizeof(control.data);
+
+      ssize_t received = recvmsg(fd, &msg, 0);
+      if(received < 0 && errno == EINTR)
+        continue;
+      if(received <= 0)
+        return false;
+
+      for(struct cmsghdr * cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+      {
+        if((cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SCM_RIGHTS))
+          continue;
+        size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for(size_t i = 0; i < count; ++i)
+        {
+          int passed;
+          memcpy(&passed, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+          fds.push_back(passed);
+        }
+      }
+
+      data += received;
+      n -= received;
+    }
+    return true;
+  }
+
+  bool sendDescriptors(int fd, const int * fds, size_t count)
+  {
+    char byte = 'F';
+    struct iovec iov;
+    iov.iov_base = &byte;
+    iov.iov_len = 1;
+
+    union
+    {
+      struct cmsghdr header;
+      char data[CMSG_SPACE(HANDOFF_FD_CHUNK * sizeof(int))];
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.data;
+    msg.msg_controllen = CMSG_SPACE(count * sizeof(int));
+
+    struct cmsghdr * cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(count * sizeof(int));
+    memcpy(CMSG_DATA(cmsg), fds, count * sizeof(int));
+
+    return sendmsg(fd, &msg, 0) == 1;
+  }
+}
+
+Museek::Handoff::Handoff(Museekd * museekd) : m_Museekd(museekd)
+{
+  m_Session.fd = -1;
+}
+
+Museek::Handoff::~Handoff()
+{
+  std::vector<int>::iterator it, end = m_Descriptors.end();
+  for(it = m_Descriptors.begin(); it != end; ++it)
+    if(*it != -1)
+      close(*it);
+}
+
+bool
+Museek::Handoff::restart(char ** argv)
+{
+  /* Prepare the command line now, the child shouldn't allocate between
+     fork() and exec(). */
+  int sv[2];
+  if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0)
+  {
+    NNLOG("museekd.warn", "Couldn't create the hot restart channel: %s.", strerror(errno));
+    return false;
+  }
+  char channel[16];
+  snprintf(channel, sizeof(channel), "%d", sv[1]);
+  std::vector<char *> args;
+  for(int i = 0; argv[i]; ++i)
+  {
+    if(strcmp(argv[i], "--handoff") == 0)
+    {
+      if(argv[i + 1])
+        ++i;
+      continue;
+    }
+    args.push_back(argv[i]);
+  }
+  args.push_back((char *)"--handoff");
+  args.push_back(channel);
+  args.push_back(0);
+  long maxFd = sysconf(_SC_OPEN_MAX);
+
+  pid_t pid = fork();
+  if(pid < 0)
+  {
+    NNLOG("museekd.warn", "Couldn't fork the new instance: %s.", strerror(errno));
+    close(sv[0]);
+    close(sv[1]);
+    return false;
+  }
+  if(pid == 0)
+  {
+    /* Everything the new instance gets comes through the channel. Sockets
+       we don't hand over must close when we exit. */
+    for(long fd = 3; fd < maxFd; ++fd)
+      if(fd != sv[1])
+        close(fd);
+    execvp(args[0], &args[0]);
+    _exit(127);
+  }
+
+  close(sv[1]);
+  NNLOG("museekd.debug", "Handing over to the new instance (pid %d).", (int)pid);
+  bool ok = send(sv[0]);
+  close(sv[0]);
+  if(! ok)
+    waitpid(pid, 0, WNOHANG);
+  return ok;
+}
+
+void
+Museek::Handoff::collect(std::vector<int> & fds)
+{
+  m_Listeners.clear();
+  m_Uploads.clear();
+  m_Downloads.clear();
+  m_Session.fd = -1;
+
+  PeerManager * peers = museekd()->peers();
+  if(peers->peerFactory() && (peers->peerFactory()->serverSocket()->socketState() == NewNet::Socket::SocketListening))
+  {
+    m_Listeners["peers"] = fds.size();
+    fds.push_back(peers->peerFactory()->serverSocket()->descriptor());
+  }
+  if(peers->obfuscatedFactory() && (peers->obfuscatedFactory()->serverSocket()->socketState() == NewNet::Socket::SocketListening))
+  {
+    m_Listeners["peers.obfuscated"] = fds.size();
+    fds.push_back(peers->obfuscatedFactory()->serverSocket()->descriptor());
+  }
+
+  const std::map<std::string, NewNet::RefPtr<NewNet::ServerSocket> > & listeners = museekd()->ifaces()->listeners();
+  std::map<std::string, NewNet::RefPtr<NewNet::ServerSocket> >::const_iterator lit;
+  for(lit = listeners.begin(); lit != listeners.end(); ++lit)
+  {
+    if((*lit).second->socketState() != NewNet::Socket::SocketListening)
+      continue;
+    m_Listeners["iface:" + (*lit).first] = fds.size();
+    fds.push_back((*lit).second->descriptor());
+  }
+
+  /* A session that's still logging in is simply started again. */
+  TcpMessageSocket * server = museekd()->server()->socket();
+  if(server && museekd()->server()->loggedIn() && (server->socketState() == NewNet::Socket::SocketConnected))
+  {
+    m_Session.fd = fds.size();
+    fds.push_back(server->descriptor());
+    m_Session.rooms = museekd()->server()->joinedRooms();
+    m_Session.received = std::string((const char *)server->receiveBuffer().data(), server->receiveBuffer().count());
+    m_Session.unsent = std::string((const char *)server->sendBuffer().data(), server->sendBuffer().count());
+  }
+
+  /* Running transfers keep their connection, uploads waiting for their
+     turn go back to the queue. Obfuscated connections have a cipher state
+     we can't hand over. */
+  std::vector<NewNet::RefPtr<Upload> >::const_iterator uit;
+  for(uit = museekd()->uploads()->uploads().begin(); uit != museekd()->uploads()->uploads().end(); ++uit)
+  {
+    Upload * upload = *uit;
+    Transfer transfer;
+    transfer.user = upload->user();
+    transfer.path = upload->localPath();
+    transfer.ticket = upload->ticket();
+    transfer.position = 0;
+    transfer.fd = -1;
+    UploadSocket * socket = upload->socket();
+    if((upload->state() == TS_Transferring) && socket && ! socket->needsObfuscated()
+       && (socket->socketState() == NewNet::Socket::SocketConnected))
+    {
+      transfer.position = socket->sentPosition();
+      transfer.fd = fds.size();
+      fds.push_back(socket->descriptor());
+    }
+    else if((upload->state() == TS_Finished) || (upload->state() == TS_Aborted)
+            || (upload->state() == TS_LocalError) || (upload->state() == TS_RemoteError))
+      continue;
+    m_Uploads.push_back(transfer);
+  }
+
+  /* The download list itself is saved to disk before the restart. */
+  std::vector<NewNet::RefPtr<Download> >::const_iterator dit;
+  for(dit = museekd()->downloads()->downloads().begin(); dit != museekd()->downloads()->downloads().end(); ++dit)
+  {
+    Download * download = *dit;
+    DownloadSocket * socket = download->socket();
+    if((download->state() != TS_Transferring) || ! socket || socket->needsObfuscated()
+       || (socket->socketState() != NewNet::Socket::SocketConnected) || (socket->sendBuffer().count() > 0))
+      continue;
+    socket->syncOutput();
+    Transfer transfer;
+    transfer.user = download->user();
+    transfer.path = download->remotePath();
+    transfer.ticket = download->ticket();
+    transfer.position = download->position();
+    transfer.fd = fds.size();
+    fds.push_back(socket->descriptor());
+    m_Downloads.push_back(transfer);
+  }
+}
+
+bool
+Museek::Handoff::send(int channel)
+{
+  std::vector<int> fds;
+  collect(fds);
+
+  std::string state;
+  putInt(state, HANDOFF_MAGIC);
+  putInt(state, HANDOFF_VERSION);
+
+  putInt(state, m_Listeners.size());
+  std::map<std::string, int>::const_iterator lit;
+  for(lit = m_Listeners.begin(); lit != m_Listeners.end(); ++lit)
+  {
+    putString(state, (*lit).first);
+    putInt(state, (*lit).second);
+  }
+
+  putInt(state, m_Session.fd);
+  if(m_Session.fd != -1)
+  {
+    putInt(state, m_Session.rooms.size());
+    std::vector<std::string>::const_iterator rit;
+    for(rit = m_Session.rooms.begin(); rit != m_Session.rooms.end(); ++rit)
+      putString(state, *rit);
+    putString(state, m_Session.received);
+    putString(state, m_Session.unsent);
+  }
+
+  std::vector<Transfer> * lists[2] = { &m_Uploads, &m_Downloads };
+  for(int l = 0; l < 2; ++l)
+  {
+    putInt(state, lists[l]->size());
+    std::vector<Transfer>::const_iterator tit;
+    for(tit = lists[l]->begin(); tit != lists[l]->end(); ++tit)
+    {
+      putString(state, (*tit).user);
+      putString(state, (*tit).path);
+      putInt(state, (*tit).ticket);
+      putInt64(state, (*tit).position);
+      putInt(state, (*tit).fd);
+    }
+  }
+
+  std::string header;
+  putInt(header, state.size());
+  putInt(header, fds.size());
+  if(! writeAll(channel, header.data(), header.size()) || ! writeAll(channel, state.data(), state.size()))
+  {
+    NNLOG("museekd.warn", "Couldn't send the state to the new instance.");
+    return false;
+  }
+  for(size_t i = 0; i < fds.size(); i += HANDOFF_FD_CHUNK)
+  {
+    size_t count = std::min((size_t)HANDOFF_FD_CHUNK, fds.size() - i);
+    if(! sendDescriptors(channel, &fds[i], count))
+    {
+      NNLOG("museekd.warn", "Couldn't pass the descriptors to the new instance: %s.", strerror(errno));
+      return false;
+    }
+  }
+
+  /* The new instance confirms once it holds everything. Until then we're
+     still in charge. */
+  struct pollfd pfd;
+  pfd.fd = channel;
+  pfd.events = POLLIN;
+  char ack = 0;
+  if((poll(&pfd, 1, 30000) != 1) || (read(channel, &ack, 1) != 1) || (ack != 'K'))
+  {
+    NNLOG("museekd.warn", "The new instance didn't confirm the handover.");
+    return false;
+  }
+
+  NNLOG("museekd.debug", "Handed over %u listeners, %s, %u uploads and %u downloads.",
+        (unsigned int)m_Listeners.size(), m_Session.fd != -1 ? "the server session" : "no server session",
+        (unsigned int)m_Uploads.size(), (unsigned int)m_Downloads.size());
+  return true;
+}
+
+bool
+Museek::Handoff::receive(int channel)
+{
+  std::vector<int> fds;
+  char header[8];
+  if(! readAll(channel, header, 8, fds))
+  {
+    NNLOG("museekd.warn", "Couldn't read the state of the previous instance.");
+    return false;
+  }
+  std::string headerData(header, 8);
+  Reader headerReader(headerData);
+  uint32 stateSize = headerReader.getInt();
+  uint32 fdCount = headerReader.getInt();
+
+  std::string state(stateSize, '\0');
+  if((stateSize > 0) && ! readAll(channel, &state[0], stateSize, fds))
+  {
+    NNLOG("museekd.warn", "Couldn't read the state of the previous instance.");
+    return false;
+  }
+  while(fds.size() < fdCount)
+  {
+    char byte;
+    if(! readAll(channel, &byte, 1, fds))
+      break;
+  }
+  m_Descriptors = fds;
+  if(m_Descriptors.size() != fdCount)
+  {
+    NNLOG("museekd.warn", "Got %u descriptors from the previous instance instead of %u.", (unsigned int)m_Descriptors.size(), fdCount);
+    return false;
+  }
+
+  Reader reader(state);
+  if((reader.getInt() != HANDOFF_MAGIC) || (reader.getInt() != HANDOFF_VERSION))
+  {
+    NNLOG("museekd.warn", "The previous instance speaks another handover protocol.");
+    return false;
+  }
+
+  uint32 count = reader.getInt();
+  for(uint32 i = 0; (i < count) && ! reader.failed(); ++i)
+  {
+    std::string key = reader.getString();
+    m_Listeners[key] = reader.getInt();
+  }
+
+  m_Session.fd = reader.getInt();
+  if(m_Session.fd != -1)
+  {
+    count = reader.getInt();
+    for(uint32 i = 0; (i < count) && ! reader.failed(); ++i)
+      m_Session.rooms.push_back(reader.getString());
+    m_Session.received = reader.getString();
+    m_Session.unsent = reader.getString();
+  }
+
+  std::vector<Transfer> * lists[2] = { &m_Uploads, &m_Downloads };
+  for(int l = 0; l < 2; ++l)
+  {
+    count = reader.getInt();
+    for(uint32 i = 0; (i < count) && ! reader.failed(); ++i)
+    {
+      Transfer transfer;
+      transfer.user = reader.getString();
+      transfer.path = reader.getString();
+      transfer.ticket = reader.getInt();
+      transfer.position = reader.getInt64();
+      transfer.fd = reader.getInt();
+      lists[l]->push_back(transfer);
+    }
+  }
+
+  if(reader.failed())
+  {
+    NNLOG("museekd.warn", "The state of the previous instance is truncated.");
+    return false;
+  }
+
+  /* From now on the previous instance may go. */
+  char ack = 'K';
+  if(! writeAll(channel, &ack, 1))
+    return false;
+
+  NNLOG("museekd.debug", "Took over %u listeners, %s, %u uploads and %u downloads.",
+        (unsigned int)m_Listeners.size(), m_Session.fd != -1 ? "the server session" : "no server session",
+        (unsigned int)m_Uploads.size(), (unsigned int)m_Downloads.size());
+  return true;
+}
+
+#else
+
+Museek::Handoff::Handoff(Museekd * museekd) : m_Museekd(museekd)
+{
+  m_Session.fd = -1;
+}
+
+Museek::Handoff::~Handoff()
+{
+}
+
+bool
+Museek::Handoff::restart(char **)
+{
+  return false;
+}
+
+bool
+Museek::Handoff::receive(int)
+{
+  return false;
+}
+
+#endif // WIN32
+
+int
+Museek::Handoff::takeDescriptor(int index)
+{
+  if((index < 0) || ((size_t)index >= m_Descriptors.size()))
+    return -1;
+  int fd = m_Descriptors[index];
+  m_Descriptors[index] = -1;
+  return fd;
+}
+
+int
+Museek::Handoff::takeListener(const std::string & key)
+{
+  std::map<std::string, int>::iterator it = m_Listeners.find(key);
+  if(it == m_Listeners.end())
+    return -1;
+  int fd = takeDescriptor((*it).second);
+  m_Listeners.erase(it);
+  return fd;
+}
+
+void
+Museek::Handoff::adopt()
+{
+  /* Transfers first: once the session is back the managers start looking
+     for work, and these are already done. */
+  std::vector<Transfer>::const_iterator it;
+  for(it = m_Downloads.begin(); it != m_Downloads.end(); ++it)
+  {
+    int fd = takeDescriptor((*it).fd);
+    if(fd != -1)
+      museekd()->downloads()->resume((*it).user, (*it).path, (*it).ticket, fd);
+  }
+  for(it = m_Uploads.begin(); it != m_Uploads.end(); ++it)
+  {
+    int fd = takeDescriptor((*it).fd);
+    if(fd != -1)
+      museekd()->uploads()->resume((*it).user, (*it).path, (*it).ticket, fd, (*it).position);
+  }
+
+  int fd = takeDescriptor(m_Session.fd);
+  if(fd != -1)
+    museekd()->server()->adopt(fd, m_Session.rooms, m_Session.received, m_Session.unsent);
+
+  for(it = m_Uploads.begin(); it != m_Uploads.end(); ++it)
+  {
+    if((*it).fd == -1)
+      museekd()->uploads()->add((*it).user, (*it).path, (*it).ticket);
+  }
+
+  m_Uploads.clear();
+  m_Downloads.clear();
+}
@@ -0,0 +1,99 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_HANDOFF_H
+#define MUSEEK_HANDOFF_H
+
+#include <NewNet/nnobject.h>
+#include <NewNet/nnweakrefptr.h>
+#include <NewNet/nnbuffer.h>
+#include "mutypes.h"
+#include <string>
+#include <vector>
+#include <map>
+
+namespace Museek
+{
+  class Museekd;
+
+  /* Hot restart. The running daemon starts a new instance of itself and
+     hands it its listening sockets, the server session and the connections
+     of the running transfers, over a unix socket with SCM_RIGHTS. The new
+     instance adopts them, so the peers and the server don't notice the
+     restart. Peer message connections and interfaces aren't handed over,
+     they're cheap to establish again. */
+  class Handoff : public NewNet::Object
+  {
+  public:
+    Handoff(Museekd * museekd);
+    /* Closes the descriptors that weren't adopted. */
+    ~Handoff();
+
+    Museekd * museekd() const
+    {
+      return m_Museekd;
+    }
+
+    /* Old instance: execute argv with '--handoff <fd>' and hand everything
+       over. Returns true when the new instance confirmed it has everything,
+       the caller should then exit without touching the sockets. Otherwise
+       the daemon can go on running. */
+    bool restart(char ** argv);
+
+    /* New instance: read the state sent by the old one and confirm. */
+    bool receive(int channel);
+
+    /* Take the descriptor of a listening socket ("peers", "peers.obfuscated"
+       or "iface:" followed by a bind path). Returns -1 if there's none. */
+    int takeListener(const std::string & key);
+
+    /* New instance: adopt the server session and the transfers. Call this
+       once the configuration and the downloads are loaded. */
+    void adopt();
+
+  private:
+    struct Session
+    {
+      int fd;
+      std::vector<std::string> rooms;
+      std::string received, unsent;
+    };
+
+    struct Transfer
+    {
+      std::string user, path;
+      uint ticket;
+      uint64 position;
+      int fd;
+    };
+
+    bool send(int channel);
+    void collect(std::vector<int> & fds);
+    int takeDescriptor(int index);
+
+    NewNet::WeakRefPtr<Museekd> m_Museekd;
+    std::map<std::string, int> m_Listeners;
+    Session m_Session;
+    std::vector<Transfer> m_Uploads, m_Downloads;
+    std::vector<int> m_Descriptors;
+  };
+}
+
+#endif // MUSEEK_HANDOFF_H
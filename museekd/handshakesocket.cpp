@@ -92,11 +92,19 @@ Museek::HandshakeSocket::onMessageReceived(const MessageData * data)
         receiveBuffer().clear();
       if(msg.type == "P")
       {
-        // Create a new PeerSocket which will copy our descriptor and state.
-        Museek::PeerSocket * that = new Museek::PeerSocket(this);
-        museekd()->peers()->addPeerSocket(that);
-        // Add the newly constructed socket to the reactor.
-        reactor()->add(that);
+        if(! museekd()->peers()->acceptsPeer(m_User))
+        {
+          // We're overloaded, hang up.
+          disconnect(false);
+        }
+        else
+        {
+          // Create a new PeerSocket which will copy our descriptor and state.
+          Museek::PeerSocket * that = new Museek::PeerSocket(this);
+          museekd()->peers()->addPeerSocket(that);
+          // Add the newly constructed socket to the reactor.
+          reactor()->add(that);
+        }
       }
       else if(msg.type == "F")
       {
@@ -22,6 +22,8 @@ MAP_MESSAGE(0x0000, IPing, pingEvent)
 MAP_MESSAGE(0x0002, ILogin, loginEvent)
 MAP_MESSAGE(0x0004, ICheckPrivileges, checkPrivilegesEvent)
 MAP_MESSAGE(0x0005, ISetStatus, setStatusEvent)
+MAP_MESSAGE(0x0006, ILocalTransport, localTransportEvent)
+MAP_MESSAGE(0x0008, IStatistics, statisticsEvent)
 MAP_C_MESSAGE(0x0012, INewPassword, newPasswordEvent)
 
 // These messages require the crypto context
@@ -27,16 +27,27 @@
 #include "sharesdatabase.h"
 #include "servermanager.h"
 #include "peersocket.h"
+#include "distributedsocket.h"
+#include "uploadsocket.h"
+#include "downloadsocket.h"
+#include "tcpmessagesocket.h"
 #include "downloadmanager.h"
 #include "uploadmanager.h"
 #include "searchmanager.h"
 #include "peermanager.h"
+#include "handoff.h"
+#ifndef WIN32
+# include "ifacering.h"
+#endif // WIN32
 #include <Muhelp/string_ext.hh>
 #include <NewNet/nnunixfactorysocket.h>
 #include <NewNet/nntcpfactorysocket.h>
 #include <NewNet/nnlog.h>
+#include <NewNet/util.h>
+#include <NewNet/nnclock.h>
 
 #include <fstream>
+#include <sstream>
 
 #define SEND_MESSAGE(SOCKET, MESSAGE) (SOCKET)->sendMessage(MESSAGE.make_network_packet())
 #define SEND_ALL(MESSAGE) \
@@ -77,7 +88,9 @@ Museek::IfaceManager::IfaceManager(Museekd * museekd) : m_Museekd(museekd)
   m_AwayState = 0;
   m_ReceivedTimeDiff = false;
 
-  NNLOG.logEvent.connect(this, &IfaceManager::onLog);
+  m_LogCallback = 0;
+  m_LogRate = 20;
+  m_LogBurst = 50;
 
   museekd->config()->keySetEvent.connect(this, &IfaceManager::onConfigKeySet);
   museekd->config()->keyRemovedEvent.connect(this, &IfaceManager::onConfigKeyRemoved);
@@ -128,6 +141,17 @@ Museek::IfaceManager::IfaceManager(Museekd * museekd) : m_Museekd(museekd)
 
   museekd->peers()->peerSocketUnavailableEvent.connect(this, &IfaceManager::onPeerSocketUnavailable);
   museekd->peers()->peerSocketReadyEvent.connect(this, &IfaceManager::onPeerSocketReady);
+
+  museekd->load()->levelChangedEvent.connect(this, &IfaceManager::onLoadLevelChanged);
+}
+
+/* Listening socket handed over by the previous instance, see Handoff. */
+int
+Museek::IfaceManager::adoptedListener(const std::string & path)
+{
+  if(! museekd()->handoff())
+    return -1;
+  return museekd()->handoff()->takeListener("iface:" + path);
 }
 
 bool
@@ -142,7 +166,11 @@ Museek::IfaceManager::addListener(const std::string & path)
     NewNet::RefPtr<NewNet::UnixFactorySocket<IfaceSocket> > factory;
     factory = new NewNet::UnixFactorySocket<IfaceSocket>;
     factory->clientAcceptedEvent.connect(this, &IfaceManager::onIfaceAccepted);
-    factory->serverSocket()->listen(path);
+    int fd = adoptedListener(path);
+    if(fd != -1)
+      factory->serverSocket()->adopt(fd, path);
+    else
+      factory->serverSocket()->listen(path);
     if(factory->serverSocket()->socketState() != NewNet::Socket::SocketListening)
     {
       NNLOG("museekd.iface.warn", "Couldn't listen on unix path '%s'.", path.c_str());
@@ -166,7 +194,11 @@ Museek::IfaceManager::addListener(const std::string & path)
     NewNet::RefPtr<NewNet::TcpFactorySocket<IfaceSocket> > factory;
     factory = new NewNet::TcpFactorySocket<IfaceSocket>;
     factory->clientAcceptedEvent.connect(this, &IfaceManager::onIfaceAccepted);
-    factory->serverSocket()->listen(host, port);
+    int fd = adoptedListener(path);
+    if(fd != -1)
+      factory->serverSocket()->adopt(fd);
+    else
+      factory->serverSocket()->listen(host, port);
     if(factory->serverSocket()->socketState() != NewNet::Socket::SocketListening)
     {
       NNLOG("museekd.iface.warn", "Couldn't listen on '%s:%u'", host.c_str(), port);
@@ -196,9 +228,73 @@ Museek::IfaceManager::removeListener(const std::string & path)
     m_Factories.erase(fit);
 }
 
+/* Only listen to the logger while an interface wants debug messages, so
+   nothing is built for them otherwise. */
+void
+Museek::IfaceManager::updateLogForwarding()
+{
+  bool wanted = false;
+  std::vector<NewNet::RefPtr<IfaceSocket> >::const_iterator it;
+  for(it = m_Ifaces.begin(); it != m_Ifaces.end(); ++it)
+    if((*it)->authenticated() && ((*it)->mask() & EM_DEBUG))
+      wanted = true;
+
+  if(wanted && ! m_LogCallback)
+  {
+    m_LogRate = museekd()->config()->getInt("interfaces", "debug_rate", 20);
+    m_LogBurst = museekd()->config()->getInt("interfaces", "debug_burst", 50);
+    m_LogBudgets.clear();
+    m_LogCallback = NewNet::log.logEvent.connect(this, &IfaceManager::onLog);
+  }
+  else if(! wanted && m_LogCallback)
+  {
+    NewNet::log.logEvent.disconnect(m_LogCallback);
+    m_LogCallback = 0;
+  }
+}
+
+/* Each log domain may send debug_burst messages at once and debug_rate
+   messages per second after that. The rest is counted and reported with
+   the next message that gets through. A rate of 0 disables the limit. */
 void
 Museek::IfaceManager::onLog(const NewNet::Log::LogNotify * log)
 {
+  if(m_LogRate > 0)
+  {
+    const struct timeval & now = NewNet::clock.now();
+
+    std::map<std::string, LogBudget>::iterator it = m_LogBudgets.find(log->domain);
+    if(it == m_LogBudgets.end())
+    {
+      LogBudget budget;
+      budget.tokens = m_LogBurst;
+      budget.last = now;
+      budget.suppressed = 0;
+      it = m_LogBudgets.insert(std::make_pair(log->domain, budget)).first;
+    }
+    LogBudget & budget = it->second;
+
+    budget.tokens += difftime(now, budget.last) * m_LogRate / 1000.0;
+    if(budget.tokens > m_LogBurst)
+      budget.tokens = m_LogBurst;
+    budget.last = now;
+
+    if(budget.tokens < 1)
+    {
+      ++budget.suppressed;
+      return;
+    }
+    budget.tokens -= 1;
+
+    if(budget.suppressed)
+    {
+      std::stringstream notice;
+      notice << budget.suppressed << " messages suppressed";
+      budget.suppressed = 0;
+      SEND_MASK(EM_DEBUG, IDebugMessage(log->domain, notice.str()));
+    }
+  }
+
   SEND_MASK(EM_DEBUG, IDebugMessage(log->domain, log->message));
 }
 
@@ -211,6 +307,11 @@ Museek::IfaceManager::onConfigKeySet(const ConfigManager::ChangeNotify * data)
       return;
     addListener(data->key);
   }
+  else if(data->domain == "interfaces" && (data->key == "debug_rate" || data->key == "debug_burst"))
+  {
+    m_LogRate = museekd()->config()->getInt("interfaces", "debug_rate", 20);
+    m_LogBurst = museekd()->config()->getInt("interfaces", "debug_burst", 50);
+  }
   SEND_C_MASK(EM_CONFIG, IConfigSet((*it)->cipherContext(), data->domain, data->key, data->value));
 }
 
@@ -278,6 +379,7 @@ Museek::IfaceManager::onIfaceAccepted(IfaceSocket * socket)
 {
   NNLOG("museekd.iface.debug", "Accepted new interface socket.");
   m_Ifaces.push_back(socket);
+  socket->setSocketOptions(museekd()->socketOptions("interface"));
 
   // Connect the events
   socket->disconnectedEvent.connect(this, &IfaceManager::onIfaceDisconnected);
@@ -285,6 +387,8 @@ Museek::IfaceManager::onIfaceAccepted(IfaceSocket * socket)
   socket->loginEvent.connect(this, &IfaceManager::onIfaceLogin);
   socket->checkPrivilegesEvent.connect(this, &IfaceManager::onIfaceCheckPrivileges);
   socket->setStatusEvent.connect(this, &IfaceManager::onIfaceSetStatus);
+  socket->localTransportEvent.connect(this, &IfaceManager::onIfaceLocalTransport);
+  socket->statisticsEvent.connect(this, &IfaceManager::onIfaceStatistics);
   socket->newPasswordEvent.connect(this, &IfaceManager::onIfaceNewPassword);
   socket->setConfigEvent.connect(this, &IfaceManager::onIfaceSetConfig);
   socket->removeConfigEvent.connect(this, &IfaceManager::onIfaceRemoveConfig);
@@ -357,6 +461,7 @@ Museek::IfaceManager::onIfaceDisconnected(NewNet::ClientSocket * socket)
         m_Ifaces.erase(it);
     if(socket->reactor())
         socket->reactor()->remove(socket);
+    updateLogForwarding();
 }
 
 void
@@ -420,6 +525,7 @@ Museek::IfaceManager::onIfaceLogin(const ILogin * message)
     socket->setAuthenticated(true);
     socket->setMask(message->mask);
     socket->setCipherKey(password);
+    updateLogForwarding();
     SEND_MESSAGE(socket, ILogin(true, std::string(), std::string()));
     SEND_MESSAGE(socket, IServerState(museekd()->server()->loggedIn(), museekd()->server()->username()));
     if(socket->mask() & EM_CHAT) {
@@ -474,6 +580,177 @@ Museek::IfaceManager::onIfaceCheckPrivileges(const ICheckPrivileges * message)
   SEND_MESSAGE(museekd()->server(), SCheckPrivileges());
 }
 
+/* Roles of the connections, as given to Museekd::socketOptions(). */
+static const char * socketRoles[] = {
+  "server", "interface", "peer", "distributed", "upload", "download"
+};
+
+/* Index of the role of socket in socketRoles, -1 if it has none (still
+   shaking hands, listening...). */
+static int
+socketRole(Museek::Museekd * museekd, NewNet::Socket * socket)
+{
+  if(socket == museekd->server()->socket())
+    return 0;
+  if(dynamic_cast<Museek::IfaceSocket *>(socket))
+    return 1;
+  if(dynamic_cast<Museek::PeerSocket *>(socket))
+    return 2;
+  if(dynamic_cast<Museek::DistributedSocket *>(socket))
+    return 3;
+  if(dynamic_cast<Museek::UploadSocket *>(socket))
+    return 4;
+  if(dynamic_cast<Museek::DownloadSocket *>(socket))
+    return 5;
+  return -1;
+}
+
+/* Add the sockets.<role>.* counters of IStatistics. */
+static void
+socketStatistics(Museek::Museekd * museekd, IStatistics & stats)
+{
+  const int roles = sizeof(socketRoles) / sizeof(socketRoles[0]);
+  unsigned long count[roles];
+  NewNet::ClientSocket::SendStats sent[roles];
+  NewNet::ClientSocket * sample[roles];
+  memset(count, 0, sizeof(count));
+  memset(sent, 0, sizeof(sent));
+  memset(sample, 0, sizeof(sample));
+
+  std::vector<NewNet::RefPtr<NewNet::Socket> >::const_iterator it = museekd->reactor()->sockets().begin();
+  for(; it != museekd->reactor()->sockets().end(); ++it)
+  {
+    int role = socketRole(museekd, *it);
+    if(role < 0)
+      continue;
+    NewNet::ClientSocket * socket = static_cast<NewNet::ClientSocket *>((*it).ptr());
+    const NewNet::ClientSocket::SendStats & s = socket->sendStats();
+    ++count[role];
+    sent[role].queued += s.queued;
+    sent[role].sent += s.sent;
+    sent[role].writes += s.writes;
+    sent[role].flushes += s.flushes;
+    sent[role].capped += s.capped;
+    if(! sample[role] && socket->descriptor() != -1)
+      sample[role] = socket;
+  }
+
+  for(int i = 0; i < roles; ++i)
+  {
+    std::string prefix = std::string("sockets.") + socketRoles[i];
+    stats.add(prefix, "count", count[i]);
+    stats.add(prefix, "queued", sent[i].queued);
+    stats.add(prefix, "sent", sent[i].sent);
+    stats.add(prefix, "writes", sent[i].writes);
+    stats.add(prefix, "flushes", sent[i].flushes);
+    stats.add(prefix, "capped", sent[i].capped);
+    if(! sample[i])
+      continue;
+
+    /* Read back once per descriptor, the options of a role are the same on
+       all its sockets. */
+    const NewNet::ClientSocket::SocketOptions & options = sample[i]->effectiveSocketOptions();
+    stats.add(prefix, "send_buffer", options.sendBuffer);
+    stats.add(prefix, "receive_buffer", options.receiveBuffer);
+    stats.add(prefix, "nodelay", options.noDelay);
+    stats.add(prefix, "keepalive", options.keepAlive);
+    stats.add(prefix, "keepalive_interval", options.keepAliveInterval);
+    stats.add(prefix, "keepalive_count", options.keepAliveCount);
+    stats.add(prefix, "notsent_lowat", options.notSentLowat);
+  }
+}
+
+/* Add the load.* counters of IStatistics. */
+static void
+loadStatistics(Museek::LoadMonitor * load, IStatistics & stats)
+{
+  static const char * levels[] = {
+    0, "drop_searches", "no_forwarding", "defer_updates", "refuse_peers"
+  };
+
+  stats.add("load", "level", load->level());
+  stats.add("load", "lag", load->lag() > 0 ? load->lag() : 0);
+  for(int i = Museek::LoadMonitor::DropSearches; i < Museek::LoadMonitor::Levels; ++i)
+  {
+    Museek::LoadMonitor::Level level = static_cast<Museek::LoadMonitor::Level>(i);
+    std::string prefix = std::string("load.") + levels[i];
+    stats.add(prefix, "entered", load->entered(level));
+    stats.add(prefix, "shed", load->shed(level));
+  }
+}
+
+/* Add the searches.* counters of IStatistics. */
+static void
+searchStatistics(Museek::SearchManager * searches, IStatistics & stats)
+{
+  static const char * reasons[] = {
+    "overloaded", "duplicate", "flooding", "too_busy", "too_expensive", "queue_full", "expired"
+  };
+
+  for(int i = 0; i < Museek::SearchAdmission::Reasons; ++i)
+    stats.add("searches.dropped", reasons[i], searches->admission()->dropped(static_cast<Museek::SearchAdmission::Reason>(i)));
+}
+
+void
+Museek::IfaceManager::onIfaceStatistics(const IStatistics * message)
+{
+  IStatistics reply;
+  socketStatistics(museekd(), reply);
+  loadStatistics(museekd()->load(), reply);
+  searchStatistics(museekd()->searches(), reply);
+  reply.add("searches.cache", "hits", museekd()->shares()->cacheHits() + museekd()->buddyshares()->cacheHits());
+  reply.add("searches.cache", "misses", museekd()->shares()->cacheMisses() + museekd()->buddyshares()->cacheMisses());
+  SEND_MESSAGE(message->ifaceSocket(), reply);
+}
+
+/* Flags of ILocalTransport. */
+#define LT_SHARED_MEMORY 0x01
+#define LT_PLAINTEXT 0x02
+
+void
+Museek::IfaceManager::onIfaceLocalTransport(const ILocalTransport * message)
+{
+  IfaceSocket * socket = message->ifaceSocket();
+  uint32 granted = 0;
+
+#ifndef WIN32
+  /* Only unix sockets can tell who's on the other side, and only our own
+     user may skip the cipher or map our memory. */
+  IfaceRing * ring = 0;
+  uid_t uid;
+  if(! socket->peerUid(uid) || (uid != getuid()))
+    NNLOG("museekd.iface.warn", "Refused local transport to an interface that isn't running as our user.");
+  else
+  {
+    granted = message->flags & LT_PLAINTEXT;
+    if((message->flags & LT_SHARED_MEMORY) && ! socket->ring())
+    {
+      ring = new IfaceRing;
+      if(ring->create(museekd()->config()->getInt("interfaces", "local_ring_size", 4 * 1024 * 1024))
+         && socket->sendDescriptor(ring->descriptor()))
+        granted |= LT_SHARED_MEMORY;
+      else
+      {
+        delete ring;
+        ring = 0;
+      }
+    }
+  }
+
+  /* The reply carries the descriptor, it must go through the socket:
+     install the ring after it was queued. */
+  SEND_MESSAGE(socket, ILocalTransport(granted, ring ? ring->size() : 0));
+  if(ring)
+    socket->setRing(ring, museekd()->config()->getInt("interfaces", "local_threshold", 4096));
+#else
+  SEND_MESSAGE(socket, ILocalTransport(granted, 0));
+#endif // WIN32
+
+  socket->setPlaintext(granted & LT_PLAINTEXT);
+  if(granted)
+    NNLOG("museekd.iface.debug", "Interface switched to the local transport, flags: %u.", granted);
+}
+
 void
 Museek::IfaceManager::onIfaceSetStatus(const ISetStatus * message)
 {
@@ -1408,27 +1685,66 @@ Museek::IfaceManager::sendStatusMessage(bool type, std::string message)
 void
 Museek::IfaceManager::onDownloadUpdated(Download * download)
 {
+  if(museekd()->load()->shedding(LoadMonitor::DeferUpdates))
+  {
+    /* Only the latest state matters, it's read when sending. */
+    if(m_DeferredDownloads.insert(std::make_pair(download, NewNet::RefPtr<Download>(download))).second)
+      museekd()->load()->countShed(LoadMonitor::DeferUpdates);
+    return;
+  }
   SEND_MASK(EM_TRANSFERS, ITransferUpdate(download));
 }
 
 void
 Museek::IfaceManager::onDownloadRemoved(Download * download)
 {
+  m_DeferredDownloads.erase(download);
   SEND_MASK(EM_TRANSFERS, ITransferRemove(false, download->user(), download->remotePath()));
 }
 
 void
 Museek::IfaceManager::onUploadUpdated(Upload * upload)
 {
+  if(museekd()->load()->shedding(LoadMonitor::DeferUpdates))
+  {
+    if(m_DeferredUploads.insert(std::make_pair(upload, NewNet::RefPtr<Upload>(upload))).second)
+      museekd()->load()->countShed(LoadMonitor::DeferUpdates);
+    return;
+  }
   SEND_MASK(EM_TRANSFERS, ITransferUpdate(upload));
 }
 
 void
 Museek::IfaceManager::onUploadRemoved(Upload * upload)
 {
+    m_DeferredUploads.erase(upload);
     SEND_MASK(EM_TRANSFERS, ITransferRemove(true, upload->user(), museekd()->codeset()->fromFsToUtf8(upload->localPath())));
 }
 
+void
+Museek::IfaceManager::onLoadLevelChanged(LoadMonitor::Level level)
+{
+  if(level < LoadMonitor::DeferUpdates)
+    sendDeferredUpdates();
+}
+
+void
+Museek::IfaceManager::sendDeferredUpdates()
+{
+  std::map<Download *, NewNet::RefPtr<Download> > downloads;
+  std::map<Upload *, NewNet::RefPtr<Upload> > uploads;
+  downloads.swap(m_DeferredDownloads);
+  uploads.swap(m_DeferredUploads);
+
+  std::map<Download *, NewNet::RefPtr<Download> >::iterator dit;
+  for(dit = downloads.begin(); dit != downloads.end(); ++dit)
+    SEND_MASK(EM_TRANSFERS, ITransferUpdate(dit->first));
+
+  std::map<Upload *, NewNet::RefPtr<Upload> >::iterator uit;
+  for(uit = uploads.begin(); uit != uploads.end(); ++uit)
+    SEND_MASK(EM_TRANSFERS, ITransferUpdate(uit->first));
+}
+
 void
 Museek::IfaceManager::onSearchReply(uint ticket, const std::string & user, bool slotfree, uint avgspeed, uint queuelen, const Folder & folders, const Folder & locked)
 {
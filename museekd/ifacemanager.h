@@ -25,6 +25,7 @@
 #include "servermessages.h"
 #include "configmanager.h"
 #include "peermessages.h"
+#include "loadmonitor.h"
 #include <NewNet/nnobject.h>
 #include <NewNet/nnrefptr.h>
 #include <NewNet/nnweakrefptr.h>
@@ -70,7 +71,14 @@ namespace Museek
 
     void sendNewSearchToAll(const std::string & query, uint token);
 
+    /* Listening sockets, by bind path. */
+    const std::map<std::string, NewNet::RefPtr<NewNet::ServerSocket> > & listeners() const
+    {
+      return m_ServerSockets;
+    }
+
   private:
+    int adoptedListener(const std::string & path);
     bool addListener(const std::string & path);
     void removeListener(const std::string & path);
 
@@ -78,6 +86,7 @@ namespace Museek
 
     // Log event handler:
     void onLog(const NewNet::Log::LogNotify * notice);
+    void updateLogForwarding();
 
     // Config changed listener events:
     void onConfigKeySet(const ConfigManager::ChangeNotify * data);
@@ -90,6 +99,8 @@ namespace Museek
     void onIfaceLogin(const ILogin * message);
     void onIfaceCheckPrivileges(const ICheckPrivileges * message);
     void onIfaceSetStatus(const ISetStatus * message);
+    void onIfaceLocalTransport(const ILocalTransport * message);
+    void onIfaceStatistics(const IStatistics * message);
     void onIfaceNewPassword(const INewPassword * message);
     void onIfaceSetConfig(const IConfigSet * message);
     void onIfaceRemoveConfig(const IConfigRemove * message);
@@ -199,12 +210,21 @@ namespace Museek
     void onUploadUpdated(Upload * upload);
     void onUploadRemoved(Upload * upload);
 
+    // Overload protection: transfer updates are held back while the
+    // daemon is overloaded and sent when it recovers.
+    void onLoadLevelChanged(LoadMonitor::Level level);
+    void sendDeferredUpdates();
+
     NewNet::WeakRefPtr<Museekd> m_Museekd;
 
     std::map<std::string, NewNet::RefPtr<NewNet::Object> > m_Factories;
     std::map<std::string, NewNet::RefPtr<NewNet::ServerSocket> > m_ServerSockets;
     std::vector<NewNet::RefPtr<IfaceSocket> > m_Ifaces;
 
+    // Transfers with an update held back by overload protection:
+    std::map<Download *, NewNet::RefPtr<Download> > m_DeferredDownloads;
+    std::map<Upload *, NewNet::RefPtr<Upload> > m_DeferredUploads;
+
     // Pending requests:
     std::map<std::string, std::vector<NewNet::WeakRefPtr<IfaceSocket> > > m_PendingInfo, m_PendingShares;
     std::vector<std::string> m_PendingInfoWaiting, m_PendingSharesWaiting; // List of users we don't have yet asked the pendinginfo/shares
@@ -232,6 +252,17 @@ namespace Museek
       std::string message;
     };
     std::vector<PrivateMessage> m_PrivateMessages;
+
+    // Debug messages forwarded to interfaces, limited per log domain:
+    struct LogBudget
+    {
+      double tokens;
+      struct timeval last;
+      uint32 suppressed;
+    };
+    NewNet::Event<const NewNet::Log::LogNotify *>::Callback * m_LogCallback;
+    std::map<std::string, LogBudget> m_LogBudgets;
+    double m_LogRate, m_LogBurst;
   };
 }
 
@@ -101,7 +101,12 @@ public:
 		return r;
 	}
 
+	/* Interfaces on the plaintext local transport have no context. */
 	inline void cipher(CipherContext* ctx, const std::string& s) {
+		if(! ctx) {
+			pack(s);
+			return;
+		}
 		pack((uint32)s.size());
 
 		uint32 len = CIPHER_BLOCK(s.size());
@@ -113,9 +118,18 @@ public:
 	}
 
 	inline std::string decipher(CipherContext* ctx) {
+		if(! ctx)
+			return unpack_string();
 		uint32 s_len = unpack_int(),
 		       c_len = CIPHER_BLOCK(s_len);
 
+		// Don't trust the length, the message is malformed if it's too long.
+		if(c_len < s_len || c_len > buffer.count()) {
+			NNLOG("museekd.warn", "Corrupted message encountered (ciphered string too long).");
+			buffer.clear();
+			return std::string();
+		}
+
 		unsigned char ciph[c_len], deciph[c_len];
 		for(uint32 i = 0; i < c_len; i++)
 			ciph[i] = unpack_char();
@@ -285,6 +299,114 @@ IFACEMESSAGE(ISetStatus, 0x0005)
 	uint32 status;
 END
 
+IFACEMESSAGE(ILocalTransport, 0x0006)
+/*
+	Local transport -- Switch a logged in interface on a unix socket to the
+	local transport. Only granted to clients running as the daemon's user.
+	Don't send ciphered messages between the request and the reply.
+
+	uint flags -- Requested features, bitwise OR-ed value of:
+		0x01 -- Shared memory ring for large messages
+		0x02 -- Plaintext: ciphered fields are sent as plain strings
+
+	uint flags -- Granted features, same values as above
+	uint size -- Size of the ring's data area, 0 if no ring was granted
+
+	If the ring is granted, the descriptor of the shared memory comes with
+	the first byte of this reply (SCM_RIGHTS). See ifacering.h for its
+	layout. From then on large messages are written to the ring and announced
+	with ILocalPayload. Plaintext applies to the messages following the reply.
+*/
+
+	ILocalTransport() {}
+	ILocalTransport(uint32 _f, uint32 _s) : flags(_f), size(_s) {}
+
+	MAKE
+		pack(flags);
+		pack(size);
+	END_MAKE
+
+	PARSE
+		flags = unpack_int();
+	END_PARSE
+
+	uint32 flags, size;
+END
+
+IFACEMESSAGE(ILocalPayload, 0x0007)
+/*
+	Local payload -- A message was written to the shared memory ring
+
+	*not sent*
+
+	uint position -- Position of the message in the ring
+	uint length -- Length of the message, including its length and code
+
+	Process the message as if it had arrived at this point of the stream,
+	then move the ring's tail past it.
+*/
+
+	ILocalPayload(uint32 _p, uint32 _l) : position(_p), length(_l) {}
+
+	MAKE
+		pack(position);
+		pack(length);
+	END_MAKE
+
+	uint32 position, length;
+END
+
+IFACEMESSAGE(IStatistics, 0x0008)
+/*
+	Statistics -- Counters about what the daemon is doing
+
+	*empty*
+
+	uint number of counters
+	  string name -- Dot separated, like sockets.peer.sent
+	  off value -- Its value
+
+	sockets.<role>.* are about the connections of each role (server,
+	interface, peer, distributed, upload, download): count is how many
+	are open, queued, sent, writes, flushes and capped add up their send
+	statistics, and send_buffer, receive_buffer, nodelay, keepalive,
+	keepalive_interval, keepalive_count and notsent_lowat are the socket
+	options actually in effect on one of them.
+
+	load.level and load.lag are the current overload level (0 is normal)
+	and reactor lag in ms, load.<level>.entered and load.<level>.shed how
+	often each level (drop_searches, no_forwarding, defer_updates,
+	refuse_peers) was entered and how many items it dropped or deferred.
+
+	searches.dropped.<reason> count the search requests left unanswered
+	because of each reason: overloaded, duplicate, flooding, too_busy,
+	too_expensive, queue_full and expired. searches.cache.hits and
+	searches.cache.misses tell how many searches were answered from the
+	result cache of the shares and buddy shares databases, and not.
+*/
+
+	IStatistics() {}
+
+	MAKE
+		pack((uint32)counters.size());
+		std::vector<std::pair<std::string, uint64> >::const_iterator it = counters.begin();
+		for(; it != counters.end(); ++it) {
+			pack((*it).first);
+			pack((*it).second);
+		}
+	END_MAKE
+
+	PARSE
+	END_PARSE
+
+	/* Add a counter named prefix.name */
+	void add(const std::string & prefix, const char * name, uint64 value) {
+		counters.push_back(std::make_pair(prefix + "." + name, value));
+	}
+
+	std::vector<std::pair<std::string, uint64> > counters;
+END
+
 IFACEMESSAGE(IStatusMessage, 0x0010)
 /*
 	Status Message -- Forward messages to the clients
@@ -0,0 +1,142 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "ifacering.h"
+#include <NewNet/nnlog.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#define RING_MAGIC 0x5253554d
+#define RING_MAGIC_OFFSET 0
+#define RING_SIZE_OFFSET 4
+#define RING_HEAD_OFFSET 8
+#define RING_TAIL_OFFSET 64
+#define RING_DATA_OFFSET 128
+
+Museek::IfaceRing::IfaceRing() : m_Fd(-1), m_Map(0), m_MapSize(0), m_Size(0), m_Head(0)
+{
+}
+
+Museek::IfaceRing::~IfaceRing()
+{
+  if(m_Map)
+    munmap(m_Map, m_MapSize);
+  if(m_Fd != -1)
+    close(m_Fd);
+}
+
+/* Anonymous shared memory: a memfd where available, otherwise a POSIX
+   shared memory object that is unlinked right away. */
+static int
+openSharedMemory()
+{
+#ifdef MFD_CLOEXEC
+  return memfd_create("museekd-iface", MFD_CLOEXEC);
+#else
+  char name[64];
+  static unsigned int counter = 0;
+  snprintf(name, sizeof(name), "/museekd-iface-%d-%u", (int)getpid(), counter++);
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if(fd != -1)
+  {
+    shm_unlink(name);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+  }
+  return fd;
+#endif // MFD_CLOEXEC
+}
+
+bool
+Museek::IfaceRing::create(size_t size)
+{
+  uint32_t ringSize = 65536;
+  while((ringSize < size) && (ringSize < (1u << 28)))
+    ringSize <<= 1;
+
+  m_Fd = openSharedMemory();
+  if(m_Fd == -1)
+  {
+    NNLOG("museekd.iface.warn", "Couldn't create shared memory for the interface ring: %s.", strerror(errno));
+    return false;
+  }
+
+  m_MapSize = RING_DATA_OFFSET + ringSize;
+  if(ftruncate(m_Fd, m_MapSize) != 0)
+  {
+    NNLOG("museekd.iface.warn", "Couldn't size the interface ring: %s.", strerror(errno));
+    return false;
+  }
+
+  void * map = mmap(0, m_MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_Fd, 0);
+  if(map == MAP_FAILED)
+  {
+    NNLOG("museekd.iface.warn", "Couldn't map the interface ring: %s.", strerror(errno));
+    return false;
+  }
+  m_Map = (unsigned char *)map;
+  m_Size = ringSize;
+
+  /* ftruncate() zeroed head and tail. */
+  uint32_t magic = RING_MAGIC;
+  memcpy(m_Map + RING_MAGIC_OFFSET, &magic, 4);
+  memcpy(m_Map + RING_SIZE_OFFSET, &m_Size, 4);
+  return true;
+}
+
+void
+Museek::IfaceRing::copy(uint32_t position, const unsigned char * data, size_t n)
+{
+  uint32_t offset = position & (m_Size - 1);
+  size_t first = n < m_Size - offset ? n : m_Size - offset;
+  memcpy(m_Map + RING_DATA_OFFSET + offset, data, first);
+  if(first < n)
+    memcpy(m_Map + RING_DATA_OFFSET, data + first, n - first);
+}
+
+bool
+Museek::IfaceRing::write(const unsigned char * header, size_t headerSize,
+                         const unsigned char * data, size_t dataSize, uint32_t & position)
+{
+  if(! m_Map)
+    return false;
+
+  /* The client may be anything, don't believe a tail that isn't behind
+     the head. */
+  uint32_t tail = __atomic_load_n((uint32_t *)(m_Map + RING_TAIL_OFFSET), __ATOMIC_ACQUIRE);
+  uint32_t used = m_Head - tail;
+  if(used > m_Size)
+    return false;
+  if(headerSize + dataSize > m_Size - used)
+    return false;
+
+  position = m_Head;
+  copy(m_Head, header, headerSize);
+  copy(m_Head + headerSize, data, dataSize);
+  m_Head += headerSize + dataSize;
+  __atomic_store_n((uint32_t *)(m_Map + RING_HEAD_OFFSET), m_Head, __ATOMIC_RELEASE);
+  return true;
+}
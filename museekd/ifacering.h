@@ -0,0 +1,88 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_IFACERING_H
+#define MUSEEK_IFACERING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Museek
+{
+  /* Shared memory ring buffer carrying large interface messages to a client
+     running on the same host. The daemon creates it, passes its descriptor
+     to the client and is its only writer; the client maps it and is its
+     only reader. Layout of the mapping, all integers in host byte order:
+
+       offset   0: uint32 magic, 'MUSR' (0x5253554d)
+       offset   4: uint32 size of the data area, a power of two
+       offset   8: uint32 head, bytes written so far by the daemon
+       offset  64: uint32 tail, bytes consumed so far by the client
+       offset 128: data area
+
+     head and tail count bytes modulo 2^32, a byte at position p lives at
+     p & (size - 1) in the data area. Records are copies of the messages as
+     they would travel on the socket (length, code, payload) and may wrap
+     around the end of the data area. The client must advance tail after
+     processing a record, with release semantics. */
+  class IfaceRing
+  {
+  public:
+    IfaceRing();
+    /* Unmaps the ring and closes its descriptor. */
+    ~IfaceRing();
+
+    /* Create a ring of at least 'size' bytes. Returns false on failure. */
+    bool create(size_t size);
+
+    /* Descriptor of the shared memory, to be passed to the client. */
+    int descriptor() const
+    {
+      return m_Fd;
+    }
+
+    /* Size of the data area. */
+    uint32_t size() const
+    {
+      return m_Size;
+    }
+
+    /* Append a record made of 'header' and 'data'. Returns false if there
+       isn't enough room, otherwise stores the position of the record in
+       'position'. */
+    bool write(const unsigned char * header, size_t headerSize,
+               const unsigned char * data, size_t dataSize, uint32_t & position);
+
+  private:
+    /* Private copy constructor and assignment, the mapping is owned */
+    IfaceRing(const IfaceRing &);
+    IfaceRing & operator=(const IfaceRing &);
+
+    void copy(uint32_t position, const unsigned char * data, size_t n);
+
+    int m_Fd;
+    unsigned char * m_Map;
+    size_t m_MapSize;
+    uint32_t m_Size;
+    uint32_t m_Head;
+  };
+}
+
+#endif // MUSEEK_IFACERING_H
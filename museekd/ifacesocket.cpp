@@ -22,9 +22,12 @@
 # include "config.h"
 #endif // HAVE_CONFIG_H
 #include "ifacesocket.h"
+#include "ifacering.h"
+#include "messagedispatcher.h"
 #include <NewNet/nnreactor.h>
 
-Museek::IfaceSocket::IfaceSocket() : NewNet::ClientSocket(), MessageProcessor(4), m_Authenticated(false)
+Museek::IfaceSocket::IfaceSocket() : NewNet::ClientSocket(), MessageProcessor(4), m_Authenticated(false),
+                                     m_Plaintext(false), m_Ring(0), m_RingThreshold(0)
 {
   m_CipherContext = new CipherContext();
   dataReceivedEvent.connect(this, &IfaceSocket::onDataReceived);
@@ -36,8 +39,21 @@ Museek::IfaceSocket::~IfaceSocket()
 {
   NNLOG("museekd.iface.debug", "IfaceSocket destroyed");
   free(m_CipherContext);
+#ifndef WIN32
+  delete m_Ring;
+#endif // WIN32
 }
 
+#ifndef WIN32
+void
+Museek::IfaceSocket::setRing(IfaceRing * ring, size_t threshold)
+{
+  delete m_Ring;
+  m_Ring = ring;
+  m_RingThreshold = threshold;
+}
+#endif // WIN32
+
 void
 Museek::IfaceSocket::sendMessage(const NewNet::Buffer & buffer)
 {
@@ -47,13 +63,79 @@ Museek::IfaceSocket::sendMessage(const NewNet::Buffer & buffer)
     return;
   }
 
+#ifndef WIN32
+  /* Large messages go through the ring, only a notification goes through
+     the socket. When the client is behind and the ring is full, fall back
+     to the socket: notifications and messages stay in order either way. */
+  if(m_Ring && (buffer.count() >= m_RingThreshold))
+  {
+    unsigned char buf[4];
+    buf[0] = buffer.count() & 0xff;
+    buf[1] = (buffer.count() >> 8) & 0xff;
+    buf[2] = (buffer.count() >> 16) & 0xff;
+    buf[3] = (buffer.count() >> 24) & 0xff;
+    uint32_t position;
+    if(m_Ring->write(buf, 4, buffer.data(), buffer.count(), position))
+    {
+      sendFrame(ILocalPayload(position, buffer.count() + 4).make_network_packet());
+      return;
+    }
+    NNLOG("museekd.iface.debug", "Interface ring is full, sending %u bytes through the socket.", buffer.count());
+  }
+#endif // WIN32
+
+  sendFrame(buffer);
+}
+
+void
+Museek::IfaceSocket::sendFrame(const NewNet::Buffer & buffer)
+{
   unsigned char buf[4];
   buf[0] = buffer.count() & 0xff;
   buf[1] = (buffer.count() >> 8) & 0xff;
   buf[2] = (buffer.count() >> 16) & 0xff;
   buf[3] = (buffer.count() >> 24) & 0xff;
-  send(buf, 4);
-  send(buffer.data(), buffer.count());
+  send(buf, 4, buffer.data(), buffer.count());
+}
+
+namespace
+{
+  #define MAP_MESSAGE(ID, TYPE, EVENT) \
+    DISPATCH_SUBSCRIBED(Museek::IfaceSocket, EVENT) \
+    static void dispatch_##EVENT(Museek::IfaceSocket * owner, const Museek::MessageProcessor::MessageData * data) \
+    { \
+      NNLOG("museek.messages.iface", "Received interface message " #TYPE "."); \
+      TYPE msg; \
+      msg.setIfaceSocket(owner); \
+      msg.parse_network_packet(data->data, data->length); \
+      owner->EVENT(&msg); \
+    }
+  #define MAP_C_MESSAGE(ID, TYPE, EVENT) \
+    DISPATCH_SUBSCRIBED(Museek::IfaceSocket, EVENT) \
+    static void dispatch_##EVENT(Museek::IfaceSocket * owner, const Museek::MessageProcessor::MessageData * data) \
+    { \
+      NNLOG("museek.messages.iface", "Received interface message " #TYPE "."); \
+      TYPE msg(owner->cipherContext()); \
+      msg.setIfaceSocket(owner); \
+      msg.parse_network_packet(data->data, data->length); \
+      owner->EVENT(&msg); \
+    }
+  #include "ifaceeventtable.h"
+  #undef MAP_MESSAGE
+  #undef MAP_C_MESSAGE
+
+  typedef Museek::MessageDispatcher<Museek::IfaceSocket> IfaceDispatcher;
+
+  const IfaceDispatcher::Entry ifaceDispatchEntries[] = {
+    #define MAP_MESSAGE(ID, TYPE, EVENT) DISPATCH_ENTRY(ID, TYPE, EVENT)
+    #define MAP_C_MESSAGE(ID, TYPE, EVENT) DISPATCH_ENTRY(ID, TYPE, EVENT)
+    #include "ifaceeventtable.h"
+    #undef MAP_MESSAGE
+    #undef MAP_C_MESSAGE
+  };
+
+  const IfaceDispatcher ifaceDispatcher(ifaceDispatchEntries,
+      sizeof(ifaceDispatchEntries) / sizeof(ifaceDispatchEntries[0]));
 }
 
 void
@@ -66,36 +148,11 @@ Museek::IfaceSocket::onMessageReceived(const MessageData * data)
     return;
   }
 
-  switch(data->type)
+  if(! ifaceDispatcher.dispatch(this, data))
   {
-    #define MAP_MESSAGE(ID, TYPE, EVENT) \
-      case ID: \
-      { \
-        NNLOG("museek.messages.iface", "Received interface message " #TYPE "."); \
-        TYPE msg; \
-        msg.setIfaceSocket(this); \
-        msg.parse_network_packet(data->data, data->length); \
-        EVENT(&msg); \
-        break; \
-      }
-    #define MAP_C_MESSAGE(ID, TYPE, EVENT) \
-      case ID: \
-      { \
-        NNLOG("museek.messages.iface", "Received interface message " #TYPE "."); \
-        TYPE msg(m_CipherContext); \
-        msg.setIfaceSocket(this); \
-        msg.parse_network_packet(data->data, data->length); \
-        EVENT(&msg); \
-        break; \
-      }
-    #include "ifaceeventtable.h"
-    #undef MAP_MESSAGE
-    #undef MAP_C_MESSAGE
-
-    default:
-        NNLOG("museekd.iface.warn", "Received unknown interface message, type: %u, length: %u", data->type, data->length);
-        NetworkMessage msg;
-        msg.parse_network_packet(data->data, data->length);
+    NNLOG("museekd.iface.warn", "Received unknown interface message, type: %u, length: %u", data->type, data->length);
+    NetworkMessage msg;
+    msg.parse_network_packet(data->data, data->length);
   }
 }
 
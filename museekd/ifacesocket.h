@@ -33,6 +33,8 @@ namespace NewNet
 
 namespace Museek
 {
+  class IfaceRing;
+
   class IfaceSocket : public NewNet::ClientSocket, public MessageProcessor
   {
   public:
@@ -71,10 +73,31 @@ namespace Museek
       cipherKeySHA256(m_CipherContext, (char *)key.data(), key.size());
     }
 
+    /* Returns 0 on the plaintext local transport. */
     CipherContext * cipherContext()
     {
-      return m_CipherContext;
+      return m_Plaintext ? 0 : m_CipherContext;
+    }
+
+    /* Send ciphered fields as plain strings. See ILocalTransport. */
+    bool plaintext() const
+    {
+      return m_Plaintext;
+    }
+    void setPlaintext(bool plaintext)
+    {
+      m_Plaintext = plaintext;
+    }
+
+#ifndef WIN32
+    /* Write messages of at least 'threshold' bytes to a shared memory ring.
+       The socket takes ownership of the ring. */
+    void setRing(IfaceRing * ring, size_t threshold);
+    IfaceRing * ring() const
+    {
+      return m_Ring;
     }
+#endif // WIN32
 
     void sendMessage(const NewNet::Buffer & message);
 
@@ -88,11 +111,15 @@ namespace Museek
 
   private:
     void onMessageReceived(const MessageData * data);
+    void sendFrame(const NewNet::Buffer & message);
 
     bool m_Authenticated;
     unsigned int m_Mask;
     std::string m_Challenge;
     CipherContext * m_CipherContext;
+    bool m_Plaintext;
+    IfaceRing * m_Ring;
+    size_t m_RingThreshold;
   };
 }
 
@@ -0,0 +1,145 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "loadmonitor.h"
+#include "museekd.h"
+#include "configmanager.h"
+#include "searchmanager.h"
+#include <NewNet/nnlog.h>
+#include <NewNet/nnclock.h>
+#include <stdio.h>
+
+/* How often the lag is sampled, in ms. */
+#define HEARTBEAT_INTERVAL 500
+/* How long a level is kept at least before going down, in ms. */
+#define HOLD_TIME 5000
+/* How often the counters are logged at most, in ms. */
+#define REPORT_INTERVAL 60000
+
+static const char * levelNames[] = {
+  "normal operation",
+  "dropping search requests",
+  "not forwarding search requests",
+  "deferring transfer updates",
+  "refusing peers"
+};
+
+Museek::LoadMonitor::LoadMonitor(Museekd * museekd) : m_Museekd(museekd), m_Level(Normal), m_Lag(0), m_Reported(0)
+{
+  m_Since = m_ReportedAt = NewNet::clock.now();
+  for(int i = 0; i < Levels; ++i)
+  {
+    m_Entered[i] = 0;
+    m_Shed[i] = 0;
+  }
+
+  m_Heartbeat = museekd->reactor()->addTimeout(HEARTBEAT_INTERVAL, this, &LoadMonitor::onHeartbeat);
+}
+
+Museek::LoadMonitor::~LoadMonitor()
+{
+  if(m_Heartbeat.isValid() && museekd())
+    museekd()->reactor()->removeTimeout(m_Heartbeat);
+}
+
+void
+Museek::LoadMonitor::onHeartbeat(long overdue)
+{
+  m_Heartbeat = museekd()->reactor()->addTimeout(HEARTBEAT_INTERVAL, this, &LoadMonitor::onHeartbeat);
+
+  /* A single late heartbeat counts for half, a loop that keeps falling
+     behind gets there in a few samples. */
+  m_Lag = (m_Lag + overdue) / 2;
+
+  struct timeval now = NewNet::clock.now();
+  if(difftime(now, m_ReportedAt) >= REPORT_INTERVAL)
+    report(now);
+
+  long threshold = museekd()->config()->getInt("overload", "lag", 250);
+  if(threshold <= 0)
+  {
+    if(m_Level != Normal)
+      setLevel(Normal);
+    return;
+  }
+
+  int target = Normal;
+  while(target < RefusePeers && m_Lag >= (threshold << target))
+    ++target;
+
+  int maxPending = museekd()->config()->getInt("overload", "max_pending_results", 200);
+  if(target == Normal && maxPending > 0 && museekd()->searches()->pendingResults() > static_cast<size_t>(maxPending))
+    target = DropSearches;
+
+  if(target > m_Level)
+  {
+    /* Go up right away, through every level in between. */
+    while(m_Level < target)
+      setLevel(static_cast<Level>(m_Level + 1));
+  }
+  else if(target < m_Level && difftime(now, m_Since) >= HOLD_TIME)
+  {
+    /* Only go down once the lag is well below the threshold of the
+       current level, one level at a time, so we don't flap. */
+    if(m_Lag < (threshold << (m_Level - 1)) / 2)
+      setLevel(static_cast<Level>(m_Level - 1));
+  }
+}
+
+void
+Museek::LoadMonitor::setLevel(Level level)
+{
+  if(level > m_Level)
+    NNLOG("museekd.warn", "Overloaded (reactor lag %li ms), %s.", m_Lag, levelNames[level]);
+  else
+    NNLOG("museekd.warn", "Load went down (reactor lag %li ms), %s.", m_Lag, levelNames[level]);
+
+  m_Level = level;
+  m_Since = NewNet::clock.now();
+  ++m_Entered[level];
+  levelChangedEvent(level);
+}
+
+/* Log how often each level was entered and how much it shed, if anything
+   happened since the last time. */
+void
+Museek::LoadMonitor::report(const struct timeval & now)
+{
+  unsigned long total = 0;
+  std::string counts;
+  for(int i = DropSearches; i < Levels; ++i)
+  {
+    total += m_Entered[i] + m_Shed[i];
+    if(m_Entered[i] || m_Shed[i])
+    {
+      char buf[128];
+      snprintf(buf, sizeof(buf), "%s%lu times %s, %lu shed", counts.empty() ? "" : "; ", m_Entered[i], levelNames[i], m_Shed[i]);
+      counts += buf;
+    }
+  }
+
+  if(total != m_Reported)
+    NNLOG("museekd.debug", "Load (reactor lag %li ms, %s): %s.", m_Lag, levelNames[m_Level], counts.c_str());
+  m_Reported = total;
+  m_ReportedAt = now;
+}
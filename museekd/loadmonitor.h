@@ -0,0 +1,121 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_LOADMONITOR_H
+#define MUSEEK_LOADMONITOR_H
+
+#include <NewNet/nnobject.h>
+#include <NewNet/nnweakrefptr.h>
+#include <NewNet/nnevent.h>
+#include <NewNet/nnreactor.h>
+
+namespace Museek
+{
+  class Museekd;
+
+  /* Watches how far the reactor falls behind and sheds load when it can't
+     keep up. The lag is how late a heartbeat timeout fires, the queue depth
+     the number of search replies waiting for a connection. Each overload
+     level also implies the ones below it. The thresholds are read from the
+     overload domain: 'lag' is the lag in ms entering the first level (every
+     following level needs twice as much, 0 disables shedding) and
+     'max_pending_results' the search reply backlog entering it. How often
+     each level was entered and how much it shed is logged now and then, and
+     sent to the interfaces with the statistics. */
+  class LoadMonitor : public NewNet::Object
+  {
+  public:
+    enum Level
+    {
+      Normal = 0,
+      DropSearches,   // Don't answer search requests
+      NoForwarding,   // Don't forward search requests to our children
+      DeferUpdates,   // Hold transfer updates back from the interfaces
+      RefusePeers,    // Refuse new peer connections from non buddies
+      Levels
+    };
+
+    LoadMonitor(Museekd * museekd);
+    ~LoadMonitor();
+
+    /* Return pointer to museekd instance. */
+    Museekd * museekd() const
+    {
+      return m_Museekd;
+    }
+
+    /* The current overload level. */
+    Level level() const
+    {
+      return m_Level;
+    }
+
+    /* Returns true if work belonging to 'level' should be shed. */
+    bool shedding(Level level) const
+    {
+      return m_Level >= level;
+    }
+
+    /* Smoothed reactor lag in ms. */
+    long lag() const
+    {
+      return m_Lag;
+    }
+
+    /* Number of times 'level' was entered. */
+    unsigned long entered(Level level) const
+    {
+      return m_Entered[level];
+    }
+
+    /* Number of items dropped or deferred because of 'level'. */
+    unsigned long shed(Level level) const
+    {
+      return m_Shed[level];
+    }
+
+    /* Count an item dropped or deferred because of 'level'. */
+    void countShed(Level level)
+    {
+      ++m_Shed[level];
+    }
+
+    /* Emitted every time the level goes one step up or down, with the new
+       level. */
+    NewNet::Event<Level> levelChangedEvent;
+
+  private:
+    void onHeartbeat(long overdue);
+    void setLevel(Level level);
+    void report(const struct timeval & now);
+
+    NewNet::WeakRefPtr<Museekd> m_Museekd;
+    NewNet::WeakRefPtr<NewNet::Reactor::Timeout::Callback> m_Heartbeat;
+    Level m_Level;
+    long m_Lag;
+    struct timeval m_Since;       // When we entered the current level
+    unsigned long m_Entered[Levels];
+    unsigned long m_Shed[Levels];
+    unsigned long m_Reported;     // Sum of the counters at the last report
+    struct timeval m_ReportedAt;
+  };
+}
+
+#endif // MUSEEK_LOADMONITOR_H
@@ -26,17 +26,23 @@
 #include "ifacemanager.h"
 #include "downloadmanager.h"
 #include "uploadmanager.h"
+#include "handoff.h"
 #include "util.h"
 #include <NewNet/nnreactor.h>
 #include <NewNet/nnlog.h>
+#include <NewNet/nnlogsink.h>
 #include <sys/types.h>
 #include <signal.h>
 
 /* Global reference to the museekd instance. */
 static NewNet::RefPtr<Museek::Museekd> museekd;
 
-/* Returns 0 if museekd is already running, 1 otherwise. */
-int get_lock(void)
+/* Set by SIGUSR2: hand over to a new instance when the reactor stops. */
+static volatile sig_atomic_t restartRequested = 0;
+
+/* Returns 0 if museekd is already running, 1 otherwise. If wait is true,
+   wait for the running instance to go away instead. */
+int get_lock(bool wait = false)
 {
 # ifdef HAVE_FCNTL_H
   struct flock fl;
@@ -50,7 +56,7 @@ int get_lock(void)
   if((fdlock = open("/tmp/museekd.lock", O_WRONLY|O_CREAT, 0666)) == -1)
     return 0;
 
-  if(fcntl(fdlock, F_SETLK, &fl) == -1)
+  if(fcntl(fdlock, wait ? F_SETLKW : F_SETLK, &fl) == -1)
     return 0;
 
 # endif // HAVE_FCNTL_H
@@ -75,6 +81,11 @@ static void museekd_signal_handler(int signal)
         if (!museekd->server()->loggedIn())
             museekd->server()->connect();
     }
+    else if (signal == SIGUSR2) {
+        NNLOG("museekd.debug", "Trapped signal %i. Restarting.", signal);
+        restartRequested = 1;
+        museekd->reactor()->stop();
+    }
 #endif // WIN32
 
 
@@ -83,6 +94,7 @@ static void museekd_signal_handler(int signal)
 #ifndef WIN32
   ::signal(SIGHUP, &museekd_signal_handler);
   ::signal(SIGALRM, &museekd_signal_handler);
+  ::signal(SIGUSR2, &museekd_signal_handler);
 #endif // WIN32
   ::signal(SIGINT, &museekd_signal_handler);
 }
@@ -107,9 +119,9 @@ public:
     if(notice->domain == "museekd.debug")
     {
       if(museekd->config()->getBool(notice->domain, notice->key))
-        NNLOG.enable(notice->key);
+        NewNet::log.enable(notice->key);
       else
-        NNLOG.disable(notice->key);
+        NewNet::log.disable(notice->key);
     }
   }
 };
@@ -120,18 +132,12 @@ public:
   virtual void operator()(const Museek::ConfigManager::RemoveNotify * notice)
   {
     if(notice->domain == "museekd.debug")
-      NNLOG.disable(notice->key);
+      NewNet::log.disable(notice->key);
   }
 };
 
 int main(int argc, char ** argv)
 {
-  if(!get_lock())
-  {
-    std::cerr << "Museekd already running!" << std::endl;
-    return 1;
-  }
-
   std::string version("museekd :: Version 0.4.0 :: Museek Daemon Plus");
 
 #ifndef WIN32
@@ -143,6 +149,8 @@ int main(int argc, char ** argv)
 #endif // WIN32
 
     bool fullDebug = false;
+    std::string logPath;
+    int handoffFd = -1;
 
   for(int i = 1; i < argc; i++) {
     std::string arg(argv[i]);
@@ -158,6 +166,17 @@ int main(int argc, char ** argv)
       return 0;
     } else if(arg == "--debug" || arg == "-d" ) {
       fullDebug = true;
+    } else if(arg == "--logfile" || arg == "-l") {
+      if(i + 1 < argc) {
+        logPath = argv[++i];
+      } else {
+        std::cerr << "Missing log file path, bailing out." << std::endl;
+        return -1;
+      }
+    } else if(arg == "--handoff") {
+      /* Internal: we're the new instance of a hot restart. */
+      if(i + 1 < argc)
+        handoffFd = atoi(argv[++i]);
     } else if(arg == "--help" || arg == "-h") {
       std::cout << version << std::endl;
       std::cout << "Syntax: museekd [options]" << std::endl << std::endl;
@@ -165,17 +184,40 @@ int main(int argc, char ** argv)
       std::cout << "-c --config <config file>\tUse alternative config file" << std::endl;
       std::cout << "-h --help\t\t\tDisplay this message and quit" << std::endl;
       std::cout << "-d --debug\t\t\tDisplay debugging messages" << std::endl;
+      std::cout << "-l --logfile <log file>\tWrite messages to a file instead" << std::endl;
       std::cout << "-V --version\t\t\tDisplay museekd version and quit" << std::endl << std::endl;
       std::cout << "Signals:" << std::endl;
       std::cout << "kill -HUP \tReload Shares Database(s)" << std::endl;
       std::cout << "kill -ALRM \tReconnect to Server" << std::endl;
+      std::cout << "kill -USR2 \tRestart without dropping connections" << std::endl;
       return 0;
     }
   }
 
+  /* The previous instance of a hot restart still holds the lock, we'll
+     wait for it once it handed everything over. */
+  if((handoffFd == -1) && !get_lock())
+  {
+    std::cerr << "Museekd already running!" << std::endl;
+    return 1;
+  }
+
+  /* Messages are written by a background thread, to the console or the
+     log file. The sink lives until the process exits so messages logged
+     while shutting down still get out. */
+  int logFd = STDOUT_FILENO;
+  if(! logPath.empty()) {
+    logFd = open(logPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if(logFd == -1) {
+      std::cerr << "Couldn't open log file " << logPath << ", bailing out." << std::endl;
+      return -1;
+    }
+  }
+  NewNet::AsyncLogSink * logSink = new NewNet::AsyncLogSink(logFd);
+  NewNet::log.setSink(logSink);
+
   /* Enable various interesting logging domains. */
-  NNLOG.logEvent.connect(new NewNet::ConsoleOutput);
-  NNLOG.enable("ALL");
+  NewNet::log.enable("ALL");
 
   /* Check size of off_t */
   if(sizeof(off_t) < 8)
@@ -186,6 +228,23 @@ int main(int argc, char ** argv)
   /* Create our Museek Daemon instance. */
   museekd = new Museek::Museekd();
 
+  /* Get the sockets of the previous instance before the configuration
+     makes us listen. */
+  if(handoffFd != -1)
+  {
+    NewNet::RefPtr<Museek::Handoff> handoff(new Museek::Handoff(museekd));
+    if(handoff->receive(handoffFd))
+      museekd->setHandoff(handoff);
+    close(handoffFd);
+    if(!get_lock(museekd->handoff() != 0))
+    {
+      NNLOG("museekd.warn", "Museekd already running, bailing out.");
+      museekd = 0;
+      logSink->flush();
+      return 1;
+    }
+  }
+
   /* Connect our config watchers. */
   museekd->config()->keySetEvent.connect(new KeySetCallback);
   museekd->config()->keyRemovedEvent.connect(new KeyRemovedCallback);
@@ -193,30 +252,63 @@ int main(int argc, char ** argv)
   if(! museekd->config()->load(configPath))
   {
     NNLOG("museek.config.warn", "Failed to load configuration, bailing out.");
+    museekd = 0;
+    logSink->flush();
     return -1;
   }
 
   /* Disable the debug override. */
   if(!museekd->config()->getBool("museekd.debug", "ALL") && !fullDebug)
-    NNLOG.disable("ALL");
+    NewNet::log.disable("ALL");
 
   /* Load the shares database. */
   museekd->LoadShares();
   museekd->LoadDownloads();
 
+  /* Take over the server session and the transfers. */
+  if(museekd->handoff())
+  {
+    museekd->handoff()->adopt();
+    museekd->setHandoff(0);
+  }
+
   /* Connect signal handlers for HUP, ALRM and INT signals. */
 #ifndef WIN32
   signal(SIGHUP, &museekd_signal_handler);
   signal(SIGALRM, &museekd_signal_handler);
+  signal(SIGUSR2, &museekd_signal_handler);
 #endif // WIN32
   signal(SIGINT, &museekd_signal_handler);
 
   /* Add a timeout callback: Wait 5 seconds, then connect to the server. */
-  museekd->reactor()->addTimeout(5000, new AutoConnectCallback);
+  if(! museekd->server()->loggedIn())
+    museekd->reactor()->addTimeout(5000, new AutoConnectCallback);
 
   /* Start the reactor. This drives the daemon. */
-  museekd->reactor()->run();
-  museekd->downloads()->saveDownloads();
+  while(true)
+  {
+    museekd->reactor()->run();
+    museekd->downloads()->saveDownloads();
+    if(! restartRequested)
+      break;
+    restartRequested = 0;
+
+    /* Hand everything over to a new instance. The sockets belong to it
+       now: leave without running any destructor, they could close or
+       unlink them. */
+    NewNet::RefPtr<Museek::Handoff> handoff(new Museek::Handoff(museekd));
+    if(handoff->restart(argv))
+    {
+      logSink->flush();
+      _exit(0);
+    }
+    NNLOG("museekd.warn", "Hot restart failed, going on.");
+  }
+
+  /* Tear the daemon down while the logger is still around, static
+     destruction order across files is unspecified. */
+  museekd = 0;
+  logSink->flush();
 
   return 0;
 }
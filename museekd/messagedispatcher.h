@@ -0,0 +1,97 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_MESSAGEDISPATCHER_H
+#define MUSEEK_MESSAGEDISPATCHER_H
+
+#include "messageprocessor.h"
+#include <vector>
+
+namespace Museek
+{
+  /* MessageDispatcher maps message codes to the handlers generated from one
+     of the *eventtable.h files. Owner is the class that declares the message
+     events. The lookup table is indexed directly by message code, and a
+     message is only parsed when somebody is connected to its event. */
+  template<class Owner> class MessageDispatcher
+  {
+  public:
+    /* Returns true if at least one callback is connected to the event. */
+    typedef bool (*SubscribedFunc)(Owner *);
+    /* Parses the message and emits the event. */
+    typedef void (*DispatchFunc)(Owner *, const MessageProcessor::MessageData *);
+
+    struct Entry
+    {
+      uint32 code;
+      const char * name;
+      SubscribedFunc subscribed;
+      DispatchFunc dispatch;
+    };
+
+    /* Build the lookup table from a static array of entries. */
+    MessageDispatcher(const Entry * entries, size_t count)
+    {
+      for(size_t i = 0; i < count; ++i)
+      {
+        if(entries[i].code >= m_Table.size())
+          m_Table.resize(entries[i].code + 1, 0);
+        m_Table[entries[i].code] = &entries[i];
+      }
+    }
+
+    /* Find the entry for a message code. Returns 0 for unknown codes. */
+    const Entry * find(uint32 code) const
+    {
+      if(code >= m_Table.size())
+        return 0;
+      return m_Table[code];
+    }
+
+    /* Dispatch a message to its event. Messages nobody listens to are
+       dropped without being parsed. Returns false if the code is unknown. */
+    bool dispatch(Owner * owner, const MessageProcessor::MessageData * data) const
+    {
+      const Entry * entry = find(data->type);
+      if(! entry)
+        return false;
+      if(entry->subscribed(owner))
+        entry->dispatch(owner, data);
+      return true;
+    }
+
+  private:
+    std::vector<const Entry *> m_Table;
+  };
+}
+
+/* Helpers to generate the subscription check and dispatch function for a
+   MAP_MESSAGE line. The dispatch body is provided by the caller since each
+   socket type sets up its messages differently. */
+#define DISPATCH_SUBSCRIBED(OWNER, EVENT) \
+  static bool subscribed_##EVENT(OWNER * owner) \
+  { \
+    return ! owner->EVENT.empty(); \
+  }
+
+#define DISPATCH_ENTRY(ID, TYPE, EVENT) \
+  { ID, #TYPE, &subscribed_##EVENT, &dispatch_##EVENT },
+
+#endif // MUSEEK_MESSAGEDISPATCHER_H
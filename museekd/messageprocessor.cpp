@@ -23,7 +23,14 @@
 #endif // HAVE_CONFIG_H
 #include "messageprocessor.h"
 #include <NewNet/nnclientsocket.h>
-#include <limits.h>
+#include <algorithm>
+#include <string.h>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif // __SSE2__
+#ifdef __AVX2__
+# include <immintrin.h>
+#endif // __AVX2__
 
 bool
 Museek::MessageProcessor::parseMessage(NewNet::ClientSocket * socket)
@@ -45,21 +52,39 @@ Museek::MessageProcessor::parseMessage(NewNet::ClientSocket * socket)
     if(count < (4 + m_CodeSize + keySize))
         return false;
 
-    uint32 len = getMessageLen(inbuf);
+    /* Obfuscated messages are decoded in place as they arrive. Start with
+       the key and the message length. */
+    if (obfuscated() && (m_Decoded < 8)) {
+        m_Decoder.setKey(inbuf);
+        m_Decoder.decode(inbuf, 4, 8);
+        m_Decoded = 8;
+    }
+
+    /* Unpack the message length. 32bit little endian, that's the slsk way. */
+    uint32 len = inbuf[keySize] + (inbuf[keySize + 1] << 8) + (inbuf[keySize + 2] << 16) + (inbuf[keySize + 3] << 24);
+    size_t total = (size_t)len + 4 + keySize;
+
+    /* Decode whatever part of the message body arrived since last time. */
+    if (obfuscated()) {
+        size_t available = std::min(count, total);
+        if (available > m_Decoded) {
+            m_Decoder.decode(inbuf, m_Decoded, available);
+            m_Decoded = available;
+        }
+    }
 
     /* 'len' includes the message type, so if we have less than len + 4 bytes in
        the buffer, bail out. */
-    if(count < (len + 4 + keySize))
+    if(count < total)
       return false;
 
-    if (obfuscated()) {
-        decodeMessage(inbuf, len);
-    }
+    /* The next message will bring its own key. */
+    m_Decoded = 0;
 
     /* Unpack the message type. 8 or 32bit little endian depending on m_CodeSize */
     uint32 mtype = 0;
-    for(uint j = keySize; j < m_CodeSize + keySize; ++j)
-        mtype += inbuf[4 + j] << (j * 8);
+    for(uint j = 0; j < m_CodeSize; ++j)
+        mtype += inbuf[4 + keySize + j] << (j * 8);
 
     /* A complete message is here. Set up the message data structure and emit
        messageReceivedEvent. */
@@ -77,75 +102,67 @@ Museek::MessageProcessor::parseMessage(NewNet::ClientSocket * socket)
         return false;
 
     /* Seek to the end of the message. */
-    socket->receiveBuffer().seek(len + 4 + keySize);
+    socket->receiveBuffer().seek(total);
 
     /* Is the buffer empty? Stop processing. If it's not, keep processing. */
     return ! socket->receiveBuffer().empty();
 }
 
 void
-Museek::MessageProcessor::rotrKey(unsigned char *buf, unsigned int c)
+Museek::ObfuscationDecoder::setKey(const unsigned char * key)
 {
-    const unsigned int mask = (CHAR_BIT*sizeof(buf) - 1);
-
-    uint32_t key_orig = buf[0] + (buf[1] << 8) + (buf[2] << 16) + (buf[3] << 24);
-
-    c &= mask;
-    uint32_t key_rotated = (key_orig>>c) | (key_orig<<( (-c)&mask ));
-
-    buf[0] = key_rotated & 0xff;
-    buf[1] = (key_rotated >> 8) & 0xff;
-    buf[2] = (key_rotated >> 16) & 0xff;
-    buf[3] = (key_rotated >> 24) & 0xff;
+    uint32 k = key[0] + (key[1] << 8) + (key[2] << 16) + ((uint32)key[3] << 24);
+
+    /* Block n is XORed with the key rotated left by n + 1 bits. After 32
+       blocks the rotation wraps around. */
+    for (uint n = 0; n < 32; ++n) {
+        k = (k << 1) | (k >> 31);
+        m_KeyStream[n * 4] = k & 0xff;
+        m_KeyStream[n * 4 + 1] = (k >> 8) & 0xff;
+        m_KeyStream[n * 4 + 2] = (k >> 16) & 0xff;
+        m_KeyStream[n * 4 + 3] = (k >> 24) & 0xff;
+    }
+    memcpy(m_KeyStream + 128, m_KeyStream, 128);
 }
 
-
-/*
- * Decodes an unobfuscted message directly in the passed buffer
- * Only <len> bytes will be decoded (not counting the key size)
- */
 void
-Museek::MessageProcessor::decodeMessage(unsigned char *buf, uint32 len)
+Museek::ObfuscationDecoder::decode(unsigned char * buf, size_t from, size_t to) const
 {
-    // First read the key
-    uint keySize = 4;
-    uchar * key = new uchar[keySize]; // The key we will use to decode the msg
-
-    for(uint j = 0; j < keySize; ++j) {
-        key[j] = buf[j];
+    size_t i = from;
+    size_t phase = (from - 4) & 127;
+
+#ifdef __AVX2__
+    while (to - i >= 32) {
+        __m256i data = _mm256_loadu_si256((const __m256i *)(buf + i));
+        __m256i key = _mm256_loadu_si256((const __m256i *)(m_KeyStream + phase));
+        _mm256_storeu_si256((__m256i *)(buf + i), _mm256_xor_si256(data, key));
+        i += 32;
+        phase = (phase + 32) & 127;
     }
-
-    // Then decode the asked content length
-    uint32 key_pos = 0;
-    for (uint i = keySize; i < (len + keySize + 4); i++) {
-        key_pos = i % keySize;
-        if (key_pos == 0) {
-            rotrKey(key, 31);
-        }
-        buf[i] = buf[i] ^ key[key_pos];
+#endif // __AVX2__
+
+#ifdef __SSE2__
+    while (to - i >= 16) {
+        __m128i data = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i key = _mm_loadu_si128((const __m128i *)(m_KeyStream + phase));
+        _mm_storeu_si128((__m128i *)(buf + i), _mm_xor_si128(data, key));
+        i += 16;
+        phase = (phase + 16) & 127;
     }
-
-    delete[] key;
-}
-
-uint32
-Museek::MessageProcessor::getMessageLen(const unsigned char *inbuf)
-{
-    if (obfuscated()) {
-        // Decode only the message length
-        uchar * msg_len = new uchar[8]; // 8 = keysize + 4 bytes for message length
-        for(uint j = 0; j < 8; ++j)
-            msg_len[j] = inbuf[j];
-        decodeMessage(msg_len, 4);
-
-        /* Unpack the message length. 32bit little endian, that's the slsk way. */
-        uint32 len = msg_len[4] + (msg_len[5] << 8) + (msg_len[6] << 16) + (msg_len[7] << 24);
-        delete[] msg_len;
-
-        return len;
+#endif // __SSE2__
+
+    while (to - i >= 8) {
+        uint64 data, key;
+        memcpy(&data, buf + i, 8);
+        memcpy(&key, m_KeyStream + phase, 8);
+        data ^= key;
+        memcpy(buf + i, &data, 8);
+        i += 8;
+        phase = (phase + 8) & 127;
     }
-    else {
-        /* Unpack the message length. 32bit little endian, that's the slsk way. */
-        return inbuf[0] + (inbuf[1] << 8) + (inbuf[2] << 16) + (inbuf[3] << 24);
+
+    for (; i < to; ++i) {
+        buf[i] ^= m_KeyStream[phase];
+        phase = (phase + 1) & 127;
     }
 }
@@ -32,6 +32,27 @@ namespace NewNet
 
 namespace Museek
 {
+  /* Decodes obfuscated peer messages. Every 4-byte block following the
+     4-byte key is XORed with the key rotated left by one more bit than the
+     previous block, so the keystream repeats every 32 blocks. It is expanded
+     once per message and applied in place without any allocation. */
+  class ObfuscationDecoder
+  {
+  public:
+    /* Expand the keystream from the 4 key bytes at the start of a message. */
+    void setKey(const unsigned char * key);
+
+    /* Decode bytes [from, to) of a message in place. Offsets are relative to
+       the start of the message (the key), so from must be at least 4. Any
+       range may be decoded, which allows decoding a message as it arrives. */
+    void decode(unsigned char * buf, size_t from, size_t to) const;
+
+  private:
+    /* 32 blocks of keystream, stored twice so any 128-byte window starting
+       in the first half is contiguous. */
+    unsigned char m_KeyStream[256];
+  };
+
   /* MessageProcessor is a mix-in class that provides the means to process
      soulseek message packets coming in on a socket. */
   class MessageProcessor
@@ -39,7 +60,7 @@ namespace Museek
   public:
     /* Constructor. codeSize defines how wide the messageCode parameter will
        be. 1 is used for handshake socket, other types use 4. */
-    MessageProcessor(uint codeSize, bool obfuscated = false) : m_CodeSize(codeSize), m_IsObfuscated(obfuscated)
+    MessageProcessor(uint codeSize, bool obfuscated = false) : m_CodeSize(codeSize), m_IsObfuscated(obfuscated), m_Decoded(0)
     {
     }
 
@@ -72,6 +93,7 @@ namespace Museek
 
     void setObfuscated(bool isObfuscated) {
         m_IsObfuscated = isObfuscated;
+        m_Decoded = 0;
     }
 
     bool obfuscated() {
@@ -84,12 +106,13 @@ namespace Museek
 
     bool m_IsObfuscated;
 
+    /* Number of bytes of the current obfuscated message (key included)
+       that have already been decoded in the receive buffer. */
+    size_t m_Decoded;
+    ObfuscationDecoder m_Decoder;
+
     /* Try to parse a complete message from the socket's receive buffer. */
     bool parseMessage(NewNet::ClientSocket * socket);
-
-    void rotrKey(unsigned char *buf, unsigned int c);
-    void decodeMessage(unsigned char *buf, uint32 len);
-    uint32 getMessageLen(const unsigned char *buf);
   };
 }
 
@@ -32,6 +32,8 @@
 #include "uploadmanager.h"
 #include "sharesdatabase.h"
 #include "searchmanager.h"
+#include "handoff.h"
+#include "loadmonitor.h"
 #include <NewNet/nnreactor.h>
 #include <fstream>
 
@@ -49,6 +51,7 @@ Museek::Museekd::Museekd(NewNet::Reactor * reactor) : m_Reactor(reactor)
 
   /* Instantiate the various components. Order can be important here. */
   m_Config = new ConfigManager();
+  m_Load = new LoadMonitor(this);
   m_Codeset = new CodesetManager(this);
   m_Server = new ServerManager(this);
   m_Peers = new PeerManager(this);
@@ -71,6 +74,10 @@ void Museek::Museekd::LoadShares() {
     m_BuddyShares->load(bshares, (!shares.empty()));
 }
 
+void Museek::Museekd::setHandoff(Handoff * handoff) {
+    m_Handoff = handoff;
+}
+
 void Museek::Museekd::LoadDownloads() {
     m_Downloads->loadDownloads();
 }
@@ -173,3 +180,48 @@ void Museek::Museekd::sendSharedNumber() {
 bool Museek::Museekd::isEnabledPrivRoom() {
     return config()->getBool("priv_rooms", "enable_priv_room", false);
 }
+
+/* Defaults for socketOptions(). Latency matters for the server and the
+   interfaces, throughput for the transfers. Keepalive probes detect peers
+   that vanished while their connection was idle. */
+static const struct
+{
+    const char * role;
+    int sendBuffer, receiveBuffer;
+    bool noDelay;
+    int keepAlive, keepAliveInterval, keepAliveCount;
+    int notSentLowat;
+} socketDefaults[] = {
+    { "server",      0,           0,           true,  60,  10, 6, 0 },
+    { "interface",   0,           0,           true,  0,   0,  0, 0 },
+    { "peer",        0,           0,           true,  120, 30, 4, 0 },
+    { "distributed", 0,           0,           false, 120, 30, 4, 0 },
+    { "upload",      1024 * 1024, 0,           false, 0,   0,  0, 128 * 1024 },
+    { "download",    0,           1024 * 1024, false, 0,   0,  0, 0 },
+};
+
+NewNet::ClientSocket::SocketOptions Museek::Museekd::socketOptions(const std::string & role) const {
+    NewNet::ClientSocket::SocketOptions options;
+    for (size_t i = 0; i < sizeof(socketDefaults) / sizeof(socketDefaults[0]); ++i) {
+        if (role == socketDefaults[i].role) {
+            options.sendBuffer = socketDefaults[i].sendBuffer;
+            options.receiveBuffer = socketDefaults[i].receiveBuffer;
+            options.noDelay = socketDefaults[i].noDelay;
+            options.keepAlive = socketDefaults[i].keepAlive;
+            options.keepAliveInterval = socketDefaults[i].keepAliveInterval;
+            options.keepAliveCount = socketDefaults[i].keepAliveCount;
+            options.notSentLowat = socketDefaults[i].notSentLowat;
+            break;
+        }
+    }
+
+    std::string domain = "sockets." + role;
+    options.sendBuffer = config()->getInt(domain, "send_buffer", options.sendBuffer);
+    options.receiveBuffer = config()->getInt(domain, "receive_buffer", options.receiveBuffer);
+    options.noDelay = config()->getBool(domain, "nodelay", options.noDelay);
+    options.keepAlive = config()->getInt(domain, "keepalive", options.keepAlive);
+    options.keepAliveInterval = config()->getInt(domain, "keepalive_interval", options.keepAliveInterval);
+    options.keepAliveCount = config()->getInt(domain, "keepalive_count", options.keepAliveCount);
+    options.notSentLowat = config()->getInt(domain, "notsent_lowat", options.notSentLowat);
+    return options;
+}
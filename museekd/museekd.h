@@ -28,6 +28,7 @@ namespace NewNet
 
 #include "servermessages.h"
 #include <NewNet/nnrefptr.h>
+#include <NewNet/nnclientsocket.h>
 
 namespace Museek
 {
@@ -41,6 +42,8 @@ namespace Museek
   class SharesDatabase;
   class SearchManager;
   class IfaceManager;
+  class Handoff;
+  class LoadMonitor;
 
   class Museekd : public NewNet::Object
   {
@@ -120,6 +123,20 @@ namespace Museek
       return m_Searches;
     }
 
+    /* Return a pointer to the load monitor (overload protection). */
+    LoadMonitor * load() const
+    {
+      return m_Load;
+    }
+
+    /* Return the state handed over by the previous instance during a hot
+       restart, 0 if there's none (anymore). */
+    Handoff * handoff() const
+    {
+      return m_Handoff;
+    }
+    void setHandoff(Handoff * handoff);
+
     void LoadShares();
     void LoadDownloads();
 
@@ -143,6 +160,11 @@ namespace Museek
     void sendSharedNumber();
     bool isEnabledPrivRoom();
 
+    /* Socket options for a kind of connection: "server", "interface",
+       "peer", "distributed", "upload" or "download". Each has its own
+       defaults, which can be changed in the sockets.<role> domain. */
+    NewNet::ClientSocket::SocketOptions socketOptions(const std::string & role) const;
+
   private:
     /* Our strong references to the various components. */
     NewNet::RefPtr<NewNet::Reactor> m_Reactor;
@@ -155,6 +177,8 @@ namespace Museek
     NewNet::RefPtr<IfaceManager> m_Ifaces;
     NewNet::RefPtr<SharesDatabase> m_Shares, m_BuddyShares;
     NewNet::RefPtr<SearchManager> m_Searches;
+    NewNet::RefPtr<Handoff> m_Handoff;
+    NewNet::RefPtr<LoadMonitor> m_Load;
 
     int m_Token;
 
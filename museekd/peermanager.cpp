@@ -31,7 +31,10 @@
 #include "distributedsocket.h"
 #include "searchmanager.h"
 #include "ifacemanager.h"
+#include "handoff.h"
+#include "loadmonitor.h"
 #include <NewNet/util.h>
+#include <NewNet/nnclock.h>
 #include <NewNet/nntcpserversocket.h>
 
 Museek::PeerManager::PeerManager(Museekd * museekd) : m_Museekd(museekd)
@@ -100,6 +103,9 @@ Museek::PeerManager::listen()
     unlisten();
   }
 
+  if(adoptListeners(first, last))
+    return;
+
   // Normal peer socket
   unsigned int port = first;
   while(port <= last)
@@ -144,6 +150,51 @@ Museek::PeerManager::listen()
   NNLOG("museekd.peers.warn", "Couldn't find port to listen for peers on (range: %i - %i).", first, last);
 }
 
+/**
+  * Use the listening sockets handed over by the previous instance, if they're still in the range.
+  */
+bool
+Museek::PeerManager::adoptListeners(uint first, uint last)
+{
+  if(! m_Museekd->handoff())
+    return false;
+
+  int fd = m_Museekd->handoff()->takeListener("peers");
+  int obfuscatedFd = m_Museekd->handoff()->takeListener("peers.obfuscated");
+  if(fd == -1)
+  {
+    if(obfuscatedFd != -1)
+      closesocket(obfuscatedFd);
+    return false;
+  }
+
+  m_Factory = new PeerFactory();
+  m_Factory->clientAcceptedEvent.connect(this, &PeerManager::onClientAccepted);
+  m_Museekd->reactor()->add(m_Factory->serverSocket());
+  m_Factory->serverSocket()->adopt(fd);
+  unsigned int port = m_Factory->serverSocket()->listenPort();
+  if((port < first) || (port > last))
+  {
+    NNLOG("museekd.peers.debug", "Inherited port %u is out of the range, not using it.", port);
+    unlisten();
+    if(obfuscatedFd != -1)
+      closesocket(obfuscatedFd);
+    return false;
+  }
+
+  if(obfuscatedFd != -1)
+  {
+    m_ObfuscatedFactory = new ObfuscatedFactory();
+    m_ObfuscatedFactory->clientAcceptedEvent.connect(this, &PeerManager::onClientAccepted);
+    m_Museekd->reactor()->add(m_ObfuscatedFactory->serverSocket());
+    m_ObfuscatedFactory->serverSocket()->adopt(obfuscatedFd);
+  }
+
+  onServerLoggedInStateChanged(m_Museekd->server()->loggedIn());
+  NNLOG("museekd.peers.debug", "Listening for peers on inherited port %u", port);
+  return true;
+}
+
 /**
   * Returns a peersocket for the given user name.
   */
@@ -165,6 +216,11 @@ Museek::PeerManager::peerSocket(const std::string & user, bool force) {
             return;
         }
 
+        if (!force && !acceptsPeer(user)) {
+            peerSocketUnavailableEvent(user);
+            return;
+        }
+
         // We can, register the user
         m_Peers[user] = 0;
 
@@ -200,8 +256,7 @@ Museek::PeerManager::peerSocket(const std::string & user, bool force) {
 void Museek::PeerManager::requestUserData(const std::string& user) {
     // Tell the server we want to watch this user
     // We don't need to send another SAddUser if we've just sent one
-    struct timeval now;
-    gettimeofday(&now, NULL);
+    const struct timeval & now = NewNet::clock.now();
     std::map<std::string, struct timeval >::iterator tit;
     tit = m_LastStatusTime.find(user);
     if(tit == m_LastStatusTime.end() || difftime(now, (*tit).second) > 10000.0) {
@@ -214,6 +269,18 @@ void Museek::PeerManager::requestUserData(const std::string& user) {
     }
 }
 
+/**
+  * Should we open a new peer socket for this user? Only buddies get one when we're overloaded.
+  */
+bool Museek::PeerManager::acceptsPeer(const std::string & user) {
+    if (!museekd()->load()->shedding(LoadMonitor::RefusePeers) || museekd()->isBuddied(user))
+        return true;
+
+    NNLOG("museekd.peers.debug", "Overloaded, refusing a new peer socket for %s", user.c_str());
+    museekd()->load()->countShed(LoadMonitor::RefusePeers);
+    return false;
+}
+
 /**
   * Register a peer socket associated with the given user
   */
@@ -468,6 +535,8 @@ Museek::PeerManager::onServerConnectToPeerRequested(const SConnectToPeer * messa
     }
 
     if (message->type == "P") {
+        if (!acceptsPeer(message->user))
+            return;
         PeerSocket * socket = new PeerSocket(m_Museekd, message->use_obfuscation);
         socket->setUser(message->user);
         addPeerSocket(socket);
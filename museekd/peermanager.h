@@ -71,6 +71,9 @@ namespace Museek
     /* Find or make a peer socket for the specified user. */
     void peerSocket(const std::string & user, bool force = true);
     void addPeerSocket(PeerSocket * socket);
+    /* Returns false if a new peer socket for this user should be refused
+       because we're overloaded. */
+    bool acceptsPeer(const std::string & user);
     void removePeerSocket(const std::string & user, bool disconnect = false);
 
     std::map<std::string, UserData> *userStats() {return &m_UserStats;};
@@ -87,6 +90,7 @@ namespace Museek
 
   protected:
     void listen();
+    bool adoptListeners(uint first, uint last);
     void unlisten();
 
   private:
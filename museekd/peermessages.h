@@ -362,8 +362,16 @@ PEERMESSAGE(PFolderContentsReply, 37)
 	PFolderContentsReply() {};
 	PFolderContentsReply(const Folders _f)
                            : folders(_f) {};
+	PFolderContentsReply(const std::vector<uchar>& _data)
+                           : data(_data) {};
 
 	MAKE
+		if(! data.empty()) {
+			// Packed and compressed already
+			buffer.append(&data[0], data.size());
+			return buffer;
+		}
+
 		pack((uint32)folders.size());
 		Folders::iterator fit = folders.begin();
 		for(; fit != folders.end(); ++fit) {
@@ -432,6 +440,7 @@ PEERMESSAGE(PFolderContentsReply, 37)
 		}
 	END_PARSE
 
+	std::vector<uchar> data;
 	Folders folders;
 END
 
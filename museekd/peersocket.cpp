@@ -36,6 +36,7 @@
 #include "uploadsocket.h"
 #include "searchmanager.h"
 #include "sharesdatabase.h"
+#include "messagedispatcher.h"
 #include <Muhelp/string_ext.hh>
 #include <fstream>
 #include <NewNet/nnratelimiter.h>
@@ -45,11 +46,13 @@
 Museek::PeerSocket::PeerSocket(Museek::Museekd * museekd, bool obfuscated) : Museek::UserSocket(museekd, "P", obfuscated), Museek::MessageProcessor(4, obfuscated)
 {
   connectMessageSignals();
+  setSocketOptions(museekd->socketOptions("peer"));
 }
 
 Museek::PeerSocket::PeerSocket(Museek::HandshakeSocket * that) : Museek::UserSocket(that, "P"), Museek::MessageProcessor(4, that->obfuscated())
 {
   connectMessageSignals();
+  setSocketOptions(museekd()->socketOptions("peer"));
 
   // If there's no activity within the next 130 seconds, then the socket should be closed (timeout)
   m_SocketTimeout = museekd()->reactor()->addTimeout(130000, this, &PeerSocket::onSocketTimeout);
@@ -119,6 +122,33 @@ Museek::PeerSocket::onDataReceived(NewNet::ClientSocket * socket)
   }
 }
 
+namespace
+{
+  #define MAP_MESSAGE(ID, TYPE, EVENT) \
+    DISPATCH_SUBSCRIBED(Museek::PeerSocket, EVENT) \
+    static void dispatch_##EVENT(Museek::PeerSocket * owner, const Museek::MessageProcessor::MessageData * data) \
+    { \
+      NNLOG("museek.messages.peer", "Received peer message " #TYPE "."); \
+      TYPE msg; \
+      msg.setPeerSocket(owner); \
+      msg.parse_network_packet(data->data, data->length); \
+      owner->EVENT(&msg); \
+    }
+  #include "peereventtable.h"
+  #undef MAP_MESSAGE
+
+  typedef Museek::MessageDispatcher<Museek::PeerSocket> PeerDispatcher;
+
+  const PeerDispatcher::Entry peerDispatchEntries[] = {
+    #define MAP_MESSAGE(ID, TYPE, EVENT) DISPATCH_ENTRY(ID, TYPE, EVENT)
+    #include "peereventtable.h"
+    #undef MAP_MESSAGE
+  };
+
+  const PeerDispatcher peerDispatcher(peerDispatchEntries,
+      sizeof(peerDispatchEntries) / sizeof(peerDispatchEntries[0]));
+}
+
 void
 Museek::PeerSocket::onMessageReceived(const MessageData * data)
 {
@@ -132,25 +162,11 @@ Museek::PeerSocket::onMessageReceived(const MessageData * data)
     m_SocketTimeout = museekd()->reactor()->addTimeout(130000, this, &PeerSocket::onSocketTimeout);
   }
 
-  switch(data->type)
+  if(! peerDispatcher.dispatch(this, data))
   {
-    #define MAP_MESSAGE(ID, TYPE, EVENT) \
-      case ID: \
-      { \
-        NNLOG("museek.messages.peer", "Received peer message " #TYPE "."); \
-        TYPE msg; \
-        msg.setPeerSocket(this); \
-        msg.parse_network_packet(data->data, data->length); \
-        EVENT(&msg); \
-        break; \
-      }
-    #include "peereventtable.h"
-    #undef MAP_MESSAGE
-
-    default:
-        NNLOG("museekd.peers.warn", "Received unknown peer message, type: %u, length: %u", data->type, data->length);
-        NetworkMessage msg;
-        msg.parse_network_packet(data->data, data->length);
+    NNLOG("museekd.peers.warn", "Received unknown peer message, type: %u, length: %u", data->type, data->length);
+    NetworkMessage msg;
+    msg.parse_network_packet(data->data, data->length);
   }
 }
 
@@ -432,21 +448,29 @@ void
 Museek::PeerSocket::onFolderContentsRequested(const PFolderContentsRequest * message)
 {
     if (! museekd()->isBanned(user())) {
+        SharesDatabase* db;
+        if (museekd()->haveBuddyShares() && museekd()->isBuddied(user()))
+            db = museekd()->buddyshares();
+        else
+            db = museekd()->shares();
+
+        // A single folder, the usual case: the reply may be cached already
+        if (message->dirs.size() == 1) {
+            std::shared_ptr<const std::vector<uchar> > data = db->folder_reply(message->dirs.front());
+            if (data) {
+                PFolderContentsReply msg(*data);
+                sendMessage(msg.make_network_packet());
+            }
+            return;
+        }
+
         std::vector<std::string>::const_iterator it;
         Folders reply;
         for (it = message->dirs.begin(); it != message->dirs.end(); it++) {
             std::string dir = *it;
-            Shares content;
-            if (museekd()->haveBuddyShares() && museekd()->isBuddied(user())) {
-                content = museekd()->buddyshares()->folder_contents(dir);
-                if (content.size() > 0)
-                    reply[dir] = content;
-            }
-            else {
-                content = museekd()->shares()->folder_contents(dir);
-                if (content.size() > 0)
-                    reply[dir] = content;
-            }
+            Shares content = db->folder_contents(dir);
+            if (content.size() > 0)
+                reply[dir] = content;
         }
 
         if (reply.size() > 0) {
@@ -516,7 +540,7 @@ Museek::PeerSocket::initiateOurself()
     HInitiate handshake(museekd()->server()->username(), type(), token());
     sendMessage(handshake.make_network_packet());
 
-    m_CannotConnectOurselfCallback = cannotConnectEvent.connect(this, & PeerManager::onCannotConnectOurself);
+    m_CannotConnectOurselfCallback = cannotConnectEvent.connect(museekd()->peers(), & PeerManager::onCannotConnectOurself);
 
     uint port = museekd()->peers()->peerFactory()->serverSocket()->listenPort();
 
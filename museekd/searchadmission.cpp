@@ -0,0 +1,173 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "searchadmission.h"
+#include "museekd.h"
+#include "configmanager.h"
+#include <NewNet/nnlog.h>
+#include <NewNet/nnclock.h>
+#include <NewNet/util.h>
+#include <algorithm>
+#include <stdio.h>
+
+/* How long the same query from the same user counts as a repeat, in ms. */
+#define REPEAT_TIME 10000
+/* How often the drop counters are logged at most, in ms. */
+#define REPORT_INTERVAL 60000
+/* Number of searchers we remember at most. */
+#define MAX_SEARCHERS 4096
+
+static const char * reasonNames[] = {
+  "overloaded",
+  "duplicate",
+  "flooding",
+  "too busy",
+  "too expensive",
+  "queue full",
+  "expired"
+};
+
+Museek::SearchAdmission::SearchAdmission(Museekd * museekd) : m_Museekd(museekd), m_Tokens(0), m_Reported(0)
+{
+  m_Last = m_ReportedAt = NewNet::clock.now();
+  for(int i = 0; i < Reasons; ++i)
+    m_Dropped[i] = 0;
+}
+
+bool
+Museek::SearchAdmission::admit(const std::string & username, const std::string & query, uint token)
+{
+  struct timeval now = NewNet::clock.now();
+  int userRate = museekd()->config()->getInt("searches", "user_rate", 20);
+  int rate = museekd()->config()->getInt("searches", "rate", 50);
+
+  expire(now);
+
+  std::map<std::string, Searcher>::iterator it = m_Searchers.find(username);
+  bool known = it != m_Searchers.end();
+  if(known)
+    m_Recent.splice(m_Recent.begin(), m_Recent, it->second.recent);
+  else
+  {
+    /* Everybody we remember searched lately: that's a flood of users. */
+    if(m_Searchers.size() >= MAX_SEARCHERS)
+    {
+      NNLOG("museekd.peers.debug", "Too many searchers, dropping search request from %s", username.c_str());
+      drop(TooBusy);
+      return false;
+    }
+    it = m_Searchers.insert(std::make_pair(username, Searcher())).first;
+    it->second.tokens = userRate / 4.0 + 1;
+    it->second.last = now;
+    it->second.recent = m_Recent.insert(m_Recent.begin(), username);
+  }
+  Searcher & searcher = it->second;
+  searcher.seen = now;
+
+  /* The same search often reaches us twice, from the server and from our
+     parent. */
+  if(known && (token == searcher.token || (query == searcher.query && difftime(now, searcher.last) < REPEAT_TIME)))
+  {
+    NNLOG("museekd.peers.debug", "Duplicate, dropping search request from %s", username.c_str());
+    drop(Duplicate);
+    return false;
+  }
+
+  if(userRate > 0 && ! take(searcher.tokens, searcher.last, now, userRate / 60000.0, userRate / 4.0 + 1))
+  {
+    NNLOG("museekd.peers.debug", "Flooding, dropping search request from %s", username.c_str());
+    drop(Flooding);
+    return false;
+  }
+  searcher.last = now;
+  searcher.query = query;
+  searcher.token = token;
+
+  if(rate > 0 && ! take(m_Tokens, m_Last, now, rate / 1000.0, rate))
+  {
+    NNLOG("museekd.peers.debug", "Too busy, dropping search request from %s", username.c_str());
+    drop(TooBusy);
+    return false;
+  }
+
+  return true;
+}
+
+void
+Museek::SearchAdmission::drop(Reason reason)
+{
+  ++m_Dropped[reason];
+
+  /* Keep the log readable under a flood: a summary now and then. */
+  struct timeval now = NewNet::clock.now();
+  if(difftime(now, m_ReportedAt) < REPORT_INTERVAL)
+    return;
+
+  unsigned long total = 0;
+  std::string counts;
+  for(int i = 0; i < Reasons; ++i)
+  {
+    total += m_Dropped[i];
+    if(m_Dropped[i])
+    {
+      char buf[64];
+      snprintf(buf, sizeof(buf), "%s%s %lu", counts.empty() ? "" : ", ", reasonNames[i], m_Dropped[i]);
+      counts += buf;
+    }
+  }
+  NNLOG("museekd.debug", "Dropped %lu search requests lately, %lu overall: %s.", total - m_Reported, total, counts.c_str());
+  m_Reported = total;
+  m_ReportedAt = now;
+}
+
+/* Token bucket: 'rate' tokens come in every ms, up to 'burst'. Takes one
+   and returns true if there's one left. */
+bool
+Museek::SearchAdmission::take(double & tokens, struct timeval & last, const struct timeval & now, double rate, double burst)
+{
+  double elapsed = difftime(now, last);
+  if(elapsed > 0)
+  {
+    tokens = std::min(burst, tokens + elapsed * rate);
+    last = now;
+  }
+  if(tokens < 1)
+    return false;
+  tokens -= 1;
+  return true;
+}
+
+/* Forget the users we haven't heard of for a while. They're at the end
+   of m_Recent, so this only looks at the ones it forgets, and one more. */
+void
+Museek::SearchAdmission::expire(const struct timeval & now)
+{
+  while(! m_Recent.empty())
+  {
+    std::map<std::string, Searcher>::iterator it = m_Searchers.find(m_Recent.back());
+    if(difftime(now, it->second.seen) < REPEAT_TIME)
+      break;
+    m_Searchers.erase(it);
+    m_Recent.pop_back();
+  }
+}
@@ -0,0 +1,107 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_SEARCHADMISSION_H
+#define MUSEEK_SEARCHADMISSION_H
+
+#include <NewNet/nnobject.h>
+#include <NewNet/nnweakrefptr.h>
+#include "mutypes.h"
+#include <list>
+#include <map>
+#include <string>
+
+namespace Museek
+{
+  class Museekd;
+
+  /* Decides which of the search requests we receive get answered, and
+     counts the ones that don't, by reason. Repeats of a search (the same
+     ticket, or the same query within a few seconds) are dropped, so are
+     users searching faster than their share and searches coming in faster
+     than we want to answer them. Set up from the searches domain:
+     'user_rate' is the most searches a user may send per minute and 'rate'
+     the most searches per second overall (0 disables either), both allow
+     short bursts. At most a few thousand searchers are remembered: when
+     they were all heard of lately, searches from new users count as too
+     busy. */
+  class SearchAdmission : public NewNet::Object
+  {
+  public:
+    enum Reason
+    {
+      Overloaded = 0, // The reactor can't keep up
+      Duplicate,      // Already received
+      Flooding,       // The user searches too often
+      TooBusy,        // Everybody searches too often
+      TooExpensive,   // Would take too long to answer
+      QueueFull,      // Too many searches waiting for a worker
+      Expired,        // Waited too long for a worker
+      Reasons
+    };
+
+    SearchAdmission(Museekd * museekd);
+
+    /* Return pointer to museekd instance. */
+    Museekd * museekd() const
+    {
+      return m_Museekd;
+    }
+
+    /* Returns false, and counts why, if the search shouldn't be answered.
+       Cheap, call it before looking at the query. */
+    bool admit(const std::string & username, const std::string & query, uint token);
+
+    /* Count a search dropped later on. */
+    void drop(Reason reason);
+
+    /* Number of searches dropped because of 'reason'. Also logged now and
+       then, and sent to the interfaces with the statistics. */
+    unsigned long dropped(Reason reason) const
+    {
+      return m_Dropped[reason];
+    }
+
+  private:
+    struct Searcher
+    {
+      double tokens;          // Searches the user may still send right now
+      struct timeval last;    // Last time we heard of them
+      std::string query;      // Last query they sent
+      uint token;             // Its ticket
+      struct timeval seen;    // Last time they sent anything
+      std::list<std::string>::iterator recent; // Their place in m_Recent
+    };
+
+    static bool take(double & tokens, struct timeval & last, const struct timeval & now, double rate, double burst);
+    void expire(const struct timeval & now);
+
+    NewNet::WeakRefPtr<Museekd> m_Museekd;
+    std::map<std::string, Searcher> m_Searchers;
+    std::list<std::string> m_Recent;        // Searchers, the latest heard of first
+    double m_Tokens;                        // Searches anybody may still send right now
+    struct timeval m_Last;
+    unsigned long m_Dropped[Reasons];
+    unsigned long m_Reported;               // Drops already logged
+    struct timeval m_ReportedAt;
+  };
+}
+
+#endif // MUSEEK_SEARCHADMISSION_H
@@ -28,6 +28,8 @@
 #include "peermanager.h"
 #include "sharesdatabase.h"
 #include "ifacemanager.h"
+#include "loadmonitor.h"
+#include <Muhelp/Codec.hh>
 #include <NewNet/nnreactor.h>
 #include <NewNet/util.h>
 
@@ -53,6 +55,11 @@ Museek::SearchManager::SearchManager(Museekd * museekd) : m_Museekd(museekd)
     m_TransferSpeed = 0;
     m_ChildrenMaxNumber = 0;
     m_WishlistInterval = 720; // Default wishlist interval
+
+    m_Workers = new SearchWorkers(museekd);
+    m_Workers->finishedEvent.connect(this, &SearchManager::onSearchFinished);
+    m_Workers->expiredEvent.connect(this, &SearchManager::onSearchExpired);
+    m_Admission = new SearchAdmission(museekd);
 }
 
 Museek::SearchManager::~SearchManager()
@@ -386,6 +393,14 @@ void Museek::SearchManager::onWishlistTimeout(long) {
   * The query's encoding should be the network one
   */
 void Museek::SearchManager::transmitSearch(uint unknown, const std::string & username, uint ticket, const std::string & query) {
+    if (m_Children.empty())
+        return;
+
+    if (museekd()->load()->shedding(LoadMonitor::NoForwarding)) {
+        museekd()->load()->countShed(LoadMonitor::NoForwarding);
+        return;
+    }
+
     std::map<std::string, std::pair<NewNet::RefPtr<DistributedSocket>, uint> >::const_iterator it;
     for (it = m_Children.begin(); it != m_Children.end(); it++) {
         DistributedSocket * socket = it->second.first;
@@ -402,6 +417,16 @@ void Museek::SearchManager::transmitSearch(uint unknown, const std::string & use
   */
 void Museek::SearchManager::sendSearchResults(const std::string & username, const std::string & query, uint token) {
 	if(! museekd()->isBanned(username) && (username != museekd()->server()->username())) {
+        if (museekd()->load()->shedding(LoadMonitor::DropSearches)) {
+            NNLOG("museekd.peers.debug", "Overloaded, dropping search request from %s", username.c_str());
+            museekd()->load()->countShed(LoadMonitor::DropSearches);
+            m_Admission->drop(SearchAdmission::Overloaded);
+            return;
+        }
+
+        if (! m_Admission->admit(username, query, token))
+            return;
+
         SharesDatabase* db;
 
         if (museekd()->isBuddied(username))
@@ -409,16 +434,64 @@ void Museek::SearchManager::sendSearchResults(const std::string & username, cons
         else
             db = museekd()->shares();
 
-        Folder results;
-        db->search(query, results);
+        std::unique_ptr<SearchWorkers::Job> job(new SearchWorkers::Job);
+        if (! db->parse(query, job->query))
+            return;
+
+        job->username = username;
+        job->token = token;
+        job->buddies = (db == museekd()->buddyshares());
+        job->snapshot = db->snapshot();
+
+        if (! db->cached(job->query, job->files)) {
+            // One very common word and a few exclusions can go through every file we share
+            int maxCost = museekd()->config()->getInt("searches", "max_cost", 10000000);
+            if (maxCost > 0 && SharesDatabase::cost(*job->snapshot, job->query) > static_cast<uint64>(maxCost)) {
+                NNLOG("museekd.peers.debug", "Too expensive, dropping search request from %s", username.c_str());
+                m_Admission->drop(SearchAdmission::TooExpensive);
+                return;
+            }
+
+            if (m_Workers->start()) {
+                if (! m_Workers->submit(job)) {
+                    NNLOG("museekd.peers.debug", "Too many searches waiting, dropping search request from %s", username.c_str());
+                    m_Admission->drop(SearchAdmission::QueueFull);
+                }
+                return;
+            }
 
-        if (!results.empty()) {
-            m_PendingResults[username][token] = results;
-            museekd()->peers()->peerSocket(username, false);
+            // No workers, search right here
+            Codec codec(job->snapshot->encoding, "UTF-8");
+            SharesDatabase::find_files(*job->snapshot, codec, job->query, job->files);
         }
+
+        SharesDatabase::results(*job->snapshot, job->files, job->results);
+        onSearchFinished(job.get());
 	}
 }
 
+/**
+  * A search ran by the workers is done, keep its results and get them on
+  * their way
+  */
+void Museek::SearchManager::onSearchFinished(SearchWorkers::Job * job) {
+    SharesDatabase * db = job->buddies ? museekd()->buddyshares() : museekd()->shares();
+    db->cache(job->query, job->snapshot->generation, job->files);
+
+    if (!job->results.empty()) {
+        m_PendingResults[job->username][job->token].swap(job->results);
+        museekd()->peers()->peerSocket(job->username, false);
+    }
+}
+
+/**
+  * A search waited too long for the workers, it won't be answered
+  */
+void Museek::SearchManager::onSearchExpired(SearchWorkers::Job * job) {
+    NNLOG("museekd.peers.debug", "Search request from %s waited too long, dropping it", job->username.c_str());
+    m_Admission->drop(SearchAdmission::Expired);
+}
+
 /**
   * Initiate a search in our buddy list
   */
@@ -30,6 +30,8 @@
 #include "peermessages.h"
 #include "distributedsocket.h"
 #include "configmanager.h"
+#include "searchworkers.h"
+#include "searchadmission.h"
 
 /* Forward declarations. */
 class SGetStatus;
@@ -82,6 +84,13 @@ namespace Museek
 
     bool acceptChildren() {return ((m_TransferSpeed > m_ParentMinSpeed) && (m_Children.size() < m_ChildrenMaxNumber));};
 
+    /* Number of users we have search results waiting for, and of searches
+       still running. */
+    size_t pendingResults() const {return m_PendingResults.size() + m_Workers->pending();};
+
+    /* Which search requests get answered, and why the others don't. */
+    SearchAdmission * admission() const {return m_Admission;};
+
     void buddySearch(uint token, const std::string & query);
     void roomsSearch(uint token, const std::string & query);
     void wishlistAdd(const std::string & query);
@@ -106,6 +115,8 @@ namespace Museek
     void onConfigKeySet(const ConfigManager::ChangeNotify * data);
     void onConfigKeyRemoved(const ConfigManager::RemoveNotify * data);
     void onWishlistTimeout(long);
+    void onSearchFinished(SearchWorkers::Job * job);
+    void onSearchExpired(SearchWorkers::Job * job);
 
     NewNet::WeakRefPtr<Museekd>                 m_Museekd;          // Ref to the museekd
     std::string                                 m_ParentIp;         // The IP address of our parent
@@ -125,6 +136,8 @@ namespace Museek
                                                 m_PendingResults;   // Pending search results we'll have to send soon
     std::map<std::string, time_t>               m_Wishlist;         // Wishlist items with the last time we searched for them
     NewNet::WeakRefPtr<NewNet::Event<long>::Callback> m_WishlistTimeout; // Wishlist timeout
+    NewNet::RefPtr<SearchWorkers>               m_Workers;          // Threads answering the searches we receive
+    NewNet::RefPtr<SearchAdmission>             m_Admission;        // Filters the searches we receive
   };
 }
 
@@ -0,0 +1,172 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif // HAVE_CONFIG_H
+#include "searchworkers.h"
+#include "museekd.h"
+#include "configmanager.h"
+#include <Muhelp/Codec.hh>
+#include <NewNet/nnreactor.h>
+#include <NewNet/nnlog.h>
+
+Museek::SearchWorkers::SearchWorkers(Museekd * museekd) : m_Museekd(museekd), m_Running(0), m_Started(false), m_Stop(false)
+{
+}
+
+Museek::SearchWorkers::~SearchWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stop = true;
+  }
+  m_Wakeup.notify_all();
+  std::vector<std::thread>::iterator it = m_Threads.begin();
+  for(; it != m_Threads.end(); ++it)
+    it->join();
+
+  while(! m_Queue.empty())
+  {
+    delete m_Queue.front();
+    m_Queue.pop_front();
+  }
+  while(! m_Done.empty())
+  {
+    delete m_Done.front();
+    m_Done.pop_front();
+  }
+
+  if(m_Notifier && m_Notifier->reactor())
+    m_Notifier->reactor()->remove(m_Notifier);
+}
+
+bool
+Museek::SearchWorkers::start()
+{
+  if(m_Started)
+    return ! m_Threads.empty();
+  m_Started = true;
+
+  int workers = museekd()->config()->getInt("searches", "workers", 2);
+  if(workers <= 0)
+    return false;
+
+  m_Notifier = new NewNet::Notifier();
+  if(! m_Notifier->valid())
+  {
+    NNLOG("museekd.warn", "Couldn't start the search workers, searching in the reactor thread.");
+    return false;
+  }
+  m_Notifier->notifiedEvent.connect(this, &SearchWorkers::onNotified);
+  museekd()->reactor()->add(m_Notifier);
+
+  for(int i = 0; i < workers; ++i)
+    m_Threads.push_back(std::thread(&SearchWorkers::run, this));
+  NNLOG("museekd.debug", "Started %i search workers.", workers);
+  return true;
+}
+
+bool
+Museek::SearchWorkers::submit(std::unique_ptr<Job> & job)
+{
+  int maxDelay = museekd()->config()->getInt("searches", "max_delay", 10000);
+  size_t queueSize = museekd()->config()->getInt("searches", "queue_size", 256);
+
+  job->deadline = Clock::now() + std::chrono::milliseconds(maxDelay);
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_Queue.size() >= queueSize)
+      return false;
+    m_Queue.push_back(job.release());
+  }
+  m_Wakeup.notify_one();
+  return true;
+}
+
+size_t
+Museek::SearchWorkers::pending() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Queue.size() + m_Running + m_Done.size();
+}
+
+/* Body of the worker threads. Don't log nor touch anything but the job in
+   here: the rest of the daemon belongs to the reactor thread. */
+void
+Museek::SearchWorkers::run()
+{
+  std::unique_ptr<Codec> codec;
+  std::string encoding;
+
+  while(true)
+  {
+    std::unique_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      while(! m_Stop && m_Queue.empty())
+        m_Wakeup.wait(lock);
+      if(m_Stop)
+        return;
+      job.reset(m_Queue.front());
+      m_Queue.pop_front();
+      ++m_Running;
+    }
+
+    // Nobody is waiting for the results of an expired search anymore
+    if(Clock::now() <= job->deadline)
+    {
+      if(! codec || encoding != job->snapshot->encoding)
+      {
+        encoding = job->snapshot->encoding;
+        codec.reset(new Codec(encoding, "UTF-8"));
+      }
+      SharesDatabase::find_files(*job->snapshot, *codec, job->query, job->files);
+      SharesDatabase::results(*job->snapshot, job->files, job->results);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      --m_Running;
+      m_Done.push_back(job.release());
+    }
+    m_Notifier->notify();
+  }
+}
+
+void
+Museek::SearchWorkers::onNotified(NewNet::Notifier *)
+{
+  std::deque<Job *> done;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    done.swap(m_Done);
+  }
+
+  while(! done.empty())
+  {
+    std::unique_ptr<Job> job(done.front());
+    done.pop_front();
+    if(Clock::now() > job->deadline)
+      expiredEvent(job.get());
+    else
+      finishedEvent(job.get());
+  }
+}
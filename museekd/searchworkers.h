@@ -0,0 +1,113 @@
+/*  Museek - A SoulSeek client written in C++
+    Copyright (C) 2006-2007 Ingmar K. Steen (iksteen@gmail.com)
+    Copyright 2008 little blue poney <lbponey@users.sourceforge.net>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+ */
+
+#ifndef MUSEEK_SEARCHWORKERS_H
+#define MUSEEK_SEARCHWORKERS_H
+
+#include <NewNet/nnobject.h>
+#include <NewNet/nnweakrefptr.h>
+#include <NewNet/nnrefptr.h>
+#include <NewNet/nnevent.h>
+#include <NewNet/nnnotifier.h>
+#include "mutypes.h"
+#include "sharesdatabase.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Museek
+{
+  class Museekd;
+
+  /* Runs the searches other users send us in a pool of threads, so a heavy
+     query doesn't hold the reactor up. Each search runs against the
+     snapshot of the shares it was queued with and its results are handed
+     back in the reactor thread through finishedEvent. Searches still
+     queued when their results would arrive too late are dropped and
+     handed back through expiredEvent. Set up
+     from the searches domain: 'workers' is the number of threads (0 runs
+     the searches in the reactor, only read once), 'queue_size' the most searches waiting,
+     'max_delay' how long (in ms) a search may wait before it's dropped. */
+  class SearchWorkers : public NewNet::Object
+  {
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Job
+    {
+      std::string username;
+      uint token;
+      bool buddies;                                     // Search the buddy shares
+      SearchQuery query;
+      std::shared_ptr<const SharesSnapshot> snapshot;
+      Clock::time_point deadline;
+      // Filled in by the worker
+      std::vector<uint32> files;
+      Folder results;
+    };
+
+    SearchWorkers(Museekd * museekd);
+    ~SearchWorkers();
+
+    /* Return pointer to museekd instance. */
+    Museekd * museekd() const
+    {
+      return m_Museekd;
+    }
+
+    /* Start the threads the first time it's called, the configuration
+       isn't loaded yet when we're built. Returns false if the searches
+       should be run in the reactor instead. */
+    bool start();
+
+    /* Queue a search, the deadline is set here. Returns false (and leaves
+       job alone) when the queue is full. */
+    bool submit(std::unique_ptr<Job> & job);
+
+    /* Number of searches queued, running or waiting to be handed back. */
+    size_t pending() const;
+
+    /* Emitted in the reactor thread for every search done in time. */
+    NewNet::Event<Job *> finishedEvent;
+    /* Emitted in the reactor thread for every search that waited too
+       long, its results aren't wanted anymore. */
+    NewNet::Event<Job *> expiredEvent;
+
+  private:
+    void run();
+    void onNotified(NewNet::Notifier * notifier);
+
+    NewNet::WeakRefPtr<Museekd> m_Museekd;
+    NewNet::RefPtr<NewNet::Notifier> m_Notifier;
+    std::vector<std::thread> m_Threads;
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Wakeup;
+    std::deque<Job *> m_Queue;          // Waiting for a worker
+    std::deque<Job *> m_Done;           // Waiting for the reactor
+    size_t m_Running;
+    bool m_Started, m_Stop;
+  };
+}
+
+#endif // MUSEEK_SEARCHWORKERS_H
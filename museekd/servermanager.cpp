@@ -26,11 +26,13 @@
 #include "codesetmanager.h"
 #include "configmanager.h"
 #include "peermanager.h"
+#include "messagedispatcher.h"
 #include <NewNet/nnreactor.h>
 #include <NewNet/nnlog.h>
 #include <iostream>
 #include <sstream>
 #include <NewNet/util.h>
+#include <NewNet/nnclock.h>
 
 Museek::ServerManager::ServerManager(Museekd * museekd) : m_Museekd(museekd), m_LoggedIn(false)
 {
@@ -98,6 +100,7 @@ Museek::ServerManager::connect()
 
   // Create the TcpMessageSocket
   m_Socket = new TcpMessageSocket();
+  m_Socket->setSocketOptions(museekd()->socketOptions("server"));
 
   // Connect the event handlers
   m_Socket->cannotConnectEvent.connect(this, &ServerManager::onCannotConnect);
@@ -115,6 +118,36 @@ Museek::ServerManager::connect()
   m_Socket->connect(host, port);
 }
 
+void
+Museek::ServerManager::adopt(int fd, const std::vector<std::string> & rooms, const std::string & received, const std::string & unsent)
+{
+  m_Username = museekd()->config()->get("server", "username");
+  m_Password = museekd()->config()->get("server", "password");
+
+  m_Socket = new TcpMessageSocket();
+  m_Socket->setSocketOptions(museekd()->socketOptions("server"));
+  m_Socket->cannotConnectEvent.connect(this, &ServerManager::onCannotConnect);
+  m_Socket->disconnectedEvent.connect(this, &ServerManager::onDisconnected);
+  m_Socket->messageReceivedEvent.connect(this, &ServerManager::onMessageReceived);
+
+  m_Socket->setDescriptor(fd);
+  m_Socket->setSocketState(NewNet::Socket::SocketConnected);
+  m_Socket->receiveBuffer().append((const unsigned char *)received.data(), received.size());
+  museekd()->reactor()->add(m_Socket);
+  if(! unsent.empty())
+    m_Socket->send((const unsigned char *)unsent.data(), unsent.size());
+
+  m_AutoConnect = true;
+  NNLOG("museekd.server.debug", "Took over the server session of %s.", m_Username.c_str());
+
+  /* The server doesn't know anything happened, but we know nothing about
+     the session: join the rooms again to get their state back. */
+  m_JoinedRooms = rooms;
+  m_PingTimeout = museekd()->reactor()->addTimeout(60000, this, &ServerManager::pingServer);
+  setLoggedIn(true);
+  onSessionStarted();
+}
+
 void
 Museek::ServerManager::disconnect()
 {
@@ -143,15 +176,14 @@ Museek::ServerManager::sendMessage(const NewNet::Buffer & buffer)
     return;
   }
 
-  gettimeofday(&mLastSentMessage, 0);
+  mLastSentMessage = NewNet::clock.now();
 
   unsigned char buf[4];
   buf[0] = buffer.count() & 0xff;
   buf[1] = (buffer.count() >> 8) & 0xff;
   buf[2] = (buffer.count() >> 16) & 0xff;
   buf[3] = (buffer.count() >> 24) & 0xff;
-  m_Socket->send(buf, 4);
-  m_Socket->send(buffer.data(), buffer.count());
+  m_Socket->send(buf, 4, buffer.data(), buffer.count());
 }
 
 #define SEND_MESSAGE(m) sendMessage(m.make_network_packet())
@@ -210,28 +242,40 @@ Museek::ServerManager::onDisconnected(NewNet::ClientSocket * socket)
   museekd()->reactor()->removeTimeout(m_PingTimeout);
 }
 
-void
-Museek::ServerManager::onMessageReceived(const TcpMessageSocket::MessageData * data)
+namespace
 {
-  switch(data->type)
-  {
+  #define MAP_MESSAGE(ID, TYPE, EVENT) \
+    DISPATCH_SUBSCRIBED(Museek::ServerManager, EVENT) \
+    static void dispatch_##EVENT(Museek::ServerManager * owner, const Museek::MessageProcessor::MessageData * data) \
+    { \
+      NNLOG("museek.messages.server", "Received server message " #TYPE "."); \
+      TYPE msg; \
+      msg.parse_network_packet(data->data, data->length); \
+      owner->EVENT(&msg); \
+    }
+  #include "servereventtable.h"
+  #undef MAP_MESSAGE
+
+  typedef Museek::MessageDispatcher<Museek::ServerManager> ServerDispatcher;
 
-    #define MAP_MESSAGE(ID, TYPE, EVENT) \
-      case ID: \
-      { \
-        NNLOG("museek.messages.server", "Received server message " #TYPE "."); \
-        TYPE msg; \
-        msg.parse_network_packet(data->data, data->length); \
-        EVENT(&msg); \
-        break; \
-      }
+  const ServerDispatcher::Entry serverDispatchEntries[] = {
+    #define MAP_MESSAGE(ID, TYPE, EVENT) DISPATCH_ENTRY(ID, TYPE, EVENT)
     #include "servereventtable.h"
     #undef MAP_MESSAGE
+  };
 
-    default:
-        NNLOG("museekd.server.warn", "Received unknown server message, type: %u, length: %u", data->type, data->length);
-        NetworkMessage msg;
-        msg.parse_network_packet(data->data, data->length);
+  const ServerDispatcher serverDispatcher(serverDispatchEntries,
+      sizeof(serverDispatchEntries) / sizeof(serverDispatchEntries[0]));
+}
+
+void
+Museek::ServerManager::onMessageReceived(const TcpMessageSocket::MessageData * data)
+{
+  if(! serverDispatcher.dispatch(this, data))
+  {
+    NNLOG("museekd.server.warn", "Received unknown server message, type: %u, length: %u", data->type, data->length);
+    NetworkMessage msg;
+    msg.parse_network_packet(data->data, data->length);
   }
 }
 
@@ -275,46 +319,54 @@ Museek::ServerManager::onLoggedIn(const SLogin * message)
 
   setLoggedIn(message->success);
   if(message->success)
-  {
-    museekd()->peers()->requestUserData(username());
-    std::vector<std::string>::const_iterator it, end = m_JoinedRooms.end();
-    for(it = m_JoinedRooms.begin(); it != end; ++it)
-      SEND_MESSAGE(SJoinRoom(*it));
-    m_JoinedRooms.clear();
-
-    std::vector<std::string> interests;
-    interests = museekd()->config()->keys("interests.like");
-    end = interests.end();
-    for(it = interests.begin(); it != end; ++it)
-      SEND_MESSAGE(SInterestAdd(*it));
-    interests = museekd()->config()->keys("interests.hate");
-    end = interests.end();
-    for(it = interests.begin(); it != end; ++it)
-      SEND_MESSAGE(SInterestHatedAdd(*it));
-
-    // Get status and stats for every users we have in our lists
-    std::vector<std::string> users, trusted, banned, ignored;
-    users = museekd()->config()->keys("buddies");
-    trusted = museekd()->config()->keys("trusted");
-    banned = museekd()->config()->keys("banned");
-    ignored = museekd()->config()->keys("ignored");
-    users.insert(users.begin(), trusted.begin(), trusted.end());
-    users.insert(users.begin(), banned.begin(), banned.end());
-    users.insert(users.begin(), ignored.begin(), ignored.end());
-    std::sort(users.begin(), users.end());
-    std::unique(users.begin(), users.end());
-    for(it = users.begin(); it != users.end(); ++it) {
-      museekd()->peers()->requestUserData(*it);
-    }
-
-    museekd()->sendSharedNumber();
+    onSessionStarted();
+}
 
-    SEND_MESSAGE(SPrivRoomToggle(museekd()->isEnabledPrivRoom()));
+/**
+  * We're logged in: join our rooms and tell the server what we're interested in
+  */
+void
+Museek::ServerManager::onSessionStarted()
+{
+  museekd()->peers()->requestUserData(username());
+  std::vector<std::string>::const_iterator it, end = m_JoinedRooms.end();
+  for(it = m_JoinedRooms.begin(); it != end; ++it)
+    SEND_MESSAGE(SJoinRoom(*it));
+  m_JoinedRooms.clear();
+
+  std::vector<std::string> interests;
+  interests = museekd()->config()->keys("interests.like");
+  end = interests.end();
+  for(it = interests.begin(); it != end; ++it)
+    SEND_MESSAGE(SInterestAdd(*it));
+  interests = museekd()->config()->keys("interests.hate");
+  end = interests.end();
+  for(it = interests.begin(); it != end; ++it)
+    SEND_MESSAGE(SInterestHatedAdd(*it));
+
+  // Get status and stats for every users we have in our lists
+  std::vector<std::string> users, trusted, banned, ignored;
+  users = museekd()->config()->keys("buddies");
+  trusted = museekd()->config()->keys("trusted");
+  banned = museekd()->config()->keys("banned");
+  ignored = museekd()->config()->keys("ignored");
+  users.insert(users.begin(), trusted.begin(), trusted.end());
+  users.insert(users.begin(), banned.begin(), banned.end());
+  users.insert(users.begin(), ignored.begin(), ignored.end());
+  std::sort(users.begin(), users.end());
+  std::unique(users.begin(), users.end());
+  for(it = users.begin(); it != users.end(); ++it) {
+    museekd()->peers()->requestUserData(*it);
   }
+
+  museekd()->sendSharedNumber();
+
+  SEND_MESSAGE(SPrivRoomToggle(museekd()->isEnabledPrivRoom()));
 }
 
 void
 Museek::ServerManager::launchServerTimeTest(long) {
+    // Wall clock time on purpose, it is compared with the server's clock
     gettimeofday(&mLastServerTimeTestTime, 0);
     std::ostringstream oss;
     oss << "Testing server time " << mLastServerTimeTestTime.tv_sec << " " << mLastServerTimeTestTime.tv_usec;
@@ -356,10 +408,7 @@ Museek::ServerManager::onServerPrivateMessageReceived(const SPrivateMessage * me
   */
 void
 Museek::ServerManager::pingServer(long diff) {
-    struct timeval now;
-    gettimeofday(&now, 0);
-
-    if (difftime(now, mLastSentMessage) > 59000) {
+    if (difftime(NewNet::clock.now(), mLastSentMessage) > 59000) {
         // No data sent to server since 60 seconds. Ping the server
         NNLOG("museekd.server.debug", "Pinging the server (%dms delay)", diff);
         SPing msg;
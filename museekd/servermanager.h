@@ -71,6 +71,10 @@ namespace Museek
 
     void connect();
     void disconnect();
+    /* Take over the logged in session of the previous instance (see
+       Handoff). 'received' holds the start of a message that was only
+       partly received, 'unsent' data that wasn't sent yet. */
+    void adopt(int fd, const std::vector<std::string> & rooms, const std::string & received, const std::string & unsent);
 
     std::vector<std::string> joinedRooms() {return m_JoinedRooms;};
 
@@ -105,6 +109,7 @@ namespace Museek
     void onDisconnected(NewNet::ClientSocket * socket);
     void onMessageReceived(const TcpMessageSocket::MessageData * data);
     void onLoggedIn(const SLogin *);
+    void onSessionStarted();
     void onRoomJoined(const SJoinRoom * message);
     void onRoomLeft(const SLeaveRoom * message);
     void onPrivilegedUsersReceived(const SPrivilegedUsers * message);
@@ -215,11 +215,16 @@ SERVERMESSAGE(SJoinRoom, 14)
 		room = unpack_string();
 		uint32 n = unpack_int();
 		std::vector<std::string> _u;
-		for(uint32 i = 0; i < n; i++)
+		for(uint32 i = 0; i < n; i++) {
+			if (buffer.count() < 4)
+				break; // If this happens, message is malformed. No need to continue (prevent huge loops)
 			_u.push_back(unpack_string());
+		}
 		std::vector<UserData> _d;
 		unpack_int();
 		for(uint32 i = 0; i < n; i++) {
+			if (buffer.count() < 4)
+				break; // If this happens, message is malformed. No need to continue (prevent huge loops)
 			UserData _data;
 			_data.status = unpack_int();
 			_d.push_back(_data);
@@ -257,8 +262,11 @@ SERVERMESSAGE(SJoinRoom, 14)
             owner = unpack_string();
 
             uint32 no = unpack_int();
-            for(uint32 io = 0; io < no; io++)
+            for(uint32 io = 0; io < no; io++) {
+                if (buffer.count() < 4)
+                    break; // If this happens, message is malformed. No need to continue (prevent huge loops)
                 ops.push_back(unpack_string());
+            }
 		}
 	END_PARSE
 
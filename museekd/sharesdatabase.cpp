@@ -26,13 +26,19 @@
 #include "museekd.h"
 #include "codesetmanager.h"
 #include "servermanager.h"
+#include "configmanager.h"
 #include <Muhelp/string_ext.hh>
+#include <Muhelp/Codec.hh>
+#include <Muhelp/ShareIndexer.hh>
+#include <Muhelp/UnicodeFold.hh>
 #include <zlib.h>
 #include <string>
 #include <map>
 #include <vector>
 #include <algorithm>
 #include <NewNet/nnpath.h>
+#include <NewNet/nnnotifier.h>
+#include <NewNet/nnreactor.h>
 
 using std::string;
 using std::wstring;
@@ -41,94 +47,222 @@ using std::vector;
 
 #include <iostream>
 
-Museek::SharesDatabase::SharesDatabase(Museekd* museekd) : mMuseekd(museekd), mNumFolders(0), mNumFiles(0) {
+/* Building a path and looking in it costs about as much as reading this
+   many entries of a list. */
+#define CHECK_COST 128
+
+Museek::SharesDatabase::SharesDatabase(Museekd* museekd) : mMuseekd(museekd), mNumFolders(0), mNumFiles(0),
+	mMapped(false), mCompressing(0), mIndexing(false), mGeneration(0), mCacheMemory(0), mCacheHits(0), mCacheMisses(0),
+	mReplyCacheMemory(0) {
+	// Nothing is shared until the first load
+	std::shared_ptr<SharesSnapshot> snapshot(new SharesSnapshot);
+	snapshot->index.finish();
+	snapshot->generation = mGeneration;
+	mSnapshot = snapshot;
+
+	mNotifier = new NewNet::Notifier();
+	if(mNotifier->valid()) {
+		mNotifier->notifiedEvent.connect(this, &SharesDatabase::onCompressed);
+		museekd->reactor()->add(mNotifier);
+	}
+
+	mIndexNotifier = new NewNet::Notifier();
+	if(mIndexNotifier->valid()) {
+		mIndexNotifier->notifiedEvent.connect(this, &SharesDatabase::onIndexed);
+		museekd->reactor()->add(mIndexNotifier);
+	}
+}
+
+Museek::SharesDatabase::~SharesDatabase() {
+	if(mIndexTimeout.isValid() && mMuseekd.isValid())
+		mMuseekd->reactor()->removeTimeout(mIndexTimeout);
+	if(mIndexer.joinable())
+		mIndexer.join();
+	if(mIndexNotifier->reactor())
+		mIndexNotifier->reactor()->remove(mIndexNotifier);
+	if(mCompressor.joinable())
+		mCompressor.join();
+	if(mNotifier->reactor())
+		mNotifier->reactor()->remove(mNotifier);
 }
 
 void Museek::SharesDatabase::load(const string& db, bool add) {
+	if(mIndexing) {
+		NNLOG("museekd.shares.debug", "still indexing, share database %s will be loaded after", db.c_str());
+		mPendingLoads.push_back(std::make_pair(db, add));
+		return;
+	}
+
  	NNLOG("museekd.shares.debug", "loading share database %s", db.c_str());
-	mShares.load(db);
-	update(add);
-}
 
-void Museek::SharesDatabase::update(bool add) {
-	recode(add);
-	update_flat();
-	update_compressed();
-	update_word_maps();
+	if(! add && load_index(db)) {
+		update();
+		return;
+	}
 
-	mNumFolders = mRecoded.folders.size();
-	mNumFiles = mFlat.size();
+	if(! add && ! mMapped && mSources.size() == 1 && mSources.front().first == db && load_delta(db)) {
+		update();
+		return;
+	}
 
-	NNLOG("museekd.shares.debug", "Updated shares, mNumFolders=%i, mNumFiles=%i", mNumFolders, mNumFiles);
+	if(add && mMapped) {
+		/* Only the index of the first database was mapped, we need its
+		   folders to merge them */
+		mSources.front().second = ShareDelta::stamp(mSources.front().first);
+		mShares.load(mSources.front().first);
+	}
+	mMapped = false;
 
-    mMuseekd->sendSharedNumber();
+	// Taken first: if db changes while we read it, the next delta won't apply
+	ShareDelta::Stamp stamp = ShareDelta::stamp(db);
+	if(! add) {
+		mShares.load(db);
+		mSources.clear();
+	}
+	else {
+		/* Merge the folders of db with the ones we have */
+		DirEntry extra;
+		extra.load(db);
+		std::map<std::string, DirEntry*>::iterator it = extra.folders.begin();
+		for(; it != extra.folders.end(); ++it) {
+			std::map<std::string, DirEntry*>::iterator old = mShares.folders.find((*it).first);
+			if(old != mShares.folders.end())
+				delete (*old).second;
+			mShares.folders[(*it).first] = (*it).second;
+		}
+		extra.folders.clear();
+	}
+	mSources.push_back(std::make_pair(db, stamp));
+	update();
 }
 
-void Museek::SharesDatabase::recode(bool add) {
-	if (!add)
-        mRecoded.folders.clear();
+/**
+ * Apply the delta muscan saved along with db, if it goes from the version
+ * of db we loaded to the current one.
+ */
+bool Museek::SharesDatabase::load_delta(const string& db) {
+	ShareDelta delta;
+	ShareDelta::Stamp stamp = ShareDelta::stamp(db);
+	if(! delta.load(db + ".delta"))
+		return false;
+	if(delta.from != mSources.front().second || delta.to != stamp) {
+ 		NNLOG("museekd.shares.debug", "%s.delta doesn't apply to what we have", db.c_str());
+		return false;
+	}
 
-	std::map<std::string, DirEntry*>::iterator it = mShares.folders.begin();
-	for(; it != mShares.folders.end(); ++it) {
-        std::string _redir = mMuseekd->codeset()->fromFSToNet((*it).first);
-		if(_redir.empty()) {
- 			NNLOG("museekd.shares.warn", "Couldn't transcode '%s' to network encoding", (*it).first.c_str());
-			continue;
-		}
+ 	NNLOG("museekd.shares.debug", "applying %s.delta: %u folders changed, %u removed", db.c_str(),
+	      (uint)delta.changed.size(), (uint)delta.removed.size());
+	delta.apply(mShares);
+	mSources.front().second = stamp;
+	return true;
+}
 
-		Folder::iterator fit = (*it).second->files.begin();
-		Folder _refolder;
-		for(; fit != (*it).second->files.end(); ++fit) {
-            std::string _refn = mMuseekd->codeset()->fromFSToNet((*fit).first);
-			if(_refn.empty()) {
- 				NNLOG("museekd.shares.warn", "Couldn't transcode '%s' to network encoding", (*fit).first.c_str());
-				continue;
-			}
-			_refolder[_refn] = (*fit).second;
-		}
+/**
+ * Map the index muscan saved along with db, if it's up to date.
+ */
+bool Museek::SharesDatabase::load_index(const string& db) {
+	std::shared_ptr<SharesSnapshot> snapshot(new SharesSnapshot);
+	snapshot->encoding = mMuseekd->codeset()->networkCodeset();
+	ShareIndexer indexer(mMuseekd->codeset()->filesystemCodeset(), snapshot->encoding);
+	ShareDelta::Stamp stamp = ShareDelta::stamp(db);
+	if(! indexer.map(db, snapshot->index, snapshot->reply, snapshot->replySize))
+		return false;
+
+ 	NNLOG("museekd.shares.debug", "Mapped %s.index, %u files, %u words, %u bytes", db.c_str(),
+	      snapshot->index.files(), snapshot->index.words(), (uint)snapshot->index.memory());
+
+	// The folders aren't needed anymore, only the index
+	mShares.clear();
+	mSources.clear();
+	mSources.push_back(std::make_pair(db, stamp));
+	mMapped = true;
+
+	snapshot->generation = ++mGeneration;
+	mSnapshot = snapshot;
+	return true;
+}
 
-		DirEntry* de = new DirEntry(_redir);
-		de->files = _refolder;
-		mRecoded.folders[_redir] = de;
-	}
+void Museek::SharesDatabase::update() {
+	if(mMapped)
+		updated();
+	else
+		update_index();
 }
 
-void Museek::SharesDatabase::update_flat() {
-	mFlat.clear();
-	mRecoded.flatten(mFlat);
+/**
+ * A new snapshot is in place: compress it, and tell the server how much
+ * we share now.
+ */
+void Museek::SharesDatabase::updated() {
+	update_compressed();
+
+	NNLOG("museekd.shares.debug", "Search cache: %lu hits, %lu misses, %u bytes", mCacheHits, mCacheMisses, (uint)mCacheMemory);
+
+	mNumFolders = index().sharedDirectories();
+	mNumFiles = index().files();
+
+	NNLOG("museekd.shares.debug", "Updated shares, mNumFolders=%i, mNumFiles=%i", mNumFolders, mNumFiles);
+
+    mMuseekd->sendSharedNumber();
 }
 
+/**
+ * Compress the browse reply for the current snapshot in the background.
+ * Only one at a time: when the current one is done, it's started again if
+ * the snapshot changed meanwhile.
+ */
 void Museek::SharesDatabase::update_compressed() {
-	mCompressed.clear();
+	if(mCompressing)
+		return;
 
-	std::queue<unsigned char> data;
-	mRecoded.network_pack(data);
+	/* muscan compressed it already */
+	if(mSnapshot->reply) {
+		mCompressed.assign(mSnapshot->reply, mSnapshot->reply + mSnapshot->replySize);
+		return;
+	}
 
-	uLong outbuf_len = (int)(data.size() * 1.1 + 12), i = 0;
+	if(! mNotifier->valid()) {
+		if(! ShareIndexer::compress(mSnapshot->index, mCompressed))
+ 			NNLOG("museekd.shares.warn", "compression error");
+		return;
+	}
 
-	char *inbuf = new char[data.size()],
-	     *outbuf = new char[outbuf_len];
+	mCompressing = mSnapshot->generation;
+	mCompressor = std::thread(&SharesDatabase::compressor, this, mSnapshot);
+}
 
-	while(! data.empty()) {
-		inbuf[i++] = data.front();
-		data.pop();
-	}
+/**
+ * Body of the compressor thread, only touches mNextCompressed.
+ */
+void Museek::SharesDatabase::compressor(std::shared_ptr<const SharesSnapshot> snapshot) {
+	if(! ShareIndexer::compress(snapshot->index, mNextCompressed))
+		mNextCompressed.clear();
+	mNotifier->notify();
+}
 
-	if (compress((Bytef *)outbuf, &outbuf_len, (Bytef *)inbuf, i) == Z_OK) {
-		for(uint i = 0; i < outbuf_len; i++)
-			mCompressed.push_back(outbuf[i]);
-	} else
- 		NNLOG("museekd.shares.warn", "compression error");
+void Museek::SharesDatabase::onCompressed(NewNet::Notifier *) {
+	if(! mCompressing)
+		return;
+	mCompressor.join();
 
-	delete [] outbuf;
-	delete [] inbuf;
+	if(mNextCompressed.empty())
+ 		NNLOG("museekd.shares.warn", "compression error");
+	mCompressed.swap(mNextCompressed);
+	std::vector<unsigned char>().swap(mNextCompressed);
+ 	NNLOG("museekd.shares.debug", "Compressed shares of generation %u, %u bytes", mCompressing, (uint)mCompressed.size());
+
+	bool stale = mCompressing != mGeneration;
+	mCompressing = 0;
+	if(stale)
+		update_compressed();
 }
 
 /**
  * The given path should be encoded with net encoding. Separator should be the network one (backslash).
  */
 bool Museek::SharesDatabase::is_shared(const string& path) const {
-	return mFlat.find(path) != mFlat.end();
+	uint32 file;
+	return index().lookup(path, file);
 }
 
 /**
@@ -136,116 +270,107 @@ bool Museek::SharesDatabase::is_shared(const string& path) const {
  * Do a case insensitive search in the base for a path corresponding to the given one.
  */
 std::string Museek::SharesDatabase::find_shared_nocase(const std::string& path) const {
-    Folder::const_iterator it;
-    for (it = mFlat.begin(); it != mFlat.end(); it++) {
-        if (tolower(it->first) == path)
-            return it->first;
-    }
-    return std::string();
-}
-
-/* this is a bit hairy... */
-inline wchar_t mutate(wchar_t c, bool special = false) {
-	if(c >= 'A' && c <= 'Z')
-		return c | 32;
-
-	switch(c) {
-		case '/':
-		case ' ':
-		case ';':
-		case ':':
-		case '\'':
-		case '\\':
-		case ']':
-		case '[':
-		case '{':
-		case '}':
-		case '<':
-		case '>':
-		case ',':
-		case '.':
-		case '!':
-		case '@':
-		case '#':
-		case '$':
-		case '%':
-		case '^':
-		case '&':
-		case '(':
-		case ')':
-		case '_':
-		case '+':
-		case '=':
-		case '~':
-		case '`':
-		case '"':
-			return ' ';
-		case '-':
-		case '*':
-			if(! special)
-				return ' ';
-		default:
-			return c;
+	uint32 file;
+	if(! index().lookup(path, file, true))
+		return std::string();
+	return index().path(file);
+}
+
+/**
+ * Index mShares in the background, the snapshot is swapped when it's done.
+ * Started at the next reactor iteration, so that the databases loaded
+ * together are indexed once.
+ */
+void Museek::SharesDatabase::update_index() {
+	if(! mIndexNotifier->valid()) {
+		mNextSnapshot = build_index(mShares, mMuseekd->codeset()->filesystemCodeset(), mMuseekd->codeset()->networkCodeset(), 0);
+		swap_index();
+		return;
 	}
+
+	if(! mIndexTimeout.isValid())
+		mIndexTimeout = mMuseekd->reactor()->addTimeout(0, this, &SharesDatabase::onIndex);
 }
 
-void Museek::SharesDatabase::update_word_maps() {
-	mCharMap.clear();
-
-	// Generate the search map (used for searching)
-	Folder::iterator fit = mFlat.begin();
-	for(; fit != mFlat.end(); ++fit) {
-		string entry = mMuseekd->codeset()->fromNet((*fit).first), word;
-
-		string::const_iterator sit = entry.begin();
-		for(; sit != entry.end(); ++sit) {
-			wchar_t c = mutate(*sit);
-			if(c == ' ') {
-				if(! word.empty()) {
-					mCharMap[word[0]][word][(*fit).first] = (*fit).second;
-				}
-				word = string();
-			} else
-				word += c;
-		}
+void Museek::SharesDatabase::onIndex(long) {
+	mIndexTimeout = 0;
 
-		if(! word.empty()) {
-			mCharMap[word[0]][word][(*fit).first] = (*fit).second;
-		}
-	}
+	/* muscan's index was mapped meanwhile */
+	if(mMapped)
+		return;
+
+	mIndexing = true;
+	mIndexer = std::thread(&SharesDatabase::indexer, this, mMuseekd->codeset()->filesystemCodeset(),
+	                       mMuseekd->codeset()->networkCodeset());
 }
 
-inline Folder Museek::SharesDatabase::fetch(const std::string& word) const {
-	map<wchar_t, Shares>::const_iterator it1 = mCharMap.find(word[0]);
-	if(it1 != mCharMap.end()) {
-		Shares::const_iterator it2 = (*it1).second.find(word);
-		if(it2 != (*it1).second.end())
-			return (*it2).second;
-	}
-	return Folder();
+/**
+ * Body of the indexer thread, only reads mShares and touches mNextSnapshot
+ * and mSkipped.
+ */
+void Museek::SharesDatabase::indexer(std::string filesystem, std::string network) {
+	mNextSnapshot = build_index(mShares, filesystem, network, &mSkipped);
+	mIndexNotifier->notify();
 }
 
-/* this is the best I can do I think... */
-void Museek::SharesDatabase::search(const string& _query, Folder& result) {
- 	NNLOG("museekd.shares.debug", "sharesdatabase search %s", _query.c_str());
+void Museek::SharesDatabase::onIndexed(NewNet::Notifier *) {
+	if(! mIndexing)
+		return;
+	mIndexer.join();
+	mIndexing = false;
+
+	StringList::const_iterator name = mSkipped.begin();
+	for(; name != mSkipped.end(); ++name)
+		NNLOG("museekd.shares.warn", "Couldn't transcode '%s' to network encoding", name->c_str());
+	StringList().swap(mSkipped);
+	swap_index();
+
+	/* The databases loaded meanwhile */
+	std::vector<std::pair<std::string, bool> > pending;
+	pending.swap(mPendingLoads);
+	std::vector<std::pair<std::string, bool> >::const_iterator it = pending.begin();
+	for(; it != pending.end(); ++it)
+		load(it->first, it->second);
+}
 
-	string query = _query;
+void Museek::SharesDatabase::swap_index() {
+	const ShareIndex & index = mNextSnapshot->index;
+	NNLOG("museekd.shares.debug", "Indexed %u files, %u words, %u bytes", index.files(), index.words(), (uint)index.memory());
+
+	// Searches still running keep the previous snapshot alive
+	mNextSnapshot->generation = ++mGeneration;
+	mSnapshot = mNextSnapshot;
+	mNextSnapshot.reset();
+	updated();
+}
+
+std::shared_ptr<Museek::SharesSnapshot> Museek::SharesDatabase::build_index(const DirEntry& shares,
+	const std::string& filesystem, const std::string& network, StringList* skipped) {
+	std::shared_ptr<SharesSnapshot> snapshot(new SharesSnapshot);
+	snapshot->encoding = network;
+	ShareIndexer indexer(filesystem, network);
+	indexer.build(shares, snapshot->index, skipped);
+	return snapshot;
+}
 
-	size_t results = 0;
+/* this is the best I can do I think... */
+bool Museek::SharesDatabase::parse(const string& _query, SearchQuery& q) const {
+	string query = _query;
 
 	string word;
 
 	if(query.empty())
-		return;
+		return false;
 
 	/* add a space to make sure we also get the last word */
 	query += (wchar_t)' ';
 
-	vector<Folder* > q_in; // foobar
-	StringList q_out; // -foobar
-	StringList q_part; // *foobar "foo bar"
 	bool quoted = false, was_quoted = false;
 
+	/* Every exclusion is looked for in every path found: past a few, only
+	   keep the first ones, the asker filters the results again anyway */
+	size_t maxExcluded = mMuseekd->config()->getInt("searches", "max_excluded", 16);
+
 	/* breaks up the query into in-groups, out-files and terms */
 	string::iterator sit = query.begin();
 	for(; sit != query.end(); ++sit) {
@@ -255,26 +380,23 @@ void Museek::SharesDatabase::search(const string& _query, Folder& result) {
 			continue;
 		}
 
-		wchar_t c = mutate(*sit, quoted ? false : word.empty());
+		char c = ShareIndex::fold(*sit, quoted ? false : word.empty());
 		if(! quoted && c == ' ') {
-			wchar_t firstC = word[0];
+			char firstC = word[0];
 			if(was_quoted || firstC == '*') {
 			    if (firstC == '*')
                     word = word.substr(1);
-				q_part.push_back(word);
+				word = fold(word);
+				if(! word.empty())
+					q.phrases.push_back(word);
 			}
 			else if(firstC == '-') {
-			    if (word.size() > 0)
-                    q_out.push_back(mMuseekd->codeset()->toNet(string(word.data() + 1, word.size() - 1)));
-			}
-			else {
-				/* find files that match this word */
-				Folder* t = &mCharMap[word[0]][word];
-				if(! t->empty())
-					q_in.push_back(t);
-				else
-					return;
+			    if (word.size() > 0 && q.excluded.size() < maxExcluded)
+                    q.excluded.push_back(mMuseekd->codeset()->toNet(string(word.data() + 1, word.size() - 1)));
 			}
+			else if(! word.empty())
+				/* Folding may give separators, full width ones for instance */
+				ShareIndex::split(fold(word), q.words);
 			was_quoted = false;
 			word = string();
 			continue;
@@ -282,79 +404,252 @@ void Museek::SharesDatabase::search(const string& _query, Folder& result) {
 		word += c;
 	}
 
-	if(q_in.empty() && q_part.empty())
+	if(q.words.empty() && q.phrases.empty())
+		return false;
+
+	/* The same query comes from many users at once, the order of the words
+	   doesn't matter */
+	std::sort(q.words.begin(), q.words.end());
+	std::sort(q.excluded.begin(), q.excluded.end());
+	std::sort(q.phrases.begin(), q.phrases.end());
+	const StringList * groups[] = { &q.words, &q.excluded, &q.phrases };
+	for(uint i = 0; i < 3; ++i) {
+		StringList::const_iterator it = groups[i]->begin();
+		for(; it != groups[i]->end(); ++it)
+			q.key += *it + '\0';
+		q.key += '\1';
+	}
+	return true;
+}
+
+/**
+ * Put the numbers of the files matching the query in files, 500 at most.
+ * Only reads the snapshot: safe from any thread, with a codec of its own.
+ */
+void Museek::SharesDatabase::find_files(const SharesSnapshot& snapshot, Codec& codec, const SearchQuery& q,
+                                        std::vector<uint32>& files) {
+	const ShareIndex & index = snapshot.index;
+
+	vector<ShareIndex::Cursor> words;
+	StringList::const_iterator wit = q.words.begin();
+	for(; wit != q.words.end(); ++wit) {
+		/* find files that match this word */
+		ShareIndex::Cursor cursor;
+		if(! index.find(*wit, cursor))
+			return;
+		words.push_back(cursor);
+	}
+
+	// Files having every phrase
+	ShareIndex::Ranges phrases;
+	StringList::const_iterator partit = q.phrases.begin();
+	for(; partit != q.phrases.end(); ++partit) {
+		ShareIndex::Ranges found;
+		find_phrase(index, codec, *partit, found);
+		if(partit == q.phrases.begin())
+			phrases.swap(found);
+		else {
+			ShareIndex::Ranges both;
+			ShareIndex::intersect(phrases, found, both);
+			phrases.swap(both);
+		}
+		if(phrases.empty())
+			return;
+	}
+
+	// Walk the files having every keyword, the rarest keyword first, or
+	// the files having the phrases if we're only searching phrases
+	ShareIndex::Intersection matches(words);
+	ShareIndex::Ranges::const_iterator rit = phrases.begin();
+	uint32 id = rit != phrases.end() ? rit->first : 0;
+	while(true) {
+		if(! words.empty()) {
+			if(! matches.next(id))
+				return;
+			if(! q.phrases.empty() && ! ShareIndex::contains(phrases, id))
+				continue;
+		}
+		else {
+			if(rit == phrases.end())
+				return;
+			if(id >= rit->second) {
+				if(++rit == phrases.end())
+					return;
+				id = rit->first;
+			}
+		}
+		uint32 file = id;
+		if(words.empty())
+			++id;
+
+		// Don't add results that contains forbidden words
+		if(! q.excluded.empty()) {
+			string lowr = tolower(index.path(file));
+			StringList::const_iterator oit = q.excluded.begin();
+			for(; oit != q.excluded.end(); ++oit)
+				if(lowr.find(*oit) != string::npos)
+					break;
+			if(oit != q.excluded.end())
+				continue;
+		}
+
+		files.push_back(file);
+
+		// Don't send more than 500 results
+		if(files.size() >= 500)
+			return;
+	}
+}
+
+/**
+ * Rough cost of find_files for a query, in list entries read. Building and
+ * checking a path counts as CHECK_COST entries.
+ */
+uint64 Museek::SharesDatabase::cost(const SharesSnapshot& snapshot, const SearchQuery& q) {
+	const ShareIndex & index = snapshot.index;
+	uint64 read = 0, check = 0;
+
+	// The words are walked together, led by the rarest one
+	uint64 rarest = index.files();
+	StringList::const_iterator it = q.words.begin();
+	for(; it != q.words.end(); ++it) {
+		ShareIndex::Cursor cursor;
+		if(! index.find(*it, cursor))
+			return read; // Nothing to find
+		read += cursor.count();
+		rarest = std::min<uint64>(rarest, cursor.count());
+	}
+
+	uint64 phrases = index.files();
+	for(it = q.phrases.begin(); it != q.phrases.end(); ++it) {
+		uint64 before = check;
+		index.cost(*it, read, check);
+		if(check > before)
+			phrases = std::min(phrases, check - before);
+	}
+
+	// Every file found is checked against the exclusions, which may throw
+	// most of them away: the walk doesn't stop at 500
+	if(! q.excluded.empty())
+		check += q.words.empty() ? phrases : rarest;
+
+	return read + check * CHECK_COST;
+}
+
+/**
+ * Build the search reply for the given files.
+ */
+void Museek::SharesDatabase::results(const SharesSnapshot& snapshot, const std::vector<uint32>& files, Folder& result) {
+	std::vector<uint32>::const_iterator it = files.begin();
+	for(; it != files.end(); ++it)
+		snapshot.index.entry(*it, result[snapshot.index.path(*it)]);
+}
+
+/**
+ * Look the normalized query up in the cache of results. The entries of
+ * an older generation of the shares are thrown away as they're met.
+ */
+bool Museek::SharesDatabase::cached(const SearchQuery& q, std::vector<uint32>& files) {
+	std::unordered_map<std::string, ResultCache::iterator>::iterator it = mCacheIndex.find(q.key);
+	if(it == mCacheIndex.end() || it->second->generation != mGeneration) {
+		if(it != mCacheIndex.end())
+			cache_erase(it->second);
+		++mCacheMisses;
+		return false;
+	}
+
+	// Most recently used first
+	mCache.splice(mCache.begin(), mCache, it->second);
+	files = it->second->files;
+	++mCacheHits;
+	return true;
+}
+
+/**
+ * Remember the files found for a query in a given generation of the shares.
+ * Results of an older generation (the shares were reloaded while searching)
+ * aren't kept.
+ */
+void Museek::SharesDatabase::cache(const SearchQuery& q, uint32 generation, const std::vector<uint32>& files) {
+	size_t limit = mMuseekd->config()->getInt("shares", "cache_size", 2048) * 1024;
+	size_t cost = cache_cost(q.key, files);
+	if(generation != mGeneration || cost > limit / 4 || mCacheIndex.find(q.key) != mCacheIndex.end())
 		return;
 
-    else if (!q_in.empty()) {
-        Folder* base = q_in[0];
-        vector<Folder* >::const_iterator first = q_in.begin()++;
-        Folder::const_iterator it = base->begin();
-        for(; it != base->end(); ++it) {
-            // Did we already found this result?
-            if(result.find((*it).first) != result.end())
-                continue;
-
-            // Don't add results that contains forbidden words
-            if(! q_out.empty()) {
-                string lowr = tolower((*it).first);
-                StringList::const_iterator oit = q_out.begin();
-                for(; oit != q_out.end(); ++oit)
-                    if(lowr.find(*oit) != string::npos)
-                        break;
-                if(oit != q_out.end())
-                    continue;
-            }
-
-            // If we arrive here, we can add the file to the results if it matches every keyword
-            vector<Folder* >::const_iterator ref = first;
-            for(; ref != q_in.end(); ++ref)
-                if((*ref)->find((*it).first) == (*ref)->end())
-                    break;
-
-            if(ref == q_in.end()) {
-                // Ok, it matches every keyword, but does it match every phrase?
-                StringList::const_iterator partit = q_part.begin();
-                for(; partit != q_part.end(); ++partit)
-                    if (tolower((*it).first).find(tolower(*partit)) == std::string::npos)
-                        break;
-
-                if(partit == q_part.end()) {
-                    result[(*it).first] = (*it).second;
-                    ++results;
-                }
-            }
-
-            // Don't send more than 500 results
-            if(results >= 500)
-                return;
-        }
-    }
-    else {
-        // We're only searching phrases (*foobar "foo bar"), search in flat list
-        Folder::iterator fit = mFlat.begin();
-        StringList::const_iterator wit;
-        for(; fit != mFlat.end(); ++fit) {
-            string entry = tolower(mMuseekd->codeset()->fromNet((*fit).first));
-            bool notFound = false;
-
-            for (wit = q_part.begin(); wit != q_part.end(); wit++) {
-                size_t posFound = entry.find(tolower(*wit));
-                if (posFound == std::string::npos) {
-                    notFound = true;
-                    break;
-                }
-            }
-
-            if (!notFound) {
-                result[(*fit).first] = (*fit).second;
-                ++results;
-            }
-
-            // Don't send more than 500 results
-            if(results >= 500)
-                return;
-        }
-    }
+	mCache.push_front(CachedResult());
+	mCache.front().key = q.key;
+	mCache.front().generation = generation;
+	mCache.front().files = files;
+	mCacheIndex[q.key] = mCache.begin();
+	mCacheMemory += cost;
+
+	while(mCacheMemory > limit)
+		cache_erase(--mCache.end());
+}
+
+void Museek::SharesDatabase::cache_erase(ResultCache::iterator it) {
+	mCacheMemory -= cache_cost(it->key, it->files);
+	mCacheIndex.erase(it->key);
+	mCache.erase(it);
+}
+
+/**
+ * Rough number of bytes used by a cache entry: the key twice, the files,
+ * and the list and map nodes.
+ */
+size_t Museek::SharesDatabase::cache_cost(const std::string& key, const std::vector<uint32>& files) {
+	return key.size() * 2 + files.size() * sizeof(uint32) + sizeof(CachedResult) + 64;
+}
+
+/**
+ * Put the files having phrase somewhere in their path in files. A phrase
+ * never holds a separator, so it has to be in the name of the file or in
+ * the name of one of the folders above it.
+ */
+void Museek::SharesDatabase::find_phrase(const ShareIndex& index, Codec& codec, const string& phrase, ShareIndex::Ranges& files) {
+	std::vector<uint32> directories, names;
+	bool exact = index.candidates(phrase, directories, names);
+
+	std::vector<uint32>::const_iterator it = directories.begin();
+	for(; it != directories.end(); ++it)
+		if(exact || ShareIndexer::searchable(codec, index.component(*it)).find(phrase) != string::npos)
+			files.push_back(index.subtree(*it));
+
+	// Both halves are sorted already
+	size_t folders = files.size();
+	for(it = names.begin(); it != names.end(); ++it)
+		if(exact || ShareIndexer::searchable(codec, index.name(*it)).find(phrase) != string::npos)
+			files.push_back(std::make_pair(*it, *it + 1));
+	std::inplace_merge(files.begin(), files.begin() + folders, files.end());
+
+	ShareIndex::merge(files);
+}
+
+/**
+ * Put the shared directories in folder and below it in directories, in
+ * the order of the index. False if folder isn't in the index.
+ * The given path should be encoded with net encoding. Separator should be the network one (backslash).
+ */
+bool Museek::SharesDatabase::folder_directories(const std::string& folder, std::vector<uint32>& directories) const {
+	std::string q = folder;
+	if(! q.empty() && q[q.size()-1] == '\\')
+		q = q.substr(0, q.size()-1);
+
+	uint32 top;
+	if(q.empty() || ! index().findDirectory(q, top))
+		return false;
+
+	// Walk the folder and everything below it
+	std::vector<uint32> pending(1, top);
+	while(! pending.empty()) {
+		uint32 directory = pending.back();
+		pending.pop_back();
+		index().children(directory, pending);
+		if(index().shared(directory))
+			directories.push_back(directory);
+	}
+	std::sort(directories.begin(), directories.end());
+	return true;
 }
 
 /**
@@ -363,23 +658,74 @@ void Museek::SharesDatabase::search(const string& _query, Folder& result) {
 Shares Museek::SharesDatabase::folder_contents(const std::string& _f) {
 	Shares r_map;
 
-	if(_f.empty())
+	std::vector<uint32> directories;
+	if(! folder_directories(_f, directories))
 		return r_map;
 
-	std::string q = _f;
-	if(q[q.size()-1] == '\\')
-		q = q.substr(0, q.size()-1);
+	std::vector<uint32>::const_iterator it = directories.begin();
+	for(; it != directories.end(); ++it) {
+		Folder & folder = r_map[index().directoryPath(*it)];
+		uint32 first = index().firstFile(*it), last = first + index().fileCount(*it);
+		for(uint32 id = first; id < last; ++id)
+			index().entry(id, folder[index().name(id)]);
+	}
 
-	if(q.empty())
-		return r_map;
+	return r_map;
+}
 
-	std::map<std::string, DirEntry*>::iterator it = mRecoded.folders.begin();
-	for(; it != mRecoded.folders.end(); ++it) {
-		if(((*it).first == q) || ((*it).first.substr(0, q.size()+1) == q + '\\'))
-			{
-			r_map[(*it).first ] = (*it).second->files;
-			}
+/**
+ * Look folder up in the cache of replies first, the entries of previous
+ * versions of the shares don't count. Else pack and compress the reply
+ * and keep it, unless it would take more than a quarter of the cache.
+ */
+std::shared_ptr<const std::vector<unsigned char> > Museek::SharesDatabase::folder_reply(const std::string& folder) {
+	std::unordered_map<std::string, ReplyCache::iterator>::iterator it = mReplyCacheIndex.find(folder);
+	if(it != mReplyCacheIndex.end()) {
+		if(it->second->generation == mGeneration) {
+			mReplyCache.splice(mReplyCache.begin(), mReplyCache, it->second);
+			return mReplyCache.front().reply;
+		}
+		reply_cache_erase(it->second);
 	}
 
-	return r_map;
+	std::vector<uint32> directories;
+	if(! folder_directories(folder, directories) || directories.empty())
+		return std::shared_ptr<const std::vector<unsigned char> >();
+
+	std::shared_ptr<std::vector<unsigned char> > reply(new std::vector<unsigned char>);
+	if(! ShareIndexer::compress(index(), folder, directories, *reply)) {
+		NNLOG("museekd.shares.warn", "Couldn't compress the contents of %s", folder.c_str());
+		return std::shared_ptr<const std::vector<unsigned char> >();
+	}
+
+	size_t limit = mMuseekd->config()->getInt("shares", "folder_cache_size", 1024) * 1024;
+	CachedReply entry;
+	entry.folder = folder;
+	entry.generation = mGeneration;
+	entry.reply = reply;
+	size_t cost = reply_cache_cost(entry);
+	if(cost > limit / 4)
+		return reply;
+
+	mReplyCache.push_front(entry);
+	mReplyCacheIndex[folder] = mReplyCache.begin();
+	mReplyCacheMemory += cost;
+
+	while(mReplyCacheMemory > limit)
+		reply_cache_erase(--mReplyCache.end());
+	return reply;
+}
+
+void Museek::SharesDatabase::reply_cache_erase(ReplyCache::iterator it) {
+	mReplyCacheMemory -= reply_cache_cost(*it);
+	mReplyCacheIndex.erase(it->folder);
+	mReplyCache.erase(it);
+}
+
+/**
+ * Rough number of bytes used by a cache entry of replies: the folder
+ * twice, the reply, and the list and map nodes.
+ */
+size_t Museek::SharesDatabase::reply_cache_cost(const CachedReply& entry) {
+	return entry.folder.size() * 2 + entry.reply->size() + sizeof(CachedReply) + 64;
 }
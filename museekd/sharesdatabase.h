@@ -23,17 +23,61 @@
 
 #include <NewNet/nnobject.h>
 #include <NewNet/nnweakrefptr.h>
+#include <NewNet/nnrefptr.h>
+#include <NewNet/nnreactor.h>
 #include <string>
 #include <vector>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <thread>
 #include <Muhelp/DirEntry.hh>
+#include <Muhelp/ShareIndex.hh>
+
+class Codec;
+
+namespace NewNet
+{
+  class Notifier;
+}
 
 namespace Museek
 {
 class Museekd;
+
+/* What searches run against: the index of the shares and the encoding of
+   the names in it. Never changed once built, so a search may go on using
+   it in another thread while the shares are reloaded. When the index is
+   mapped from the file muscan left, reply is the browse reply in it. */
+struct SharesSnapshot {
+	SharesSnapshot() : reply(0), replySize(0) {}
+	ShareIndex index;
+	std::string encoding;
+	uint32 generation;
+	const unsigned char* reply;
+	size_t replySize;
+};
+
+/* A search query broken up. */
+struct SearchQuery {
+	StringList words;     // foobar, folded
+	StringList excluded;  // -foobar, in network encoding
+	StringList phrases;   // *foobar "foo bar", folded
+	std::string key;      // The same, normalized
+};
+
 class SharesDatabase : public NewNet::Object {
 public:
 	SharesDatabase(Museekd * museekd);
+	~SharesDatabase();
 
+	/* Load the folders of db, in place of the ones we have or along with
+	   them. In place, map the index muscan left in db.index if it's up to
+	   date; else when db is all we have, only apply the changes muscan
+	   left in db.delta if they go from what we loaded to what db holds
+	   now. The folders are indexed in the background, searches go on
+	   with the previous index meanwhile and db is loaded once it's
+	   done. */
 	void load(const std::string& db, bool add = false);
 
 	inline uint32 folders() const { return mNumFolders; }
@@ -42,30 +86,119 @@ public:
 	bool is_shared(const std::string& path) const;
 	std::string find_shared_nocase(const std::string& path) const;
 
+	/* The compressed reply to a browse request. Built in the background,
+	   the previous one is served meanwhile. */
 	inline const std::vector<unsigned char>& shares() const { return mCompressed; }
-	void search(const std::string& query, Folder& result);
+
+	/* Searching, done by SearchWorkers: parse returns false when there's
+	   nothing to look for. find_files and results only read
+	   the snapshot, any thread may call them. cost estimates the work
+	   find_files will do, in list entries read. */
+	bool parse(const std::string& query, SearchQuery& q) const;
+	inline std::shared_ptr<const SharesSnapshot> snapshot() const { return mSnapshot; }
+	static void find_files(const SharesSnapshot& snapshot, Codec& codec, const SearchQuery& q,
+	                       std::vector<uint32>& files);
+	static uint64 cost(const SharesSnapshot& snapshot, const SearchQuery& q);
+	static void results(const SharesSnapshot& snapshot, const std::vector<uint32>& files, Folder& result);
+	bool cached(const SearchQuery& q, std::vector<uint32>& files);
+	void cache(const SearchQuery& q, uint32 generation, const std::vector<uint32>& files);
+
+	/* Searches answered from the cache, and not. */
+	inline unsigned long cacheHits() const { return mCacheHits; }
+	inline unsigned long cacheMisses() const { return mCacheMisses; }
 	Shares folder_contents(const std::string& _f);
+	/* The compressed folder contents reply to a request for folder alone,
+	   kept for the folders asked for last. Null when nothing is shared
+	   there. */
+	std::shared_ptr<const std::vector<unsigned char> > folder_reply(const std::string& folder);
 
 protected:
-	void update( bool add = false );
-	void recode( bool add = false );
-	void update_flat();
+	void update();
+	void updated();
 	void update_compressed();
-	void update_word_maps();
+	void update_index();
+	bool load_delta(const std::string& db);
+	bool load_index(const std::string& db);
+	bool folder_directories(const std::string& folder, std::vector<uint32>& directories) const;
+	static void find_phrase(const ShareIndex& index, Codec& codec, const std::string& phrase, ShareIndex::Ranges& files);
+	inline const ShareIndex& index() const { return mSnapshot->index; }
 
 private:
-	inline Folder fetch(const std::string& word) const;
+	struct CachedResult {
+		std::string key;
+		uint32 generation;
+		std::vector<uint32> files;
+	};
+	typedef std::list<CachedResult> ResultCache;
+
+	struct CachedReply {
+		std::string folder;
+		uint32 generation;
+		std::shared_ptr<const std::vector<unsigned char> > reply;
+	};
+	typedef std::list<CachedReply> ReplyCache;
+
+	void compressor(std::shared_ptr<const SharesSnapshot> snapshot);
+	void onCompressed(NewNet::Notifier * notifier);
+	void onIndex(long);
+	void indexer(std::string filesystem, std::string network);
+	void onIndexed(NewNet::Notifier * notifier);
+	void swap_index();
+	static std::shared_ptr<SharesSnapshot> build_index(const DirEntry& shares, const std::string& filesystem,
+	                                                   const std::string& network, StringList* skipped);
+	void cache_erase(ResultCache::iterator it);
+	static size_t cache_cost(const std::string& key, const std::vector<uint32>& files);
+	void reply_cache_erase(ReplyCache::iterator it);
+	static size_t reply_cache_cost(const CachedReply& entry);
 
 	NewNet::WeakRefPtr<Museekd> mMuseekd;
 
 	uint32 mNumFolders, mNumFiles;
 
-	DirEntry mShares, mRecoded;
-	Folder mFlat;
+	// Folders as loaded from the databases, in filesystem encoding, and
+	// the versions of the databases they come from. Left empty when the
+	// index is mapped (mMapped).
+	DirEntry mShares;
+	std::vector<std::pair<std::string, ShareDelta::Stamp> > mSources;
+	bool mMapped;
+
+	// The browse reply, and the one being compressed by mCompressor for
+	// generation mCompressing (0 when idle)
+	std::vector<unsigned char> mCompressed, mNextCompressed;
+	std::thread mCompressor;
+	uint32 mCompressing;
+	NewNet::RefPtr<NewNet::Notifier> mNotifier;
+
+	// The same folders in network encoding, and the words of their paths
+	std::shared_ptr<const SharesSnapshot> mSnapshot;
+
+	// The snapshot mIndexer builds from mShares, started by mIndexTimeout.
+	// mShares is left alone meanwhile, the databases loaded then wait in
+	// mPendingLoads. The names it couldn't transcode are logged from
+	// mSkipped once it's done.
+	std::shared_ptr<SharesSnapshot> mNextSnapshot;
+	StringList mSkipped;
+	std::thread mIndexer;
+	bool mIndexing;
+	NewNet::WeakRefPtr<NewNet::Reactor::Timeout::Callback> mIndexTimeout;
+	NewNet::RefPtr<NewNet::Notifier> mIndexNotifier;
+	std::vector<std::pair<std::string, bool> > mPendingLoads;
+
+	// Bumped every time the shares are loaded
+	uint32 mGeneration;
 
-	std::vector<unsigned char> mCompressed;
+	// Results of the last queries, most recently used first, bounded by
+	// shares/cache_size (in KiB, 0 disables it)
+	ResultCache mCache;
+	std::unordered_map<std::string, ResultCache::iterator> mCacheIndex;
+	size_t mCacheMemory;
+	unsigned long mCacheHits, mCacheMisses;
 
-	std::map<wchar_t, Shares> mCharMap;
+	// Folder contents replies, the same way, bounded by
+	// shares/folder_cache_size (in KiB, 0 disables it)
+	ReplyCache mReplyCache;
+	std::unordered_map<std::string, ReplyCache::iterator> mReplyCacheIndex;
+	size_t mReplyCacheMemory;
 };
 }
 #endif // MUSEEK_SHARESDATABASE_H
@@ -33,6 +33,7 @@
 #include <Muhelp/string_ext.hh>
 #include <NewNet/nnreactor.h>
 #include <NewNet/util.h>
+#include <NewNet/nnclock.h>
 #include <NewNet/nnratelimiter.h>
 
 /**
@@ -292,8 +293,7 @@ void Museek::Upload::sent(uint count) {
   * We have sent x bytes => update the stats
   */
 void Museek::Upload::collect(uint bytes) {
-	struct timeval now;
-	gettimeofday(&now, NULL);
+	const struct timeval & now = NewNet::clock.now();
 
 	if(m_CollectStart.tv_sec == 0)
 		m_CollectStart = now;
@@ -596,6 +596,26 @@ Museek::UploadManager::add(const std::string & user, const std::string & localPa
         upload->setState(TS_QueuedLocally);
 }
 
+/**
+  * Hot restart: continue an upload the previous instance was doing
+  */
+bool
+Museek::UploadManager::resume(const std::string & user, const std::string & localPath, uint ticket, int fd, uint64 position)
+{
+    Upload * upload = new Upload(museekd(), user, localPath);
+    upload->setTicket(ticket);
+    upload->validateTicket();
+    m_Uploads.push_back(upload);
+    uploadAddedEvent(upload);
+
+    NNLOG("museekd.up.debug", "Resuming upload of %s to %s from %llu.", localPath.c_str(), user.c_str(), position);
+    UploadSocket * uploadSocket = new UploadSocket(museekd(), upload);
+    uploadSocket->setUser(user);
+    upload->setSocket(uploadSocket);
+    museekd()->reactor()->add(uploadSocket);
+    return uploadSocket->resume(fd, position);
+}
+
 /**
   * Register the uploading of folder localPath to the given user
   * The given path should be encoded with utf8 encoding. Separator should be the network one (backslash).
@@ -140,6 +140,9 @@ namespace Museek
 
     /* Add a new upload or retry an existing one. */
     void add(const std::string & user, const std::string & localPath, const uint & ticket = 0, const bool caseProblem = false, const bool forceEnqueue = false);
+    /* Continue an upload on a connection handed over by the previous
+       instance (see Handoff). Takes ownership of fd. */
+    bool resume(const std::string & user, const std::string & localPath, uint ticket, int fd, uint64 position);
     /* Add a new folder to upload */
     void addFolder(const std::string & user, const std::string & localPath);
     /* Abort a upload. */
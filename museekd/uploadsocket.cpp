@@ -44,6 +44,7 @@ Museek::UploadSocket::UploadSocket(Museek::Museekd * museekd, Museek::Upload * u
     cannotConnectEvent.connect(this, &UploadSocket::onCannotConnect);
     dataSentEvent.connect(this, &UploadSocket::onDataSent);
     dataReceivedEvent.connect(this, &UploadSocket::onDataReceived);
+    setSocketOptions(museekd->socketOptions("upload"));
 }
 
 Museek::UploadSocket::~UploadSocket()
@@ -136,6 +137,37 @@ void Museek::UploadSocket::sendTicket() {
     NNLOG("museekd.ticket.debug", "Ticket %u has been sent", ticket);
 }
 
+/*
+    The upload's position is only updated when data was sent, and the send buffer holds data that
+    hasn't been sent yet.
+*/
+uint64 Museek::UploadSocket::sentPosition() {
+    uint64 position = m_Upload->position();
+    if (m_lastDataSentCount > sendBuffer().count())
+        position += m_lastDataSentCount - sendBuffer().count();
+    return position;
+}
+
+/*
+    Hot restart: the previous instance handed us a connection in the middle of the transfer. The
+    downloader doesn't know anything happened, go on from where the previous instance stopped.
+*/
+bool Museek::UploadSocket::resume(int fd, uint64 position) {
+    setDescriptor(fd);
+    setSocketState(SocketConnected);
+    mHavePos = true;
+
+    if(! m_Upload->openFile() || ! m_Upload->seek(position) || ! m_Upload->read(sendBuffer())) {
+        NNLOG("museekd.up.warn", "Couldn't resume upload of %s from %llu", m_Upload->localPath().c_str(), position);
+        m_Upload->setLocalError("File error");
+        stop();
+        return false;
+    }
+
+    m_DataTimeout = museekd()->reactor()->addTimeout(60000, this, &UploadSocket::dataTimeout);
+    return true;
+}
+
 /*
     Called when some data (probably the position) has been received
 */
@@ -41,6 +41,12 @@ namespace Museek
     void send(const unsigned char * data, size_t n);
     void sendTicket();
 
+    /* Bytes of the file actually written to the connection. */
+    uint64 sentPosition();
+    /* Continue a transfer on a connection handed over by the previous
+       instance, from 'position'. */
+    bool resume(int fd, uint64 position);
+
   private:
     void onDisconnected(NewNet::ClientSocket * socket);
     void onCannotConnect(NewNet::ClientSocket * socket);
@@ -30,7 +30,6 @@
 #include "servermanager.h"
 #include "peermanager.h"
 #include <NewNet/nnreactor.h>
-#include <limits.h>
 
 Museek::UserSocket::UserSocket(Museek::Museekd * museekd, const std::string & type, bool obfuscated) : NewNet::TcpClientSocket(), m_Museekd(museekd), m_Type(type)
 {
@@ -216,37 +215,35 @@ Museek::UserSocket::onCannotReverseConnect(NewNet::ClientSocket *)
 void
 Museek::UserSocket::sendMessage(const NewNet::Buffer & buffer)
 {
-    // If obfuscated, generate and send the key
-    unsigned char key[4];
+    // The header is the key (if obfuscated) followed by the message length
+    unsigned char header[8];
+    uint keySize = 0;
     if (needsObfuscated()) {
-        generateObfKey(key);
-        send(key, 4);
+        generateObfKey(header);
+        keySize = 4;
     }
 
-    // Send the message length
-    unsigned char len_buf[4];
-    len_buf[0] = buffer.count() & 0xff;
-    len_buf[1] = (buffer.count() >> 8) & 0xff;
-    len_buf[2] = (buffer.count() >> 16) & 0xff;
-    len_buf[3] = (buffer.count() >> 24) & 0xff;
+    header[keySize] = buffer.count() & 0xff;
+    header[keySize + 1] = (buffer.count() >> 8) & 0xff;
+    header[keySize + 2] = (buffer.count() >> 16) & 0xff;
+    header[keySize + 3] = (buffer.count() >> 24) & 0xff;
 
-    if (needsObfuscated()) {
-        encodeMessage(len_buf, key, 4);
-    }
-
-    send(len_buf, 4);
-
-    // Send the data
-    if (needsObfuscated()) {
-        NewNet::Buffer * obfBuffer = new NewNet::Buffer(buffer);
-        encodeMessage(obfBuffer->data(), key, buffer.count());
-        send(obfBuffer->data(), buffer.count());
-        delete obfBuffer;
-    }
-    else {
-        send(buffer.data(), buffer.count());
+    if (! needsObfuscated()) {
+        // Queue the whole message at once
+        send(header, 4, buffer.data(), buffer.count());
+        return;
     }
 
+    // Obfuscate it in place, right there in the send buffer, before it
+    // can be written: queued() may write it right away
+    size_t total = 8 + buffer.count();
+    sendBuffer().append(header, 8);
+    sendBuffer().append(buffer.data(), buffer.count());
+    unsigned char * message = sendBuffer().data() + sendBuffer().count() - total;
+    ObfuscationDecoder encoder;
+    encoder.setKey(message);
+    encoder.decode(message, 4, total);
+    queued(total);
 }
 
 void
@@ -257,34 +254,3 @@ Museek::UserSocket::generateObfKey(unsigned char *buf)
         buf[i] = (rand() % 255) + 1;
     }
 }
-
-void
-Museek::UserSocket::rotrKey(unsigned char *buf, unsigned int c)
-{
-    const unsigned int mask = (CHAR_BIT*sizeof(buf) - 1);
-
-    uint32_t key_orig = buf[0] + (buf[1] << 8) + (buf[2] << 16) + (buf[3] << 24);
-
-    c &= mask;
-    uint32_t key_rotated = (key_orig>>c) | (key_orig<<( (-c)&mask ));
-
-    buf[0] = key_rotated & 0xff;
-    buf[1] = (key_rotated >> 8) & 0xff;
-    buf[2] = (key_rotated >> 16) & 0xff;
-    buf[3] = (key_rotated >> 24) & 0xff;
-}
-
-void
-Museek::UserSocket::encodeMessage(unsigned char *buf, unsigned char *key, uint32 len)
-{
-    uint keySize = 4;
-
-    uint32 key_pos = 0;
-    for (int i = 0; i < len; i++) {
-        key_pos = i % keySize;
-        if (key_pos == 0) {
-            rotrKey(key, 31);
-        }
-        buf[i] = buf[i] ^ key[key_pos];
-    }
-}
@@ -73,9 +73,6 @@ namespace Museek
     void onDisconnected(NewNet::ClientSocket *);
     void onCannotConnectNotify(const SCannotConnect * msg);
 
-    void rotrKey(unsigned char *buf, unsigned int c);
-    void encodeMessage(unsigned char *buf, unsigned char *key, uint32 len);
-
   private:
     NewNet::WeakRefPtr<Museekd> m_Museekd;
     NewNet::WeakRefPtr<NewNet::Event<long>::Callback> m_PassiveConnectTimeout;
@@ -1,3 +1,4 @@
 import messages
 import driver
+import local
 VERSION = "0.3.0"
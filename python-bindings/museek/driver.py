@@ -16,6 +16,7 @@
 # along with this program; if not, write to the Free Software
 # Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
+import os
 import socket
 import struct
 import random
@@ -49,6 +50,7 @@ class UnknownMessageException(Exception):
 
 # Extract message codes and classes from messages.py and add them to MSGTAB
 import messages
+import local
 MSGTAB = {}
 for _message in dir(messages):
 	message = getattr(messages, _message)
@@ -64,6 +66,9 @@ class Driver:
 		self.password = None
 		self.mask = None
 		self.cipher = None
+		self.ring = None
+		self.local_pending = False
+		self.local_fd = None
 		self.sync_id = 0
 		self.callback = callback
 	# Connect to museekd, host in the form of "/tmp/museekd.user" for unix sockets
@@ -71,6 +76,8 @@ class Driver:
 	def connect(self, host, password, mask = 0):
 		self.password = password
 		self.mask = mask
+		self.ring = None
+		self.local_pending = False
 		if host[:1] == '/':
 			# Connect to a unix socket
 			self.socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
@@ -97,7 +104,7 @@ class Driver:
 		## Unpack the first 8 bytes of the message
 		data = ""
 		while len(data) < 8:
-			buf = self.socket.recv(8 - len(data))
+			buf = self.recv(8 - len(data))
 			if not buf:
 				self.cb_disconnected()
 				self.socket = None
@@ -117,7 +124,7 @@ class Driver:
 		if length > 4:
 			length -= 4
 			while len(data) < length:
-				recv = self.socket.recv(length  - len(data))
+				recv = self.recv(length  - len(data))
 				if not recv:
 					self.cb_disconnected()
 					self.socket = None
@@ -125,6 +132,15 @@ class Driver:
 				
 				data += recv
 	
+		message = self.parse(code, data)
+		if message.__class__ is messages.LocalTransport:
+			self.local_granted(message)
+		elif message.__class__ is messages.LocalPayload:
+			message = self.local_payload(message)
+		return message
+	
+	# Parse the data of a message with the given code
+	def parse(self, code, data):
 		## If message doesn't match known messages, raise an error
 		if not code in MSGTAB:
 			raise UnknownMessageException, 'received unknown message tyoe 0x%04X' % code
@@ -139,6 +155,50 @@ class Driver:
 		else:
 			return newmessage
 			
+	# Read up to size bytes from museekd, picking up the descriptor of the
+	# shared memory ring while a local transport request is pending
+	def recv(self, size):
+		if not self.local_pending:
+			return self.socket.recv(size)
+		data, fd = local.recv_fd(self.socket, size)
+		if fd is not None:
+			if self.local_fd is not None:
+				os.close(self.local_fd)
+			self.local_fd = fd
+		return data
+	
+	# Ask museekd to switch to the local transport, flags are LT_* values
+	# (see messages.py). Only works on unix sockets, once logged in, and don't
+	# send anything ciphered until the reply came.
+	def local_transport(self, flags = messages.LT_SHARED_MEMORY | messages.LT_PLAINTEXT):
+		self.local_pending = True
+		self.send(messages.LocalTransport(flags))
+	
+	# museekd replied to the local transport request
+	def local_granted(self, message):
+		self.local_pending = False
+		fd, self.local_fd = self.local_fd, None
+		if message.flags & messages.LT_SHARED_MEMORY:
+			if fd is None:
+				raise InvalidMessageException, 'shared memory ring granted without its descriptor'
+			self.ring = local.Ring(fd, message.size)
+		elif fd is not None:
+			os.close(fd)
+		if message.flags & messages.LT_PLAINTEXT:
+			self.cipher = None
+	
+	# Fetch and parse a message museekd wrote to the shared memory ring
+	def local_payload(self, message):
+		if self.ring is None:
+			raise InvalidMessageException, 'received local payload without a shared memory ring'
+		data = self.ring.read(message.position, message.length)
+		self.ring.release(message.position + message.length)
+		length = struct.unpack("<i", data[:4])[0]
+		if length != message.length - 4:
+			raise InvalidMessageException, 'received invalid local payload length (%i)' % length
+		code = struct.unpack("<I", data[4:8])[0]
+		return self.parse(code, data[8:])
+	
 	def PassError(self, message):
 		if self.callback is not None:
 			self.callback(message)
@@ -173,6 +233,10 @@ class Driver:
 			else:
 				self.cb_login_ok()
 				self.cipher = Cipher(self.password)
+		elif message.__class__ is messages.LocalTransport:
+			self.cb_local_transport(message.flags, message.size)
+		elif message.__class__ is messages.Statistics:
+			self.cb_statistics(message.counters)
 		elif message.__class__ is messages.ServerState:
 			self.cb_server_state(message.state, message.username)
 		elif message.__class__ is messages.CheckPrivileges:
@@ -325,6 +389,14 @@ class Driver:
 		pass
 #		print 'logged in'
 	
+	# Local transport request answered, flags are the granted LT_* values
+	def cb_local_transport(self, flags, size):
+		pass
+	
+	# Counters about museekd, a dict of dot separated names to values
+	def cb_statistics(self, counters):
+		pass
+	
 	# Server state
 	def cb_server_state(self, state, username):
 		pass
@@ -0,0 +1,109 @@
+# pymuseekd - Python tools for museekd
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+# Local transport: receiving the descriptor of museekd's shared memory ring
+# and reading the large messages it carries (see museekd/ifacering.h)
+
+import os
+import mmap
+import socket
+import struct
+import ctypes
+import ctypes.util
+
+class InvalidRingException(Exception):
+	pass
+
+SOL_SOCKET = 1
+SCM_RIGHTS = 1
+
+class _iovec(ctypes.Structure):
+	_fields_ = [("iov_base", ctypes.c_void_p),
+		("iov_len", ctypes.c_size_t)]
+
+class _msghdr(ctypes.Structure):
+	_fields_ = [("msg_name", ctypes.c_void_p),
+		("msg_namelen", ctypes.c_uint32),
+		("msg_iov", ctypes.POINTER(_iovec)),
+		("msg_iovlen", ctypes.c_size_t),
+		("msg_control", ctypes.c_void_p),
+		("msg_controllen", ctypes.c_size_t),
+		("msg_flags", ctypes.c_int)]
+
+_libc = None
+
+# Receive up to size bytes from sock, along with a descriptor if one was
+# passed with them. Returns (data, fd), fd is None if none came. Python 2's
+# socket module can't do this, so go through libc's recvmsg (Linux layout).
+def recv_fd(sock, size):
+	global _libc
+	if _libc is None:
+		_libc = ctypes.CDLL(ctypes.util.find_library("c"), use_errno = True)
+
+	align = ctypes.sizeof(ctypes.c_size_t)
+	header = (ctypes.sizeof(ctypes.c_size_t) + 8 + align - 1) & ~(align - 1)
+
+	buf = ctypes.create_string_buffer(size)
+	control = ctypes.create_string_buffer(header + align * 2)
+	iov = _iovec(ctypes.cast(buf, ctypes.c_void_p), size)
+	msg = _msghdr(None, 0, ctypes.pointer(iov), 1,
+		ctypes.cast(control, ctypes.c_void_p), len(control), 0)
+
+	n = _libc.recvmsg(sock.fileno(), ctypes.byref(msg), 0)
+	if n < 0:
+		e = ctypes.get_errno()
+		raise socket.error, (e, os.strerror(e))
+
+	fd = None
+	if msg.msg_controllen >= header + 4:
+		raw = control.raw
+		length = ctypes.c_size_t.from_buffer(control).value
+		level, type = struct.unpack("ii", raw[align:align + 8])
+		if level == SOL_SOCKET and type == SCM_RIGHTS and length >= header + 4:
+			fd = struct.unpack("i", raw[header:header + 4])[0]
+	return buf.raw[:n], fd
+
+# museekd's shared memory ring, mapped from the descriptor it passed along
+# with the ILocalTransport reply. Takes ownership of fd.
+class Ring:
+	MAGIC = 0x5253554d
+	DATA = 128
+
+	def __init__(self, fd, size):
+		try:
+			self.map = mmap.mmap(fd, self.DATA + size)
+		finally:
+			os.close(fd)
+		magic, self.size = struct.unpack("=II", self.map[0:8])
+		if magic != self.MAGIC or self.size != size or size & (size - 1):
+			self.map.close()
+			raise InvalidRingException, "invalid shared memory ring"
+
+	# Copy the record of length bytes at position out of the ring
+	def read(self, position, length):
+		offset = position & (self.size - 1)
+		first = min(length, self.size - offset)
+		data = self.map[self.DATA + offset:self.DATA + offset + first]
+		if first < length:
+			data += self.map[self.DATA:self.DATA + length - first]
+		return data
+
+	# Hand the bytes up to position back to museekd
+	def release(self, position):
+		self.map[64:68] = struct.pack("=I", position & 0xffffffff)
+
+	def close(self):
+		self.map.close()
@@ -28,6 +28,10 @@ EM_INTERESTS	= 1 << 5
 EM_CONFIG	= 1 << 6
 EM_DEBUG	= 1 << 7
 
+# Local transport features
+LT_SHARED_MEMORY	= 1 << 0
+LT_PLAINTEXT	= 1 << 1
+
 # Transfer state
 TS_Finished	= 0
 TS_Transferring = 1
@@ -98,7 +102,11 @@ class BaseMessage:
 		string = data[position:position+lenstring]
 		return string, position+lenstring
 	
+	# Ciphered fields are plain strings once the local transport granted
+	# plaintext, the driver then drops its cipher
 	def unpack_cipher(self, d):
+		if self.cipher is None:
+			return self.unpack_string(d)
 		l, d = self.unpack_uint(d);
 		if(l % 16) != 0:
 			l_c = ((l / 16) + 1) * 16
@@ -107,6 +115,8 @@ class BaseMessage:
 		return self.cipher.decipher(d[0:l_c])[:l], d[l_c:]
 	
 	def pack_cipher(self, s):
+		if self.cipher is None:
+			return self.pack_string(s)
 		return self.pack_uint(len(s)) + self.cipher.cipher(s)
 	
 
@@ -208,6 +218,52 @@ class SetStatus(BaseMessage):
 		self.status, data = self.unpack_uint(data)
 		return self
 
+class LocalTransport(BaseMessage):
+	code = 0x0006
+	
+	def __init__(self, flags = None):
+		self.flags = flags
+		self.size = None
+	
+	def make(self):
+		return self.pack_uint(self.code) + \
+			self.pack_uint(self.flags)
+	
+	def parse(self, data):
+		self.flags, data = self.unpack_uint(data)
+		self.size, data = self.unpack_uint(data)
+		return self
+
+class LocalPayload(BaseMessage):
+	code = 0x0007
+	
+	def __init__(self):
+		self.position = None
+		self.length = None
+	
+	def parse(self, data):
+		self.position, data = self.unpack_uint(data)
+		self.length, data = self.unpack_uint(data)
+		return self
+
+class Statistics(BaseMessage):
+	code = 0x0008
+	
+	def __init__(self):
+		self.counters = None
+	
+	def make(self):
+		return self.pack_uint(self.code)
+	
+	def parse(self, data):
+		self.counters = {}
+		n, data = self.unpack_uint(data)
+		for i in range(n):
+			name, data = self.unpack_string(data)
+			value, data = self.unpack_off(data)
+			self.counters[name] = value
+		return self
+
 class StatusMessage(BaseMessage):
 	code = 0x0010
 	